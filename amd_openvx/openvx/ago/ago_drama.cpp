@@ -58,35 +58,43 @@ static bool DetectRectOverlap(vx_rectangle_t& a, vx_rectangle_t& b)
 	return (c.start_x < c.end_x) && (c.start_y < c.end_y) ? true : false;
 }
 
-void agoOptimizeDramaGetDataUsageOfROI(AgoGraph * agraph, AgoData * roiMasterImage, vx_uint32& inputUsageCount, vx_uint32& outputUsageCount, vx_uint32& inoutUsageCount)
+// data objects seen by the optimizer: the virtual objects of the graph followed by the context
+// objects used by the graph (see agoAcquireGraphContextData)
+static void agoOptimizeDramaGetDataList(AgoGraph * agraph, std::vector<AgoData *>& dataList)
+{
+	dataList.clear();
+	for (AgoData * data = agraph->dataList.head; data; data = data->next)
+		dataList.push_back(data);
+	dataList.insert(dataList.end(), agraph->contextDataList.begin(), agraph->contextDataList.end());
+}
+
+void agoOptimizeDramaGetDataUsageOfROI(const std::vector<AgoData *>& dataList, AgoData * roiMasterImage, vx_uint32& inputUsageCount, vx_uint32& outputUsageCount, vx_uint32& inoutUsageCount)
 {
 	std::list<vx_rectangle_t> rectList;
 	vx_uint32 outputUsageCount_ = 0;
-	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
-			if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage == roiMasterImage) {
-				inputUsageCount += data->inputUsageCount;
-				inoutUsageCount += data->inoutUsageCount;
-				if (data->outputUsageCount > 0) {
-					if (outputUsageCount == 0) {
-						bool detectedOverlap = false;
-						for (auto it = rectList.begin(); it != rectList.end(); it++) {
-							if (DetectRectOverlap(*it, data->u.img.rect_roi)) {
-								detectedOverlap = true;
-								break;
-							}
-						}
-						rectList.push_back(data->u.img.rect_roi);
-						if (detectedOverlap) {
-							outputUsageCount_ += data->outputUsageCount;
-						}
-						else {
-							outputUsageCount_ = max(outputUsageCount_, data->outputUsageCount);
+	for (AgoData * data : dataList) {
+		if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage == roiMasterImage) {
+			inputUsageCount += data->inputUsageCount;
+			inoutUsageCount += data->inoutUsageCount;
+			if (data->outputUsageCount > 0) {
+				if (outputUsageCount == 0) {
+					bool detectedOverlap = false;
+					for (auto it = rectList.begin(); it != rectList.end(); it++) {
+						if (DetectRectOverlap(*it, data->u.img.rect_roi)) {
+							detectedOverlap = true;
+							break;
 						}
 					}
-					else {
+					rectList.push_back(data->u.img.rect_roi);
+					if (detectedOverlap) {
 						outputUsageCount_ += data->outputUsageCount;
 					}
+					else {
+						outputUsageCount_ = max(outputUsageCount_, data->outputUsageCount);
+					}
+				}
+				else {
+					outputUsageCount_ += data->outputUsageCount;
 				}
 			}
 		}
@@ -94,46 +102,44 @@ void agoOptimizeDramaGetDataUsageOfROI(AgoGraph * agraph, AgoData * roiMasterIma
 	outputUsageCount += outputUsageCount_;
 }
 
-void agoOptimizeDramaMarkDataUsageOfROI(AgoGraph * agraph, AgoData * roiMasterImage, vx_uint32 inputUsageCount, vx_uint32 outputUsageCount, vx_uint32 inoutUsageCount)
+void agoOptimizeDramaMarkDataUsageOfROI(const std::vector<AgoData *>& dataList, AgoData * roiMasterImage, vx_uint32 inputUsageCount, vx_uint32 outputUsageCount, vx_uint32 inoutUsageCount)
 {
-	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
-			if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage == roiMasterImage) {
-				data->inputUsageCount = inputUsageCount;
-				data->outputUsageCount = outputUsageCount;
-				data->inoutUsageCount = inoutUsageCount;
-			}
+	for (AgoData * data : dataList) {
+		if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage == roiMasterImage) {
+			data->inputUsageCount = inputUsageCount;
+			data->outputUsageCount = outputUsageCount;
+			data->inoutUsageCount = inoutUsageCount;
 		}
 	}
 }
 
 void agoOptimizeDramaMarkDataUsage(AgoGraph * agraph)
 {
+	std::vector<AgoData *> dataList;
+	agoOptimizeDramaGetDataList(agraph, dataList);
 	// reset the data usage in all data elements
-	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
-			data->inputUsageCount = 0;
-			data->outputUsageCount = 0;
-			data->inoutUsageCount = 0;
-			for (vx_uint32 i = 0; i < data->numChildren; i++) {
-				AgoData * idata = data->children[i];
-				if (idata) {
-					idata->inputUsageCount = 0;
-					idata->outputUsageCount = 0;
-					idata->inoutUsageCount = 0;
-					for (vx_uint32 j = 0; j < idata->numChildren; j++) {
-						AgoData * jdata = idata->children[j];
-						if (jdata) {
-							jdata->inputUsageCount = 0;
-							jdata->outputUsageCount = 0;
-							jdata->inoutUsageCount = 0;
-							for (vx_uint32 k = 0; k < jdata->numChildren; k++) {
-								AgoData * kdata = jdata->children[k];
-								if (kdata) {
-									kdata->inputUsageCount = 0;
-									kdata->outputUsageCount = 0;
-									kdata->inoutUsageCount = 0;
-								}
+	for (AgoData * data : dataList) {
+		data->inputUsageCount = 0;
+		data->outputUsageCount = 0;
+		data->inoutUsageCount = 0;
+		for (vx_uint32 i = 0; i < data->numChildren; i++) {
+			AgoData * idata = data->children[i];
+			if (idata) {
+				idata->inputUsageCount = 0;
+				idata->outputUsageCount = 0;
+				idata->inoutUsageCount = 0;
+				for (vx_uint32 j = 0; j < idata->numChildren; j++) {
+					AgoData * jdata = idata->children[j];
+					if (jdata) {
+						jdata->inputUsageCount = 0;
+						jdata->outputUsageCount = 0;
+						jdata->inoutUsageCount = 0;
+						for (vx_uint32 k = 0; k < jdata->numChildren; k++) {
+							AgoData * kdata = jdata->children[k];
+							if (kdata) {
+								kdata->inputUsageCount = 0;
+								kdata->outputUsageCount = 0;
+								kdata->inoutUsageCount = 0;
 							}
 						}
 					}
@@ -176,60 +182,56 @@ void agoOptimizeDramaMarkDataUsage(AgoGraph * agraph)
 		}
 	}
 	// propagate usage counts from top-level to children (e.g., PYRAMID to IMAGE)
-	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
-			if (!data->parent) {
-				vx_uint32 min_outputUsageCount = INT_MAX;
-				for (vx_uint32 i = 0; i < data->numChildren; i++) {
-					AgoData * idata = data->children[i];
-					if (idata) {
-						idata->outputUsageCount += data->outputUsageCount;
-						idata->inoutUsageCount += data->inoutUsageCount;
-						idata->inputUsageCount += data->inputUsageCount;
-						vx_uint32 imin_outputUsageCount = INT_MAX;
-						for (vx_uint32 j = 0; j < idata->numChildren; j++) {
-							AgoData * jdata = idata->children[j];
-							if (jdata) {
-								jdata->outputUsageCount += idata->outputUsageCount;
-								jdata->inoutUsageCount += idata->inoutUsageCount;
-								jdata->inputUsageCount += idata->inputUsageCount;
-								vx_uint32 jmin_outputUsageCount = INT_MAX;
-								for (vx_uint32 k = 0; k < jdata->numChildren; k++) {
-									AgoData * kdata = jdata->children[k];
-									if (kdata) {
-										kdata->outputUsageCount += jdata->outputUsageCount;
-										kdata->inoutUsageCount += jdata->inoutUsageCount;
-										kdata->inputUsageCount += jdata->inputUsageCount;
-										// IMPORTANT: parent check is needed to deal with image aliasing inside pyramids (result of agoReplaceDataInGraph)
-										if (kdata->parent == jdata && jmin_outputUsageCount > kdata->outputUsageCount) jmin_outputUsageCount = kdata->outputUsageCount;
-									}
+	for (AgoData * data : dataList) {
+		if (!data->parent) {
+			vx_uint32 min_outputUsageCount = INT_MAX;
+			for (vx_uint32 i = 0; i < data->numChildren; i++) {
+				AgoData * idata = data->children[i];
+				if (idata) {
+					idata->outputUsageCount += data->outputUsageCount;
+					idata->inoutUsageCount += data->inoutUsageCount;
+					idata->inputUsageCount += data->inputUsageCount;
+					vx_uint32 imin_outputUsageCount = INT_MAX;
+					for (vx_uint32 j = 0; j < idata->numChildren; j++) {
+						AgoData * jdata = idata->children[j];
+						if (jdata) {
+							jdata->outputUsageCount += idata->outputUsageCount;
+							jdata->inoutUsageCount += idata->inoutUsageCount;
+							jdata->inputUsageCount += idata->inputUsageCount;
+							vx_uint32 jmin_outputUsageCount = INT_MAX;
+							for (vx_uint32 k = 0; k < jdata->numChildren; k++) {
+								AgoData * kdata = jdata->children[k];
+								if (kdata) {
+									kdata->outputUsageCount += jdata->outputUsageCount;
+									kdata->inoutUsageCount += jdata->inoutUsageCount;
+									kdata->inputUsageCount += jdata->inputUsageCount;
+									// IMPORTANT: parent check is needed to deal with image aliasing inside pyramids (result of agoReplaceDataInGraph)
+									if (kdata->parent == jdata && jmin_outputUsageCount > kdata->outputUsageCount) jmin_outputUsageCount = kdata->outputUsageCount;
 								}
-								if (!jdata->outputUsageCount && jmin_outputUsageCount != INT_MAX) jdata->outputUsageCount = jmin_outputUsageCount;
-								// IMPORTANT: parent check is needed to deal with image aliasing inside pyramids (result of agoReplaceDataInGraph)
-								if (jdata->parent == idata && imin_outputUsageCount > jdata->outputUsageCount) imin_outputUsageCount = jdata->outputUsageCount;
 							}
+							if (!jdata->outputUsageCount && jmin_outputUsageCount != INT_MAX) jdata->outputUsageCount = jmin_outputUsageCount;
+							// IMPORTANT: parent check is needed to deal with image aliasing inside pyramids (result of agoReplaceDataInGraph)
+							if (jdata->parent == idata && imin_outputUsageCount > jdata->outputUsageCount) imin_outputUsageCount = jdata->outputUsageCount;
 						}
-						if (!idata->outputUsageCount && imin_outputUsageCount != INT_MAX) idata->outputUsageCount = imin_outputUsageCount;
-						// IMPORTANT: parent check is needed to deal with image aliasing inside pyramids (result of agoReplaceDataInGraph)
-						if (idata->parent == data && min_outputUsageCount > idata->outputUsageCount) min_outputUsageCount = idata->outputUsageCount;
 					}
+					if (!idata->outputUsageCount && imin_outputUsageCount != INT_MAX) idata->outputUsageCount = imin_outputUsageCount;
+					// IMPORTANT: parent check is needed to deal with image aliasing inside pyramids (result of agoReplaceDataInGraph)
+					if (idata->parent == data && min_outputUsageCount > idata->outputUsageCount) min_outputUsageCount = idata->outputUsageCount;
 				}
-				if (!data->outputUsageCount && min_outputUsageCount != INT_MAX) data->outputUsageCount = min_outputUsageCount;
 			}
+			if (!data->outputUsageCount && min_outputUsageCount != INT_MAX) data->outputUsageCount = min_outputUsageCount;
 		}
 	}
 	// add up ROI data usage
-	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? agraph->ref.context->dataList.head : agraph->dataList.head; data; data = data->next) {
-			if (data->ref.type == VX_TYPE_IMAGE && !data->u.img.isROI) {
-				agoOptimizeDramaGetDataUsageOfROI(agraph, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
-				agoOptimizeDramaMarkDataUsageOfROI(agraph, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
-			}
+	for (AgoData * data : dataList) {
+		if (data->ref.type == VX_TYPE_IMAGE && !data->u.img.isROI) {
+			agoOptimizeDramaGetDataUsageOfROI(dataList, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
+			agoOptimizeDramaMarkDataUsageOfROI(dataList, data, data->inputUsageCount, data->outputUsageCount, data->inoutUsageCount);
 		}
 	}
 }
 
-static int agoSetDataHierarchicalLevel(AgoData * data, vx_uint32 hierarchical_level)
+static int agoSetDataHierarchicalLevel(const std::vector<AgoData *>& dataList, AgoData * data, vx_uint32 hierarchical_level)
 {
 	data->hierarchical_level = hierarchical_level;
 	if(!hierarchical_level) {
@@ -245,20 +247,20 @@ static int agoSetDataHierarchicalLevel(AgoData * data, vx_uint32 hierarchical_le
 	// propagate hierarchical_level to all of its children (if available)
 	for (vx_uint32 child = 0; child < data->numChildren; child++) {
 		if (data->children[child]) {
-			agoSetDataHierarchicalLevel(data->children[child], hierarchical_level);
+			agoSetDataHierarchicalLevel(dataList, data->children[child], hierarchical_level);
 		}
 	}
 	// propagate hierarchical_level to image-ROI master (if available)
 	if (data->ref.type == VX_TYPE_IMAGE) {
 		if (data->u.img.isROI) {
 			if (data->u.img.roiMasterImage && !data->u.img.roiMasterImage->hierarchical_level) {
-				agoSetDataHierarchicalLevel(data->u.img.roiMasterImage, hierarchical_level);
+				agoSetDataHierarchicalLevel(dataList, data->u.img.roiMasterImage, hierarchical_level);
 			}
 		}
 		else if (hierarchical_level) {
-			for (AgoData * pdata = data->isVirtual ? ((AgoGraph *)data->ref.scope)->dataList.head : data->ref.context->dataList.head; pdata; pdata = pdata->next) {
+			for (AgoData * pdata : dataList) {
 				if (pdata->ref.type == VX_TYPE_IMAGE && pdata->u.img.isROI && pdata->u.img.roiMasterImage == data && !pdata->hierarchical_level) {
-					agoSetDataHierarchicalLevel(pdata, hierarchical_level);
+					agoSetDataHierarchicalLevel(dataList, pdata, hierarchical_level);
 				}
 			}
 		}
@@ -324,10 +326,10 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 	////////////////////////////////////////////////
 	// reset hierarchical_level = 0 for all data
 	////////////////////////////////////////////////
-	for (int isVirtual = 0; isVirtual <= 1; isVirtual++) {
-		for (AgoData * data = isVirtual ? graph->ref.context->dataList.head : graph->dataList.head; data; data = data->next) {
-			agoSetDataHierarchicalLevel(data, 0);
-		}
+	std::vector<AgoData *> dataList;
+	agoOptimizeDramaGetDataList(graph, dataList);
+	for (AgoData * data : dataList) {
+		agoSetDataHierarchicalLevel(dataList, data, 0);
 	}
 
 	////////////////////////////////////////////////
@@ -384,7 +386,7 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 #endif
 				if (outputUsageCount == 0) {
 					// mark that this data object can be input to nodes with hierarchical_level = 1
-					agoSetDataHierarchicalLevel(data, 1);
+					agoSetDataHierarchicalLevel(dataList, data, 1);
 				}
 			}
 		}
@@ -418,7 +420,7 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 			for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
 				AgoData * data = node->paramList[arg];
 				if (data && (kernel->argConfig[arg] & AGO_KERNEL_ARG_OUTPUT_FLAG))
-					agoSetDataHierarchicalLevel(data, node->hierarchical_level + 1);
+					agoSetDataHierarchicalLevel(dataList, data, node->hierarchical_level + 1);
 			}
 		}
 	}
@@ -462,7 +464,7 @@ int agoOptimizeDramaComputeGraphHierarchy(AgoGraph * graph)
 					for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
 						AgoData * data = node->paramList[arg];
 						if (data && (kernel->argConfig[arg] & AGO_KERNEL_ARG_OUTPUT_FLAG))
-							agoSetDataHierarchicalLevel(data, node->hierarchical_level + 1);
+							agoSetDataHierarchicalLevel(dataList, data, node->hierarchical_level + 1);
 					}
 				}
 			}
@@ -868,7 +868,7 @@ int agoOptimizeDramaAlloc(AgoGraph * agraph)
             return -1;
         }
     }
-    for (AgoData * adata = agraph->ref.context->dataList.head; adata; adata = adata->next) {
+    for (AgoData * adata : agraph->contextDataList) {
         if (!adata->buffer && agoDataSanityCheckAndUpdate(adata)) {
             return -1;
         }
@@ -910,7 +910,7 @@ int agoOptimizeDramaAlloc(AgoGraph * agraph)
             return -1;
         }
     }
-    for (AgoData * adata = agraph->ref.context->dataList.head; adata; adata = adata->next) {
+    for (AgoData * adata : agraph->contextDataList) {
         if (agoAllocData(adata)) {
             vx_char name[1024]; agoGetDataName(name, adata);
             agoAddLogEntry(&adata->ref, VX_FAILURE, "ERROR: agoOptimizeDramaAlloc: data allocation failed for %s\n", name);
@@ -567,9 +567,26 @@ int agoDramaDivideScaleImageNode(AgoNodeList * nodeList, AgoNode * anode)
 	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_IMAGE);
 	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_IMAGE);
 	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
-	if (anode->paramList[0]->u.img.format != VX_DF_IMAGE_U8 || anode->paramList[1]->u.img.format != VX_DF_IMAGE_U8) return -1;
+	vx_df_image format = anode->paramList[0]->u.img.format;
+	if (anode->paramList[1]->u.img.format != format) return -1;
 	// save parameters
 	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	if (format != VX_DF_IMAGE_U8) {
+		// multi-channel and 16-bit images: all channels of a pixel are interpolated together
+		// (area interpolation is performed as bilinear and border modes other than UNDEFINED are not supported)
+		vx_enum interpolation = paramList[2]->u.scalar.u.e;
+		bool nearest = (interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR);
+		vx_enum new_kernel_id = VX_KERNEL_AMD_INVALID;
+		if (anode->attr_border_mode.mode != VX_BORDER_MODE_UNDEFINED) return -1;
+		if (format == VX_DF_IMAGE_RGB) new_kernel_id = nearest ? VX_KERNEL_AMD_SCALE_IMAGE_U24_U24_NEAREST : VX_KERNEL_AMD_SCALE_IMAGE_U24_U24_BILINEAR;
+		else if (format == VX_DF_IMAGE_RGBX) new_kernel_id = nearest ? VX_KERNEL_AMD_SCALE_IMAGE_U32_U32_NEAREST : VX_KERNEL_AMD_SCALE_IMAGE_U32_U32_BILINEAR;
+		else if (format == VX_DF_IMAGE_U16) new_kernel_id = nearest ? VX_KERNEL_AMD_SCALE_IMAGE_U16_U16_NEAREST : VX_KERNEL_AMD_SCALE_IMAGE_U16_U16_BILINEAR;
+		else if (format == VX_DF_IMAGE_S16) new_kernel_id = nearest ? VX_KERNEL_AMD_SCALE_IMAGE_S16_S16_NEAREST : VX_KERNEL_AMD_SCALE_IMAGE_S16_S16_BILINEAR;
+		anode->paramList[0] = paramList[1];
+		anode->paramList[1] = paramList[0];
+		anode->paramCount = 2;
+		return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+	}
 	// check for special no-scale case
 	vx_enum new_kernel_id = VX_KERNEL_AMD_INVALID;
 	if ((paramList[0]->u.img.width == paramList[1]->u.img.width) && (paramList[0]->u.img.height == paramList[1]->u.img.height)) {
@@ -1524,17 +1541,17 @@ int agoDramaDivideRemapNode(AgoNodeList * nodeList, AgoNode * anode)
 			}
 		}
 	}
-	else if (anode->paramList[0]->u.img.format == VX_DF_IMAGE_RGB && anode->paramList[1]->u.img.format == VX_DF_IMAGE_RGB) {
-		if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED && interpolation == VX_INTERPOLATION_TYPE_BILINEAR) 
-			new_kernel_id = VX_KERNEL_AMD_REMAP_U24_U24_BILINEAR;
-	}
-	else if (anode->paramList[0]->u.img.format == VX_DF_IMAGE_RGB && anode->paramList[1]->u.img.format == VX_DF_IMAGE_RGBX) {
-		if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED && interpolation == VX_INTERPOLATION_TYPE_BILINEAR)
-			new_kernel_id = VX_KERNEL_AMD_REMAP_U24_U32_BILINEAR;
-	}
-	else if (anode->paramList[0]->u.img.format == VX_DF_IMAGE_RGBX && anode->paramList[1]->u.img.format == VX_DF_IMAGE_RGBX) {
-		if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED && interpolation == VX_INTERPOLATION_TYPE_BILINEAR)
-			new_kernel_id = VX_KERNEL_AMD_REMAP_U32_U32_BILINEAR;
+	else if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED &&
+		(interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR || interpolation == VX_INTERPOLATION_TYPE_BILINEAR))
+	{
+		// multi-channel and 16-bit images: all channels of a pixel are interpolated together
+		vx_df_image dstFormat = anode->paramList[0]->u.img.format, srcFormat = anode->paramList[1]->u.img.format;
+		bool nearest = (interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR);
+		if (dstFormat == VX_DF_IMAGE_RGB && srcFormat == VX_DF_IMAGE_RGB) new_kernel_id = nearest ? VX_KERNEL_AMD_REMAP_U24_U24_NEAREST : VX_KERNEL_AMD_REMAP_U24_U24_BILINEAR;
+		else if (dstFormat == VX_DF_IMAGE_RGB && srcFormat == VX_DF_IMAGE_RGBX) new_kernel_id = nearest ? VX_KERNEL_AMD_REMAP_U24_U32_NEAREST : VX_KERNEL_AMD_REMAP_U24_U32_BILINEAR;
+		else if (dstFormat == VX_DF_IMAGE_RGBX && srcFormat == VX_DF_IMAGE_RGBX) new_kernel_id = nearest ? VX_KERNEL_AMD_REMAP_U32_U32_NEAREST : VX_KERNEL_AMD_REMAP_U32_U32_BILINEAR;
+		else if (dstFormat == VX_DF_IMAGE_U16 && srcFormat == VX_DF_IMAGE_U16) new_kernel_id = nearest ? VX_KERNEL_AMD_REMAP_U16_U16_NEAREST : VX_KERNEL_AMD_REMAP_U16_U16_BILINEAR;
+		else if (dstFormat == VX_DF_IMAGE_S16 && srcFormat == VX_DF_IMAGE_S16) new_kernel_id = nearest ? VX_KERNEL_AMD_REMAP_S16_S16_NEAREST : VX_KERNEL_AMD_REMAP_S16_S16_BILINEAR;
 	}
 	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
 }
@@ -1555,7 +1572,19 @@ int agoDramaDivideWarpAffineNode(AgoNodeList * nodeList, AgoNode * anode)
 	anode->paramCount = 3;
 	vx_enum interpolation = paramList[2]->u.scalar.u.e;
 	vx_enum new_kernel_id = VX_KERNEL_AMD_INVALID;
-	if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) {
+	vx_df_image format = anode->paramList[1]->u.img.format;
+	if (format != VX_DF_IMAGE_U8) {
+		// multi-channel and 16-bit images: all channels of a pixel are interpolated together
+		bool nearest = (interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR);
+		bool supported = (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) && (anode->paramList[0]->u.img.format == format) &&
+			(interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR || interpolation == VX_INTERPOLATION_TYPE_BILINEAR);
+		if (!supported) return -1;
+		if (format == VX_DF_IMAGE_RGB) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_AFFINE_U24_U24_NEAREST : VX_KERNEL_AMD_WARP_AFFINE_U24_U24_BILINEAR;
+		else if (format == VX_DF_IMAGE_RGBX) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_AFFINE_U32_U32_NEAREST : VX_KERNEL_AMD_WARP_AFFINE_U32_U32_BILINEAR;
+		else if (format == VX_DF_IMAGE_U16) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_AFFINE_U16_U16_NEAREST : VX_KERNEL_AMD_WARP_AFFINE_U16_U16_BILINEAR;
+		else if (format == VX_DF_IMAGE_S16) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_AFFINE_S16_S16_NEAREST : VX_KERNEL_AMD_WARP_AFFINE_S16_S16_BILINEAR;
+	}
+	else if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) {
 		if (interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR) new_kernel_id = VX_KERNEL_AMD_WARP_AFFINE_U8_U8_NEAREST;
 		else if (interpolation == VX_INTERPOLATION_TYPE_BILINEAR) new_kernel_id = VX_KERNEL_AMD_WARP_AFFINE_U8_U8_BILINEAR;
 	}
@@ -1593,7 +1622,19 @@ int agoDramaDivideWarpPerspectiveNode(AgoNodeList * nodeList, AgoNode * anode)
 	anode->paramCount = 3;
 	vx_enum interpolation = paramList[2]->u.scalar.u.e;
 	vx_enum new_kernel_id = VX_KERNEL_AMD_INVALID;
-	if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) {
+	vx_df_image format = anode->paramList[1]->u.img.format;
+	if (format != VX_DF_IMAGE_U8) {
+		// multi-channel and 16-bit images: all channels of a pixel are interpolated together
+		bool nearest = (interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR);
+		bool supported = (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) && (anode->paramList[0]->u.img.format == format) &&
+			(interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR || interpolation == VX_INTERPOLATION_TYPE_BILINEAR);
+		if (!supported) return -1;
+		if (format == VX_DF_IMAGE_RGB) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_PERSPECTIVE_U24_U24_NEAREST : VX_KERNEL_AMD_WARP_PERSPECTIVE_U24_U24_BILINEAR;
+		else if (format == VX_DF_IMAGE_RGBX) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_PERSPECTIVE_U32_U32_NEAREST : VX_KERNEL_AMD_WARP_PERSPECTIVE_U32_U32_BILINEAR;
+		else if (format == VX_DF_IMAGE_U16) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_PERSPECTIVE_U16_U16_NEAREST : VX_KERNEL_AMD_WARP_PERSPECTIVE_U16_U16_BILINEAR;
+		else if (format == VX_DF_IMAGE_S16) new_kernel_id = nearest ? VX_KERNEL_AMD_WARP_PERSPECTIVE_S16_S16_NEAREST : VX_KERNEL_AMD_WARP_PERSPECTIVE_S16_S16_BILINEAR;
+	}
+	else if (anode->attr_border_mode.mode == VX_BORDER_MODE_UNDEFINED) {
 		if (interpolation == VX_INTERPOLATION_TYPE_NEAREST_NEIGHBOR) new_kernel_id = VX_KERNEL_AMD_WARP_PERSPECTIVE_U8_U8_NEAREST;
 		else if (interpolation == VX_INTERPOLATION_TYPE_BILINEAR) new_kernel_id = VX_KERNEL_AMD_WARP_PERSPECTIVE_U8_U8_BILINEAR;
 	}
@@ -1989,6 +2030,44 @@ int agoDramaDivideLaplacianReconstructNode(AgoNodeList * nodeList, AgoNode * ano
 	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
 }
 
+int agoDramaDivideTensorTransposeNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[1];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[2];
+	anode->paramList[3] = paramList[3];
+	anode->paramCount = 4;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
+int agoDramaDivideTensorConvertDepthNode(AgoNodeList * nodeList, AgoNode * anode)
+{
+	// sanity checks
+	SANITY_CHECK_DATA_TYPE(anode->paramList[0], VX_TYPE_TENSOR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[1], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[2], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[3], VX_TYPE_SCALAR);
+	SANITY_CHECK_DATA_TYPE(anode->paramList[4], VX_TYPE_TENSOR);
+	// save parameters
+	AgoData * paramList[AGO_MAX_PARAMS]; memcpy(paramList, anode->paramList, sizeof(paramList));
+	anode->paramList[0] = paramList[4];
+	anode->paramList[1] = paramList[0];
+	anode->paramList[2] = paramList[1];
+	anode->paramList[3] = paramList[2];
+	anode->paramList[4] = paramList[3];
+	anode->paramCount = 5;
+	vx_enum new_kernel_id = VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA;
+	return agoDramaDivideAppend(nodeList, anode, new_kernel_id);
+}
+
 int agoDramaDivideNode(AgoNodeList * nodeList, AgoNode * anode)
 {
 	// save parameter list
@@ -2139,6 +2218,12 @@ int agoDramaDivideNode(AgoNodeList * nodeList, AgoNode * anode)
 		case VX_KERNEL_LAPLACIAN_RECONSTRUCT:
 			status = agoDramaDivideLaplacianReconstructNode(nodeList, anode);
 			break;
+		case VX_KERNEL_TENSOR_TRANSPOSE:
+			status = agoDramaDivideTensorTransposeNode(nodeList, anode);
+			break;
+		case VX_KERNEL_TENSOR_CONVERT_DEPTH:
+			status = agoDramaDivideTensorConvertDepthNode(nodeList, anode);
+			break;
 		default:
 			break;
 	}
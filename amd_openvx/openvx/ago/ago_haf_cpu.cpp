@@ -23,6 +23,8 @@ THE SOFTWARE.
 
 #include "ago_internal.h"
 
+#define HAFCPU_REDUCTION_MIN_PIXELS_PER_STRIP  65536
+
 int HafCpu_ColorConvert_IU_RGB
 	(
 		vx_uint32     dstWidth,
@@ -232,3 +234,46 @@ int HafCpu_Convolve_S16_U8_MxN
 	return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
 }
 
+void HafCpu_ParallelFor
+	(
+		vx_uint32     count,
+		vx_uint32     minItemsPerThread,
+		const std::function<void(vx_uint32, vx_uint32)>& func
+	)
+{
+	if (count / std::max(minItemsPerThread, 1u) <= 1) {
+		if (count > 0)
+			func(0, count);
+		return;
+	}
+	// run on the persistent workers of the context scheduler instead of creating threads per call
+	AgoGraphScheduler::forCallingThread()->parallelFor(count, minItemsPerThread, func);
+}
+
+vx_uint32 HafCpu_ReductionStripCount
+	(
+		vx_uint32     width,
+		vx_uint32     height
+	)
+{
+	// each strip should be large enough to hide the cost of dispatch and of merging its partial result
+	vx_uint32 numStrips = (vx_uint32)(((vx_uint64)width * height) / HAFCPU_REDUCTION_MIN_PIXELS_PER_STRIP);
+	numStrips = std::min(numStrips, std::min(height, (vx_uint32)HAFCPU_REDUCTION_MAX_STRIPS));
+	return std::max(numStrips, 1u);
+}
+
+void HafCpu_ParallelStrips
+	(
+		vx_uint32     numStrips,
+		vx_uint32     height,
+		const std::function<void(vx_uint32, vx_uint32, vx_uint32)>& func
+	)
+{
+	HafCpu_ParallelFor(numStrips, 1, [&](vx_uint32 begin, vx_uint32 end) {
+		for (vx_uint32 strip = begin; strip < end; strip++) {
+			vx_uint32 y = (vx_uint32)((vx_uint64)height * strip / numStrips);
+			vx_uint32 yEnd = (vx_uint32)((vx_uint64)height * (strip + 1) / numStrips);
+			func(strip, y, yEnd - y);
+		}
+	});
+}
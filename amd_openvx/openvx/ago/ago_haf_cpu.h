@@ -65,6 +65,7 @@ typedef struct {
 } ago_perspective_matrix_t;
 
 typedef struct AgoConfigScaleMatrix ago_scale_matrix_t;
+typedef struct AgoConvolveSeparable ago_separable_conv_t;
 
 typedef struct {
 	vx_int16   x; // x-coordinate
@@ -103,6 +104,46 @@ typedef struct {
 	vx_uint32 gridBufSize;
 } ago_harris_grid_header_t;
 
+// run func(begin, end) on sub-ranges of [0, count) in parallel, with at least minItemsPerThread items per sub-range
+void HafCpu_ParallelFor
+	(
+		vx_uint32     count,
+		vx_uint32     minItemsPerThread,
+		const std::function<void(vx_uint32, vx_uint32)>& func
+	);
+// upper limit of the number of per-thread partials of a reduction over an image
+#define HAFCPU_REDUCTION_MAX_STRIPS    64
+// number of horizontal strips used to split a reduction over an image into per-thread partials
+vx_uint32 HafCpu_ReductionStripCount
+	(
+		vx_uint32     width,
+		vx_uint32     height
+	);
+// run func(strip, y, stripHeight) on numStrips horizontal strips of the image rows in parallel
+void HafCpu_ParallelStrips
+	(
+		vx_uint32     numStrips,
+		vx_uint32     height,
+		const std::function<void(vx_uint32, vx_uint32, vx_uint32)>& func
+	);
+// remove keypoints that have a stronger keypoint within min_distance (grid-bucketed) and return the remaining count
+vx_uint32 HafCpu_SuppressKeypoints_MinDistance
+	(
+		vx_keypoint_t * list,
+		vx_uint32       count,
+		vx_uint32       width,
+		vx_uint32       height,
+		vx_float32      min_distance
+	);
+// copy the capacity strongest keypoints from src (reordered) into dst sorted by decreasing strength and return the copied count
+vx_uint32 HafCpu_PickStrongestKeypoints
+	(
+		vx_uint32       capacity,
+		vx_keypoint_t   dst[],
+		vx_keypoint_t * src,
+		vx_uint32       count
+	);
+
 int HafCpu_Not_U8_U8
 	(
 		vx_uint32     dstWidth,
@@ -2042,6 +2083,37 @@ int HafCpu_Convolve_S16_U8_MxN
 		vx_uint32     convolutionHeight,
 		vx_int32      shift
 	);
+// factorize a convolution matrix into a row and a column filter; the result is cached in filter and
+// only recomputed when the coefficients change. returns vx_true_e when the matrix is separable
+vx_bool HafCpu_FactorizeConvolution
+	(
+		ago_separable_conv_t * filter,
+		const vx_int16       * convMatrix,
+		vx_uint32              convolutionWidth,
+		vx_uint32              convolutionHeight
+	);
+int HafCpu_ConvolveSeparable_U8_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		const ago_separable_conv_t * filter,
+		vx_int32      shift
+	);
+int HafCpu_ConvolveSeparable_S16_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		const ago_separable_conv_t * filter,
+		vx_int32      shift
+	);
 int HafCpu_SobelMagnitude_S16_U8_3x3
 	(
 		vx_uint32     dstWidth,
@@ -2664,6 +2736,442 @@ int HafCpu_ScaleImage_U8_U8_Area
 		vx_uint32            srcImageStrideInBytes,
 		ago_scale_matrix_t * matrix
 	);
+int HafCpu_Remap_U24_U24_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_U24_U24_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_U24_U32_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_U24_U32_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_U32_U32_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_U32_U32_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_U16_U16_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_U16_U16_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_S16_S16_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_Remap_S16_S16_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	);
+int HafCpu_WarpAffine_U24_U24_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpAffine_U24_U24_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpAffine_U32_U32_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpAffine_U32_U32_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpAffine_U16_U16_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpAffine_U16_U16_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpAffine_S16_S16_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpAffine_S16_S16_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_U24_U24_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_U24_U24_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_U32_U32_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_U32_U32_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_U16_U16_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_U16_U16_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_S16_S16_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_WarpPerspective_S16_S16_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	);
+int HafCpu_ScaleImage_U24_U24_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
+int HafCpu_ScaleImage_U24_U24_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
+int HafCpu_ScaleImage_U32_U32_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
+int HafCpu_ScaleImage_U32_U32_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
+int HafCpu_ScaleImage_U16_U16_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
+int HafCpu_ScaleImage_U16_U16_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
+int HafCpu_ScaleImage_S16_S16_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
+int HafCpu_ScaleImage_S16_S16_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	);
 int HafCpu_OpticalFlowPyrLK_XY_XY_Generic
 (
 	vx_keypoint_t      newKeyPoint[],
@@ -3117,4 +3625,141 @@ int HafCpu_LaplacianReconstruct_DATA_DATA_DATA
 	vx_image input,
 	vx_image output
 );
+// tensor element-wise operations: dims[] are the output dimensions, strides are in bytes, and a zero input stride broadcasts that dimension
+int HafCpu_TensorAdd_DATA_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_enum          overflowPolicy,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc1,
+		const vx_size  * src1Stride,
+		const vx_uint8 * pSrc2,
+		const vx_size  * src2Stride
+	);
+int HafCpu_TensorSubtract_DATA_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_enum          overflowPolicy,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc1,
+		const vx_size  * src1Stride,
+		const vx_uint8 * pSrc2,
+		const vx_size  * src2Stride
+	);
+int HafCpu_TensorMultiply_DATA_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_uint32        fixedPointPos,
+		vx_float32       scale,
+		vx_enum          overflowPolicy,
+		vx_enum          roundingPolicy,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc1,
+		const vx_size  * src1Stride,
+		const vx_uint8 * pSrc2,
+		const vx_size  * src2Stride
+	);
+int HafCpu_TensorTableLookup_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc,
+		const vx_size  * srcStride,
+		const vx_uint8 * pLut,
+		vx_uint32        lutOffset
+	);
+// dst = src * scale + offset, rounded to nearest even and converted with saturation or wrap-around
+int HafCpu_TensorConvertDepth_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dstType,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		vx_enum          srcType,
+		const vx_uint8 * pSrc,
+		const vx_size  * srcStride,
+		vx_float32       scale,
+		vx_float32       offset,
+		vx_bool          saturate
+	);
+// strided copy where srcStride[i] is the input stride of the dimension that becomes output dimension i
+int HafCpu_TensorTranspose_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_size          elemSize,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc,
+		const vx_size  * srcStride
+	);
+// U8/RGB image with batch images stacked vertically to a [W,H,C,N] (NCHW) or [C,W,H,N] (NHWC) tensor:
+// tensor channel c = image channel c (or 2-c when reversed) * scale[c] + offset[c]
+int HafCpu_ImageToTensor_DATA_DATA
+	(
+		vx_uint32          width,
+		vx_uint32          height,
+		vx_uint32          channels,
+		vx_uint32          batch,
+		const vx_uint8   * pSrcImage,
+		vx_uint32          srcImageStrideInBytes,
+		vx_enum            dstType,
+		vx_uint8         * pDst,
+		const vx_size    * dstStride,
+		vx_bool            nhwc,
+		const vx_float32 * scale,
+		const vx_float32 * offset,
+		vx_bool            reverseChannelOrder
+	);
+// inverse of HafCpu_ImageToTensor_DATA_DATA: image channel = saturate(tensor channel c * scale[c] + offset[c])
+int HafCpu_TensorToImage_DATA_DATA
+	(
+		vx_uint32          width,
+		vx_uint32          height,
+		vx_uint32          channels,
+		vx_uint32          batch,
+		vx_uint8         * pDstImage,
+		vx_uint32          dstImageStrideInBytes,
+		vx_enum            srcType,
+		const vx_uint8   * pSrc,
+		const vx_size    * srcStride,
+		vx_bool            nhwc,
+		const vx_float32 * scale,
+		const vx_float32 * offset,
+		vx_bool            reverseChannelOrder
+	);
+// crop of a U8 RGB or NV12 image scaled with bilinear interpolation to one [W,H,3] (NCHW) float32/float16 tensor slice:
+// tensor channel c = RGB channel c (or 2-c when reversed) * scale[c] + offset[c], in a single pass over the output
+int HafCpu_ScaleCropImageToTensor_DATA_DATA
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_enum                dstType,
+		vx_uint8             * pDst,
+		const vx_size        * dstStride,
+		vx_df_image            srcFormat,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		const vx_uint8       * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		const vx_uint8       * pSrcUV,
+		vx_uint32              srcUVStrideInBytes,
+		const vx_rectangle_t * crop,
+		const vx_float32     * scale,
+		const vx_float32     * offset,
+		vx_bool                reverseChannelOrder
+	);
 #endif // __ago_haf_cpu_h__
@@ -6818,10 +6818,10 @@ int HafCpu_Mul_S16_S16S16_Sat_Round
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MeanStdDev_DATA_U8
+static int HafCpu_MeanStdDevRows_DATA_U8
 	(
-		vx_float32  * pSum,
-		vx_float32  * pSumOfSquared,
+		vx_uint64   * pSum,
+		vx_uint64   * pSumOfSquared,
 		vx_uint32     srcWidth,
 		vx_uint32     srcHeight,
 		vx_uint8    * pSrcImage,
@@ -6919,8 +6919,35 @@ int HafCpu_MeanStdDev_DATA_U8
 	pixels = _mm_srli_si128(sum_squared, 8);
 	sum_squared = _mm_add_epi64(sum_squared, pixels);
 
-	*pSum = (vx_float32)(M128I(sum).m128i_u32[0] + prefixSum + postfixSum);
-	*pSumOfSquared = (vx_float32)(M128I(sum_squared).m128i_u64[0] + prefixSumSquared + postfixSumSquared);
+	*pSum = (vx_uint64)M128I(sum).m128i_u32[0] + prefixSum + postfixSum;
+	*pSumOfSquared = M128I(sum_squared).m128i_u64[0] + prefixSumSquared + postfixSumSquared;
+
+	return AGO_SUCCESS;
+}
+
+int HafCpu_MeanStdDev_DATA_U8
+	(
+		vx_float32  * pSum,
+		vx_float32  * pSumOfSquared,
+		vx_uint32     srcWidth,
+		vx_uint32     srcHeight,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	// per-strip partial sums are kept in 64-bit integers and added up once all strips are done
+	vx_uint32 numStrips = HafCpu_ReductionStripCount(srcWidth, srcHeight);
+	vx_uint64 partSum[HAFCPU_REDUCTION_MAX_STRIPS], partSumOfSquared[HAFCPU_REDUCTION_MAX_STRIPS];
+	HafCpu_ParallelStrips(numStrips, srcHeight, [&](vx_uint32 strip, vx_uint32 y, vx_uint32 height) {
+		HafCpu_MeanStdDevRows_DATA_U8(&partSum[strip], &partSumOfSquared[strip], srcWidth, height, pSrcImage + y * srcImageStrideInBytes, srcImageStrideInBytes);
+	});
+	vx_uint64 sum = 0, sumOfSquared = 0;
+	for (vx_uint32 strip = 0; strip < numStrips; strip++) {
+		sum += partSum[strip];
+		sumOfSquared += partSumOfSquared[strip];
+	}
+	*pSum = (vx_float32)sum;
+	*pSumOfSquared = (vx_float32)sumOfSquared;
 
 	return AGO_SUCCESS;
 }
@@ -7295,8 +7322,7 @@ int HafCpu_Histogram_DATA_U8
 #endif
 
 #define NUM_BINS	256
-// special case histogram primitive : range - 255, offset: 0, NumBins: 255
-int HafCpu_Histogram_DATA_U8
+static void HafCpu_HistogramRows_DATA_U8
 (
 	vx_uint32     dstHist[],
 	vx_uint32     srcWidth,
@@ -7305,42 +7331,58 @@ int HafCpu_Histogram_DATA_U8
 	vx_uint32     srcImageStrideInBytes
 )
 {
-	unsigned int *pdst = dstHist;
-	memset(pdst, 0x0, NUM_BINS * sizeof(unsigned int));
+	// consecutive pixels update separate sub-histograms, so that runs of equal pixels
+	// do not stall on a store-to-load dependency of the same counter
+	vx_uint32 subHist[4][NUM_BINS];
+	memset(subHist, 0, sizeof(subHist));
 	for (unsigned int y = 0; y < srcHeight; y++)
 	{
-		unsigned int * src = (unsigned int *)(pSrcImage + y*srcImageStrideInBytes);
-		unsigned int * srclast = src + (srcWidth >> 2);
-		while (src < srclast)
+		vx_uint8 * srcRow = pSrcImage + y*srcImageStrideInBytes;
+		unsigned int x = 0;
+		for (; x + 16 <= srcWidth; x += 16)
 		{
 			// do for 16 pixels..
-			unsigned int pixel4;
-			pixel4 = *src++;
-			pdst[(pixel4 & 0xFF)]++;
-			pdst[(pixel4 >> 8) & 0xFF]++;
-			pdst[(pixel4 >> 16) & 0xFF]++;
-			pdst[(pixel4 >> 24) & 0xFF]++;
-
-			pixel4 = *src++;
-			pdst[(pixel4 & 0xFF)]++;
-			pdst[(pixel4 >> 8) & 0xFF]++;
-			pdst[(pixel4 >> 16) & 0xFF]++;
-			pdst[(pixel4 >> 24) & 0xFF]++;
-
-			pixel4 = *src++;
-			pdst[(pixel4 & 0xFF)]++;
-			pdst[(pixel4 >> 8) & 0xFF]++;
-			pdst[(pixel4 >> 16) & 0xFF]++;
-			pdst[(pixel4 >> 24) & 0xFF]++;
-
-			pixel4 = *src++;
-			pdst[(pixel4 & 0xFF)]++;
-			pdst[(pixel4 >> 8) & 0xFF]++;
-			pdst[(pixel4 >> 16) & 0xFF]++;
-			pdst[(pixel4 >> 24) & 0xFF]++;
+			unsigned int pixel4[4];
+			memcpy(pixel4, srcRow + x, sizeof(pixel4));
+			for (int i = 0; i < 4; i++)
+			{
+				subHist[0][(pixel4[i] & 0xFF)]++;
+				subHist[1][(pixel4[i] >> 8) & 0xFF]++;
+				subHist[2][(pixel4[i] >> 16) & 0xFF]++;
+				subHist[3][(pixel4[i] >> 24) & 0xFF]++;
+			}
 		}
+		for (; x < srcWidth; x++)
+			subHist[x & 3][srcRow[x]]++;
 	}
-	return AGO_SUCCESS;
+	for (unsigned int n = 0; n < NUM_BINS; n++)
+		dstHist[n] = subHist[0][n] + subHist[1][n] + subHist[2][n] + subHist[3][n];
+}
+
+// special case histogram primitive : range - 255, offset: 0, NumBins: 255
+int HafCpu_Histogram_DATA_U8
+(
+	vx_uint32     dstHist[],
+	vx_uint32     srcWidth,
+	vx_uint32     srcHeight,
+	vx_uint8    * pSrcImage,
+	vx_uint32     srcImageStrideInBytes
+)
+{
+	vx_uint32 numStrips = HafCpu_ReductionStripCount(srcWidth, srcHeight);
+	if (numStrips <= 1) {
+		HafCpu_HistogramRows_DATA_U8(dstHist, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes);
+		return AGO_SUCCESS;
+	}
+	// compute a partial histogram per strip and merge them
+	std::vector<vx_uint32> partHist(numStrips * NUM_BINS);
+	vx_uint32 * pPartHist[HAFCPU_REDUCTION_MAX_STRIPS];
+	for (vx_uint32 strip = 0; strip < numStrips; strip++)
+		pPartHist[strip] = &partHist[strip * NUM_BINS];
+	HafCpu_ParallelStrips(numStrips, srcHeight, [&](vx_uint32 strip, vx_uint32 y, vx_uint32 height) {
+		HafCpu_HistogramRows_DATA_U8(pPartHist[strip], srcWidth, height, pSrcImage + y*srcImageStrideInBytes, srcImageStrideInBytes);
+	});
+	return HafCpu_HistogramMerge_DATA_DATA(dstHist, numStrips, pPartHist);
 }
 
 int HafCpu_HistogramMerge_DATA_DATA
@@ -7358,15 +7400,15 @@ int HafCpu_HistogramMerge_DATA_DATA
 		__m128i sum1 = _mm_setzero_si128();
 		__m128i sum2 = _mm_setzero_si128();
 		for (unsigned int i = 0; i < numPartitions; i++){
-			__m128i *phist = (__m128i *)&pPartSrcHist[i];
-			pixels1 = _mm_load_si128(&phist[(n >> 2)]);
-			pixels2 = _mm_load_si128(&phist[(n >> 2)+1]);
+			__m128i *phist = (__m128i *)pPartSrcHist[i];
+			pixels1 = _mm_loadu_si128(&phist[(n >> 2)]);
+			pixels2 = _mm_loadu_si128(&phist[(n >> 2)+1]);
 			sum1 = _mm_add_epi32(sum1, pixels1);
 			sum2 = _mm_add_epi32(sum2, pixels2);
 		}
 		// copy merged
-		_mm_store_si128(&dst[(n >> 2)], sum1);
-		_mm_store_si128(&dst[(n >> 2) + 1], sum2);
+		_mm_storeu_si128(&dst[(n >> 2)], sum1);
+		_mm_storeu_si128(&dst[(n >> 2) + 1], sum2);
 	}
 	return AGO_SUCCESS;
 }
@@ -7441,7 +7483,7 @@ vx_uint32   * pPartSrcHist[]
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMax_DATA_U8
+static int HafCpu_MinMaxRows_DATA_U8
 	(
 		vx_int32    * pDstMinValue,
 		vx_int32    * pDstMaxValue,
@@ -7509,7 +7551,103 @@ int HafCpu_MinMax_DATA_U8
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_Min
+int HafCpu_MinMax_DATA_U8
+	(
+		vx_int32    * pDstMinValue,
+		vx_int32    * pDstMaxValue,
+		vx_uint32     srcWidth,
+		vx_uint32     srcHeight,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	// compute min and max per strip and merge them
+	vx_uint32 numStrips = HafCpu_ReductionStripCount(srcWidth, srcHeight);
+	vx_int32 partMinValue[HAFCPU_REDUCTION_MAX_STRIPS], partMaxValue[HAFCPU_REDUCTION_MAX_STRIPS];
+	HafCpu_ParallelStrips(numStrips, srcHeight, [&](vx_uint32 strip, vx_uint32 y, vx_uint32 height) {
+		HafCpu_MinMaxRows_DATA_U8(&partMinValue[strip], &partMaxValue[strip], srcWidth, height, pSrcImage + y * srcImageStrideInBytes, srcImageStrideInBytes);
+	});
+	return HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numStrips, partMinValue, partMaxValue);
+}
+
+// run a min/max location search on horizontal strips in parallel: each strip collects its own counts and
+// location lists, which are then concatenated in raster order with HafCpu_MinMaxLocMerge_DATA_DATA
+typedef std::function<int(vx_uint32 *, vx_uint32 *, vx_uint32, vx_coordinates2d_t *, vx_uint32, vx_coordinates2d_t *, vx_uint32, vx_uint8 *)> HafCpu_MinMaxLocRowsFunc;
+static int HafCpu_MinMaxLocStrips
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMinLocList,
+		vx_coordinates2d_t   minLocList[],
+		vx_uint32            capacityOfMaxLocList,
+		vx_coordinates2d_t   maxLocList[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		const HafCpu_MinMaxLocRowsFunc& rowsFunc
+	)
+{
+	vx_uint32 numStrips = HafCpu_ReductionStripCount(srcWidth, srcHeight);
+	if (numStrips <= 1) {
+		return rowsFunc(pMinLocCount, pMaxLocCount, capacityOfMinLocList, minLocList, capacityOfMaxLocList, maxLocList, srcHeight, pSrcImage);
+	}
+	// a strip never needs more list entries than its pixel count or the list capacity
+	vx_uint32 partMinCount[HAFCPU_REDUCTION_MAX_STRIPS] = { 0 }, partMaxCount[HAFCPU_REDUCTION_MAX_STRIPS] = { 0 };
+	vx_coordinates2d_t * partMinList[HAFCPU_REDUCTION_MAX_STRIPS], * partMaxList[HAFCPU_REDUCTION_MAX_STRIPS];
+	vx_uint32 partMinCapacity[HAFCPU_REDUCTION_MAX_STRIPS], partMaxCapacity[HAFCPU_REDUCTION_MAX_STRIPS];
+	size_t minListSize = 0, maxListSize = 0;
+	for (vx_uint32 strip = 0; strip < numStrips; strip++) {
+		vx_uint32 stripPixels = srcWidth * (vx_uint32)(((vx_uint64)srcHeight * (strip + 1) / numStrips) - ((vx_uint64)srcHeight * strip / numStrips));
+		partMinCapacity[strip] = minLocList ? min(capacityOfMinLocList, stripPixels) : 0;
+		partMaxCapacity[strip] = maxLocList ? min(capacityOfMaxLocList, stripPixels) : 0;
+		minListSize += partMinCapacity[strip];
+		maxListSize += partMaxCapacity[strip];
+	}
+	std::vector<vx_coordinates2d_t> minListBuffer(minListSize), maxListBuffer(maxListSize);
+	for (vx_uint32 strip = 0, minOffset = 0, maxOffset = 0; strip < numStrips; strip++) {
+		partMinList[strip] = minLocList ? &minListBuffer[minOffset] : nullptr;
+		partMaxList[strip] = maxLocList ? &maxListBuffer[maxOffset] : nullptr;
+		minOffset += partMinCapacity[strip];
+		maxOffset += partMaxCapacity[strip];
+	}
+	int status = AGO_SUCCESS;
+	HafCpu_ParallelStrips(numStrips, srcHeight, [&](vx_uint32 strip, vx_uint32 y, vx_uint32 height) {
+		if (rowsFunc(pMinLocCount ? &partMinCount[strip] : nullptr, pMaxLocCount ? &partMaxCount[strip] : nullptr,
+			partMinCapacity[strip], partMinList[strip], partMaxCapacity[strip], partMaxList[strip], height, pSrcImage + y * srcImageStrideInBytes))
+		{
+			status = AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+		}
+		// convert the strip-relative rows into image rows
+		for (vx_uint32 i = 0; partMinList[strip] && i < min(partMinCount[strip], partMinCapacity[strip]); i++)
+			partMinList[strip][i].y += y;
+		for (vx_uint32 i = 0; partMaxList[strip] && i < min(partMaxCount[strip], partMaxCapacity[strip]); i++)
+			partMaxList[strip][i].y += y;
+	});
+	if (pMinLocCount) {
+		if (minLocList) {
+			HafCpu_MinMaxLocMerge_DATA_DATA(pMinLocCount, capacityOfMinLocList, minLocList, numStrips, partMinCount, partMinList);
+		}
+		else {
+			*pMinLocCount = 0;
+			for (vx_uint32 strip = 0; strip < numStrips; strip++)
+				*pMinLocCount += partMinCount[strip];
+		}
+	}
+	if (pMaxLocCount) {
+		if (maxLocList) {
+			HafCpu_MinMaxLocMerge_DATA_DATA(pMaxLocCount, capacityOfMaxLocList, maxLocList, numStrips, partMaxCount, partMaxList);
+		}
+		else {
+			*pMaxLocCount = 0;
+			for (vx_uint32 strip = 0; strip < numStrips; strip++)
+				*pMaxLocCount += partMaxCount[strip];
+		}
+	}
+	return status;
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_None_Count_Min
 	(
 		vx_uint32          * pMinLocCount,
 		vx_int32           * pDstMinValue,
@@ -7589,7 +7727,31 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_Min
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_Max
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_Min
+	(
+		vx_uint32          * pMinLocCount,
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, nullptr, 0, nullptr, 0, nullptr,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_None_Count_Min(minCount, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_None_Count_Max
 	(
 		vx_uint32          * pMaxLocCount,
 		vx_int32           * pDstMinValue,
@@ -7669,7 +7831,31 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_Max
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_Max
+	(
+		vx_uint32          * pMaxLocCount,
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(nullptr, pMaxLocCount, 0, nullptr, 0, nullptr,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_None_Count_Max(maxCount, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_None_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -7770,7 +7956,32 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_MinMax
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Min_Count_Min
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_None_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, 0, nullptr, 0, nullptr,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_None_Count_MinMax(minCount, maxCount, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Min_Count_Min
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32            capacityOfMinLocList,
@@ -7885,7 +8096,33 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Min_Count_Min
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Min_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Min_Count_Min
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32            capacityOfMinLocList,
+		vx_coordinates2d_t   minLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, nullptr, capacityOfMinLocList, minLocList, 0, nullptr,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Min_Count_Min(minCount, minCapacity, minList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Min_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -8019,7 +8256,34 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Min_Count_MinMax
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Max_Count_Max
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Min_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMinLocList,
+		vx_coordinates2d_t   minLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, capacityOfMinLocList, minLocList, 0, nullptr,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Min_Count_MinMax(minCount, maxCount, minCapacity, minList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Max_Count_Max
 	(
 		vx_uint32          * pMaxLocCount,
 		vx_uint32            capacityOfMaxLocList,
@@ -8135,7 +8399,33 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Max_Count_Max
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Max_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Max_Count_Max
+	(
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMaxLocList,
+		vx_coordinates2d_t   maxLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(nullptr, pMaxLocCount, 0, nullptr, capacityOfMaxLocList, maxLocList,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Max_Count_Max(maxCount, maxCapacity, maxList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Max_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -8269,7 +8559,34 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Max_Count_MinMax
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_MinMax_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_Max_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMaxLocList,
+		vx_coordinates2d_t   maxLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, 0, nullptr, capacityOfMaxLocList, maxLocList,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_Max_Count_MinMax(minCount, maxCount, maxCapacity, maxList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_MinMax_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -8433,7 +8750,36 @@ int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_MinMax_Count_MinMax
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMax_DATA_S16
+int HafCpu_MinMaxLoc_DATA_U8DATA_Loc_MinMax_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMinLocList,
+		vx_coordinates2d_t   minLocList[],
+		vx_uint32            capacityOfMaxLocList,
+		vx_coordinates2d_t   maxLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, capacityOfMinLocList, minLocList, capacityOfMaxLocList, maxLocList,
+		srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_U8DATA_Loc_MinMax_Count_MinMax(minCount, maxCount, minCapacity, minList, maxCapacity, maxList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxRows_DATA_S16
 	(
 		vx_int32    * pDstMinValue,
 		vx_int32    * pDstMaxValue,
@@ -8502,7 +8848,26 @@ int HafCpu_MinMax_DATA_S16
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_Min
+int HafCpu_MinMax_DATA_S16
+	(
+		vx_int32    * pDstMinValue,
+		vx_int32    * pDstMaxValue,
+		vx_uint32     srcWidth,
+		vx_uint32     srcHeight,
+		vx_int16    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes
+	)
+{
+	// compute min and max per strip and merge them
+	vx_uint32 numStrips = HafCpu_ReductionStripCount(srcWidth, srcHeight);
+	vx_int32 partMinValue[HAFCPU_REDUCTION_MAX_STRIPS], partMaxValue[HAFCPU_REDUCTION_MAX_STRIPS];
+	HafCpu_ParallelStrips(numStrips, srcHeight, [&](vx_uint32 strip, vx_uint32 y, vx_uint32 height) {
+		HafCpu_MinMaxRows_DATA_S16(&partMinValue[strip], &partMaxValue[strip], srcWidth, height, (vx_int16 *)((vx_uint8 *)pSrcImage + y * srcImageStrideInBytes), srcImageStrideInBytes);
+	});
+	return HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numStrips, partMinValue, partMaxValue);
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_None_Count_Min
 	(
 		vx_uint32          * pMinLocCount,
 		vx_int32           * pDstMinValue,
@@ -8587,7 +8952,31 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_Min
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_Max
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_Min
+	(
+		vx_uint32          * pMinLocCount,
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, nullptr, 0, nullptr, 0, nullptr,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_None_Count_Min(minCount, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_None_Count_Max
 	(
 		vx_uint32          * pMaxLocCount,
 		vx_int32           * pDstMinValue,
@@ -8672,7 +9061,31 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_Max
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_Max
+	(
+		vx_uint32          * pMaxLocCount,
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(nullptr, pMaxLocCount, 0, nullptr, 0, nullptr,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_None_Count_Max(maxCount, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_None_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -8780,7 +9193,32 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_MinMax
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Min_Count_Min
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_None_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, 0, nullptr, 0, nullptr,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_None_Count_MinMax(minCount, maxCount, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Min_Count_Min
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32            capacityOfMinLocList,
@@ -8898,7 +9336,33 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Min_Count_Min
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Min_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Min_Count_Min
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32            capacityOfMinLocList,
+		vx_coordinates2d_t   minLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, nullptr, capacityOfMinLocList, minLocList, 0, nullptr,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Min_Count_Min(minCount, minCapacity, minList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Min_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -9040,7 +9504,34 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Min_Count_MinMax
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Max_Count_Max
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Min_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMinLocList,
+		vx_coordinates2d_t   minLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, capacityOfMinLocList, minLocList, 0, nullptr,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Min_Count_MinMax(minCount, maxCount, minCapacity, minList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Max_Count_Max
 	(
 		vx_uint32          * pMaxLocCount,
 		vx_uint32            capacityOfMaxLocList,
@@ -9160,7 +9651,33 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Max_Count_Max
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Max_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Max_Count_Max
+	(
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMaxLocList,
+		vx_coordinates2d_t   maxLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(nullptr, pMaxLocCount, 0, nullptr, capacityOfMaxLocList, maxLocList,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Max_Count_Max(maxCount, maxCapacity, maxList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Max_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -9301,7 +9818,34 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Max_Count_MinMax
 	return AGO_SUCCESS;
 }
 
-int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_MinMax_Count_MinMax
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_Max_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMaxLocList,
+		vx_coordinates2d_t   maxLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, 0, nullptr, capacityOfMaxLocList, maxLocList,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_Max_Count_MinMax(minCount, maxCount, maxCapacity, maxList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
+static int HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_MinMax_Count_MinMax
 	(
 		vx_uint32          * pMinLocCount,
 		vx_uint32          * pMaxLocCount,
@@ -9472,6 +10016,35 @@ int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_MinMax_Count_MinMax
 	return AGO_SUCCESS;
 }
 
+int HafCpu_MinMaxLoc_DATA_S16DATA_Loc_MinMax_Count_MinMax
+	(
+		vx_uint32          * pMinLocCount,
+		vx_uint32          * pMaxLocCount,
+		vx_uint32            capacityOfMinLocList,
+		vx_coordinates2d_t   minLocList[],
+		vx_uint32            capacityOfMaxLocList,
+		vx_coordinates2d_t   maxLocList[],
+		vx_int32           * pDstMinValue,
+		vx_int32           * pDstMaxValue,
+		vx_uint32            numDataPartitions,
+		vx_int32             srcMinValue[],
+		vx_int32             srcMaxValue[],
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_int16           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes
+	)
+{
+	HafCpu_MinMaxMerge_DATA_DATA(pDstMinValue, pDstMaxValue, numDataPartitions, srcMinValue, srcMaxValue);
+	return HafCpu_MinMaxLocStrips(pMinLocCount, pMaxLocCount, capacityOfMinLocList, minLocList, capacityOfMaxLocList, maxLocList,
+		srcWidth, srcHeight, (vx_uint8 *)pSrcImage, srcImageStrideInBytes,
+		[&](vx_uint32 * minCount, vx_uint32 * maxCount, vx_uint32 minCapacity, vx_coordinates2d_t * minList,
+			vx_uint32 maxCapacity, vx_coordinates2d_t * maxList, vx_uint32 height, vx_uint8 * pSrc) {
+		vx_int32 minValue, maxValue;
+		return HafCpu_MinMaxLocRows_DATA_S16DATA_Loc_MinMax_Count_MinMax(minCount, maxCount, minCapacity, minList, maxCapacity, maxList, &minValue, &maxValue, numDataPartitions, srcMinValue, srcMaxValue, srcWidth, height, (vx_int16 *)pSrc, srcImageStrideInBytes);
+	});
+}
+
 int HafCpu_MinMaxMerge_DATA_DATA
 	(
 		vx_int32    * pDstMinValue,
@@ -9489,7 +10062,7 @@ int HafCpu_MinMaxMerge_DATA_DATA
 	for (int i = 1; i < (int) numDataPartitions; i++)
 	{
 		minVal = min(minVal, srcMinValue[i]);
-		maxVal = min(minVal, srcMaxValue[i]);
+		maxVal = max(maxVal, srcMaxValue[i]);
 	}
 
 	*pDstMinValue = minVal;
@@ -9509,27 +10082,18 @@ int HafCpu_MinMaxLocMerge_DATA_DATA
 		vx_coordinates2d_t * partLocList[]
 	)
 {
-	int dstCount = 0;
-	int srcCount;
-	vx_coordinates2d_t * srcList;
-	
+	// the count includes the locations that did not fit in the destination list
+	vx_uint32 dstCount = 0;
 	for (int i = 0; i < (int)numDataPartitions; i++)
 	{
-		srcList = partLocList[i];
-		srcCount = partLocCount[i];
-
-		while (srcCount)
+		if (dstCount < capacityOfDstLocList)
 		{
-			*dstLocList++ = *srcList++;
-			dstCount++;
-			srcCount--;
-			if (dstCount > (int) capacityOfDstLocList)
-			{
-				*pDstLocCount = (vx_uint32)(dstCount - 1);
-				return AGO_SUCCESS;
-			}
+			vx_uint32 copyCount = min(partLocCount[i], capacityOfDstLocList - dstCount);
+			memcpy(&dstLocList[dstCount], partLocList[i], copyCount * sizeof(vx_coordinates2d_t));
 		}
+		dstCount += partLocCount[i];
 	}
+	*pDstLocCount = dstCount;
 	return AGO_SUCCESS;
 }
 
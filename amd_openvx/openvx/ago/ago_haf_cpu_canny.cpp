@@ -595,6 +595,69 @@ int HafCpu_CannySuppThreshold_U8XY_U16_3x3
 	return AGO_SUCCESS;
 }
 
+#define CANNY_TRACE_TILE_HEIGHT      64 // rows per tile of the hysteresis edge tracing
+#define CANNY_WEAK_EDGE             127 // weak edge pixel from the suppression stage
+#define CANNY_WEAK_EDGE_ON_BORDER   126 // weak edge pixel connected to a tile border, not yet resolved
+#define CANNY_TRACED_EDGE           128 // weak edge pixel connected to a strong edge, set to 255 by the final pass
+
+// per tile state of the hysteresis edge tracing
+struct CannyTraceTile {
+	vx_uint32 y0, y1;                                // rows [y0, y1) of the tile
+	vx_uint32 labelBase;                             // global label of the first border component of the tile
+	std::vector<ago_coord2d_ushort_t> seeds;         // one pixel of each border component
+	std::vector<vx_int32> topLabel, bottomLabel;     // local label of weak pixels on the first and last rows, or -1
+};
+
+// trace all edges connected to the pixels on the stack through 8-connected pixels with value 'from' within the
+// rows [y0, y1), by changing them to 'to'; calls visit(x, y) for each changed pixel
+template <typename F>
+static inline void CannyTraceFill(std::vector<ago_coord2d_ushort_t>& stack, vx_uint32 width, vx_uint32 y0, vx_uint32 y1,
+	vx_uint8 * pDstImage, vx_uint32 dstImageStrideInBytes, vx_uint8 from, vx_uint8 to, F visit)
+{
+	while (!stack.empty()) {
+		ago_coord2d_ushort_t xy = stack.back();
+		stack.pop_back();
+		for (int i = 0; i < 8; i++) {
+			vx_int32 x1 = xy.x + dir_offsets[i].x;
+			vx_int32 y1n = xy.y + dir_offsets[i].y;
+			if (x1 < 0 || x1 >= (vx_int32)width || y1n < (vx_int32)y0 || y1n >= (vx_int32)y1)
+				continue;
+			vx_uint8 * pDst = pDstImage + y1n * dstImageStrideInBytes + x1;
+			if (*pDst == from) {
+				*pDst = to;
+				visit((vx_uint32)x1, (vx_uint32)y1n);
+				ago_coord2d_ushort_t xy1 = { (vx_uint16)x1, (vx_uint16)y1n };
+				stack.push_back(xy1);
+			}
+		}
+	}
+}
+
+static inline vx_uint32 CountTrailingZeros(vx_uint32 mask)
+{
+#if _WIN32
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (vx_uint32)index;
+#else
+	return (vx_uint32)__builtin_ctz(mask);
+#endif
+}
+
+static vx_uint32 CannyTraceFindRoot(std::vector<vx_uint32>& parent, vx_uint32 label)
+{
+	while (parent[label] != label) {
+		parent[label] = parent[parent[label]];
+		label = parent[label];
+	}
+	return label;
+}
+
+// Hysteresis edge tracing, done on tiles of rows in parallel:
+//   1. each tile traces the strong edges inside the tile and labels the weak edges that reach the first or last row of the tile
+//   2. the labels are merged across the tile borders with union-find, where label 0 stands for strong edges
+//   3. each tile promotes the border components connected to a strong edge and clears all remaining weak edges
+// The strong edges are found from the destination image, so the xyStack from the suppression stage is not needed.
 int HafCpu_CannyEdgeTrace_U8_U8XY
 	(
 		vx_uint32              dstWidth,
@@ -606,40 +669,125 @@ int HafCpu_CannyEdgeTrace_U8_U8XY
 		vx_uint32              xyStackTop
 	)
 {
-	ago_coord2d_ushort_t *pxyStack = xyStack + xyStackTop;
-	while (pxyStack != xyStack){
-			pxyStack--;
-			vx_uint16 x = pxyStack->x;
-			vx_uint16 y = pxyStack->y;
-			// look at all the neighbors for strong edge value
-		for (int i = 0; i < 8; i++){
-			const ago_coord2d_short_t offs = dir_offsets[i];
-			vx_int16 x1 = x + offs.x;
-			vx_int16 y1 = y + offs.y;
-			vx_uint8 *pDst = pDstImage + y1*dstImageStrideInBytes + x1;
-			if (*pDst == 127)
-			{
-				*pDst |= 0x80;		// *pDst = 255
-				*((unsigned *)pxyStack) = (y1<<16)|x1;
-				pxyStack++;
+	vx_uint32 numTiles = (dstHeight + CANNY_TRACE_TILE_HEIGHT - 1) / CANNY_TRACE_TILE_HEIGHT;
+	std::vector<CannyTraceTile> tiles(numTiles);
+
+	// pass 1: trace within tiles and label the weak edges on tile borders
+	HafCpu_ParallelFor(numTiles, 1, [&](vx_uint32 begin, vx_uint32 end) {
+		std::vector<ago_coord2d_ushort_t> stack;
+		const __m128i mm255 = _mm_set1_epi8((char)255);
+		for (vx_uint32 t = begin; t < end; t++) {
+			CannyTraceTile& tile = tiles[t];
+			tile.y0 = t * CANNY_TRACE_TILE_HEIGHT;
+			tile.y1 = min(tile.y0 + CANNY_TRACE_TILE_HEIGHT, dstHeight);
+			for (vx_uint32 y = tile.y0; y < tile.y1; y++) {
+				const vx_uint8 * pRow = pDstImage + y * dstImageStrideInBytes;
+				for (vx_uint32 x16 = 0; x16 < dstWidth; x16 += 16) {
+					// the traced pixels are marked differently from the strong pixels, so that they aren't seeds again
+					vx_uint32 strong = (vx_uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)(pRow + x16)), mm255));
+					for (; strong; strong &= strong - 1) {
+						vx_uint32 x = x16 + CountTrailingZeros(strong);
+						if (x < dstWidth) {
+							ago_coord2d_ushort_t xy = { (vx_uint16)x, (vx_uint16)y };
+							stack.push_back(xy);
+							CannyTraceFill(stack, dstWidth, tile.y0, tile.y1, pDstImage, dstImageStrideInBytes, CANNY_WEAK_EDGE, CANNY_TRACED_EDGE, [](vx_uint32, vx_uint32) {});
+						}
+					}
+				}
+			}
+			tile.topLabel.assign(dstWidth, -1);
+			tile.bottomLabel.assign(dstWidth, -1);
+			vx_int32 label = 0;
+			auto setLabel = [&](vx_uint32 x, vx_uint32 y) {
+				if (y == tile.y0) tile.topLabel[x] = label;
+				if (y == tile.y1 - 1) tile.bottomLabel[x] = label;
+			};
+			for (vx_uint32 y : { tile.y0, tile.y1 - 1 }) {
+				vx_uint8 * pRow = pDstImage + y * dstImageStrideInBytes;
+				for (vx_uint32 x = 0; x < dstWidth; x++) {
+					if (pRow[x] == CANNY_WEAK_EDGE) {
+						ago_coord2d_ushort_t xy = { (vx_uint16)x, (vx_uint16)y };
+						pRow[x] = CANNY_WEAK_EDGE_ON_BORDER;
+						setLabel(x, y);
+						tile.seeds.push_back(xy);
+						stack.push_back(xy);
+						CannyTraceFill(stack, dstWidth, tile.y0, tile.y1, pDstImage, dstImageStrideInBytes, CANNY_WEAK_EDGE, CANNY_WEAK_EDGE_ON_BORDER, setLabel);
+						label++;
+					}
+				}
 			}
 		}
+	});
+
+	// pass 2: merge the border components of neighboring tiles
+	vx_uint32 numLabels = 1;
+	for (auto& tile : tiles) {
+		tile.labelBase = numLabels;
+		numLabels += (vx_uint32)tile.seeds.size();
 	}
-	// go through the entire destination and convert all 127 to 0
-	const __m128i mm127 = _mm_set1_epi8((char)127);
-	for (unsigned int y = 0; y < dstHeight; y++) {
-		__m128i * src = (__m128i *)pDstImage;
-		vx_uint32 width = (dstWidth + 15) >> 4;
-
-		for (unsigned int x = 0; x < width; x++) {
-			__m128i mask;
-			__m128i pixels = _mm_load_si128(src);
-			mask = _mm_cmpeq_epi8(pixels, mm127);
-			pixels = _mm_andnot_si128(mask, pixels);
-			_mm_store_si128(src++, pixels);
+	std::vector<vx_uint32> parent(numLabels);
+	for (vx_uint32 i = 0; i < numLabels; i++)
+		parent[i] = i;
+	for (vx_uint32 t = 1; t < numTiles; t++) {
+		const CannyTraceTile& above = tiles[t - 1];
+		const CannyTraceTile& below = tiles[t];
+		const vx_uint8 * pRowAbove = pDstImage + (above.y1 - 1) * dstImageStrideInBytes;
+		const vx_uint8 * pRowBelow = pDstImage + below.y0 * dstImageStrideInBytes;
+		for (vx_uint32 x = 0; x < dstWidth; x++) {
+			vx_int32 labelAbove = (pRowAbove[x] == 255 || pRowAbove[x] == CANNY_TRACED_EDGE) ? 0 : (above.bottomLabel[x] >= 0 ? (vx_int32)above.labelBase + above.bottomLabel[x] : -1);
+			if (labelAbove < 0)
+				continue;
+			for (vx_int32 xb = max((vx_int32)x - 1, 0); xb <= min((vx_int32)x + 1, (vx_int32)dstWidth - 1); xb++) {
+				vx_int32 labelBelow = (pRowBelow[xb] == 255 || pRowBelow[xb] == CANNY_TRACED_EDGE) ? 0 : (below.topLabel[xb] >= 0 ? (vx_int32)below.labelBase + below.topLabel[xb] : -1);
+				if (labelBelow < 0)
+					continue;
+				vx_uint32 rootAbove = CannyTraceFindRoot(parent, labelAbove);
+				vx_uint32 rootBelow = CannyTraceFindRoot(parent, labelBelow);
+				if (rootAbove != rootBelow) {
+					// the smaller label becomes the root, so that strong edges stay at root 0
+					parent[max(rootAbove, rootBelow)] = min(rootAbove, rootBelow);
+				}
+			}
 		}
-		pDstImage += dstImageStrideInBytes;
 	}
+
+	// point every label directly at its root, so that pass 3 only reads parent: a parent is never larger than its label,
+	// hence the parent of a label is already flattened when the labels are visited in increasing order
+	for (vx_uint32 i = 1; i < numLabels; i++)
+		parent[i] = parent[parent[i]];
+
+	// pass 3: promote the border components connected to strong edges, then set the traced pixels to 255 and clear all remaining weak edges
+	HafCpu_ParallelFor(numTiles, 1, [&](vx_uint32 begin, vx_uint32 end) {
+		std::vector<ago_coord2d_ushort_t> stack;
+		const __m128i mm126 = _mm_set1_epi8((char)CANNY_WEAK_EDGE_ON_BORDER);
+		const __m128i mm127 = _mm_set1_epi8((char)CANNY_WEAK_EDGE);
+		const __m128i mm128 = _mm_set1_epi8((char)CANNY_TRACED_EDGE);
+		for (vx_uint32 t = begin; t < end; t++) {
+			CannyTraceTile& tile = tiles[t];
+			for (vx_uint32 i = 0; i < (vx_uint32)tile.seeds.size(); i++) {
+				if (parent[tile.labelBase + i] == 0) {
+					ago_coord2d_ushort_t xy = tile.seeds[i];
+					vx_uint8 * pDst = pDstImage + xy.y * dstImageStrideInBytes + xy.x;
+					if (*pDst == CANNY_WEAK_EDGE_ON_BORDER) {
+						*pDst = CANNY_TRACED_EDGE;
+						stack.push_back(xy);
+						CannyTraceFill(stack, dstWidth, tile.y0, tile.y1, pDstImage, dstImageStrideInBytes, CANNY_WEAK_EDGE_ON_BORDER, CANNY_TRACED_EDGE, [](vx_uint32, vx_uint32) {});
+					}
+				}
+			}
+			for (vx_uint32 y = tile.y0; y < tile.y1; y++) {
+				__m128i * src = (__m128i *)(pDstImage + y * dstImageStrideInBytes);
+				vx_uint32 width = (dstWidth + 15) >> 4;
+				for (vx_uint32 x = 0; x < width; x++) {
+					__m128i pixels = _mm_load_si128(src);
+					__m128i maskWeak = _mm_or_si128(_mm_cmpeq_epi8(pixels, mm127), _mm_cmpeq_epi8(pixels, mm126));
+					__m128i maskTraced = _mm_cmpeq_epi8(pixels, mm128);
+					pixels = _mm_or_si128(_mm_andnot_si128(maskWeak, pixels), maskTraced);
+					_mm_store_si128(src++, pixels);
+				}
+			}
+		}
+	});
 	return AGO_SUCCESS;
 }
 
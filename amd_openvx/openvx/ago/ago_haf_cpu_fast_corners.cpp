@@ -799,28 +799,27 @@ int HafCpu_FastCornerMerge_XY_XY
 		vx_uint32       numSrcCorners[]
 	)
 {
-	int dstCount = 0;
-	int srcCount;
-	vx_keypoint_t * srcList;
-
-	for (int i = 0; i < (int)numSrcCornerBuffers; i++)
-	{
-		srcCount = numSrcCorners[i];
-		srcList = pSrcCorners[i];
-
-		while (srcCount)
-		{
-			*dstCorner++ = *srcList++;
-			dstCount++;
-			srcCount--;
-			if (dstCount >(int) capacityOfDstCorner)
-			{
-				*pDstCornerCount = (vx_uint32)(dstCount - 1);
-				return AGO_SUCCESS;
-			}
+	vx_uint32 totalCount = 0;
+	for (vx_uint32 i = 0; i < numSrcCornerBuffers; i++)
+		totalCount += numSrcCorners[i];
+
+	if (totalCount <= capacityOfDstCorner) {
+		// all corners fit: keep them in the order of the source buffers
+		vx_keypoint_t * dst = dstCorner;
+		for (vx_uint32 i = 0; i < numSrcCornerBuffers; i++) {
+			memcpy(dst, pSrcCorners[i], numSrcCorners[i] * sizeof(vx_keypoint_t));
+			dst += numSrcCorners[i];
 		}
 	}
+	else {
+		// keep the strongest corners
+		std::vector<vx_keypoint_t> candidates;
+		candidates.reserve(totalCount);
+		for (vx_uint32 i = 0; i < numSrcCornerBuffers; i++)
+			candidates.insert(candidates.end(), pSrcCorners[i], pSrcCorners[i] + numSrcCorners[i]);
+		HafCpu_PickStrongestKeypoints(capacityOfDstCorner, dstCorner, candidates.data(), totalCount);
+	}
 
-	*pDstCornerCount = (vx_uint32)(dstCount - 1);
+	*pDstCornerCount = totalCount;
 	return AGO_SUCCESS;
 }
@@ -2721,6 +2721,7 @@ int HafCpu_Convolve_S16_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -2816,10 +2817,10 @@ int HafCpu_Convolve_S16_U8_3xN
 				result0 = _mm_add_epi32(result0, temp0);
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -2842,6 +2843,7 @@ int HafCpu_Convolve_S16_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -2901,6 +2903,7 @@ int HafCpu_Convolve_U8_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -2995,10 +2998,10 @@ int HafCpu_Convolve_U8_U8_3xN
 				result0 = _mm_add_epi32(result0, temp0);
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3021,6 +3024,7 @@ int HafCpu_Convolve_U8_U8_3xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3082,6 +3086,7 @@ int HafCpu_Convolve_S16_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3128,10 +3133,10 @@ int HafCpu_Convolve_S16_U8_5xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3154,6 +3159,7 @@ int HafCpu_Convolve_S16_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3213,6 +3219,7 @@ int HafCpu_Convolve_U8_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3259,10 +3266,10 @@ int HafCpu_Convolve_U8_U8_5xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3285,6 +3292,7 @@ int HafCpu_Convolve_U8_U8_5xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3343,9 +3351,10 @@ int HafCpu_Convolve_S16_U8_7xN
 			{
 				for (int j = -3; j <= 3; j++)
 				{
-					temp += ((int)pLocalSrc[i*srcStride - j] * (int)convMatrix[idx--]);
+					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3392,10 +3401,10 @@ int HafCpu_Convolve_S16_U8_7xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3418,6 +3427,7 @@ int HafCpu_Convolve_S16_U8_7xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3477,6 +3487,7 @@ int HafCpu_Convolve_U8_U8_7xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3523,10 +3534,10 @@ int HafCpu_Convolve_U8_U8_7xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3549,6 +3560,7 @@ int HafCpu_Convolve_U8_U8_7xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3610,6 +3622,7 @@ int HafCpu_Convolve_S16_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3656,10 +3669,10 @@ int HafCpu_Convolve_S16_U8_9xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3682,6 +3695,7 @@ int HafCpu_Convolve_S16_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, SHRT_MAX);
 			temp = max(temp, SHRT_MIN);
 			*pLocalDst++ = (short)temp;
@@ -3741,6 +3755,7 @@ int HafCpu_Convolve_U8_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -3787,10 +3802,10 @@ int HafCpu_Convolve_U8_U8_9xN
 				}
 			}
 
-			result0 = _mm_srli_epi32(result0, shift);
-			result1 = _mm_srli_epi32(result1, shift);
-			result2 = _mm_srli_epi32(result2, shift);
-			result3 = _mm_srli_epi32(result3, shift);
+			result0 = _mm_srai_epi32(result0, shift);
+			result1 = _mm_srai_epi32(result1, shift);
+			result2 = _mm_srai_epi32(result2, shift);
+			result3 = _mm_srai_epi32(result3, shift);
 
 			row = _mm_packs_epi32(result2, result3);
 			temp0 = _mm_packs_epi32(result0, result1);
@@ -3813,6 +3828,7 @@ int HafCpu_Convolve_U8_U8_9xN
 					temp += ((int)pLocalSrc[i*srcStride + j] * (int)convMatrix[idx--]);
 				}
 			}
+			temp >>= shift;
 			temp = min(temp, 255);
 			temp = max(temp, 0);
 			*pLocalDst++ = (unsigned char)temp;
@@ -4200,4 +4216,282 @@ int HafCpu_SobelMagnitudePhase_S16U8_U8_3x3
 		height--;
 	}
 	return AGO_SUCCESS;
-}
\ No newline at end of file
+}
+
+/* Separable convolution
+A rank-1 matrix C = v * h' is applied as a row pass with h followed by a column pass with v, which is
+O(M+N) instead of O(M*N) per pixel. When all coefficients are equal (box filter) the row and column passes
+are running sums, so the cost per pixel does not depend on the filter size.
+The factors are integers, so the result is bit-exact with the direct summation: intermediate sums are
+accumulated with 32-bit wrap-around arithmetic, which is exact as long as the final sum fits in 32 bits.
+*/
+#define CONVSEP_MIN_PIXELS_PER_THREAD  16384
+
+static vx_int32 ConvSepGcd(vx_int32 a, vx_int32 b)
+{
+	while (b) {
+		vx_int32 t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+
+vx_bool HafCpu_FactorizeConvolution
+	(
+		ago_separable_conv_t * filter,
+		const vx_int16       * convMatrix,
+		vx_uint32              convolutionWidth,
+		vx_uint32              convolutionHeight
+	)
+{
+	vx_uint32 M = convolutionWidth, N = convolutionHeight;
+	if (!filter || !convMatrix || M > AGO_MAX_CONVOLUTION_DIM || N > AGO_MAX_CONVOLUTION_DIM)
+		return vx_false_e;
+	// re-use the previous factorization if the coefficients did not change since then
+	if (filter->columns == M && filter->rows == N && !memcmp(filter->matrix, convMatrix, M * N * sizeof(vx_int16)))
+		return filter->separable;
+	memcpy(filter->matrix, convMatrix, M * N * sizeof(vx_int16));
+	filter->columns = M;
+	filter->rows = N;
+	filter->separable = vx_false_e;
+	filter->box = vx_false_e;
+	// the first non-zero row divided by the gcd of its elements is the primitive row vector h: every
+	// other row of a rank-1 integer matrix is then an integer multiple of h
+	vx_int32 h[AGO_MAX_CONVOLUTION_DIM], v[AGO_MAX_CONVOLUTION_DIM];
+	vx_int32 g = 0;
+	vx_uint32 pivot = 0;
+	for (; pivot < N && !g; pivot++) {
+		for (vx_uint32 j = 0; j < M; j++)
+			g = ConvSepGcd(g, abs((vx_int32)convMatrix[pivot * M + j]));
+	}
+	if (!g)
+		return vx_false_e;
+	pivot--;
+	for (vx_uint32 j = 0; j < M; j++)
+		h[j] = (vx_int32)convMatrix[pivot * M + j] / g;
+	// the first non-zero element of h gives the multiple of h in every row
+	vx_uint32 k = 0;
+	while (!h[k])
+		k++;
+	for (vx_uint32 i = 0; i < N; i++) {
+		const vx_int16 * row = convMatrix + i * M;
+		if (row[k] % h[k])
+			return vx_false_e;
+		v[i] = row[k] / h[k];
+		for (vx_uint32 j = 0; j < M; j++) {
+			if ((vx_int32)row[j] != v[i] * h[j])
+				return vx_false_e;
+		}
+	}
+	// the matrix is applied flipped (true convolution)
+	bool box = true;
+	for (vx_uint32 j = 0; j < M; j++) {
+		filter->rowCoef[j] = h[M - 1 - j];
+		box = box && (h[j] == h[0]);
+	}
+	for (vx_uint32 i = 0; i < N; i++) {
+		filter->colCoef[i] = v[N - 1 - i];
+		box = box && (v[i] == v[0]);
+	}
+	filter->separable = vx_true_e;
+	filter->box = box ? vx_true_e : vx_false_e;
+	return vx_true_e;
+}
+
+// row pass: pDst[x] = sum_j rowCoef[j] * pSrc[x - M/2 + j], with replicated pixels beyond the row ends
+static void ConvSepRow
+	(
+		vx_int32       * pDst,
+		const vx_uint8 * pSrc,
+		vx_int32         width,
+		const ago_separable_conv_t * filter,
+		const __m128i  * coefPairs
+	)
+{
+	vx_int32 M = (vx_int32)filter->columns, m = M >> 1;
+	if (filter->box) {
+		// running sum over the window
+		vx_int32 sum = 0;
+		for (vx_int32 j = -m; j <= m; j++)
+			sum += pSrc[std::min(std::max(j, 0), width - 1)];
+		pDst[0] = sum;
+		for (vx_int32 x = 1; x < width; x++) {
+			sum += (vx_int32)pSrc[std::min(x + m, width - 1)] - (vx_int32)pSrc[std::max(x - m - 1, 0)];
+			pDst[x] = sum;
+		}
+		return;
+	}
+	vx_int32 x = 0;
+	for (; x < std::min(m, width); x++) {
+		vx_int32 sum = 0;
+		for (vx_int32 j = 0; j < M; j++)
+			sum += filter->rowCoef[j] * (vx_int32)pSrc[std::min(std::max(x - m + j, 0), width - 1)];
+		pDst[x] = sum;
+	}
+	// two taps per madd: every row pass sum fits in 32 bits (9 * 255 * 32767)
+	__m128i zero = _mm_setzero_si128();
+	for (; x + 8 <= width - m; x += 8) {
+		const vx_uint8 * pLocalSrc = pSrc + x - m;
+		__m128i sum0 = _mm_setzero_si128();
+		__m128i sum1 = _mm_setzero_si128();
+		for (vx_int32 j = 0; j < M; j += 2) {
+			__m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(pLocalSrc + j)));
+			__m128i b = (j + 1 < M) ? _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(pLocalSrc + j + 1))) : zero;
+			sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), coefPairs[j >> 1]));
+			sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), coefPairs[j >> 1]));
+		}
+		_mm_storeu_si128((__m128i *)(pDst + x), sum0);
+		_mm_storeu_si128((__m128i *)(pDst + x + 4), sum1);
+	}
+	for (; x < width; x++) {
+		vx_int32 sum = 0;
+		for (vx_int32 j = 0; j < M; j++)
+			sum += filter->rowCoef[j] * (vx_int32)pSrc[std::min(std::max(x - m + j, 0), width - 1)];
+		pDst[x] = sum;
+	}
+}
+
+static inline void ConvSepStore(vx_uint8 * pDst, __m128i r0, __m128i r1)
+{
+	_mm_storel_epi64((__m128i *)pDst, _mm_packus_epi16(_mm_packs_epi32(r0, r1), r0));
+}
+
+static inline void ConvSepStore(vx_int16 * pDst, __m128i r0, __m128i r1)
+{
+	_mm_storeu_si128((__m128i *)pDst, _mm_packs_epi32(r0, r1));
+}
+
+static inline void ConvSepStorePixel(vx_uint8 * pDst, vx_int32 value)
+{
+	*pDst = (vx_uint8)std::min(std::max(value, 0), UCHAR_MAX);
+}
+
+static inline void ConvSepStorePixel(vx_int16 * pDst, vx_int32 value)
+{
+	*pDst = (vx_int16)std::min(std::max(value, SHRT_MIN), SHRT_MAX);
+}
+
+template <typename T>
+static int ConvolveSeparable
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		T           * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		const ago_separable_conv_t * filter,
+		vx_int32      shift
+	)
+{
+	vx_int32 width = (vx_int32)dstWidth;
+	vx_int32 N = (vx_int32)filter->rows, n = N >> 1;
+	bool box = filter->box ? true : false;
+	// coefficient pairs of the row pass and the constant weight of a box filter
+	__m128i coefPairs[(AGO_MAX_CONVOLUTION_DIM + 1) >> 1];
+	for (vx_int32 j = 0; j < (vx_int32)filter->columns; j += 2) {
+		vx_int32 c1 = (j + 1 < (vx_int32)filter->columns) ? filter->rowCoef[j + 1] : 0;
+		coefPairs[j >> 1] = _mm_set1_epi32((vx_int32)(((vx_uint32)c1 << 16) | ((vx_uint32)filter->rowCoef[j] & 0xffff)));
+	}
+	vx_int32 boxWeight = filter->rowCoef[0] * filter->colCoef[0];
+	vx_uint32 minRowsPerThread = std::max((vx_uint32)N, (vx_uint32)CONVSEP_MIN_PIXELS_PER_THREAD / std::max(1u, dstWidth));
+	HafCpu_ParallelFor(dstHeight, minRowsPerThread, [&](vx_uint32 begin, vx_uint32 end) {
+		// ring of the row pass results of the last N source rows; row r is kept in slot (r + n) % N
+		std::vector<vx_int32> ringBuf(N * width + width);
+		vx_int32 * ring = ringBuf.data();
+		vx_int32 * colSum = ring + N * width;
+		__m128i vshift = _mm_cvtsi32_si128(shift);
+		for (vx_int32 r = (vx_int32)begin - n; r < (vx_int32)begin + n; r++)
+			ConvSepRow(ring + ((r + n) % N) * width, pSrcImage + (intptr_t)r * srcImageStrideInBytes, width, filter, coefPairs);
+		if (box) {
+			memset(colSum, 0, width * sizeof(vx_int32));
+			for (vx_int32 r = (vx_int32)begin - n; r < (vx_int32)begin + n; r++) {
+				const vx_int32 * pRow = ring + ((r + n) % N) * width;
+				for (vx_int32 x = 0; x < width; x++)
+					colSum[x] += pRow[x];
+			}
+		}
+		for (vx_int32 y = (vx_int32)begin; y < (vx_int32)end; y++) {
+			// row pass on the new source row; for box filters it replaces the oldest row in the running column sum
+			vx_int32 * pNew = ring + ((y + n + n) % N) * width;
+			vx_int32 x = 0;
+			if (box && y > (vx_int32)begin) {
+				for (x = 0; x + 4 <= width; x += 4)
+					_mm_storeu_si128((__m128i *)(colSum + x), _mm_sub_epi32(_mm_loadu_si128((__m128i *)(colSum + x)), _mm_loadu_si128((__m128i *)(pNew + x))));
+				for (; x < width; x++)
+					colSum[x] -= pNew[x];
+			}
+			ConvSepRow(pNew, pSrcImage + (intptr_t)(y + n) * srcImageStrideInBytes, width, filter, coefPairs);
+			T * pDst = (T *)((vx_uint8 *)pDstImage + (size_t)y * dstImageStrideInBytes);
+			if (box) {
+				__m128i vweight = _mm_set1_epi32(boxWeight);
+				for (x = 0; x + 8 <= width; x += 8) {
+					__m128i s0 = _mm_add_epi32(_mm_loadu_si128((__m128i *)(colSum + x)), _mm_loadu_si128((__m128i *)(pNew + x)));
+					__m128i s1 = _mm_add_epi32(_mm_loadu_si128((__m128i *)(colSum + x + 4)), _mm_loadu_si128((__m128i *)(pNew + x + 4)));
+					_mm_storeu_si128((__m128i *)(colSum + x), s0);
+					_mm_storeu_si128((__m128i *)(colSum + x + 4), s1);
+					s0 = _mm_sra_epi32(_mm_mullo_epi32(s0, vweight), vshift);
+					s1 = _mm_sra_epi32(_mm_mullo_epi32(s1, vweight), vshift);
+					ConvSepStore(pDst + x, s0, s1);
+				}
+				for (; x < width; x++) {
+					colSum[x] += pNew[x];
+					ConvSepStorePixel(pDst + x, (colSum[x] * boxWeight) >> shift);
+				}
+			}
+			else {
+				const vx_int32 * pRows[AGO_MAX_CONVOLUTION_DIM];
+				for (vx_int32 i = 0; i < N; i++)
+					pRows[i] = ring + ((y + i) % N) * width;
+				for (x = 0; x + 8 <= width; x += 8) {
+					__m128i s0 = _mm_setzero_si128();
+					__m128i s1 = _mm_setzero_si128();
+					for (vx_int32 i = 0; i < N; i++) {
+						__m128i c = _mm_set1_epi32(filter->colCoef[i]);
+						s0 = _mm_add_epi32(s0, _mm_mullo_epi32(_mm_loadu_si128((__m128i *)(pRows[i] + x)), c));
+						s1 = _mm_add_epi32(s1, _mm_mullo_epi32(_mm_loadu_si128((__m128i *)(pRows[i] + x + 4)), c));
+					}
+					ConvSepStore(pDst + x, _mm_sra_epi32(s0, vshift), _mm_sra_epi32(s1, vshift));
+				}
+				for (; x < width; x++) {
+					vx_uint32 sum = 0;
+					for (vx_int32 i = 0; i < N; i++)
+						sum += (vx_uint32)pRows[i][x] * (vx_uint32)filter->colCoef[i];
+					ConvSepStorePixel(pDst + x, (vx_int32)sum >> shift);
+				}
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+int HafCpu_ConvolveSeparable_U8_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_uint8    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		const ago_separable_conv_t * filter,
+		vx_int32      shift
+	)
+{
+	return ConvolveSeparable<vx_uint8>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes, filter, shift);
+}
+
+int HafCpu_ConvolveSeparable_S16_U8
+	(
+		vx_uint32     dstWidth,
+		vx_uint32     dstHeight,
+		vx_int16    * pDstImage,
+		vx_uint32     dstImageStrideInBytes,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		const ago_separable_conv_t * filter,
+		vx_int32      shift
+	)
+{
+	return ConvolveSeparable<vx_int16>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, pSrcImage, srcImageStrideInBytes, filter, shift);
+}
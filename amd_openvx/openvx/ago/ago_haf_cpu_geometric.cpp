@@ -2830,3 +2830,1004 @@ int HafCpu_ScaleGaussianHalf_U8_U8_3x3
 	}
 	return AGO_SUCCESS;
 }
+
+//=======================================
+// Multi-channel and 16-bit remap, warp and scale
+//=======================================
+// The source location of every destination pixel is computed once per pixel (integer for
+// nearest neighbor, GEOM_FRAC_BITS fixed-point for bilinear) and all channels of the pixel
+// are gathered and interpolated together. Bilinear interpolation blends the two taps of
+// each row with rounding first and then the two rows. Destination pixels whose location
+// falls outside of the source image are set to zero; the scale functions clamp instead.
+#define GEOM_FRAC_BITS                  8
+#define GEOM_FRAC_ONE                   (1 << GEOM_FRAC_BITS)
+#define GEOM_SPAN_PIXELS              256 // destination pixels per coordinate pass
+#define GEOM_MIN_PIXELS_PER_THREAD  16384
+#define GEOM_INVALID                   -1 // x-coordinate of a destination pixel without a source location
+
+struct GeomSource {
+	const vx_uint8 * ptr;
+	vx_uint32 stride;
+	vx_uint32 width;
+	vx_uint32 height;
+};
+
+static inline void GeomSetCoord(vx_float32 xf, vx_float32 yf, vx_float32 srcWidth, vx_float32 srcHeight, bool nearest, vx_int32& sx, vx_int32& sy)
+{
+	if (nearest) {
+		bool valid = (xf >= 0.0f) && (xf < srcWidth) && (yf >= 0.0f) && (yf < srcHeight);
+		sx = valid ? (vx_int32)xf : GEOM_INVALID;
+		sy = valid ? (vx_int32)yf : 0;
+	}
+	else {
+		bool valid = (xf >= 0.0f) && (xf <= srcWidth - 1.0f) && (yf >= 0.0f) && (yf <= srcHeight - 1.0f);
+		sx = valid ? (vx_int32)(xf * (vx_float32)GEOM_FRAC_ONE + 0.5f) : GEOM_INVALID;
+		sy = valid ? (vx_int32)(yf * (vx_float32)GEOM_FRAC_ONE + 0.5f) : 0;
+	}
+}
+
+// source locations from a remap table with remap_fractional_bits fixed-point entries
+struct GeomRemapCoords {
+	const vx_uint8 * map;
+	vx_uint32 mapStride;
+	vx_uint32 fracBits;
+	vx_uint32 srcWidth;
+	vx_uint32 srcHeight;
+	bool nearest;
+	void operator()(vx_uint32 x, vx_uint32 y, vx_uint32 count, vx_int32 * sx, vx_int32 * sy) const
+	{
+		const ago_coord2d_ushort_t * pMap = (const ago_coord2d_ushort_t *)(map + y * mapStride) + x;
+		vx_uint32 half = (1 << fracBits) >> 1;
+		for (vx_uint32 i = 0; i < count; i++) {
+			vx_uint32 mx = pMap[i].x, my = pMap[i].y;
+			vx_uint32 ix = nearest ? ((mx + half) >> fracBits) : (mx >> fracBits);
+			vx_uint32 iy = nearest ? ((my + half) >> fracBits) : (my >> fracBits);
+			bool valid = !(mx == AGO_REMAP_CONSTANT_BORDER_VALUE && my == AGO_REMAP_CONSTANT_BORDER_VALUE) && ix < srcWidth && iy < srcHeight;
+			sx[i] = !valid ? GEOM_INVALID : nearest ? (vx_int32)ix : (vx_int32)(mx << (GEOM_FRAC_BITS - fracBits));
+			sy[i] = !valid ? 0 : nearest ? (vx_int32)iy : (vx_int32)(my << (GEOM_FRAC_BITS - fracBits));
+		}
+	}
+};
+
+struct GeomAffineCoords {
+	const ago_affine_matrix_t * matrix;
+	vx_float32 srcWidth;
+	vx_float32 srcHeight;
+	bool nearest;
+	void operator()(vx_uint32 x, vx_uint32 y, vx_uint32 count, vx_int32 * sx, vx_int32 * sy) const
+	{
+		const vx_float32 (*m)[2] = matrix->matrix;
+		vx_float32 x0 = m[1][0] * (vx_float32)y + m[2][0];
+		vx_float32 y0 = m[1][1] * (vx_float32)y + m[2][1];
+		for (vx_uint32 i = 0; i < count; i++) {
+			vx_float32 dx = (vx_float32)(x + i);
+			GeomSetCoord(m[0][0] * dx + x0, m[0][1] * dx + y0, srcWidth, srcHeight, nearest, sx[i], sy[i]);
+		}
+	}
+};
+
+struct GeomPerspectiveCoords {
+	const ago_perspective_matrix_t * matrix;
+	vx_float32 srcWidth;
+	vx_float32 srcHeight;
+	bool nearest;
+	void operator()(vx_uint32 x, vx_uint32 y, vx_uint32 count, vx_int32 * sx, vx_int32 * sy) const
+	{
+		const vx_float32 (*m)[3] = matrix->matrix;
+		vx_float32 x0 = m[1][0] * (vx_float32)y + m[2][0];
+		vx_float32 y0 = m[1][1] * (vx_float32)y + m[2][1];
+		vx_float32 z0 = m[1][2] * (vx_float32)y + m[2][2];
+		for (vx_uint32 i = 0; i < count; i++) {
+			vx_float32 dx = (vx_float32)(x + i);
+			vx_float32 z = m[0][2] * dx + z0;
+			vx_float32 rz = (z != 0.0f) ? 1.0f / z : 0.0f;
+			vx_float32 xf = (z != 0.0f) ? (m[0][0] * dx + x0) * rz : -1.0f;
+			GeomSetCoord(xf, (m[0][1] * dx + y0) * rz, srcWidth, srcHeight, nearest, sx[i], sy[i]);
+		}
+	}
+};
+
+// x-coordinates of the scaled image are the same for every row, so they are computed once into pXMap
+struct GeomScaleCoords {
+	const vx_int32 * pXMap;
+	const ago_scale_matrix_t * matrix;
+	vx_uint32 srcHeight;
+	bool nearest;
+	void operator()(vx_uint32 x, vx_uint32 y, vx_uint32 count, vx_int32 * sx, vx_int32 * sy) const
+	{
+		vx_int32 iy = GeomScaleCoord(y, matrix->yscale, matrix->yoffset, srcHeight, nearest);
+		memcpy(sx, pXMap + x, count * sizeof(vx_int32));
+		for (vx_uint32 i = 0; i < count; i++)
+			sy[i] = iy;
+	}
+	static vx_int32 GeomScaleCoord(vx_uint32 d, vx_float32 scale, vx_float32 offset, vx_uint32 srcSize, bool nearest)
+	{
+		if (nearest) {
+			vx_int32 s = (vx_int32)(((vx_float32)d + 0.5f) * scale);
+			return std::min(s, (vx_int32)srcSize - 1);
+		}
+		vx_float32 f = (vx_float32)d * scale + offset;
+		f = std::min(std::max(f, 0.0f), (vx_float32)(srcSize - 1));
+		return (vx_int32)(f * (vx_float32)GEOM_FRAC_ONE + 0.5f);
+	}
+};
+
+// copy the nearest source pixel (the first DstBytes of a SrcBytes pixel)
+template <int SrcBytes, int DstBytes>
+struct GeomNearest {
+	enum { DstPixelBytes = DstBytes };
+	static void Sample(const GeomSource& src, vx_uint8 * pDst, vx_uint32 count, const vx_int32 * sx, const vx_int32 * sy)
+	{
+		for (vx_uint32 i = 0; i < count; i++, pDst += DstBytes) {
+			if (sx[i] == GEOM_INVALID)
+				memset(pDst, 0, DstBytes);
+			else
+				memcpy(pDst, src.ptr + (size_t)sy[i] * src.stride + sx[i] * SrcBytes, DstBytes);
+		}
+	}
+};
+
+// bilinear interpolation of pixels with C channels of type T, one pixel at a time
+template <typename T, int SrcC, int DstC>
+static void GeomBilinearScalar(const GeomSource& src, vx_uint8 * pDst, vx_uint32 count, const vx_int32 * sx, const vx_int32 * sy)
+{
+	const vx_int32 round = GEOM_FRAC_ONE >> 1;
+	for (vx_uint32 i = 0; i < count; i++) {
+		T * dst = (T *)pDst + i * DstC;
+		if (sx[i] == GEOM_INVALID) {
+			for (int c = 0; c < DstC; c++)
+				dst[c] = 0;
+			continue;
+		}
+		vx_uint32 x0 = sx[i] >> GEOM_FRAC_BITS, y0 = sy[i] >> GEOM_FRAC_BITS;
+		vx_int32 fx = sx[i] & (GEOM_FRAC_ONE - 1), fy = sy[i] & (GEOM_FRAC_ONE - 1);
+		const T * p0 = (const T *)(src.ptr + (size_t)y0 * src.stride) + x0 * SrcC;
+		const T * p1 = (y0 + 1 < src.height) ? (const T *)((const vx_uint8 *)p0 + src.stride) : p0;
+		vx_uint32 dx = (x0 + 1 < src.width) ? SrcC : 0;
+		for (int c = 0; c < DstC; c++) {
+			vx_int32 h0 = ((vx_int32)p0[c] * (GEOM_FRAC_ONE - fx) + (vx_int32)p0[c + dx] * fx + round) >> GEOM_FRAC_BITS;
+			vx_int32 h1 = ((vx_int32)p1[c] * (GEOM_FRAC_ONE - fx) + (vx_int32)p1[c + dx] * fx + round) >> GEOM_FRAC_BITS;
+			dst[c] = (T)((h0 * (GEOM_FRAC_ONE - fy) + h1 * fy + round) >> GEOM_FRAC_BITS);
+		}
+	}
+}
+
+// returns the two taps of a row of an RGB/RGBX pixel as 2 x 4 bytes
+template <int SrcC>
+static inline __m128i GeomLoadTapPair_U8(const vx_uint8 * p)
+{
+	if (SrcC == 4)
+		return _mm_loadl_epi64((const __m128i *)p);
+	// RGB: two 32-bit loads that stay within the 6 bytes of the taps
+	__m128i t0 = _mm_cvtsi32_si128(*(const int *)p);
+	__m128i t1 = _mm_srli_epi32(_mm_cvtsi32_si128(*(const int *)(p + 2)), 8);
+	return _mm_unpacklo_epi32(t0, t1);
+}
+
+// returns the 2x2 taps of the pixel (row y0 in the low 8 bytes, row y0+1 in the high 8 bytes) and the
+// blend weights as 16-bit pairs; a location on the last column/row gives full weight to the second tap
+template <int SrcC>
+static inline __m128i GeomLoadTaps_U8(const GeomSource& src, vx_int32 sx, vx_int32 sy, vx_int32& wx, vx_int32& wy)
+{
+	vx_uint32 x0 = sx >> GEOM_FRAC_BITS, y0 = sy >> GEOM_FRAC_BITS;
+	vx_int32 fx = sx & (GEOM_FRAC_ONE - 1), fy = sy & (GEOM_FRAC_ONE - 1);
+	if (x0 >= src.width - 1) { x0 = src.width - 2; fx = GEOM_FRAC_ONE; }
+	if (y0 >= src.height - 1) { y0 = src.height - 2; fy = GEOM_FRAC_ONE; }
+	wx = (fx << 16) | (GEOM_FRAC_ONE - fx);
+	wy = (fy << 16) | (GEOM_FRAC_ONE - fy);
+	const vx_uint8 * p = src.ptr + (size_t)y0 * src.stride + x0 * SrcC;
+	return _mm_unpacklo_epi64(GeomLoadTapPair_U8<SrcC>(p), GeomLoadTapPair_U8<SrcC>(p + src.stride));
+}
+
+template <int DstC>
+static inline void GeomStorePixel_U8(vx_uint8 * pDst, vx_uint32 pixel, bool last)
+{
+	if (DstC == 4 || !last) {
+		// an RGB pixel is written as 4 bytes when the next pixel is written after it
+		*(vx_uint32 *)pDst = pixel;
+	}
+	else {
+		*(vx_uint16 *)pDst = (vx_uint16)pixel;
+		pDst[2] = (vx_uint8)(pixel >> 16);
+	}
+}
+
+// bilinear interpolation of RGB/RGBX pixels: all four channels of a pixel are blended in one register
+template <int SrcC, int DstC>
+struct GeomBilinear_U8 {
+	enum { DstPixelBytes = DstC };
+	static void Sample(const GeomSource& src, vx_uint8 * pDst, vx_uint32 count, const vx_int32 * sx, const vx_int32 * sy)
+	{
+		if (src.width < 2 || src.height < 2) {
+			GeomBilinearScalar<vx_uint8, SrcC, DstC>(src, pDst, count, sx, sy);
+			return;
+		}
+		vx_uint32 i = 0;
+		vx_int32 wx0, wy0;
+		const __m128i round = _mm_set1_epi32(GEOM_FRAC_ONE >> 1);
+		const __m128i zero = _mm_setzero_si128();
+		for (; i < count; i++) {
+			if (sx[i] == GEOM_INVALID) {
+				GeomStorePixel_U8<DstC>(pDst + i * DstC, 0, i + 1 == count);
+				continue;
+			}
+			__m128i taps = GeomLoadTaps_U8<SrcC>(src, sx[i], sy[i], wx0, wy0);
+			__m128i wx = _mm_set1_epi32(wx0);
+			__m128i wy = _mm_set1_epi32(wy0);
+			// blend the taps of each row: pair up the two taps of every channel
+			__m128i r0 = _mm_unpacklo_epi8(taps, zero);
+			__m128i r1 = _mm_unpackhi_epi8(taps, zero);
+			__m128i h0 = _mm_madd_epi16(_mm_unpacklo_epi16(r0, _mm_srli_si128(r0, 8)), wx);
+			__m128i h1 = _mm_madd_epi16(_mm_unpacklo_epi16(r1, _mm_srli_si128(r1, 8)), wx);
+			h0 = _mm_srai_epi32(_mm_add_epi32(h0, round), GEOM_FRAC_BITS);
+			h1 = _mm_srai_epi32(_mm_add_epi32(h1, round), GEOM_FRAC_BITS);
+			// blend the two rows
+			__m128i v = _mm_madd_epi16(_mm_or_si128(h0, _mm_slli_epi32(h1, 16)), wy);
+			v = _mm_srai_epi32(_mm_add_epi32(v, round), GEOM_FRAC_BITS);
+			v = _mm_packs_epi32(v, v);
+			v = _mm_packus_epi16(v, v);
+			GeomStorePixel_U8<DstC>(pDst + i * DstC, (vx_uint32)_mm_cvtsi128_si32(v), i + 1 == count);
+		}
+	}
+};
+
+// The library is built for SSE4.2: the AVX2 code paths are compiled with this target attribute
+// and selected at run time with agoIsCpuAvx2Supported().
+#if _WIN32
+#define GEOM_TARGET_AVX2
+#else
+#define GEOM_TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+// bilinear interpolation of 8 U16/S16 pixels at a time: both taps of a row are fetched with one 32-bit gather;
+// returns the number of pixels done
+template <typename T>
+GEOM_TARGET_AVX2
+static vx_uint32 GeomBilinear_16_AVX2(const GeomSource& src, vx_uint8 * pDst, vx_uint32 count, const vx_int32 * sx, const vx_int32 * sy)
+{
+	vx_uint32 i = 0;
+	const __m256i invalid = _mm256_set1_epi32(GEOM_INVALID);
+	const __m256i fracMask = _mm256_set1_epi32(GEOM_FRAC_ONE - 1);
+	const __m256i one = _mm256_set1_epi32(GEOM_FRAC_ONE);
+	const __m256i round = _mm256_set1_epi32(GEOM_FRAC_ONE >> 1);
+	const __m256i lastX = _mm256_set1_epi32((int)src.width - 2);
+	const __m256i lastY = _mm256_set1_epi32((int)src.height - 2);
+	const __m256i stride = _mm256_set1_epi32((int)src.stride);
+	const int * p0 = (const int *)src.ptr;
+	const int * p1 = (const int *)(src.ptr + src.stride);
+	for (; i + 8 <= count; i += 8) {
+		__m256i vx = _mm256_loadu_si256((const __m256i *)(sx + i));
+		__m256i vy = _mm256_loadu_si256((const __m256i *)(sy + i));
+		__m256i mask = _mm256_cmpeq_epi32(vx, invalid);
+		vx = _mm256_andnot_si256(mask, vx);
+		__m256i x0 = _mm256_srai_epi32(vx, GEOM_FRAC_BITS), fx = _mm256_and_si256(vx, fracMask);
+		__m256i y0 = _mm256_srai_epi32(vy, GEOM_FRAC_BITS), fy = _mm256_and_si256(vy, fracMask);
+		fx = _mm256_blendv_epi8(fx, one, _mm256_cmpgt_epi32(x0, lastX));
+		fy = _mm256_blendv_epi8(fy, one, _mm256_cmpgt_epi32(y0, lastY));
+		x0 = _mm256_min_epi32(x0, lastX);
+		y0 = _mm256_min_epi32(y0, lastY);
+		__m256i offset = _mm256_add_epi32(_mm256_mullo_epi32(y0, stride), _mm256_slli_epi32(x0, 1));
+		__m256i t0 = _mm256_i32gather_epi32(p0, offset, 1);
+		__m256i t1 = _mm256_i32gather_epi32(p1, offset, 1);
+		__m256i a0, a1, b0, b1;
+		if ((T)-1 < 0) {
+			a0 = _mm256_srai_epi32(_mm256_slli_epi32(t0, 16), 16); a1 = _mm256_srai_epi32(t0, 16);
+			b0 = _mm256_srai_epi32(_mm256_slli_epi32(t1, 16), 16); b1 = _mm256_srai_epi32(t1, 16);
+		}
+		else {
+			a0 = _mm256_srli_epi32(_mm256_slli_epi32(t0, 16), 16); a1 = _mm256_srli_epi32(t0, 16);
+			b0 = _mm256_srli_epi32(_mm256_slli_epi32(t1, 16), 16); b1 = _mm256_srli_epi32(t1, 16);
+		}
+		__m256i gx = _mm256_sub_epi32(one, fx), gy = _mm256_sub_epi32(one, fy);
+		__m256i h0 = _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(a0, gx), _mm256_mullo_epi32(a1, fx)), round);
+		__m256i h1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(b0, gx), _mm256_mullo_epi32(b1, fx)), round);
+		h0 = _mm256_srai_epi32(h0, GEOM_FRAC_BITS);
+		h1 = _mm256_srai_epi32(h1, GEOM_FRAC_BITS);
+		__m256i v = _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(h0, gy), _mm256_mullo_epi32(h1, fy)), round);
+		v = _mm256_andnot_si256(mask, _mm256_srai_epi32(v, GEOM_FRAC_BITS));
+		v = ((T)-1 < 0) ? _mm256_packs_epi32(v, v) : _mm256_packus_epi32(v, v);
+		v = _mm256_permute4x64_epi64(v, 0x08);
+		_mm_storeu_si128((__m128i *)(pDst + i * 2), _mm256_castsi256_si128(v));
+	}
+	return i;
+}
+
+// bilinear interpolation of U16/S16 pixels
+template <typename T>
+struct GeomBilinear_16 {
+	enum { DstPixelBytes = 2 };
+	static void Sample(const GeomSource& src, vx_uint8 * pDst, vx_uint32 count, const vx_int32 * sx, const vx_int32 * sy)
+	{
+		vx_uint32 i = 0;
+		if (src.width >= 2 && src.height >= 2 && agoIsCpuAvx2Supported())
+			i = GeomBilinear_16_AVX2<T>(src, pDst, count, sx, sy);
+		GeomBilinearScalar<T, 1, 1>(src, pDst + i * 2, count - i, sx + i, sy + i);
+	}
+};
+
+template <typename Sampler, typename Coords>
+static int GeomTransform
+	(
+		vx_uint32       dstWidth,
+		vx_uint32       dstHeight,
+		vx_uint8      * pDstImage,
+		vx_uint32       dstImageStrideInBytes,
+		vx_uint32       srcWidth,
+		vx_uint32       srcHeight,
+		vx_uint8      * pSrcImage,
+		vx_uint32       srcImageStrideInBytes,
+		const Coords&   coords
+	)
+{
+	GeomSource src = { pSrcImage, srcImageStrideInBytes, srcWidth, srcHeight };
+	vx_uint32 minRowsPerThread = std::max(1u, (vx_uint32)GEOM_MIN_PIXELS_PER_THREAD / std::max(1u, dstWidth));
+	HafCpu_ParallelFor(dstHeight, minRowsPerThread, [&](vx_uint32 begin, vx_uint32 end) {
+		vx_int32 sx[GEOM_SPAN_PIXELS], sy[GEOM_SPAN_PIXELS];
+		for (vx_uint32 y = begin; y < end; y++) {
+			vx_uint8 * pDstRow = pDstImage + (size_t)y * dstImageStrideInBytes;
+			for (vx_uint32 x = 0; x < dstWidth; x += GEOM_SPAN_PIXELS) {
+				vx_uint32 count = std::min((vx_uint32)GEOM_SPAN_PIXELS, dstWidth - x);
+				coords(x, y, count, sx, sy);
+				Sampler::Sample(src, pDstRow + x * Sampler::DstPixelBytes, count, sx, sy);
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+template <typename Sampler>
+static int GeomRemap
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits,
+		bool                   nearest
+	)
+{
+	if (mapFractionalBits > GEOM_FRAC_BITS)
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	GeomRemapCoords coords = { (const vx_uint8 *)pMap, mapStrideInBytes, mapFractionalBits, srcWidth, srcHeight, nearest };
+	return GeomTransform<Sampler>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, coords);
+}
+
+template <typename Sampler>
+static int GeomWarpAffine
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix,
+		bool                  nearest
+	)
+{
+	GeomAffineCoords coords = { matrix, (vx_float32)srcWidth, (vx_float32)srcHeight, nearest };
+	return GeomTransform<Sampler>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, coords);
+}
+
+template <typename Sampler>
+static int GeomWarpPerspective
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix,
+		bool                       nearest
+	)
+{
+	GeomPerspectiveCoords coords = { matrix, (vx_float32)srcWidth, (vx_float32)srcHeight, nearest };
+	return GeomTransform<Sampler>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, coords);
+}
+
+template <typename Sampler>
+static int GeomScaleImage
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData,
+		bool                 nearest
+	)
+{
+	vx_int32 * pXMap = (vx_int32 *)pLocalData;
+	for (vx_uint32 x = 0; x < dstWidth; x++)
+		pXMap[x] = GeomScaleCoords::GeomScaleCoord(x, matrix->xscale, matrix->xoffset, srcWidth, nearest);
+	GeomScaleCoords coords = { pXMap, matrix, srcHeight, nearest };
+	return GeomTransform<Sampler>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, coords);
+}
+
+
+int HafCpu_Remap_U24_U24_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomNearest<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, true);
+}
+
+int HafCpu_Remap_U24_U24_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomBilinear_U8<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, false);
+}
+
+int HafCpu_Remap_U24_U32_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomNearest<4, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, true);
+}
+
+int HafCpu_Remap_U24_U32_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomBilinear_U8<4, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, false);
+}
+
+int HafCpu_Remap_U32_U32_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomNearest<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, true);
+}
+
+int HafCpu_Remap_U32_U32_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomBilinear_U8<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, false);
+}
+
+int HafCpu_Remap_U16_U16_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, true);
+}
+
+int HafCpu_Remap_U16_U16_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomBilinear_16<vx_uint16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, false);
+}
+
+int HafCpu_Remap_S16_S16_Nearest
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, true);
+}
+
+int HafCpu_Remap_S16_S16_Bilinear
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_uint8             * pDstImage,
+		vx_uint32              dstImageStrideInBytes,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		vx_uint8             * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		ago_coord2d_ushort_t * pMap,
+		vx_uint32              mapStrideInBytes,
+		vx_uint32              mapFractionalBits
+	)
+{
+	return GeomRemap<GeomBilinear_16<vx_int16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, pMap, mapStrideInBytes, mapFractionalBits, false);
+}
+
+int HafCpu_WarpAffine_U24_U24_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomNearest<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpAffine_U24_U24_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomBilinear_U8<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_WarpAffine_U32_U32_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomNearest<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpAffine_U32_U32_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomBilinear_U8<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_WarpAffine_U16_U16_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpAffine_U16_U16_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomBilinear_16<vx_uint16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_WarpAffine_S16_S16_Nearest
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpAffine_S16_S16_Bilinear
+	(
+		vx_uint32             dstWidth,
+		vx_uint32             dstHeight,
+		vx_uint8            * pDstImage,
+		vx_uint32             dstImageStrideInBytes,
+		vx_uint32             srcWidth,
+		vx_uint32             srcHeight,
+		vx_uint8            * pSrcImage,
+		vx_uint32             srcImageStrideInBytes,
+		ago_affine_matrix_t * matrix
+	)
+{
+	return GeomWarpAffine<GeomBilinear_16<vx_int16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_WarpPerspective_U24_U24_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomNearest<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpPerspective_U24_U24_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomBilinear_U8<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_WarpPerspective_U32_U32_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomNearest<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpPerspective_U32_U32_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomBilinear_U8<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_WarpPerspective_U16_U16_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpPerspective_U16_U16_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomBilinear_16<vx_uint16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_WarpPerspective_S16_S16_Nearest
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, true);
+}
+
+int HafCpu_WarpPerspective_S16_S16_Bilinear
+	(
+		vx_uint32                  dstWidth,
+		vx_uint32                  dstHeight,
+		vx_uint8                 * pDstImage,
+		vx_uint32                  dstImageStrideInBytes,
+		vx_uint32                  srcWidth,
+		vx_uint32                  srcHeight,
+		vx_uint8                 * pSrcImage,
+		vx_uint32                  srcImageStrideInBytes,
+		ago_perspective_matrix_t * matrix
+	)
+{
+	return GeomWarpPerspective<GeomBilinear_16<vx_int16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, false);
+}
+
+int HafCpu_ScaleImage_U24_U24_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomNearest<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, true);
+}
+
+int HafCpu_ScaleImage_U24_U24_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomBilinear_U8<3, 3>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, false);
+}
+
+int HafCpu_ScaleImage_U32_U32_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomNearest<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, true);
+}
+
+int HafCpu_ScaleImage_U32_U32_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomBilinear_U8<4, 4>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, false);
+}
+
+int HafCpu_ScaleImage_U16_U16_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, true);
+}
+
+int HafCpu_ScaleImage_U16_U16_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomBilinear_16<vx_uint16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, false);
+}
+
+int HafCpu_ScaleImage_S16_S16_Nearest
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomNearest<2, 2>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, true);
+}
+
+int HafCpu_ScaleImage_S16_S16_Bilinear
+	(
+		vx_uint32            dstWidth,
+		vx_uint32            dstHeight,
+		vx_uint8           * pDstImage,
+		vx_uint32            dstImageStrideInBytes,
+		vx_uint32            srcWidth,
+		vx_uint32            srcHeight,
+		vx_uint8           * pSrcImage,
+		vx_uint32            srcImageStrideInBytes,
+		ago_scale_matrix_t * matrix,
+		vx_uint8           * pLocalData
+	)
+{
+	return GeomScaleImage<GeomBilinear_16<vx_int16>>(dstWidth, dstHeight, pDstImage, dstImageStrideInBytes, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, matrix, pLocalData, false);
+}
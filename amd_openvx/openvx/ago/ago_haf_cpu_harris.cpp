@@ -29,50 +29,6 @@ typedef struct {
 	vx_float32 GyGy;
 } ago_harris_Gxy_t;
 
-void insertAtLocation(vx_uint32 listCapacity, vx_keypoint_t * pList, vx_uint32 * cornerCount, vx_keypoint_t itemToBeAdded, vx_uint32 loc)
-{
-	vx_keypoint_t incoming_keypt = itemToBeAdded;
-	vx_keypoint_t temp;
-
-	for (int i = (int)loc; i <= (int)*cornerCount; i++)
-	{
-		temp = pList[i];
-		pList[i] = incoming_keypt;
-		incoming_keypt = temp;
-	}
-
-	*cornerCount = *cornerCount + 1;
-}
-
-void AddToTheSortedKeypointList(vx_uint32 listCapacity, vx_keypoint_t * pList, vx_uint32 * cornerCount, vx_keypoint_t itemToBeAdded)
-{
-	if (*cornerCount == 0)									// Add the item to the head
-	{
-		pList[0] = itemToBeAdded;
-		*cornerCount = 1;
-	}
-	else
-	{
-		if (itemToBeAdded.strength <= pList[*cornerCount - 1].strength)
-		{
-			if (*cornerCount == listCapacity)
-				return;
-			else
-			{
-				pList[*cornerCount] = itemToBeAdded;
-				*cornerCount = *cornerCount + 1;
-			}
-		}
-		else
-		{
-			int idx = 0;
-			while (pList[idx].strength > itemToBeAdded.strength)
-				idx++;
-			insertAtLocation(listCapacity, pList, cornerCount, itemToBeAdded, idx);
-		}
-	}
-}
-
 // Using Separable filter:
 // For Gx:
 //	-1	0	1		-1	0	1		1
@@ -801,6 +757,101 @@ int HafCpu_HarrisScore_HVC_HG3_7x7
 	return AGO_SUCCESS;
 }
 
+#define HARRIS_ROWS_PER_STRIP         32 // rows per strip for parallel candidate collection
+#define KEYPOINTS_MIN_PER_THREAD      256 // minimum number of keypoints to process per thread
+
+// strongest first; ties are ordered by raster position so that the selection is deterministic
+static inline bool KeypointStronger(const vx_keypoint_t& a, const vx_keypoint_t& b)
+{
+	if (a.strength != b.strength) return a.strength > b.strength;
+	if (a.y != b.y) return a.y < b.y;
+	return a.x < b.x;
+}
+
+vx_uint32 HafCpu_SuppressKeypoints_MinDistance
+	(
+		vx_keypoint_t * list,
+		vx_uint32       count,
+		vx_uint32       width,
+		vx_uint32       height,
+		vx_float32      min_distance
+	)
+{
+	vx_int32 radius = (vx_int32)min_distance;
+	if (radius <= 0 || count < 2)
+		return count;
+	vx_int32 radius2 = radius * radius;
+	// bucket the keypoints into cells of radius x radius, so that all neighbors are in the surrounding 3x3 cells;
+	// each cell is sorted strongest first so that the search in a cell stops at the first weaker keypoint
+	vx_int32 cellSize = radius;
+	vx_int32 gridWidth = ((vx_int32)width + cellSize - 1) / cellSize, gridHeight = ((vx_int32)height + cellSize - 1) / cellSize;
+	std::vector<vx_uint32> cellStart((size_t)gridWidth * gridHeight + 1, 0);
+	for (vx_uint32 i = 0; i < count; i++) {
+		cellStart[(list[i].y / cellSize) * gridWidth + (list[i].x / cellSize) + 1]++;
+	}
+	for (size_t c = 1; c < cellStart.size(); c++) {
+		cellStart[c] += cellStart[c - 1];
+	}
+	std::vector<vx_keypoint_t> cells(count);
+	{
+		std::vector<vx_uint32> cellPos(cellStart.begin(), cellStart.end() - 1);
+		for (vx_uint32 i = 0; i < count; i++) {
+			cells[cellPos[(list[i].y / cellSize) * gridWidth + (list[i].x / cellSize)]++] = list[i];
+		}
+	}
+	HafCpu_ParallelFor((vx_uint32)(cellStart.size() - 1), 64, [&](vx_uint32 begin, vx_uint32 end) {
+		for (vx_uint32 c = begin; c < end; c++) {
+			std::sort(cells.begin() + cellStart[c], cells.begin() + cellStart[c + 1], KeypointStronger);
+		}
+	});
+	// a keypoint is kept unless there is a strictly stronger keypoint within min_distance
+	std::vector<vx_uint8> keep(count);
+	HafCpu_ParallelFor(count, KEYPOINTS_MIN_PER_THREAD, [&](vx_uint32 begin, vx_uint32 end) {
+		for (vx_uint32 i = begin; i < end; i++) {
+			const vx_keypoint_t& kp = list[i];
+			vx_int32 cx = kp.x / cellSize, cy = kp.y / cellSize;
+			bool suppressed = false;
+			for (vx_int32 gy = max(cy - 1, 0); gy <= min(cy + 1, gridHeight - 1) && !suppressed; gy++) {
+				for (vx_int32 gx = max(cx - 1, 0); gx <= min(cx + 1, gridWidth - 1) && !suppressed; gx++) {
+					vx_uint32 c = gy * gridWidth + gx;
+					for (vx_uint32 j = cellStart[c]; j < cellStart[c + 1] && cells[j].strength > kp.strength; j++) {
+						vx_int32 dx = cells[j].x - kp.x, dy = cells[j].y - kp.y;
+						if (dx * dx + dy * dy <= radius2) {
+							suppressed = true;
+							break;
+						}
+					}
+				}
+			}
+			keep[i] = suppressed ? 0 : 1;
+		}
+	});
+	vx_uint32 numKept = 0;
+	for (vx_uint32 i = 0; i < count; i++) {
+		if (keep[i])
+			list[numKept++] = list[i];
+	}
+	return numKept;
+}
+
+vx_uint32 HafCpu_PickStrongestKeypoints
+	(
+		vx_uint32       capacity,
+		vx_keypoint_t   dst[],
+		vx_keypoint_t * src,
+		vx_uint32       count
+	)
+{
+	vx_uint32 numPicked = min(capacity, count);
+	if (count > capacity) {
+		// partial selection: only the picked keypoints need to be sorted
+		std::nth_element(src, src + numPicked, src + count, KeypointStronger);
+	}
+	std::sort(src, src + numPicked, KeypointStronger);
+	memcpy(dst, src, numPicked * sizeof(vx_keypoint_t));
+	return numPicked;
+}
+
 int HafCpu_HarrisMergeSortAndPick_XY_HVC
 	(
 		vx_uint32         capacityOfDstCorner,
@@ -813,67 +864,42 @@ int HafCpu_HarrisMergeSortAndPick_XY_HVC
 		vx_float32        min_distance
 	)
 {
-	vx_float32      * pLocalSrc;
-	vx_float32      * pSrcVc_NMS = pSrcVc;
-	vx_int32 radius = (vx_int32) min_distance;
-
-	// Non max supression
-	for (vx_int32 y = 0; y < (vx_int32)srcHeight; y++)
-	{
-		pLocalSrc = pSrcVc_NMS;
-		for (vx_int32 x = 0; x < (vx_int32)srcWidth; x++)
-		{
-			vx_float32 Vc = *pLocalSrc;
-			if (Vc)
-			{
-				
-				for (vx_int32 i = max(y - radius, 0); i <= min(y + radius, (vx_int32) srcHeight - 1); i++)
-				{
-					for (vx_int32 j = max(x - radius, 0); j <= min(x + radius, (vx_int32) srcWidth - 1); j++)
-					{
-						if ((vx_float32)((y-i)*(y-i)) + (vx_float32)((x-j)*(x-j)) <= radius*radius)
-						{
-							vx_float32 * neighbor = (vx_float32 *)(((char *)pLocalSrc) + (i - y) * (vx_int32)srcVcStrideInBytes + (j - x) * sizeof(vx_float32));
-							if (*neighbor < Vc)
-								*neighbor = 0;
-						}
+	// collect the candidates of each strip in parallel
+	vx_uint32 numStrips = (srcHeight + HARRIS_ROWS_PER_STRIP - 1) / HARRIS_ROWS_PER_STRIP;
+	std::vector<std::vector<vx_keypoint_t>> stripCandidates(numStrips);
+	HafCpu_ParallelFor(numStrips, 1, [&](vx_uint32 begin, vx_uint32 end) {
+		for (vx_uint32 strip = begin; strip < end; strip++) {
+			std::vector<vx_keypoint_t>& cand = stripCandidates[strip];
+			vx_uint32 yend = min((strip + 1) * HARRIS_ROWS_PER_STRIP, srcHeight);
+			for (vx_uint32 y = strip * HARRIS_ROWS_PER_STRIP; y < yend; y++) {
+				const vx_float32 * pLocalSrc = (const vx_float32 *)((const char *)pSrcVc + (size_t)y * srcVcStrideInBytes);
+				for (vx_uint32 x = 0; x < srcWidth; x++) {
+					if (pLocalSrc[x]) {
+						vx_keypoint_t kp;
+						kp.x = x;
+						kp.y = y;
+						kp.strength = pLocalSrc[x];
+						kp.scale = 0;
+						kp.orientation = 0;
+						kp.error = 0;
+						kp.tracking_status = 1;
+						cand.push_back(kp);
 					}
 				}
 			}
-			pLocalSrc++;
-		}
-
-		pSrcVc_NMS = (vx_float32 *)((char *)pSrcVc_NMS + srcVcStrideInBytes);
-	}	
-
-	// Populate the sorted list
-	vx_keypoint_t cand;
-	vx_uint32 numCorners = 0;
-	
-	for (vx_uint32 y = 0; y < srcHeight; y++)
-	{
-		pLocalSrc = pSrcVc;
-		for (vx_uint32 x = 0; x < srcWidth; x++)
-		{
-			if (*pLocalSrc)
-			{
-				cand.x = x;
-				cand.y = y;
-				cand.strength = *pLocalSrc;
-				cand.scale = 0;
-				cand.orientation = 0;
-				cand.error = 0;
-				cand.tracking_status = 1;
-				if (numCorners < capacityOfDstCorner)
-					AddToTheSortedKeypointList(capacityOfDstCorner, dstCorner, &numCorners, cand);
-				else
-					numCorners++;
-			}
-			pLocalSrc++;
 		}
-		pSrcVc = (vx_float32 *)((char *)pSrcVc + srcVcStrideInBytes);
-	}
-
+	});
+	size_t numCandidates = 0;
+	for (auto& cand : stripCandidates)
+		numCandidates += cand.size();
+	std::vector<vx_keypoint_t> candidates;
+	candidates.reserve(numCandidates);
+	for (auto& cand : stripCandidates)
+		candidates.insert(candidates.end(), cand.begin(), cand.end());
+
+	// min_distance suppression and selection of the strongest corners
+	vx_uint32 numCorners = HafCpu_SuppressKeypoints_MinDistance(candidates.data(), (vx_uint32)candidates.size(), srcWidth, srcHeight, min_distance);
+	HafCpu_PickStrongestKeypoints(capacityOfDstCorner, dstCorner, candidates.data(), numCorners);
 	*pDstCornerCount = numCorners;
 
 	return AGO_SUCCESS;
@@ -513,6 +513,35 @@ static int HafCpu_Histogram16Bins_DATA_U8
 	return AGO_SUCCESS;
 }
 
+// compute the counts of a histogram primitive on horizontal strips in parallel and add up the per-strip counts
+static int HafCpu_HistogramStrips_DATA_U8
+	(
+		vx_uint32     numCounts,
+		vx_uint32     dstCounts[],
+		vx_uint32     srcWidth,
+		vx_uint32     srcHeight,
+		vx_uint8    * pSrcImage,
+		vx_uint32     srcImageStrideInBytes,
+		const std::function<int(vx_uint32 *, vx_uint32, vx_uint8 *)>& countFunc
+	)
+{
+	vx_uint32 numStrips = HafCpu_ReductionStripCount(srcWidth, srcHeight);
+	if (numStrips <= 1)
+		return countFunc(dstCounts, srcHeight, pSrcImage);
+	std::vector<vx_uint32> partCounts(numStrips * numCounts);
+	int status = AGO_SUCCESS;
+	HafCpu_ParallelStrips(numStrips, srcHeight, [&](vx_uint32 strip, vx_uint32 y, vx_uint32 height) {
+		if (countFunc(&partCounts[strip * numCounts], height, pSrcImage + y * srcImageStrideInBytes))
+			status = AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	});
+	for (vx_uint32 i = 0; i < numCounts; i++) {
+		dstCounts[i] = 0;
+		for (vx_uint32 strip = 0; strip < numStrips; strip++)
+			dstCounts[i] += partCounts[strip * numCounts + i];
+	}
+	return status;
+}
+
 int HafCpu_HistogramFixedBins_DATA_U8
 	(
 		vx_uint32     dstHist[],
@@ -530,7 +559,7 @@ int HafCpu_HistogramFixedBins_DATA_U8
 
 	// compute number of split points in [0..255] range to compute the histogram
 	vx_int32 numSplits = (distBinCount - 1) + ((distOffset > 0) ? 1 : 0) + (((distOffset + distRange) < 256) ? 1 : 0);
-	bool useGeneral = (srcWidth & 7) || (((intptr_t)pSrcImage) & 15);			// Use general code if width is not multiple of 8 or the buffer is unaligned
+	bool useGeneral = (srcWidth & 7) || (((intptr_t)pSrcImage) & 15) || (srcImageStrideInBytes & 15);	// Use general code if width is not multiple of 8 or the buffer is unaligned
 	if ((numSplits < 1 && distBinCount > 1) || (distBinCount == 0)) return status;
 
 	if (numSplits <= 3 && !useGeneral) {
@@ -540,7 +569,10 @@ int HafCpu_HistogramFixedBins_DATA_U8
 		}
 		else if (numSplits == 1) {
 			vx_uint32 hist[2];
-			status = HafCpu_Histogram1Threshold_DATA_U8(hist, distOffset ? distOffset : distWindow, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes);
+			vx_uint8 thresh = distOffset ? distOffset : distWindow;
+			status = HafCpu_HistogramStrips_DATA_U8(2, hist, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, [&](vx_uint32 * counts, vx_uint32 height, vx_uint8 * pSrc) {
+				return HafCpu_Histogram1Threshold_DATA_U8(counts, thresh, srcWidth, height, pSrc, srcImageStrideInBytes);
+			});
 			if (distBinCount == 1) {
 				dstHist[0] = hist[distOffset > 0 ? 1 : 0];
 			}
@@ -564,7 +596,9 @@ int HafCpu_HistogramFixedBins_DATA_U8
 					thresh[split++] = tlast;
 			}
 			vx_uint32 count[4];
-			status = HafCpu_Histogram3Thresholds_DATA_U8(count, thresh[0], thresh[1], thresh[2], srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes);
+			status = HafCpu_HistogramStrips_DATA_U8(4, count, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, [&](vx_uint32 * counts, vx_uint32 height, vx_uint8 * pSrc) {
+				return HafCpu_Histogram3Thresholds_DATA_U8(counts, thresh[0], thresh[1], thresh[2], srcWidth, height, pSrc, srcImageStrideInBytes);
+			});
 			if (!status) {
 				for (vx_uint32 i = 0; i < distBinCount; i++) {
 					dstHist[i] = count[i + (distOffset ? 1 : 0)];
@@ -581,7 +615,9 @@ int HafCpu_HistogramFixedBins_DATA_U8
 	// 	status = HafCpu_Histogram9Bins_DATA_U8(dstHist, distOffset, distWindow, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes);
 	// }
 	else if (distBinCount == 16 && numSplits <= 16 && !useGeneral) {
-		status = HafCpu_Histogram16Bins_DATA_U8(dstHist, distOffset, distWindow, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes);
+		status = HafCpu_HistogramStrips_DATA_U8(16, dstHist, srcWidth, srcHeight, pSrcImage, srcImageStrideInBytes, [&](vx_uint32 * counts, vx_uint32 height, vx_uint8 * pSrc) {
+			return HafCpu_Histogram16Bins_DATA_U8(counts, distOffset, distWindow, srcWidth, height, pSrc, srcImageStrideInBytes);
+		});
 	}
 	else {
 		// use general 256-bin histogram
@@ -593,6 +629,7 @@ int HafCpu_HistogramFixedBins_DATA_U8
 				memcpy(dstHist, &histTmp[distOffset], distBinCount * sizeof(vx_uint32));
 			}
 			else {
+				memset(dstHist, 0, distBinCount * sizeof(vx_uint32));
 				for (vx_uint32 i = distOffset; i < (distOffset + distRange); i++) {
 					vx_size index = (i-distOffset) * distBinCount / distRange;
 					dstHist[index] += histTmp[i];
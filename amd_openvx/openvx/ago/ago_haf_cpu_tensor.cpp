@@ -0,0 +1,1270 @@
+/*
+Copyright (c) 2015 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "ago_internal.h"
+
+// The tensor functions walk the tensors as rows of contiguous elements along dims[0]:
+// dimensions that are contiguous in all operands are collapsed into longer rows, and
+// the rows are distributed over the worker threads.
+#define TENSOR_MAX_OPERANDS                 3
+#define TENSOR_MIN_ELEMENTS_PER_THREAD  16384
+#define TENSOR_CHUNK_SIZE                 240 // elements per pass through the float staging buffer (multiple of 3 and 8)
+
+// The library is built for SSE4.2: the AVX2/F16C code paths are compiled with this target attribute
+// and selected at run time with agoIsCpuAvx2Supported().
+#if _WIN32
+#define TENSOR_TARGET_AVX2
+#else
+#define TENSOR_TARGET_AVX2  __attribute__((target("avx2,f16c")))
+#endif
+
+static inline __m128i TensorLoadInt(const void * p) { return _mm_loadu_si128((const __m128i *)p); }
+static inline void TensorStoreInt(void * p, __m128i v) { _mm_storeu_si128((__m128i *)p, v); }
+
+enum TensorBinaryOp {
+	TENSOR_OP_ADD,
+	TENSOR_OP_SUB,
+	TENSOR_OP_MUL,
+};
+
+struct TensorRowLayout {
+	vx_size numDims;
+	vx_size dims[AGO_MAX_TENSOR_DIMENSIONS];
+	vx_size stride[TENSOR_MAX_OPERANDS][AGO_MAX_TENSOR_DIMENSIONS];
+};
+
+static void TensorCollapseDims
+	(
+		TensorRowLayout& layout,
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_uint32        numOperands,
+		const vx_size  * const * stride
+	)
+{
+	layout.numDims = 1;
+	layout.dims[0] = dims[0];
+	for (vx_uint32 k = 0; k < numOperands; k++)
+		layout.stride[k][0] = stride[k][0];
+	for (vx_size i = 1; i < numDims; i++) {
+		if (dims[i] == 1)
+			continue;
+		vx_size last = layout.numDims - 1;
+		bool contiguous = true;
+		for (vx_uint32 k = 0; k < numOperands; k++) {
+			if (stride[k][i] != layout.stride[k][last] * layout.dims[last])
+				contiguous = false;
+		}
+		if (contiguous) {
+			layout.dims[last] *= dims[i];
+		}
+		else {
+			layout.dims[layout.numDims] = dims[i];
+			for (vx_uint32 k = 0; k < numOperands; k++)
+				layout.stride[k][layout.numDims] = stride[k][i];
+			layout.numDims++;
+		}
+	}
+}
+
+static void TensorForEachRow
+	(
+		const TensorRowLayout& layout,
+		vx_uint32              numOperands,
+		vx_uint8             * const * base,
+		const std::function<void(vx_uint8 * const * ptr, vx_size count)>& rowFunc
+	)
+{
+	vx_size numRows = 1;
+	for (vx_size i = 1; i < layout.numDims; i++)
+		numRows *= layout.dims[i];
+	vx_size rowLength = layout.dims[0];
+	vx_uint32 minRowsPerThread = (vx_uint32)std::max<vx_size>(1, TENSOR_MIN_ELEMENTS_PER_THREAD / std::max<vx_size>(rowLength, 1));
+	HafCpu_ParallelFor((vx_uint32)numRows, minRowsPerThread, [&](vx_uint32 begin, vx_uint32 end) {
+		// locate the first row of the sub-range
+		vx_size index[AGO_MAX_TENSOR_DIMENSIONS] = { 0 };
+		vx_uint8 * ptr[TENSOR_MAX_OPERANDS];
+		vx_size row = begin;
+		for (vx_size i = 1; i < layout.numDims; i++) {
+			index[i] = row % layout.dims[i];
+			row /= layout.dims[i];
+		}
+		for (vx_uint32 k = 0; k < numOperands; k++) {
+			ptr[k] = base[k];
+			for (vx_size i = 1; i < layout.numDims; i++)
+				ptr[k] += index[i] * layout.stride[k][i];
+		}
+		for (vx_uint32 r = begin; r < end; r++) {
+			rowFunc(ptr, rowLength);
+			// advance to the next row
+			for (vx_size i = 1; i < layout.numDims; i++) {
+				for (vx_uint32 k = 0; k < numOperands; k++)
+					ptr[k] += layout.stride[k][i];
+				if (++index[i] < layout.dims[i])
+					break;
+				for (vx_uint32 k = 0; k < numOperands; k++)
+					ptr[k] -= layout.dims[i] * layout.stride[k][i];
+				index[i] = 0;
+			}
+		}
+	});
+}
+
+static inline vx_size TensorElemSize(vx_enum type)
+{
+	switch (type) {
+	case VX_TYPE_BOOL:
+	case VX_TYPE_INT8:
+	case VX_TYPE_UINT8:
+		return 1;
+	case VX_TYPE_INT16:
+	case VX_TYPE_UINT16:
+	case VX_TYPE_FLOAT16:
+		return 2;
+	case VX_TYPE_INT32:
+	case VX_TYPE_UINT32:
+	case VX_TYPE_FLOAT32:
+		return 4;
+	case VX_TYPE_INT64:
+		return 8;
+	}
+	return 0;
+}
+
+static inline vx_float32 TensorHalfToFloat(vx_uint16 h)
+{
+	vx_uint32 sign = (vx_uint32)(h & 0x8000) << 16;
+	vx_uint32 exponent = (h >> 10) & 0x1f, mantissa = h & 0x3ff;
+	vx_uint32 x;
+	vx_float32 f;
+	if (exponent == 0) {
+		f = (vx_float32)mantissa * (1.0f / 16777216.0f);
+		memcpy(&x, &f, sizeof(x));
+		x |= sign;
+	}
+	else if (exponent == 31) {
+		x = sign | 0x7f800000 | (mantissa << 13);
+	}
+	else {
+		x = sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+	memcpy(&f, &x, sizeof(f));
+	return f;
+}
+
+static inline vx_uint16 TensorFloatToHalf(vx_float32 f)
+{
+	vx_uint32 x;
+	memcpy(&x, &f, sizeof(x));
+	vx_uint16 sign = (vx_uint16)((x >> 16) & 0x8000);
+	vx_uint32 absx = x & 0x7fffffff;
+	if (absx >= 0x7f800000) // inf and nan
+		return sign | (absx > 0x7f800000 ? 0x7e00 : 0x7c00);
+	if (absx >= 0x477ff000) // rounds to inf
+		return sign | 0x7c00;
+	if (absx < 0x38800000) { // zero and denormals
+		vx_float32 af;
+		memcpy(&af, &absx, sizeof(af));
+		return sign | (vx_uint16)nearbyintf(af * 16777216.0f);
+	}
+	// rebias the exponent and round the mantissa to nearest even
+	absx += 0xfff + ((absx >> 13) & 1);
+	return sign | (vx_uint16)((absx - (112u << 23)) >> 13);
+}
+
+TENSOR_TARGET_AVX2
+static void TensorRowLoadF16_AVX2(vx_float32 * dst, const vx_uint16 * src, vx_size count)
+{
+	vx_size i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i))));
+	for (; i < count; i++)
+		dst[i] = TensorHalfToFloat(src[i]);
+}
+
+TENSOR_TARGET_AVX2
+static void TensorRowStoreF16_AVX2(vx_uint16 * dst, const vx_float32 * src, vx_size count)
+{
+	vx_size i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm_storeu_si128((__m128i *)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+	for (; i < count; i++)
+		dst[i] = TensorFloatToHalf(src[i]);
+}
+
+template <typename T>
+static inline T TensorSaturate(vx_float64 v)
+{
+	if (v <= (vx_float64)std::numeric_limits<T>::lowest()) return std::numeric_limits<T>::lowest();
+	if (v >= (vx_float64)std::numeric_limits<T>::max()) return std::numeric_limits<T>::max();
+	return (T)v;
+}
+
+// convert count elements of the given type into floats
+static void TensorRowLoadF32
+	(
+		vx_float32     * dst,
+		vx_enum          srcType,
+		const vx_uint8 * src,
+		vx_size          count
+	)
+{
+	vx_size i = 0;
+	if (srcType == VX_TYPE_FLOAT32) {
+		memcpy(dst, src, count * sizeof(vx_float32));
+		return;
+	}
+	else if (srcType == VX_TYPE_UINT8) {
+		for (; i + 4 <= count; i += 4) {
+			vx_int32 pixels;
+			memcpy(&pixels, src + i, sizeof(pixels));
+			_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(pixels))));
+		}
+		for (; i < count; i++)
+			dst[i] = (vx_float32)src[i];
+	}
+	else if (srcType == VX_TYPE_INT8) {
+		const vx_int8 * p = (const vx_int8 *)src;
+		for (; i + 4 <= count; i += 4) {
+			vx_int32 pixels;
+			memcpy(&pixels, p + i, sizeof(pixels));
+			_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(pixels))));
+		}
+		for (; i < count; i++)
+			dst[i] = (vx_float32)p[i];
+	}
+	else if (srcType == VX_TYPE_INT16) {
+		const vx_int16 * p = (const vx_int16 *)src;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)(p + i)))));
+		for (; i < count; i++)
+			dst[i] = (vx_float32)p[i];
+	}
+	else if (srcType == VX_TYPE_UINT16) {
+		const vx_uint16 * p = (const vx_uint16 *)src;
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)(p + i)))));
+		for (; i < count; i++)
+			dst[i] = (vx_float32)p[i];
+	}
+	else if (srcType == VX_TYPE_FLOAT16) {
+		const vx_uint16 * p = (const vx_uint16 *)src;
+		if (agoIsCpuAvx2Supported()) {
+			TensorRowLoadF16_AVX2(dst, p, count);
+			return;
+		}
+		for (; i < count; i++)
+			dst[i] = TensorHalfToFloat(p[i]);
+	}
+	else if (srcType == VX_TYPE_INT32) {
+		const vx_int32 * p = (const vx_int32 *)src;
+		for (; i < count; i++)
+			dst[i] = (vx_float32)p[i];
+	}
+	else if (srcType == VX_TYPE_UINT32) {
+		const vx_uint32 * p = (const vx_uint32 *)src;
+		for (; i < count; i++)
+			dst[i] = (vx_float32)p[i];
+	}
+}
+
+// convert count floats into the given type, rounding to nearest even, with saturation or wrap-around
+static void TensorRowStoreF32
+	(
+		vx_uint8         * dst,
+		vx_enum            dstType,
+		const vx_float32 * src,
+		vx_size            count,
+		bool               saturate
+	)
+{
+	vx_size i = 0;
+	if (dstType == VX_TYPE_FLOAT32) {
+		memcpy(dst, src, count * sizeof(vx_float32));
+		return;
+	}
+	else if (dstType == VX_TYPE_UINT8) {
+		__m128 lo = _mm_set1_ps(0.0f), hi = _mm_set1_ps(255.0f);
+		__m128i mask = _mm_set1_epi32(0xff);
+		for (; i + 8 <= count; i += 8) {
+			__m128 f0 = _mm_loadu_ps(src + i), f1 = _mm_loadu_ps(src + i + 4);
+			__m128i i0, i1;
+			if (saturate) {
+				i0 = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(f0, lo), hi));
+				i1 = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(f1, lo), hi));
+			}
+			else {
+				i0 = _mm_and_si128(_mm_cvtps_epi32(f0), mask);
+				i1 = _mm_and_si128(_mm_cvtps_epi32(f1), mask);
+			}
+			_mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(i0, i1), _mm_setzero_si128()));
+		}
+		for (; i < count; i++) {
+			vx_float64 v = nearbyint(src[i]);
+			dst[i] = saturate ? TensorSaturate<vx_uint8>(v) : (vx_uint8)(vx_int64)v;
+		}
+	}
+	else if (dstType == VX_TYPE_INT8) {
+		vx_int8 * p = (vx_int8 *)dst;
+		__m128 lo = _mm_set1_ps(-128.0f), hi = _mm_set1_ps(127.0f);
+		for (; saturate && i + 8 <= count; i += 8) {
+			__m128i i0 = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i), lo), hi));
+			__m128i i1 = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(src + i + 4), lo), hi));
+			_mm_storel_epi64((__m128i *)(p + i), _mm_packs_epi16(_mm_packs_epi32(i0, i1), _mm_setzero_si128()));
+		}
+		for (; i < count; i++) {
+			vx_float64 v = nearbyint(src[i]);
+			p[i] = saturate ? TensorSaturate<vx_int8>(v) : (vx_int8)(vx_int64)v;
+		}
+	}
+	else if (dstType == VX_TYPE_INT16) {
+		vx_int16 * p = (vx_int16 *)dst;
+		__m128 lo = _mm_set1_ps(-32768.0f), hi = _mm_set1_ps(32767.0f);
+		for (; i + 8 <= count; i += 8) {
+			__m128 f0 = _mm_loadu_ps(src + i), f1 = _mm_loadu_ps(src + i + 4);
+			__m128i i0, i1;
+			if (saturate) {
+				i0 = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(f0, lo), hi));
+				i1 = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(f1, lo), hi));
+			}
+			else {
+				// sign-extend the low 16 bits so that the saturating pack keeps them
+				i0 = _mm_srai_epi32(_mm_slli_epi32(_mm_cvtps_epi32(f0), 16), 16);
+				i1 = _mm_srai_epi32(_mm_slli_epi32(_mm_cvtps_epi32(f1), 16), 16);
+			}
+			_mm_storeu_si128((__m128i *)(p + i), _mm_packs_epi32(i0, i1));
+		}
+		for (; i < count; i++) {
+			vx_float64 v = nearbyint(src[i]);
+			p[i] = saturate ? TensorSaturate<vx_int16>(v) : (vx_int16)(vx_int64)v;
+		}
+	}
+	else if (dstType == VX_TYPE_UINT16) {
+		vx_uint16 * p = (vx_uint16 *)dst;
+		for (; i < count; i++) {
+			vx_float64 v = nearbyint(src[i]);
+			p[i] = saturate ? TensorSaturate<vx_uint16>(v) : (vx_uint16)(vx_int64)v;
+		}
+	}
+	else if (dstType == VX_TYPE_FLOAT16) {
+		vx_uint16 * p = (vx_uint16 *)dst;
+		if (agoIsCpuAvx2Supported()) {
+			TensorRowStoreF16_AVX2(p, src, count);
+			return;
+		}
+		for (; i < count; i++)
+			p[i] = TensorFloatToHalf(src[i]);
+	}
+	else if (dstType == VX_TYPE_INT32) {
+		vx_int32 * p = (vx_int32 *)dst;
+		for (; i < count; i++) {
+			vx_float64 v = nearbyint(src[i]);
+			p[i] = saturate ? TensorSaturate<vx_int32>(v) : (vx_int32)(vx_int64)v;
+		}
+	}
+	else if (dstType == VX_TYPE_UINT32) {
+		vx_uint32 * p = (vx_uint32 *)dst;
+		for (; i < count; i++) {
+			vx_float64 v = nearbyint(src[i]);
+			p[i] = saturate ? TensorSaturate<vx_uint32>(v) : (vx_uint32)(vx_int64)v;
+		}
+	}
+}
+
+// buf[i] = buf[i] * scale[i % period] + offset[i % period], where period is 1 or 3 and count is at most TENSOR_CHUNK_SIZE
+static void TensorRowAffineF32
+	(
+		vx_float32       * buf,
+		vx_size            count,
+		const vx_float32 * scale,
+		const vx_float32 * offset,
+		vx_size            period
+	)
+{
+	vx_size i = 0;
+	if (period == 1) {
+		if (scale[0] == 1.0f && offset[0] == 0.0f)
+			return;
+		__m128 vscale = _mm_set1_ps(scale[0]), voffset = _mm_set1_ps(offset[0]);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(buf + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(buf + i), vscale), voffset));
+		for (; i < count; i++)
+			buf[i] = buf[i] * scale[0] + offset[0];
+	}
+	else {
+		// expand the per-channel coefficients to whole vectors
+		vx_float32 scaleRep[TENSOR_CHUNK_SIZE], offsetRep[TENSOR_CHUNK_SIZE];
+		for (vx_size j = 0; j < count; j++) {
+			scaleRep[j] = scale[j % period];
+			offsetRep[j] = offset[j % period];
+		}
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(buf + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(buf + i), _mm_loadu_ps(scaleRep + i)), _mm_loadu_ps(offsetRep + i)));
+		for (; i < count; i++)
+			buf[i] = buf[i] * scaleRep[i] + offsetRep[i];
+	}
+}
+
+// dst = convert(src * scale + offset) with per-element (period 1) or per-channel (period 3, interleaved) coefficients
+static void TensorRowConvert
+	(
+		vx_uint8         * dst,
+		vx_enum            dstType,
+		const vx_uint8   * src,
+		vx_enum            srcType,
+		vx_size            count,
+		const vx_float32 * scale,
+		const vx_float32 * offset,
+		vx_size            period,
+		bool               saturate
+	)
+{
+	vx_size srcElemSize = TensorElemSize(srcType), dstElemSize = TensorElemSize(dstType);
+	vx_float32 buf[TENSOR_CHUNK_SIZE];
+	for (vx_size i = 0; i < count; i += TENSOR_CHUNK_SIZE) {
+		vx_size n = std::min<vx_size>(TENSOR_CHUNK_SIZE, count - i);
+		TensorRowLoadF32(buf, srcType, src + i * srcElemSize, n);
+		TensorRowAffineF32(buf, n, scale, offset, period);
+		TensorRowStoreF32(dst + i * dstElemSize, dstType, buf, n, saturate);
+	}
+}
+
+static void TensorRowBinary_F32
+	(
+		TensorBinaryOp     op,
+		vx_float32       * dst,
+		const vx_float32 * src1,
+		vx_size            inc1,
+		const vx_float32 * src2,
+		vx_size            inc2,
+		vx_size            count,
+		vx_float32         scale
+	)
+{
+	vx_size i = 0;
+	__m128 bcast1 = _mm_set1_ps(src1[0]), bcast2 = _mm_set1_ps(src2[0]), vscale = _mm_set1_ps(scale);
+	for (; i + 4 <= count; i += 4) {
+		__m128 a = inc1 ? _mm_loadu_ps(src1 + i) : bcast1;
+		__m128 b = inc2 ? _mm_loadu_ps(src2 + i) : bcast2;
+		__m128 r;
+		if (op == TENSOR_OP_ADD) r = _mm_add_ps(a, b);
+		else if (op == TENSOR_OP_SUB) r = _mm_sub_ps(a, b);
+		else r = _mm_mul_ps(_mm_mul_ps(a, b), vscale);
+		_mm_storeu_ps(dst + i, r);
+	}
+	for (; i < count; i++) {
+		vx_float32 a = src1[i * inc1], b = src2[i * inc2];
+		dst[i] = (op == TENSOR_OP_ADD) ? a + b : ((op == TENSOR_OP_SUB) ? a - b : a * b * scale);
+	}
+}
+
+template <typename T, TensorBinaryOp OP, bool SAT>
+static inline __m128i TensorVecAddSub(__m128i a, __m128i b)
+{
+	if (sizeof(T) == 2)
+		return OP == TENSOR_OP_ADD ? (SAT ? _mm_adds_epi16(a, b) : _mm_add_epi16(a, b))
+		                           : (SAT ? _mm_subs_epi16(a, b) : _mm_sub_epi16(a, b));
+	else if (std::is_signed<T>::value)
+		return OP == TENSOR_OP_ADD ? (SAT ? _mm_adds_epi8(a, b) : _mm_add_epi8(a, b))
+		                           : (SAT ? _mm_subs_epi8(a, b) : _mm_sub_epi8(a, b));
+	else
+		return OP == TENSOR_OP_ADD ? (SAT ? _mm_adds_epu8(a, b) : _mm_add_epi8(a, b))
+		                           : (SAT ? _mm_subs_epu8(a, b) : _mm_sub_epi8(a, b));
+}
+
+template <typename T, TensorBinaryOp OP, bool SAT>
+static void TensorRowAddSub_Int
+	(
+		T       * dst,
+		const T * src1,
+		vx_size   inc1,
+		const T * src2,
+		vx_size   inc2,
+		vx_size   count
+	)
+{
+	const vx_size lanes = sizeof(__m128i) / sizeof(T);
+	T fill1[sizeof(__m128i) / sizeof(T)], fill2[sizeof(__m128i) / sizeof(T)];
+	for (vx_size j = 0; j < lanes; j++) {
+		fill1[j] = src1[0];
+		fill2[j] = src2[0];
+	}
+	__m128i bcast1 = TensorLoadInt(fill1), bcast2 = TensorLoadInt(fill2);
+	vx_size i = 0;
+	for (; i + lanes <= count; i += lanes) {
+		__m128i a = inc1 ? TensorLoadInt(src1 + i) : bcast1;
+		__m128i b = inc2 ? TensorLoadInt(src2 + i) : bcast2;
+		TensorStoreInt(dst + i, TensorVecAddSub<T, OP, SAT>(a, b));
+	}
+	for (; i < count; i++) {
+		vx_int32 v = (OP == TENSOR_OP_ADD) ? (vx_int32)src1[i * inc1] + (vx_int32)src2[i * inc2] : (vx_int32)src1[i * inc1] - (vx_int32)src2[i * inc2];
+		dst[i] = SAT ? TensorSaturate<T>(v) : (T)v;
+	}
+}
+
+template <typename T>
+static void TensorRowMultiply_Int
+	(
+		T         * dst,
+		const T   * src1,
+		vx_size     inc1,
+		const T   * src2,
+		vx_size     inc2,
+		vx_size     count,
+		vx_float64  scale,
+		bool        saturate,
+		bool        roundToNearestEven
+	)
+{
+	for (vx_size i = 0; i < count; i++) {
+		vx_float64 v = (vx_float64)src1[i * inc1] * (vx_float64)src2[i * inc2] * scale;
+		v = roundToNearestEven ? nearbyint(v) : trunc(v);
+		dst[i] = saturate ? TensorSaturate<T>(v) : (T)(vx_int64)v;
+	}
+}
+
+static int HafCpu_TensorBinary_DATA_DATA_DATA
+	(
+		TensorBinaryOp   op,
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_float32       scale,
+		vx_uint32        fixedPointPos,
+		vx_enum          overflowPolicy,
+		vx_enum          roundingPolicy,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc1,
+		const vx_size  * src1Stride,
+		const vx_uint8 * pSrc2,
+		const vx_size  * src2Stride
+	)
+{
+	bool saturate = (overflowPolicy == VX_CONVERT_POLICY_SATURATE);
+	std::function<void(vx_uint8 * const * ptr, vx_size count)> rowFunc;
+	vx_size elemSize = TensorElemSize(dataType);
+	// a zero stride along the row broadcasts the first element of the row
+	vx_size inc1 = src1Stride[0] ? 1 : 0, inc2 = src2Stride[0] ? 1 : 0;
+	if (dataType == VX_TYPE_FLOAT32) {
+		rowFunc = [=](vx_uint8 * const * ptr, vx_size count) {
+			TensorRowBinary_F32(op, (vx_float32 *)ptr[0], (const vx_float32 *)ptr[1], inc1, (const vx_float32 *)ptr[2], inc2, count, scale);
+		};
+	}
+	else if (op == TENSOR_OP_MUL) {
+		vx_float64 fscale = (vx_float64)scale / (vx_float64)(1u << fixedPointPos);
+		bool roundToNearestEven = (roundingPolicy == VX_ROUND_POLICY_TO_NEAREST_EVEN);
+		if (dataType == VX_TYPE_INT16) {
+			rowFunc = [=](vx_uint8 * const * ptr, vx_size count) {
+				TensorRowMultiply_Int((vx_int16 *)ptr[0], (const vx_int16 *)ptr[1], inc1, (const vx_int16 *)ptr[2], inc2, count, fscale, saturate, roundToNearestEven);
+			};
+		}
+		else if (dataType == VX_TYPE_INT8) {
+			rowFunc = [=](vx_uint8 * const * ptr, vx_size count) {
+				TensorRowMultiply_Int((vx_int8 *)ptr[0], (const vx_int8 *)ptr[1], inc1, (const vx_int8 *)ptr[2], inc2, count, fscale, saturate, roundToNearestEven);
+			};
+		}
+		else if (dataType == VX_TYPE_UINT8) {
+			rowFunc = [=](vx_uint8 * const * ptr, vx_size count) {
+				TensorRowMultiply_Int((vx_uint8 *)ptr[0], (const vx_uint8 *)ptr[1], inc1, (const vx_uint8 *)ptr[2], inc2, count, fscale, saturate, roundToNearestEven);
+			};
+		}
+	}
+#define TENSOR_ADDSUB_ROW_FUNC(T, OP, SAT) \
+		[=](vx_uint8 * const * ptr, vx_size count) { \
+			TensorRowAddSub_Int<T, OP, SAT>((T *)ptr[0], (const T *)ptr[1], inc1, (const T *)ptr[2], inc2, count); \
+		}
+	else if (dataType == VX_TYPE_INT16) {
+		if (op == TENSOR_OP_ADD && saturate) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int16, TENSOR_OP_ADD, true);
+		else if (op == TENSOR_OP_ADD) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int16, TENSOR_OP_ADD, false);
+		else if (saturate) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int16, TENSOR_OP_SUB, true);
+		else rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int16, TENSOR_OP_SUB, false);
+	}
+	else if (dataType == VX_TYPE_INT8) {
+		if (op == TENSOR_OP_ADD && saturate) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int8, TENSOR_OP_ADD, true);
+		else if (op == TENSOR_OP_ADD) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int8, TENSOR_OP_ADD, false);
+		else if (saturate) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int8, TENSOR_OP_SUB, true);
+		else rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_int8, TENSOR_OP_SUB, false);
+	}
+	else if (dataType == VX_TYPE_UINT8) {
+		if (op == TENSOR_OP_ADD && saturate) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_uint8, TENSOR_OP_ADD, true);
+		else if (op == TENSOR_OP_ADD) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_uint8, TENSOR_OP_ADD, false);
+		else if (saturate) rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_uint8, TENSOR_OP_SUB, true);
+		else rowFunc = TENSOR_ADDSUB_ROW_FUNC(vx_uint8, TENSOR_OP_SUB, false);
+	}
+#undef TENSOR_ADDSUB_ROW_FUNC
+	if (!rowFunc || !elemSize)
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	const vx_size * stride[3] = { dstStride, src1Stride, src2Stride };
+	vx_uint8 * base[3] = { pDst, (vx_uint8 *)pSrc1, (vx_uint8 *)pSrc2 };
+	TensorRowLayout layout;
+	TensorCollapseDims(layout, numDims, dims, 3, stride);
+	TensorForEachRow(layout, 3, base, rowFunc);
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorAdd_DATA_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_enum          overflowPolicy,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc1,
+		const vx_size  * src1Stride,
+		const vx_uint8 * pSrc2,
+		const vx_size  * src2Stride
+	)
+{
+	return HafCpu_TensorBinary_DATA_DATA_DATA(TENSOR_OP_ADD, numDims, dims, dataType, 1.0f, 0, overflowPolicy, VX_ROUND_POLICY_TO_ZERO,
+		pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorSubtract_DATA_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_enum          overflowPolicy,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc1,
+		const vx_size  * src1Stride,
+		const vx_uint8 * pSrc2,
+		const vx_size  * src2Stride
+	)
+{
+	return HafCpu_TensorBinary_DATA_DATA_DATA(TENSOR_OP_SUB, numDims, dims, dataType, 1.0f, 0, overflowPolicy, VX_ROUND_POLICY_TO_ZERO,
+		pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorMultiply_DATA_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_uint32        fixedPointPos,
+		vx_float32       scale,
+		vx_enum          overflowPolicy,
+		vx_enum          roundingPolicy,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc1,
+		const vx_size  * src1Stride,
+		const vx_uint8 * pSrc2,
+		const vx_size  * src2Stride
+	)
+{
+	return HafCpu_TensorBinary_DATA_DATA_DATA(TENSOR_OP_MUL, numDims, dims, dataType, scale, fixedPointPos, overflowPolicy, roundingPolicy,
+		pDst, dstStride, pSrc1, src1Stride, pSrc2, src2Stride);
+}
+
+int HafCpu_TensorTableLookup_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dataType,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc,
+		const vx_size  * srcStride,
+		const vx_uint8 * pLut,
+		vx_uint32        lutOffset
+	)
+{
+	std::function<void(vx_uint8 * const * ptr, vx_size count)> rowFunc;
+	if (dataType == VX_TYPE_UINT8) {
+		rowFunc = [=](vx_uint8 * const * ptr, vx_size count) {
+			vx_uint8 * dst = ptr[0];
+			const vx_uint8 * src = ptr[1];
+			vx_size i = 0;
+			for (; i + 4 <= count; i += 4) {
+				dst[i + 0] = pLut[src[i + 0]];
+				dst[i + 1] = pLut[src[i + 1]];
+				dst[i + 2] = pLut[src[i + 2]];
+				dst[i + 3] = pLut[src[i + 3]];
+			}
+			for (; i < count; i++)
+				dst[i] = pLut[src[i]];
+		};
+	}
+	else if (dataType == VX_TYPE_INT16) {
+		const vx_int16 * lut = (const vx_int16 *)pLut + lutOffset;
+		rowFunc = [=](vx_uint8 * const * ptr, vx_size count) {
+			vx_int16 * dst = (vx_int16 *)ptr[0];
+			const vx_int16 * src = (const vx_int16 *)ptr[1];
+			vx_size i = 0;
+			for (; i + 4 <= count; i += 4) {
+				dst[i + 0] = lut[src[i + 0]];
+				dst[i + 1] = lut[src[i + 1]];
+				dst[i + 2] = lut[src[i + 2]];
+				dst[i + 3] = lut[src[i + 3]];
+			}
+			for (; i < count; i++)
+				dst[i] = lut[src[i]];
+		};
+	}
+	else
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	const vx_size * stride[2] = { dstStride, srcStride };
+	vx_uint8 * base[2] = { pDst, (vx_uint8 *)pSrc };
+	TensorRowLayout layout;
+	TensorCollapseDims(layout, numDims, dims, 2, stride);
+	TensorForEachRow(layout, 2, base, rowFunc);
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorConvertDepth_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_enum          dstType,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		vx_enum          srcType,
+		const vx_uint8 * pSrc,
+		const vx_size  * srcStride,
+		vx_float32       scale,
+		vx_float32       offset,
+		vx_bool          saturate
+	)
+{
+	if (!TensorElemSize(dstType) || !TensorElemSize(srcType) ||
+		dstType == VX_TYPE_BOOL || srcType == VX_TYPE_BOOL || dstType == VX_TYPE_INT64 || srcType == VX_TYPE_INT64)
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	const vx_size * stride[2] = { dstStride, srcStride };
+	vx_uint8 * base[2] = { pDst, (vx_uint8 *)pSrc };
+	TensorRowLayout layout;
+	TensorCollapseDims(layout, numDims, dims, 2, stride);
+	TensorForEachRow(layout, 2, base, [=](vx_uint8 * const * ptr, vx_size count) {
+		TensorRowConvert(ptr[0], dstType, ptr[1], srcType, count, &scale, &offset, 1, saturate ? true : false);
+	});
+	return AGO_SUCCESS;
+}
+
+// dst[j][i] = src[i][j] for a rows x cols block of elements
+static void TensorTranspose2D
+	(
+		vx_uint8       * dst,
+		vx_size          dstRowStride,
+		const vx_uint8 * src,
+		vx_size          srcRowStride,
+		vx_size          rows,
+		vx_size          cols,
+		vx_size          elemSize
+	)
+{
+	const vx_size tile = 32;
+	for (vx_size i0 = 0; i0 < rows; i0 += tile) {
+		vx_size i1 = std::min(rows, i0 + tile);
+		for (vx_size j0 = 0; j0 < cols; j0 += tile) {
+			vx_size j1 = std::min(cols, j0 + tile);
+			vx_size i = i0;
+			if (elemSize == 4) {
+				for (; i + 4 <= i1; i += 4) {
+					vx_size j = j0;
+					for (; j + 4 <= j1; j += 4) {
+						__m128 r0 = _mm_loadu_ps((const vx_float32 *)(src + (i + 0) * srcRowStride) + j);
+						__m128 r1 = _mm_loadu_ps((const vx_float32 *)(src + (i + 1) * srcRowStride) + j);
+						__m128 r2 = _mm_loadu_ps((const vx_float32 *)(src + (i + 2) * srcRowStride) + j);
+						__m128 r3 = _mm_loadu_ps((const vx_float32 *)(src + (i + 3) * srcRowStride) + j);
+						_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+						_mm_storeu_ps((vx_float32 *)(dst + (j + 0) * dstRowStride) + i, r0);
+						_mm_storeu_ps((vx_float32 *)(dst + (j + 1) * dstRowStride) + i, r1);
+						_mm_storeu_ps((vx_float32 *)(dst + (j + 2) * dstRowStride) + i, r2);
+						_mm_storeu_ps((vx_float32 *)(dst + (j + 3) * dstRowStride) + i, r3);
+					}
+					for (; j < j1; j++) {
+						for (vx_size ii = i; ii < i + 4; ii++)
+							((vx_uint32 *)(dst + j * dstRowStride))[ii] = ((const vx_uint32 *)(src + ii * srcRowStride))[j];
+					}
+				}
+			}
+			for (; i < i1; i++) {
+				const vx_uint8 * s = src + i * srcRowStride;
+				for (vx_size j = j0; j < j1; j++) {
+					vx_uint8 * d = dst + j * dstRowStride + i * elemSize;
+					if (elemSize == 1) *d = s[j];
+					else if (elemSize == 2) ((vx_uint16 *)d)[0] = ((const vx_uint16 *)s)[j];
+					else if (elemSize == 4) ((vx_uint32 *)d)[0] = ((const vx_uint32 *)s)[j];
+					else memcpy(d, s + j * elemSize, elemSize);
+				}
+			}
+		}
+	}
+}
+
+int HafCpu_TensorTranspose_DATA_DATA
+	(
+		vx_size          numDims,
+		const vx_size  * dims,
+		vx_size          elemSize,
+		vx_uint8       * pDst,
+		const vx_size  * dstStride,
+		const vx_uint8 * pSrc,
+		const vx_size  * srcStride
+	)
+{
+	// srcStride[] is indexed by the output dimension, so the transpose is a strided copy
+	if (srcStride[0] == elemSize) {
+		// rows stay contiguous
+		const vx_size * stride[2] = { dstStride, srcStride };
+		vx_uint8 * base[2] = { pDst, (vx_uint8 *)pSrc };
+		TensorRowLayout layout;
+		TensorCollapseDims(layout, numDims, dims, 2, stride);
+		TensorForEachRow(layout, 2, base, [=](vx_uint8 * const * ptr, vx_size count) {
+			memcpy(ptr[0], ptr[1], count * elemSize);
+		});
+		return AGO_SUCCESS;
+	}
+	// find the output dimension that is contiguous in the input
+	vx_size k = 1;
+	while (k < numDims && srcStride[k] != elemSize)
+		k++;
+	if (k >= numDims)
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	// transpose dims[0] x dims[k] planes in blocks of columns over all the remaining dimensions
+	const vx_size colsPerBlock = 64;
+	vx_size numPlanes = 1;
+	for (vx_size i = 1; i < numDims; i++) {
+		if (i != k)
+			numPlanes *= dims[i];
+	}
+	vx_size blocksPerPlane = (dims[k] + colsPerBlock - 1) / colsPerBlock;
+	HafCpu_ParallelFor((vx_uint32)(numPlanes * blocksPerPlane), 1, [&](vx_uint32 begin, vx_uint32 end) {
+		for (vx_uint32 item = begin; item < end; item++) {
+			vx_size plane = item / blocksPerPlane, block = item % blocksPerPlane;
+			vx_uint8 * dst = pDst;
+			const vx_uint8 * src = pSrc;
+			for (vx_size i = 1; i < numDims; i++) {
+				if (i != k) {
+					vx_size index = plane % dims[i];
+					plane /= dims[i];
+					dst += index * dstStride[i];
+					src += index * srcStride[i];
+				}
+			}
+			vx_size col = block * colsPerBlock;
+			TensorTranspose2D(dst + col * dstStride[k], dstStride[k], src + col * elemSize, srcStride[0],
+				dims[0], std::min(colsPerBlock, dims[k] - col), elemSize);
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+// shuffle masks to split 16 RGB pixels (3 x 16 bytes) into planes and to merge them back
+static const vx_uint8 * TensorRGBShuffleMasks()
+{
+	static vx_uint8 masks[2][3][3][16];
+	static std::once_flag initialized;
+	std::call_once(initialized, []() {
+		for (int c = 0; c < 3; c++) {
+			for (int k = 0; k < 3; k++) {
+				for (int j = 0; j < 16; j++) {
+					int pos = 3 * j + c; // byte of pixel j channel c
+					masks[0][c][k][j] = (pos / 16 == k) ? (vx_uint8)(pos % 16) : 0x80;
+					int idx = 16 * k + j; // byte j of output vector k
+					masks[1][c][k][j] = (idx % 3 == c) ? (vx_uint8)(idx / 3) : 0x80;
+				}
+			}
+		}
+	});
+	return &masks[0][0][0][0];
+}
+
+static void TensorDeinterleaveRGB(vx_uint8 * dstR, vx_uint8 * dstG, vx_uint8 * dstB, const vx_uint8 * src, vx_uint32 width)
+{
+	const __m128i * masks = (const __m128i *)TensorRGBShuffleMasks();
+	vx_uint8 * dst[3] = { dstR, dstG, dstB };
+	vx_uint32 x = 0;
+	for (; x + 16 <= width; x += 16) {
+		__m128i a0 = _mm_loadu_si128((const __m128i *)(src + 3 * x));
+		__m128i a1 = _mm_loadu_si128((const __m128i *)(src + 3 * x + 16));
+		__m128i a2 = _mm_loadu_si128((const __m128i *)(src + 3 * x + 32));
+		for (int c = 0; c < 3; c++) {
+			__m128i v = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a0, _mm_loadu_si128(masks + c * 3 + 0)),
+				_mm_shuffle_epi8(a1, _mm_loadu_si128(masks + c * 3 + 1))), _mm_shuffle_epi8(a2, _mm_loadu_si128(masks + c * 3 + 2)));
+			_mm_storeu_si128((__m128i *)(dst[c] + x), v);
+		}
+	}
+	for (; x < width; x++) {
+		dstR[x] = src[3 * x + 0];
+		dstG[x] = src[3 * x + 1];
+		dstB[x] = src[3 * x + 2];
+	}
+}
+
+static void TensorInterleaveRGB(vx_uint8 * dst, const vx_uint8 * srcR, const vx_uint8 * srcG, const vx_uint8 * srcB, vx_uint32 width)
+{
+	const __m128i * masks = (const __m128i *)TensorRGBShuffleMasks() + 9;
+	vx_uint32 x = 0;
+	for (; x + 16 <= width; x += 16) {
+		__m128i r = _mm_loadu_si128((const __m128i *)(srcR + x));
+		__m128i g = _mm_loadu_si128((const __m128i *)(srcG + x));
+		__m128i b = _mm_loadu_si128((const __m128i *)(srcB + x));
+		for (int k = 0; k < 3; k++) {
+			__m128i v = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, _mm_loadu_si128(masks + 0 * 3 + k)),
+				_mm_shuffle_epi8(g, _mm_loadu_si128(masks + 1 * 3 + k))), _mm_shuffle_epi8(b, _mm_loadu_si128(masks + 2 * 3 + k)));
+			_mm_storeu_si128((__m128i *)(dst + 3 * x + 16 * k), v);
+		}
+	}
+	for (; x < width; x++) {
+		dst[3 * x + 0] = srcR[x];
+		dst[3 * x + 1] = srcG[x];
+		dst[3 * x + 2] = srcB[x];
+	}
+}
+
+static void TensorSwapRB(vx_uint8 * dst, const vx_uint8 * src, vx_uint32 width)
+{
+	for (vx_uint32 x = 0; x < width; x++) {
+		vx_uint8 r = src[3 * x + 0];
+		dst[3 * x + 1] = src[3 * x + 1];
+		dst[3 * x + 0] = src[3 * x + 2];
+		dst[3 * x + 2] = r;
+	}
+}
+
+int HafCpu_ImageToTensor_DATA_DATA
+	(
+		vx_uint32          width,
+		vx_uint32          height,
+		vx_uint32          channels,
+		vx_uint32          batch,
+		const vx_uint8   * pSrcImage,
+		vx_uint32          srcImageStrideInBytes,
+		vx_enum            dstType,
+		vx_uint8         * pDst,
+		const vx_size    * dstStride,
+		vx_bool            nhwc,
+		const vx_float32 * scale,
+		const vx_float32 * offset,
+		vx_bool            reverseChannelOrder
+	)
+{
+	if ((channels != 1 && channels != 3) || (dstType != VX_TYPE_FLOAT32 && dstType != VX_TYPE_FLOAT16 &&
+		dstType != VX_TYPE_INT16 && dstType != VX_TYPE_UINT8 && dstType != VX_TYPE_INT8))
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	HafCpu_ParallelFor(height * batch, std::max(1u, TENSOR_MIN_ELEMENTS_PER_THREAD / (width * channels)), [&](vx_uint32 begin, vx_uint32 end) {
+		std::vector<vx_uint8> temp(channels == 3 ? 3 * width : 0);
+		for (vx_uint32 row = begin; row < end; row++) {
+			vx_uint32 n = row / height, y = row % height;
+			const vx_uint8 * src = pSrcImage + (size_t)row * srcImageStrideInBytes;
+			if (channels == 1) {
+				vx_uint8 * dst = pDst + n * dstStride[3] + y * dstStride[nhwc ? 2 : 1];
+				TensorRowConvert(dst, dstType, src, VX_TYPE_UINT8, width, scale, offset, 1, true);
+			}
+			else if (nhwc) {
+				// dims: [C,W,H,N]
+				vx_uint8 * dst = pDst + n * dstStride[3] + y * dstStride[2];
+				if (reverseChannelOrder) {
+					TensorSwapRB(temp.data(), src, width);
+					src = temp.data();
+				}
+				TensorRowConvert(dst, dstType, src, VX_TYPE_UINT8, 3 * width, scale, offset, 3, true);
+			}
+			else {
+				// dims: [W,H,C,N]
+				vx_uint8 * plane[3] = { temp.data(), temp.data() + width, temp.data() + 2 * width };
+				TensorDeinterleaveRGB(plane[0], plane[1], plane[2], src, width);
+				for (vx_uint32 c = 0; c < 3; c++) {
+					vx_uint8 * dst = pDst + n * dstStride[3] + c * dstStride[2] + y * dstStride[1];
+					TensorRowConvert(dst, dstType, plane[reverseChannelOrder ? 2 - c : c], VX_TYPE_UINT8, width, scale + c, offset + c, 1, true);
+				}
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+int HafCpu_TensorToImage_DATA_DATA
+	(
+		vx_uint32          width,
+		vx_uint32          height,
+		vx_uint32          channels,
+		vx_uint32          batch,
+		vx_uint8         * pDstImage,
+		vx_uint32          dstImageStrideInBytes,
+		vx_enum            srcType,
+		const vx_uint8   * pSrc,
+		const vx_size    * srcStride,
+		vx_bool            nhwc,
+		const vx_float32 * scale,
+		const vx_float32 * offset,
+		vx_bool            reverseChannelOrder
+	)
+{
+	if ((channels != 1 && channels != 3) || (srcType != VX_TYPE_FLOAT32 && srcType != VX_TYPE_FLOAT16 &&
+		srcType != VX_TYPE_INT16 && srcType != VX_TYPE_UINT8 && srcType != VX_TYPE_INT8))
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	HafCpu_ParallelFor(height * batch, std::max(1u, TENSOR_MIN_ELEMENTS_PER_THREAD / (width * channels)), [&](vx_uint32 begin, vx_uint32 end) {
+		std::vector<vx_uint8> temp(channels == 3 ? 3 * width : 0);
+		for (vx_uint32 row = begin; row < end; row++) {
+			vx_uint32 n = row / height, y = row % height;
+			vx_uint8 * dst = pDstImage + (size_t)row * dstImageStrideInBytes;
+			if (channels == 1) {
+				const vx_uint8 * src = pSrc + n * srcStride[3] + y * srcStride[nhwc ? 2 : 1];
+				TensorRowConvert(dst, VX_TYPE_UINT8, src, srcType, width, scale, offset, 1, true);
+			}
+			else if (nhwc) {
+				// dims: [C,W,H,N]
+				const vx_uint8 * src = pSrc + n * srcStride[3] + y * srcStride[2];
+				TensorRowConvert(reverseChannelOrder ? temp.data() : dst, VX_TYPE_UINT8, src, srcType, 3 * width, scale, offset, 3, true);
+				if (reverseChannelOrder)
+					TensorSwapRB(dst, temp.data(), width);
+			}
+			else {
+				// dims: [W,H,C,N]
+				vx_uint8 * plane[3] = { temp.data(), temp.data() + width, temp.data() + 2 * width };
+				for (vx_uint32 c = 0; c < 3; c++) {
+					const vx_uint8 * src = pSrc + n * srcStride[3] + c * srcStride[2] + y * srcStride[1];
+					TensorRowConvert(plane[reverseChannelOrder ? 2 - c : c], VX_TYPE_UINT8, src, srcType, width, scale + c, offset + c, 1, true);
+				}
+				TensorInterleaveRGB(dst, plane[0], plane[1], plane[2], width);
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
+
+// The fused scale/crop/normalize primitive samples the source with bilinear interpolation
+// (pixel centers aligned, edges clamped to the crop rectangle) and writes the normalized
+// channels of each output row straight into the tensor planes. The 8-wide path gathers the
+// four neighbours of each output pixel with AVX2; it is selected at run time, so that the
+// library built for SSE4.2 still uses it on CPUs that have AVX2 and F16C.
+struct TensorScaleCropMap {
+	std::vector<vx_int32> x0, x1;       // byte offsets of the left and right neighbours in a source row
+	std::vector<vx_float32> fx;         // weight of the right neighbour
+	vx_uint32 vecWidth;                 // number of output pixels whose neighbours can be read with 32-bit gathers
+};
+
+// clamp(center-aligned position of output pixel i, start, end - 1) split into neighbours and weight
+static inline void TensorScaleCropCoord(vx_float32 pos, vx_int32 start, vx_int32 end, vx_int32& i0, vx_int32& i1, vx_float32& f)
+{
+	pos = std::min(std::max(pos, (vx_float32)start), (vx_float32)(end - 1));
+	i0 = (vx_int32)pos;
+	i1 = std::min(i0 + 1, end - 1);
+	f = pos - (vx_float32)i0;
+}
+
+static void TensorScaleCropInitMap(TensorScaleCropMap& map, vx_uint32 dstWidth, vx_float32 ratio, vx_float32 origin,
+	vx_int32 start, vx_int32 end, vx_int32 bytesPerPixel, vx_int32 rowBytes)
+{
+	map.x0.resize(dstWidth + 8);
+	map.x1.resize(dstWidth + 8);
+	map.fx.resize(dstWidth + 8);
+	map.vecWidth = 0;
+	for (vx_uint32 x = 0; x < dstWidth; x++) {
+		vx_int32 i0, i1;
+		TensorScaleCropCoord(((vx_float32)x + 0.5f) * ratio - 0.5f + origin, start, end, i0, i1, map.fx[x]);
+		map.x0[x] = i0 * bytesPerPixel;
+		map.x1[x] = i1 * bytesPerPixel;
+		// a 32-bit gather at the right neighbour must not read past the end of the row
+		if (map.x1[x] + 4 <= rowBytes)
+			map.vecWidth = x + 1;
+	}
+	map.vecWidth &= ~7u;
+}
+
+static inline vx_float32 TensorLerp(vx_float32 a, vx_float32 b, vx_float32 f)
+{
+	return a + (b - a) * f;
+}
+
+static inline vx_float32 TensorBilinear(const vx_uint8 * r0, const vx_uint8 * r1, vx_int32 x0, vx_int32 x1, vx_float32 fx, vx_float32 fy)
+{
+	return TensorLerp(TensorLerp(r0[x0], r0[x1], fx), TensorLerp(r1[x0], r1[x1], fx), fy);
+}
+
+static inline void TensorYUVToRGB(vx_float32 Y, vx_float32 U, vx_float32 V, vx_float32 rgb[3])
+{
+	// BT.709, as in HafCpu_ColorConvert_RGB_NV12
+	U -= 128.0f;
+	V -= 128.0f;
+	rgb[0] = std::min(std::max(Y + 1.5748f * V, 0.0f), 255.0f);
+	rgb[1] = std::min(std::max(Y - 0.1873f * U - 0.4681f * V, 0.0f), 255.0f);
+	rgb[2] = std::min(std::max(Y + 1.8556f * U, 0.0f), 255.0f);
+}
+
+TENSOR_TARGET_AVX2
+static inline __m256 TensorGatherBilinearAVX2(__m256i g00, __m256i g01, __m256i g10, __m256i g11, int shift, __m256 fx, __m256 fy)
+{
+	const __m256i mask = _mm256_set1_epi32(0xff);
+	__m256 p00 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(g00, shift), mask));
+	__m256 p01 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(g01, shift), mask));
+	__m256 p10 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(g10, shift), mask));
+	__m256 p11 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(g11, shift), mask));
+	__m256 top = _mm256_add_ps(p00, _mm256_mul_ps(_mm256_sub_ps(p01, p00), fx));
+	__m256 bot = _mm256_add_ps(p10, _mm256_mul_ps(_mm256_sub_ps(p11, p10), fx));
+	return _mm256_add_ps(top, _mm256_mul_ps(_mm256_sub_ps(bot, top), fy));
+}
+
+// RGB row: out[c][x] = bilinear(channel c) * scale[c] + offset[c] for x in [0, width) with width a multiple of 8
+TENSOR_TARGET_AVX2
+static void TensorScaleCropRowRGB_AVX2(vx_float32 * out[3], const vx_uint8 * r0, const vx_uint8 * r1, vx_float32 fy,
+	const TensorScaleCropMap& map, vx_uint32 width, const vx_float32 * scale, const vx_float32 * offset)
+{
+	__m256 vfy = _mm256_set1_ps(fy);
+	for (vx_uint32 x = 0; x < width; x += 8) {
+		__m256i i0 = _mm256_loadu_si256((const __m256i *)&map.x0[x]);
+		__m256i i1 = _mm256_loadu_si256((const __m256i *)&map.x1[x]);
+		__m256 vfx = _mm256_loadu_ps(&map.fx[x]);
+		__m256i g00 = _mm256_i32gather_epi32((const int *)r0, i0, 1);
+		__m256i g01 = _mm256_i32gather_epi32((const int *)r0, i1, 1);
+		__m256i g10 = _mm256_i32gather_epi32((const int *)r1, i0, 1);
+		__m256i g11 = _mm256_i32gather_epi32((const int *)r1, i1, 1);
+		for (int c = 0; c < 3; c++) {
+			__m256 v = TensorGatherBilinearAVX2(g00, g01, g10, g11, 8 * c, vfx, vfy);
+			_mm256_storeu_ps(out[c] + x, _mm256_add_ps(_mm256_mul_ps(v, _mm256_set1_ps(scale[c])), _mm256_set1_ps(offset[c])));
+		}
+	}
+}
+
+// NV12 row: luma and chroma are interpolated separately and converted to RGB before the normalization
+TENSOR_TARGET_AVX2
+static void TensorScaleCropRowNV12_AVX2(vx_float32 * out[3], const vx_uint8 * y0, const vx_uint8 * y1, vx_float32 fy,
+	const vx_uint8 * uv0, const vx_uint8 * uv1, vx_float32 fcy, const TensorScaleCropMap& map, const TensorScaleCropMap& cmap,
+	vx_uint32 width, const vx_float32 * scale, const vx_float32 * offset)
+{
+	__m256 vfy = _mm256_set1_ps(fy), vfcy = _mm256_set1_ps(fcy);
+	__m256 c128 = _mm256_set1_ps(128.0f), zero = _mm256_setzero_ps(), c255 = _mm256_set1_ps(255.0f);
+	for (vx_uint32 x = 0; x < width; x += 8) {
+		__m256i i0 = _mm256_loadu_si256((const __m256i *)&map.x0[x]);
+		__m256i i1 = _mm256_loadu_si256((const __m256i *)&map.x1[x]);
+		__m256i c0 = _mm256_loadu_si256((const __m256i *)&cmap.x0[x]);
+		__m256i c1 = _mm256_loadu_si256((const __m256i *)&cmap.x1[x]);
+		__m256 Y = TensorGatherBilinearAVX2(_mm256_i32gather_epi32((const int *)y0, i0, 1), _mm256_i32gather_epi32((const int *)y0, i1, 1),
+			_mm256_i32gather_epi32((const int *)y1, i0, 1), _mm256_i32gather_epi32((const int *)y1, i1, 1), 0, _mm256_loadu_ps(&map.fx[x]), vfy);
+		__m256i g00 = _mm256_i32gather_epi32((const int *)uv0, c0, 1);
+		__m256i g01 = _mm256_i32gather_epi32((const int *)uv0, c1, 1);
+		__m256i g10 = _mm256_i32gather_epi32((const int *)uv1, c0, 1);
+		__m256i g11 = _mm256_i32gather_epi32((const int *)uv1, c1, 1);
+		__m256 vfcx = _mm256_loadu_ps(&cmap.fx[x]);
+		__m256 U = _mm256_sub_ps(TensorGatherBilinearAVX2(g00, g01, g10, g11, 0, vfcx, vfcy), c128);
+		__m256 V = _mm256_sub_ps(TensorGatherBilinearAVX2(g00, g01, g10, g11, 8, vfcx, vfcy), c128);
+		__m256 rgb[3];
+		rgb[0] = _mm256_add_ps(Y, _mm256_mul_ps(V, _mm256_set1_ps(1.5748f)));
+		rgb[1] = _mm256_sub_ps(Y, _mm256_add_ps(_mm256_mul_ps(U, _mm256_set1_ps(0.1873f)), _mm256_mul_ps(V, _mm256_set1_ps(0.4681f))));
+		rgb[2] = _mm256_add_ps(Y, _mm256_mul_ps(U, _mm256_set1_ps(1.8556f)));
+		for (int c = 0; c < 3; c++) {
+			__m256 v = _mm256_min_ps(_mm256_max_ps(rgb[c], zero), c255);
+			_mm256_storeu_ps(out[c] + x, _mm256_add_ps(_mm256_mul_ps(v, _mm256_set1_ps(scale[c])), _mm256_set1_ps(offset[c])));
+		}
+	}
+}
+
+int HafCpu_ScaleCropImageToTensor_DATA_DATA
+	(
+		vx_uint32              dstWidth,
+		vx_uint32              dstHeight,
+		vx_enum                dstType,
+		vx_uint8             * pDst,
+		const vx_size        * dstStride,
+		vx_df_image            srcFormat,
+		vx_uint32              srcWidth,
+		vx_uint32              srcHeight,
+		const vx_uint8       * pSrcImage,
+		vx_uint32              srcImageStrideInBytes,
+		const vx_uint8       * pSrcUV,
+		vx_uint32              srcUVStrideInBytes,
+		const vx_rectangle_t * crop,
+		const vx_float32     * scale,
+		const vx_float32     * offset,
+		vx_bool                reverseChannelOrder
+	)
+{
+	if ((srcFormat != VX_DF_IMAGE_RGB && srcFormat != VX_DF_IMAGE_NV12) || (dstType != VX_TYPE_FLOAT32 && dstType != VX_TYPE_FLOAT16))
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	if (crop->start_x >= crop->end_x || crop->start_y >= crop->end_y || crop->end_x > srcWidth || crop->end_y > srcHeight)
+		return AGO_ERROR_HAFCPU_NOT_IMPLEMENTED;
+	bool nv12 = (srcFormat == VX_DF_IMAGE_NV12);
+	bool avx2 = agoIsCpuAvx2Supported();
+	vx_float32 ratioX = (vx_float32)(crop->end_x - crop->start_x) / dstWidth;
+	vx_float32 ratioY = (vx_float32)(crop->end_y - crop->start_y) / dstHeight;
+	// column maps of the luma/RGB samples and of the chroma samples (chroma is sited at the center of each 2x2 block)
+	TensorScaleCropMap map, cmap;
+	TensorScaleCropInitMap(map, dstWidth, ratioX, (vx_float32)crop->start_x, crop->start_x, crop->end_x, nv12 ? 1 : 3, nv12 ? srcWidth : 3 * srcWidth);
+	vx_uint32 vecWidth = map.vecWidth;
+	if (nv12) {
+		TensorScaleCropInitMap(cmap, dstWidth, 0.5f * ratioX, 0.5f * crop->start_x, crop->start_x >> 1, (crop->end_x + 1) >> 1, 2, 2 * ((srcWidth + 1) >> 1));
+		vecWidth = std::min(vecWidth, cmap.vecWidth);
+	}
+	if (!avx2)
+		vecWidth = 0;
+	// output channel c is source channel c, or 2-c when reversed
+	vx_float32 channelScale[3], channelOffset[3];
+	for (vx_uint32 c = 0; c < 3; c++) {
+		channelScale[reverseChannelOrder ? 2 - c : c] = scale[c];
+		channelOffset[reverseChannelOrder ? 2 - c : c] = offset[c];
+	}
+	HafCpu_ParallelFor(dstHeight, std::max(1u, TENSOR_MIN_ELEMENTS_PER_THREAD / (3 * dstWidth)), [&](vx_uint32 begin, vx_uint32 end) {
+		// float32 output is written in place, float16 output goes through a row of floats per channel
+		std::vector<vx_float32> temp(dstType == VX_TYPE_FLOAT16 ? 3 * dstWidth : 0);
+		for (vx_uint32 y = begin; y < end; y++) {
+			vx_float32 * out[3];
+			for (vx_uint32 c = 0; c < 3; c++) {
+				vx_uint32 oc = reverseChannelOrder ? 2 - c : c;
+				out[c] = (dstType == VX_TYPE_FLOAT32) ? (vx_float32 *)(pDst + oc * dstStride[2] + y * dstStride[1]) : temp.data() + oc * dstWidth;
+			}
+			vx_int32 sy0, sy1; vx_float32 fy;
+			TensorScaleCropCoord(((vx_float32)y + 0.5f) * ratioY - 0.5f + crop->start_y, crop->start_y, crop->end_y, sy0, sy1, fy);
+			const vx_uint8 * r0 = pSrcImage + (size_t)sy0 * srcImageStrideInBytes;
+			const vx_uint8 * r1 = pSrcImage + (size_t)sy1 * srcImageStrideInBytes;
+			if (!nv12) {
+				if (vecWidth)
+					TensorScaleCropRowRGB_AVX2(out, r0, r1, fy, map, vecWidth, channelScale, channelOffset);
+				for (vx_uint32 x = vecWidth; x < dstWidth; x++) {
+					for (vx_uint32 c = 0; c < 3; c++)
+						out[c][x] = TensorBilinear(r0 + c, r1 + c, map.x0[x], map.x1[x], map.fx[x], fy) * channelScale[c] + channelOffset[c];
+				}
+			}
+			else {
+				vx_int32 cy0, cy1; vx_float32 fcy;
+				TensorScaleCropCoord(((vx_float32)y + 0.5f) * 0.5f * ratioY - 0.5f + 0.5f * crop->start_y, crop->start_y >> 1, (crop->end_y + 1) >> 1, cy0, cy1, fcy);
+				const vx_uint8 * uv0 = pSrcUV + (size_t)cy0 * srcUVStrideInBytes;
+				const vx_uint8 * uv1 = pSrcUV + (size_t)cy1 * srcUVStrideInBytes;
+				if (vecWidth)
+					TensorScaleCropRowNV12_AVX2(out, r0, r1, fy, uv0, uv1, fcy, map, cmap, vecWidth, channelScale, channelOffset);
+				for (vx_uint32 x = vecWidth; x < dstWidth; x++) {
+					vx_float32 rgb[3];
+					TensorYUVToRGB(TensorBilinear(r0, r1, map.x0[x], map.x1[x], map.fx[x], fy),
+						TensorBilinear(uv0, uv1, cmap.x0[x], cmap.x1[x], cmap.fx[x], fcy),
+						TensorBilinear(uv0 + 1, uv1 + 1, cmap.x0[x], cmap.x1[x], cmap.fx[x], fcy), rgb);
+					for (vx_uint32 c = 0; c < 3; c++)
+						out[c][x] = rgb[c] * channelScale[c] + channelOffset[c];
+				}
+			}
+			if (dstType == VX_TYPE_FLOAT16) {
+				for (vx_uint32 c = 0; c < 3; c++) {
+					vx_uint16 * dst = (vx_uint16 *)(pDst + c * dstStride[2] + y * dstStride[1]);
+					if (avx2)
+						TensorRowStoreF16_AVX2(dst, temp.data() + c * dstWidth, dstWidth);
+					else
+						TensorRowStoreF32((vx_uint8 *)dst, VX_TYPE_FLOAT16, temp.data() + c * dstWidth, dstWidth, true);
+				}
+			}
+		}
+	});
+	return AGO_SUCCESS;
+}
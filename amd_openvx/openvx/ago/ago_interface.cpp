@@ -51,6 +51,216 @@ static void agoGraphThreadFunction(LPVOID graph_)
 #endif
 }
 
+static thread_local AgoGraphScheduler * s_currentScheduler = nullptr;
+static thread_local vx_uint32 s_currentWorker = 0;
+static thread_local AgoContext * s_processingContext = nullptr;
+static AgoGraphScheduler * agoGetGraphScheduler(AgoContext * acontext);
+
+AgoGraphScheduler::AgoGraphScheduler(vx_uint32 numThreads)
+    : m_pending{ 0 }, m_nextQueue{ 0 }, m_exit{ false }
+{
+    numThreads = std::max(numThreads, 1u);
+    for (vx_uint32 i = 0; i < numThreads; i++) {
+        m_workers.push_back(std::unique_ptr<Worker>(new Worker));
+    }
+    for (vx_uint32 i = 0; i < numThreads; i++) {
+        m_threads.push_back(std::thread(&AgoGraphScheduler::workerLoop, this, i));
+    }
+}
+
+AgoGraphScheduler::~AgoGraphScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+    }
+    m_cv.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+AgoGraphScheduler * AgoGraphScheduler::current()
+{
+    return s_currentScheduler;
+}
+
+AgoGraphScheduler * AgoGraphScheduler::forCallingThread()
+{
+    if (s_currentScheduler)
+        return s_currentScheduler;
+    if (s_processingContext)
+        return agoGetGraphScheduler(s_processingContext);
+    static AgoGraphScheduler scheduler(agoGetCpuThreadCount());
+    return &scheduler;
+}
+
+void AgoGraphScheduler::submit(std::function<void()> task)
+{
+    // tasks submitted by a worker stay on its own deque, others are distributed round-robin
+    vx_uint32 index = (s_currentScheduler == this) ? s_currentWorker : (m_nextQueue++ % (vx_uint32)m_workers.size());
+    {
+        std::lock_guard<std::mutex> lock(m_workers[index]->mutex);
+        m_workers[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending++;
+    }
+    m_cv.notify_one();
+}
+
+bool AgoGraphScheduler::runTask(vx_uint32 self)
+{
+    std::function<void()> task;
+    vx_uint32 numWorkers = (vx_uint32)m_workers.size();
+    for (vx_uint32 i = 0; i < numWorkers && !task; i++) {
+        Worker * worker = m_workers[(self + i) % numWorkers].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (!worker->tasks.empty()) {
+            if (i == 0) {
+                task = std::move(worker->tasks.back());
+                worker->tasks.pop_back();
+            }
+            else {
+                task = std::move(worker->tasks.front());
+                worker->tasks.pop_front();
+            }
+        }
+    }
+    if (!task)
+        return false;
+    m_pending--;
+    task();
+    return true;
+}
+
+void AgoGraphScheduler::workerLoop(vx_uint32 self)
+{
+    s_currentScheduler = this;
+    s_currentWorker = self;
+    for (;;) {
+        if (runTask(self))
+            continue;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_exit || m_pending > 0; });
+        if (m_exit)
+            break;
+    }
+    s_currentScheduler = nullptr;
+}
+
+vx_status AgoGraphScheduler::wait(std::future<vx_status>& future)
+{
+    if (s_currentScheduler == this) {
+        // waiting inside a task: keep the worker busy until the future is ready
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!runTask(s_currentWorker))
+                future.wait_for(std::chrono::microseconds(100));
+        }
+    }
+    return future.get();
+}
+
+void AgoGraphScheduler::parallelFor(vx_uint32 count, vx_uint32 minItemsPerThread, const std::function<void(vx_uint32, vx_uint32)>& func)
+{
+    vx_uint32 numChunks = std::min(numThreads() + (s_currentScheduler == this ? 0 : 1), count / std::max(minItemsPerThread, 1u));
+    if (numChunks <= 1) {
+        if (count > 0)
+            func(0, count);
+        return;
+    }
+    std::vector<std::promise<vx_status>> done(numChunks - 1);
+    std::vector<std::future<vx_status>> futures;
+    for (vx_uint32 chunk = 1; chunk < numChunks; chunk++) {
+        vx_uint32 begin = (vx_uint32)((vx_uint64)count * chunk / numChunks);
+        vx_uint32 end = (vx_uint32)((vx_uint64)count * (chunk + 1) / numChunks);
+        std::promise<vx_status> * promise = &done[chunk - 1];
+        futures.push_back(promise->get_future());
+        submit([&func, promise, begin, end]() {
+            func(begin, end);
+            promise->set_value(VX_SUCCESS);
+        });
+    }
+    func(0, (vx_uint32)(count / numChunks));
+    for (auto& future : futures) {
+        wait(future);
+    }
+}
+
+static vx_status agoCreateGraphThread(AgoGraph * agraph)
+{
+    // create semaphore and thread for graph scheduling: limit 1000 pending requests
+    agraph->hSemToThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
+    agraph->hSemFromThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
+    if (agraph->hSemToThread == NULL || agraph->hSemFromThread == NULL) {
+        agoAddLogEntry(&agraph->ref, VX_FAILURE, "ERROR: CreateSemaphore() failed\n");
+        return VX_ERROR_NO_RESOURCES;
+    }
+    agraph->hThread = CreateThread(NULL, 0, agoGraphThreadFunction, agraph, 0, NULL);
+#if _WIN32 // TBD: need to enable this check for non-windows platforms
+    if (agraph->hThread == NULL) {
+        agoAddLogEntry(&agraph->ref, VX_FAILURE, "ERROR: CreateThread() failed\n");
+        return VX_ERROR_NO_RESOURCES;
+    }
+#if _DEBUG
+    agoAddLogEntry(&agraph->ref, VX_SUCCESS, "OK: enabled graph scheduling in separate threads\n");
+#endif
+#endif
+    return VX_SUCCESS;
+}
+
+static AgoGraphScheduler * agoGetGraphScheduler(AgoContext * acontext)
+{
+    // not under the context lock: this is also called from kernels while their graph is being processed
+    std::lock_guard<std::mutex> lock(acontext->graph_scheduler_mutex);
+    if (!acontext->graph_scheduler) {
+        // the scheduler threads are created on first use, one per CPU the process may run on
+        vx_uint32 numThreads = agoGetCpuThreadCount();
+        char textBuffer[64];
+        if (agoGetEnvironmentVariable("AGO_SCHEDULER_THREADS", textBuffer, sizeof(textBuffer))) {
+            numThreads = (vx_uint32)atoi(textBuffer);
+        }
+        acontext->graph_scheduler = new AgoGraphScheduler(numThreads);
+    }
+    return acontext->graph_scheduler;
+}
+
+// execute the pending schedule requests of a graph, one at a time
+static void agoGraphSchedulerTask(AgoGraph * graph)
+{
+    for (;;) {
+        std::promise<vx_status> promise;
+        {
+            std::lock_guard<std::mutex> lock(graph->scheduleMutex);
+            if (graph->scheduleQueue.empty()) {
+                graph->scheduleRunning = false;
+                return;
+            }
+            promise = std::move(graph->scheduleQueue.front());
+            graph->scheduleQueue.pop_front();
+        }
+        graph->status = agoProcessGraph(graph);
+        graph->threadExecuteCount++;
+        promise.set_value(graph->status);
+    }
+}
+
+// wait for all executions of the graph on the context scheduler and return the status of the last one
+static vx_status agoWaitGraphScheduler(AgoGraph * graph)
+{
+    vx_status status = VX_SUCCESS;
+    std::vector<std::future<vx_status>> futures;
+    {
+        std::lock_guard<std::mutex> lock(graph->scheduleMutex);
+        futures.swap(graph->scheduleFutures);
+    }
+    for (auto& future : futures) {
+        status = graph->ref.context->graph_scheduler->wait(future);
+    }
+    return status;
+}
+
 AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform)
 {
     CAgoLockGlobalContext lock;
@@ -83,6 +293,10 @@ AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform)
         if (agoGetEnvironmentVariable("AGO_THREAD_CONFIG", textBuffer, sizeof(textBuffer))) {
             acontext->thread_config = atoi(textBuffer);
         }
+        // initialize immediate mode graph cache config
+        if (agoGetEnvironmentVariable("AGO_IMMEDIATE_GRAPH_CACHE_SIZE", textBuffer, sizeof(textBuffer))) {
+            acontext->immediate_graph_cache_size = atoi(textBuffer);
+        }
     }
     return (AgoContext *)acontext;
 }
@@ -132,42 +346,35 @@ AgoGraph * agoCreateGraph(AgoContext * acontext)
         agraph->ref.external_count++;
         acontext->num_active_references++;
     }
-    if (acontext->thread_config & 1) {
-        // create semaphore and thread for graph scheduling: limit 1000 pending requests
-        agraph->hSemToThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
-        agraph->hSemFromThread = CreateSemaphore(nullptr, 0, 1000, nullptr);
-        if (agraph->hSemToThread == NULL || agraph->hSemFromThread == NULL) {
-            agoAddLogEntry(&agraph->ref, VX_FAILURE, "ERROR: CreateSemaphore() failed\n");
-            agoReleaseGraph(agraph);
-            return nullptr;
-        }
-        agraph->hThread = CreateThread(NULL, 0, agoGraphThreadFunction, agraph, 0, NULL);
-#if _WIN32 // TBD: need to enable this check for non-windows platforms
-        if (agraph->hThread == NULL) {
-            agoAddLogEntry(&agraph->ref, VX_FAILURE, "ERROR: CreateThread() failed\n");
-            agoReleaseGraph(agraph);
-            return nullptr;
-        }
-#if _DEBUG
-        agoAddLogEntry(&agraph->ref, VX_SUCCESS, "OK: enabled graph scheduling in separate threads\n");
-#endif
-#endif
-    }
     agraph->reverify = agraph->verified;
     agraph->verified = vx_false_e;
     agraph->state = VX_GRAPH_STATE_UNVERIFIED;
     return (AgoGraph *)agraph;
 }
 
-int agoReleaseGraph(AgoGraph * agraph)
+int agoReleaseGraph(AgoGraph * agraph, bool isForExternalUse)
 {
+    if (agraph->ref.external_count + agraph->ref.internal_count == 1 && agraph->ref.context->graph_scheduler) {
+        // wait for the executions pending on the context scheduler before locking the context,
+        // since the executions may need the context lock
+        agoWaitGraphScheduler(agraph);
+    }
     CAgoLock lock(agraph->ref.context->cs);
 
     int status = 0;
-    agraph->ref.external_count--;
-    if(agraph->ref.external_count >= 0)
-        agraph->ref.context->num_active_references--;
-    if (agraph->ref.external_count == 0) {
+    if (isForExternalUse) {
+        agraph->ref.external_count--;
+        if(agraph->ref.external_count >= 0)
+            agraph->ref.context->num_active_references--;
+    }
+    else if (agraph->ref.internal_count > 0) {
+        agraph->ref.internal_count--;
+    }
+    if (agraph->ref.external_count == 0 && agraph->ref.internal_count == 0) {
+        // wait for the executions pending on the context scheduler
+        if (agraph->ref.context->graph_scheduler) {
+            agoWaitGraphScheduler(agraph);
+        }
         EnterCriticalSection(&agraph->cs);
         // stop graph thread
         if (agraph->hThread) {
@@ -223,8 +430,9 @@ int agoReleaseGraph(AgoGraph * agraph)
 int agoOptimizeGraph(AgoGraph * agraph)
 {
     if (!agraph->status) {
+        // the context objects used by the optimizer are claimed by agoAcquireGraphContextData,
+        // so the context lock is not held while the graph is optimized
         CAgoLock lock(agraph->cs);
-        CAgoLock lock2(agraph->ref.context->cs);
 
         // run DRAMA graph optimizer
         agraph->status = agoOptimizeDrama(agraph);
@@ -232,12 +440,99 @@ int agoOptimizeGraph(AgoGraph * agraph)
     return agraph->status;
 }
 
+static AgoData * agoGetTopLevelData(AgoData * data)
+{
+    while (data->parent)
+        data = data->parent;
+    return data;
+}
+
+// collect the context objects reachable from the nodes of the graph (including the ROIs of the images
+// used by the graph) into graph->contextDataList and return their top-level objects in topList
+static void agoCollectGraphContextData(AgoGraph * agraph, std::vector<AgoData *>& topList)
+{
+    topList.clear();
+    for (AgoNode * node = agraph->nodeList.head; node; node = node->next) {
+        for (vx_uint32 arg = 0; arg < node->paramCount; arg++) {
+            AgoData * data = node->paramList[arg];
+            if (data) {
+                topList.push_back(agoGetTopLevelData(data));
+                if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage) {
+                    topList.push_back(agoGetTopLevelData(data->u.img.roiMasterImage));
+                }
+            }
+        }
+    }
+    topList.erase(std::remove_if(topList.begin(), topList.end(), [](AgoData * data) { return data->isVirtual; }), topList.end());
+    std::sort(topList.begin(), topList.end());
+    topList.erase(std::unique(topList.begin(), topList.end()), topList.end());
+
+    AgoContext * context = agraph->ref.context;
+    CAgoLock lock(context->cs);
+    agraph->contextDataList.clear();
+    for (AgoData * data = context->dataList.head; data; data = data->next) {
+        AgoData * top = agoGetTopLevelData(data);
+        if (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI && data->u.img.roiMasterImage &&
+            std::binary_search(topList.begin(), topList.end(), agoGetTopLevelData(data->u.img.roiMasterImage)))
+        {
+            agraph->contextDataList.push_back(data);
+        }
+        else if (std::binary_search(topList.begin(), topList.end(), top)) {
+            agraph->contextDataList.push_back(data);
+        }
+    }
+}
+
+// the graph optimizer keeps its bookkeeping (usage counts, hierarchical levels, buffers) in the objects
+// of the graph: the context objects used by a graph are claimed for the duration of its verification so
+// that graphs sharing objects are verified one at a time, while other graphs are verified concurrently
+void agoAcquireGraphContextData(AgoGraph * agraph)
+{
+    AgoContext * context = agraph->ref.context;
+    std::vector<AgoData *> topList;
+    agoCollectGraphContextData(agraph, topList);
+
+    // objects already claimed by this thread (e.g., a graph verified from a kernel initialize callback) are shared
+    std::thread::id self = std::this_thread::get_id();
+    std::unique_lock<std::mutex> lock(context->verify_mutex);
+    context->verify_cv.wait(lock, [&] {
+        for (AgoData * data : topList) {
+            auto it = context->verify_claims.find(data);
+            if (it != context->verify_claims.end() && it->second != self)
+                return false;
+        }
+        return true;
+    });
+    agraph->contextDataClaims.clear();
+    for (AgoData * data : topList) {
+        if (context->verify_claims.insert(std::make_pair(data, self)).second) {
+            agraph->contextDataClaims.push_back(data);
+        }
+    }
+}
+
+void agoReleaseGraphContextData(AgoGraph * agraph)
+{
+    AgoContext * context = agraph->ref.context;
+    {
+        std::lock_guard<std::mutex> lock(context->verify_mutex);
+        for (AgoData * data : agraph->contextDataClaims) {
+            context->verify_claims.erase(data);
+        }
+    }
+    context->verify_cv.notify_all();
+    agraph->contextDataClaims.clear();
+    agraph->contextDataList.clear();
+}
+
 int agoWriteGraph(AgoGraph * agraph, AgoReference * * ref, int num_ref, FILE * fp, const char * comment)
 {
     CAgoLock lock(agraph->cs);
     CAgoLock lock2(agraph->ref.context->cs);
 
 #if ENABLE_DEBUG_MESSAGES
+    std::vector<AgoData *> topList;
+    agoCollectGraphContextData(agraph, topList);
     agoOptimizeDramaMarkDataUsage(agraph);
 #endif
 
@@ -1731,6 +2026,164 @@ vx_status agoPrepareImageValidRectangleBuffers(AgoGraph * graph)
     return status;
 }
 
+static int agoAddDataReplacement(std::map<AgoData *, AgoData *>& replacement, AgoData * oldData, AgoData * newData)
+{
+    if (oldData->ref.type != newData->ref.type || oldData->numChildren != newData->numChildren)
+        return -1;
+    replacement[oldData] = newData;
+    for (vx_uint32 child = 0; child < oldData->numChildren; child++) {
+        if (oldData->children[child] && newData->children[child]) {
+            if (agoAddDataReplacement(replacement, oldData->children[child], newData->children[child]))
+                return -1;
+        }
+        else if (oldData->children[child] || newData->children[child]) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// replace oldData[i] (and its children) with newData[i] in all nodes of a verified graph, as if the graph
+// was verified with newData[]; the objects must have the same meta-formats: all replacements are done at once,
+// so the objects can be swapped between parameters
+int agoReplaceGraphData(AgoGraph * graph, vx_uint32 count, AgoData * oldData[], AgoData * newData[])
+{
+    std::map<AgoData *, AgoData *> replacement;
+    for (vx_uint32 i = 0; i < count; i++) {
+        if (oldData[i] != newData[i]) {
+            if (!oldData[i] || !newData[i] || agoAddDataReplacement(replacement, oldData[i], newData[i])) {
+                agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoReplaceGraphData: parameter #%d is not compatible\n", i);
+                return -1;
+            }
+            if (agoAllocData(newData[i])) {
+                agoAddLogEntry(&graph->ref, VX_FAILURE, "ERROR: agoReplaceGraphData: agoAllocData(%s) failed\n", newData[i]->name.c_str());
+                return -1;
+            }
+        }
+    }
+    if (replacement.empty())
+        return 0;
+    // like the nodes created by graph optimization, the node parameters aren't reference counted:
+    // the caller has to keep the new objects alive while the graph uses them
+    std::vector<AgoNode *> updatedNodes;
+    for (AgoNode * node = graph->nodeList.head; node; node = node->next) {
+        bool updated = false;
+        for (vx_uint32 i = 0; i < node->paramCount; i++) {
+            auto it = replacement.find(node->paramList[i]);
+            if (it != replacement.end()) {
+                node->paramList[i] = it->second;
+                updated = true;
+            }
+            it = replacement.find(node->paramListForAgeDelay[i]);
+            if (it != replacement.end()) {
+                node->paramListForAgeDelay[i] = it->second;
+            }
+        }
+        if (updated)
+            updatedNodes.push_back(node);
+    }
+#if (ENABLE_OPENCL||ENABLE_HIP)
+    std::vector<AgoSuperNode *> updatedSupernodes;
+    for (AgoSuperNode * supernode = graph->supernodeList; supernode; supernode = supernode->next) {
+        bool updated = false;
+        for (size_t i = 0; i < supernode->dataList.size(); i++) {
+            auto it = replacement.find(supernode->dataList[i]);
+            if (it != replacement.end()) {
+                supernode->dataList[i] = it->second;
+                updated = true;
+            }
+        }
+        for (size_t i = 0; i < supernode->dataListForAgeDelay.size(); i++) {
+            auto it = replacement.find(supernode->dataListForAgeDelay[i]);
+            if (it != replacement.end()) {
+                supernode->dataListForAgeDelay[i] = it->second;
+            }
+        }
+        if (updated)
+            updatedSupernodes.push_back(supernode);
+    }
+    // GPU buffers are allocated during verification for the objects used by GPU nodes
+    for (auto it = replacement.begin(); it != replacement.end(); it++) {
+#if ENABLE_OPENCL
+        if (it->first->opencl_buffer && !it->second->opencl_buffer && agoGpuOclAllocBuffer(it->second) < 0)
+            return -1;
+#elif ENABLE_HIP
+        if (it->first->hip_memory && !it->second->hip_memory && agoGpuHipAllocBuffer(it->second) < 0)
+            return -1;
+#endif
+    }
+#if ENABLE_OPENCL
+    // OpenCL kernel arguments are set when the kernels are built
+    for (auto supernode : updatedSupernodes) {
+        if (agoGpuOclSuperNodeSetKernelArgs(graph, supernode) < 0)
+            return -1;
+    }
+    for (auto node : updatedNodes) {
+        if (node->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_GPU && node->attr_affinity.group == 0 && node->opencl_kernel) {
+            if (agoGpuOclSingleNodeSetKernelArgs(graph, node) < 0)
+                return -1;
+        }
+    }
+#endif
+#endif
+    // valid rectangles are tracked in the data objects
+    if (agoPrepareImageValidRectangleBuffers(graph) || agoComputeImageValidRectangleOutputs(graph))
+        return -1;
+    return 0;
+}
+
+// objects that can replace each other in a verified graph: the same meta-format, and the same values for
+// the attributes that graph optimization can specialize on
+static bool agoIsDataRebindable(AgoData * oldData, AgoData * newData, vx_enum direction)
+{
+    if (oldData->ref.type != newData->ref.type || oldData->isVirtual || newData->isVirtual)
+        return false;
+    if (oldData->ref.type == VX_TYPE_IMAGE) {
+        // ROI images carry their own buffer pointer and stride, so only the pixel layout matters
+        return !oldData->u.img.isUniform && !newData->u.img.isUniform &&
+               oldData->u.img.format == newData->u.img.format &&
+               oldData->u.img.width == newData->u.img.width && oldData->u.img.height == newData->u.img.height;
+    }
+    if (oldData->ref.type == VX_TYPE_SCALAR && direction != VX_INPUT) {
+        // output values don't matter
+        return oldData->u.scalar.type == newData->u.scalar.type;
+    }
+    char descOld[MAX_DESCRIPTION_DATA_SIZE * 2], descNew[MAX_DESCRIPTION_DATA_SIZE * 2];
+    agoGetDescriptionFromData(oldData->ref.context, descOld, oldData);
+    agoGetDescriptionFromData(newData->ref.context, descNew, newData);
+    if (strcmp(descOld, descNew))
+        return false;
+    if (oldData->ref.type == VX_TYPE_CONVOLUTION || oldData->ref.type == VX_TYPE_MATRIX) {
+        // coefficients can select kernels during verification
+        return oldData->size == newData->size && oldData->buffer && newData->buffer &&
+               !memcmp(oldData->buffer, newData->buffer, oldData->size);
+    }
+    return true;
+}
+
+// bind a new object to a graph parameter of a verified graph without verifying it again: the object that
+// was bound to the parameter is replaced in all nodes of the optimized graph (see agoReplaceGraphData)
+int agoRebindGraphParameter(AgoGraph * graph, vx_uint32 index, AgoData * data)
+{
+    CAgoLock lock(graph->cs);
+    vx_parameter parameter = graph->parameters[index];
+    AgoNode * node = (AgoNode *)parameter->scope;
+    AgoData * oldData = node->paramList[parameter->index];
+    if (oldData == data)
+        return 0;
+    if (!oldData || !data || !agoIsDataRebindable(oldData, data, node->parameters[parameter->index].direction)) {
+        agoAddLogEntry(&graph->ref, VX_ERROR_INVALID_PARAMETERS, "ERROR: vxSetGraphParameterByIndex: graph parameter #%d of a verified graph needs an object with the same meta-format\n", index);
+        return -1;
+    }
+    if (agoReplaceGraphData(graph, 1, &oldData, &data))
+        return -1;
+    // the original node may have been replaced during optimization
+    node->paramList[parameter->index] = node->paramListForAgeDelay[parameter->index] = data;
+    agoRetainData(graph, data, false);
+    agoReleaseData(oldData, false);
+    return 0;
+}
+
 vx_status agoComputeImageValidRectangleOutputs(AgoGraph * graph)
 {
     vx_status status = VX_SUCCESS;
@@ -2800,6 +3253,9 @@ int agoProcessGraph(AgoGraph * graph)
     vx_status status = VX_ERROR_INVALID_REFERENCE;
     if (agoIsValidGraph(graph)) {
         CAgoLock lock(graph->cs);
+        // data-parallel kernels of the graph run on the scheduler of its context
+        AgoContext * processingContext = s_processingContext;
+        s_processingContext = graph->ref.context;
         // make sure that graph is verified
         status = VX_SUCCESS;
         if (!graph->verified) {
@@ -2815,6 +3271,7 @@ int agoProcessGraph(AgoGraph * graph)
                 status = VX_FAILURE;
             }
         }
+        s_processingContext = processingContext;
     }
     return status;
 }
@@ -2825,6 +3282,17 @@ int agoScheduleGraph(AgoGraph * graph)
     if (agoIsValidGraph(graph)) {
         status = VX_SUCCESS;
         graph->threadScheduleCount++;
+        vx_uint32 thread_config = graph->ref.context->thread_config;
+        if ((thread_config & 2) && !graph->hThread) {
+            // the dedicated graph thread is created on first use
+            CAgoLock lock(graph->cs);
+            if (!graph->hThread) {
+                status = agoCreateGraphThread(graph);
+            }
+        }
+        if (status != VX_SUCCESS) {
+            return status;
+        }
         if (graph->hThread) {
             if (!graph->verified) {
                 // make sure to verify the graph in master thread
@@ -2838,6 +3306,30 @@ int agoScheduleGraph(AgoGraph * graph)
                 }
             }
         }
+        else if (thread_config & 1) {
+            if (!graph->verified) {
+                // make sure to verify the graph in master thread
+                CAgoLock lock(graph->cs);
+                status = vxVerifyGraph(graph);
+            }
+            if (status == VX_SUCCESS) {
+                AgoGraphScheduler * scheduler = agoGetGraphScheduler(graph->ref.context);
+                std::promise<vx_status> promise;
+                bool startTask = false;
+                {
+                    std::lock_guard<std::mutex> lock(graph->scheduleMutex);
+                    graph->scheduleFutures.push_back(promise.get_future());
+                    graph->scheduleQueue.push_back(std::move(promise));
+                    if (!graph->scheduleRunning) {
+                        graph->scheduleRunning = true;
+                        startTask = true;
+                    }
+                }
+                if (startTask) {
+                    scheduler->submit([graph]() { agoGraphSchedulerTask(graph); });
+                }
+            }
+        }
         else {
             status = agoProcessGraph(graph);
         }
@@ -2853,6 +3345,9 @@ int agoWaitGraph(AgoGraph * graph)
         graph->threadWaitCount++;
         if (graph->threadScheduleCount <= 0) // the graph was never scheduled so return VX_FAILURE
             return VX_FAILURE;
+        if (graph->ref.context->graph_scheduler) {
+            status = agoWaitGraphScheduler(graph);
+        }
         if (graph->hThread) {
             graph->threadThreadWaitState = 1;
             while (graph->threadThreadWaitState == 1) {
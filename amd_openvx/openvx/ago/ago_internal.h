@@ -112,12 +112,13 @@ THE SOFTWARE.
 #define AGO_REMAP_CONSTANT_BORDER_VALUE  0xffff // corrdinate value indicating out of border for constant fills
 
 // AGO buffer sync flags
-#define AGO_BUFFER_SYNC_FLAG_DIRTY_MASK         0x0000000f // dirty bit mask
+#define AGO_BUFFER_SYNC_FLAG_DIRTY_MASK         0x0000002f // dirty bit mask
 #define AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT    0x00000001 // buffer dirty by user
 #define AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE      0x00000002 // buffer dirty by node
 #define AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL   0x00000004 // OpenCL buffer dirty by node
 #define AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED      0x00000008 // OpenCL buffer has been synced
 #define AGO_BUFFER_SYNC_FLAG_DIRTY_BY_WRITE     0x00000010 // buffer dirty by write
+#define AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED_RECT 0x00000020 // OpenCL buffer has been synced only in AgoData::synched_rect
 
 // AGO graph optimizer
 #define AGO_GRAPH_OPTIMIZER_FLAG_NO_DIVIDE                0x00000001 // don't run drama divide
@@ -173,7 +174,10 @@ THE SOFTWARE.
 #define GPU_IMAGE_FIXED_OFFSET             256
 
 // thread scheduling configuration
-#define CONFIG_THREAD_DEFAULT                 1  // 0:disable 1:enable separate threads for graph scheduling
+#define CONFIG_THREAD_DEFAULT                 1  // 0:disable 1:schedule graphs on the context-wide scheduler 2:schedule graphs on a dedicated thread per graph
+
+// immediate mode (vxu) configuration
+#define CONFIG_IMMEDIATE_GRAPH_CACHE_SIZE    16  // number of verified vxu graphs kept per context (0:disable)
 
 // module specific
 #define MAX_MODULE_NAME_SIZE 1024
@@ -256,6 +260,7 @@ struct AgoProfileEntry {
 struct AgoNode;
 struct AgoContext;
 struct AgoData;
+class AgoGraphScheduler;
 struct AgoReference {
     struct _vx_platform * platform; // platform handle to support Installable Client Driver (ICD) loader
     vx_uint32    magic;           // shall be always be AGO_MAGIC
@@ -402,6 +407,15 @@ struct AgoConfigScaleMatrix {
     vx_float32 xoffset;
     vx_float32 yoffset;
 };
+struct AgoConvolveSeparable { // rank-1 factorization: weight(dy,dx) = colCoef[dy+rows/2] * rowCoef[dx+columns/2]
+    vx_int16 matrix[AGO_MAX_CONVOLUTION_DIM * AGO_MAX_CONVOLUTION_DIM]; // coefficients the factorization was computed from
+    vx_uint32 columns;
+    vx_uint32 rows;
+    vx_bool separable;
+    vx_bool box; // all coefficients are equal: running sums are used in both directions
+    vx_int32 rowCoef[AGO_MAX_CONVOLUTION_DIM];
+    vx_int32 colCoef[AGO_MAX_CONVOLUTION_DIM];
+};
 struct AgoTargetAffinityInfo_ { // NOTE: make sure that this data structure is identical to AgoTargetAffinityInfo in vx_amd_ext.h
     vx_uint32 device_type;
     vx_uint32 device_info;
@@ -415,6 +429,7 @@ struct MappedData {
     bool used_external_ptr;
     vx_size stride;
     vx_uint32 plane;
+    vx_rectangle_t rect;
 };
 struct AgoData {
     AgoReference ref;
@@ -444,6 +459,7 @@ struct AgoData {
     vx_uint8 * reserved;
     vx_uint8 * reserved_allocated;
     vx_uint32  buffer_sync_flags;
+    vx_rectangle_t synched_rect;
 #if ENABLE_OPENCL
     cl_mem     opencl_buffer;
     cl_mem     opencl_buffer_allocated;
@@ -660,6 +676,10 @@ struct AgoGraph {
     CRITICAL_SECTION cs;
     HANDLE hThread, hSemToThread, hSemFromThread;
     vx_int32 threadScheduleCount, threadExecuteCount, threadWaitCount, threadThreadTerminationState, threadThreadWaitState;
+    std::mutex scheduleMutex;                                // protects the scheduler state below
+    std::deque<std::promise<vx_status>> scheduleQueue;      // pending executions on the context scheduler
+    std::vector<std::future<vx_status>> scheduleFutures;   // executions not yet waited by agoWaitGraph
+    bool scheduleRunning;                                   // a scheduler task is executing the scheduleQueue
     AgoDataList dataList;
     AgoNodeList nodeList;
     vx_bool isReadyToExecute;
@@ -681,6 +701,8 @@ struct AgoGraph {
     bool verified;
     std::vector<vx_parameter> parameters;
     std::vector<AgoData *> autoAgeDelayList;
+    std::vector<AgoData *> contextDataList;    // context objects used by the graph, collected for the verification
+    std::vector<AgoData *> contextDataClaims;  // top-level context objects claimed by the verification of the graph
 #if (ENABLE_OPENCL||ENABLE_HIP)
     std::vector<AgoNode *> gpu_nodeListQueued;
     AgoSuperNode * supernodeList;
@@ -722,6 +744,11 @@ struct MacroData {
     char * text;
     char * text_allocated;
 };
+struct AgoImmediateGraph {
+    std::string signature;         // kernel, node attributes, and parameter meta-formats
+    AgoGraph * graph;              // verified graph: holds one internal reference
+    std::vector<AgoData *> params; // objects currently bound to the node parameters
+};
 struct AgoContext {
     AgoReference ref;
     vx_uint64 perfNormFactor;
@@ -730,17 +757,24 @@ struct AgoContext {
     AgoDataList dataList;
     AgoGraphList graphList;
     std::vector<AgoUserStruct> userStructList;
-    vx_uint32 dataGenerationCount;
+    std::atomic<vx_uint32> dataGenerationCount;
     vx_enum nextUserStructId;
     vx_uint32 nextUserKernelId;
     vx_uint32 nextUserLibraryId;
     vx_uint32 num_active_modules;
-    vx_uint32 num_active_references;
+    std::atomic<vx_uint32> num_active_references;
     vx_border_mode_t immediate_border_mode;
     vx_border_mode_policy_e immediate_border_policy;
     vx_log_callback_f callback_log;
     vx_bool callback_reentrant;
     vx_uint32 thread_config;
+    AgoGraphScheduler * graph_scheduler;
+    std::mutex graph_scheduler_mutex;                     // protects the creation of graph_scheduler
+    std::list<AgoImmediateGraph> immediate_graph_cache; // most recently used first
+    vx_uint32 immediate_graph_cache_size;
+    std::mutex verify_mutex;                              // protects verify_claims
+    std::condition_variable verify_cv;                    // signaled when graph verifications release their claims
+    std::map<AgoData *, std::thread::id> verify_claims;   // top-level objects used by the graphs being verified
     vx_char extensions[256];
     std::vector<ModuleData> modules;
     std::vector<MacroData> macros;
@@ -850,6 +884,8 @@ int agoGetImageComponentsAndPlanes(AgoContext * acontext, vx_df_image format, vx
 int agoGetImagePlaneFormat(AgoContext * acontext, vx_df_image format, vx_uint32 width, vx_uint32 height, vx_uint32 plane, vx_df_image *pFormat, vx_uint32 * pWidth, vx_uint32 * pHeight);
 void agoGetDataName(vx_char * name, AgoData * data);
 int agoAllocData(AgoData * data);
+int agoSyncImagePatchFromGpu(AgoData * img, const vx_rectangle_t * rect);
+int agoSyncImagePatchToGpu(AgoData * img, const vx_rectangle_t * rect);
 void agoRetainData(AgoGraph * graph, AgoData * data, bool isForExternalUse);
 int agoReleaseData(AgoData * data, bool isForExternalUse);
 int agoReleaseKernel(AgoKernel * kernel, bool isForExternalUse);
@@ -906,12 +942,15 @@ int agoGpuOclReleaseSuperNode(AgoSuperNode * supernode);
 int agoGpuOclReleaseData(AgoData * data);
 int agoGpuOclCreateContext(AgoContext * context, cl_context opencl_context);
 int agoGpuOclAllocBuffer(AgoData * data);
+int agoGpuOclCopyImageRegion(AgoData * data, vx_uint32 x_in_bytes, vx_uint32 y, vx_uint32 width_in_bytes, vx_uint32 height, bool toDevice);
 int agoGpuOclSuperNodeMerge(AgoGraph * graph, AgoSuperNode * supernode, AgoNode * node);
 int agoGpuOclSuperNodeUpdate(AgoGraph * graph, AgoSuperNode * supernode);
 int agoGpuOclSuperNodeFinalize(AgoGraph * graph, AgoSuperNode * supernode);
+int agoGpuOclSuperNodeSetKernelArgs(AgoGraph * graph, AgoSuperNode * supernode);
 int agoGpuOclSuperNodeLaunch(AgoGraph * graph, AgoSuperNode * supernode);
 int agoGpuOclSuperNodeWait(AgoGraph * graph, AgoSuperNode * supernode);
 int agoGpuOclSingleNodeFinalize(AgoGraph * graph, AgoNode * node);
+int agoGpuOclSingleNodeSetKernelArgs(AgoGraph * graph, AgoNode * node);
 int agoGpuOclSingleNodeLaunch(AgoGraph * graph, AgoNode * node);
 int agoGpuOclSingleNodeWait(AgoGraph * graph, AgoNode * node);
 #elif ENABLE_HIP
@@ -921,6 +960,7 @@ int agoGpuHipReleaseGraph(AgoGraph * graph);
 int agoGpuHipReleaseSuperNode(AgoSuperNode * supernode);
 int agoGpuHipReleaseData(AgoData * data);
 int agoGpuHipAllocBuffer(AgoData * data);
+int agoGpuHipCopyImageRegion(AgoData * data, vx_uint32 x_in_bytes, vx_uint32 y, vx_uint32 width_in_bytes, vx_uint32 height, bool toDevice);
 int agoGpuHipSingleNodeWait(AgoGraph * graph, AgoNode * node);
 int agoGpuHipSuperNodeMerge(AgoGraph * graph, AgoSuperNode * supernode, AgoNode * node);
 int agoGpuHipSuperNodeUpdate(AgoGraph * graph, AgoSuperNode * supernode);
@@ -939,12 +979,16 @@ extern "C" typedef void (VX_CALLBACK * ago_data_registry_callback_f) (void * obj
 AgoContext * agoCreateContextFromPlatform(struct _vx_platform * platform);
 AgoContext * agoCreateContext();
 AgoGraph * agoCreateGraph(AgoContext * acontext);
-int agoReleaseGraph(AgoGraph * agraph);
+int agoReleaseGraph(AgoGraph * agraph, bool isForExternalUse);
 int agoReleaseContext(AgoContext * acontext);
 int agoVerifyGraph(AgoGraph * agraph);
 vx_status agoPrepareImageValidRectangleBuffers(AgoGraph * graph);
 vx_status agoComputeImageValidRectangleOutputs(AgoGraph * graph);
+int agoReplaceGraphData(AgoGraph * graph, vx_uint32 count, AgoData * oldData[], AgoData * newData[]);
+int agoRebindGraphParameter(AgoGraph * graph, vx_uint32 index, AgoData * data);
 int agoOptimizeGraph(AgoGraph * agraph);
+void agoAcquireGraphContextData(AgoGraph * agraph);
+void agoReleaseGraphContextData(AgoGraph * agraph);
 int agoInitializeGraph(AgoGraph * agraph);
 int agoShutdownGraph(AgoGraph * graph);
 int agoExecuteGraph(AgoGraph * agraph);
@@ -962,7 +1006,20 @@ vx_status agoGraphDumpPerformanceProfile(AgoGraph * graph, const char * fileName
 vx_status agoDirective(vx_reference reference, vx_enum directive);
 
 ///////////////////////////////////////////////////////////
-// locks
+// locks: when more than one is held, they are taken in this order
+//   1. global context lock (context creation and release)
+//   2. graph cs            (verify, process, schedule and release of the graph); a kernel may verify and
+//                          process a graph it created (e.g., vxu calls) while the cs of its own graph is held
+//   3. data claims         (context->verify_mutex/verify_claims, see agoAcquireGraphContextData): taken by
+//                          vxVerifyGraph with the graph cs held and released before it returns; a thread
+//                          re-claims its own objects, so nested verifications don't wait for themselves
+//   4. context cs          (context object lists, data objects, kernels, log, vxu graph cache list)
+//   5. scheduler mutexes   (context->graph_scheduler_mutex, graph->scheduleMutex, AgoGraphScheduler queues):
+//                          held only to update their queues, no other lock is taken while they are held
+// a thread holding a context cs must not wait for a graph cs or a data claim of that context: the vxu
+// graph cache takes an entry out of its list under the context cs and processes it after releasing it.
+// no lock is held while waiting for a scheduled graph: vxWaitGraph waits on the futures of the graph
+// without its graph cs, and a waiting scheduler worker keeps running tasks.
 void agoLockGlobalContext();
 void agoUnlockGlobalContext();
 class CAgoLockGlobalContext {
@@ -979,6 +1036,40 @@ private:
     CRITICAL_SECTION * m_cs;
 };
 
+//! \brief Context-wide executor for scheduled graphs.
+//  Tasks are queued on per-worker deques: a worker runs its own tasks in LIFO order and steals
+//  from the other workers in FIFO order when idle. A worker that waits for a future keeps
+//  running tasks, so that nested waits don't block the pool.
+class AgoGraphScheduler {
+public:
+    AgoGraphScheduler(vx_uint32 numThreads);
+    ~AgoGraphScheduler();
+    vx_uint32 numThreads() const { return (vx_uint32)m_workers.size(); }
+    void submit(std::function<void()> task);
+    vx_status wait(std::future<vx_status>& future);
+    // run func(begin, end) on sub-ranges of [0, count) on the workers and the calling thread
+    void parallelFor(vx_uint32 count, vx_uint32 minItemsPerThread, const std::function<void(vx_uint32, vx_uint32)>& func);
+    // scheduler of the calling worker thread or nullptr
+    static AgoGraphScheduler * current();
+    // scheduler for data-parallel work of the calling thread: its own scheduler inside a worker, the scheduler
+    // of the context whose graph is being processed, otherwise a process-wide scheduler
+    static AgoGraphScheduler * forCallingThread();
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+    bool runTask(vx_uint32 self);
+    void workerLoop(vx_uint32 self);
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::atomic<vx_uint32> m_pending;
+    std::atomic<vx_uint32> m_nextQueue;
+    bool m_exit;
+};
+
 inline int leftmostbit(unsigned int n) {
     int pos = 31;
     while (pos >= 0 && !(n & (1 << pos)))
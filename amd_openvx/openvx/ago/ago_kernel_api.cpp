@@ -31,6 +31,105 @@ THE SOFTWARE.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Local Utility Functions
 //
+static vx_status ValidateArguments_TensorTranspose(AgoNode * node, AgoData * input, AgoData * dim1, AgoData * dim2, vx_meta_format meta)
+{
+    if (dim1->u.scalar.type != VX_TYPE_SIZE || dim2->u.scalar.type != VX_TYPE_SIZE)
+        return VX_ERROR_INVALID_TYPE;
+    vx_size d1 = dim1->u.scalar.u.s, d2 = dim2->u.scalar.u.s;
+    if (d1 >= input->u.tensor.num_dims || d2 >= input->u.tensor.num_dims)
+        return VX_ERROR_INVALID_VALUE;
+    // output is the input with the two dimensions swapped
+    meta->data.u.tensor.num_dims = input->u.tensor.num_dims;
+    for (vx_size i = 0; i < input->u.tensor.num_dims; i++)
+        meta->data.u.tensor.dims[i] = input->u.tensor.dims[i];
+    meta->data.u.tensor.dims[d1] = input->u.tensor.dims[d2];
+    meta->data.u.tensor.dims[d2] = input->u.tensor.dims[d1];
+    meta->data.u.tensor.data_type = input->u.tensor.data_type;
+    meta->data.u.tensor.fixed_point_pos = input->u.tensor.fixed_point_pos;
+    return VX_SUCCESS;
+}
+
+static vx_status ValidateArguments_TensorConvertDepth(AgoNode * node, AgoData * output, AgoData * input, AgoData * policy, AgoData * norm, AgoData * offset, vx_meta_format meta)
+{
+    if (policy->u.scalar.type != VX_TYPE_ENUM || norm->u.scalar.type != VX_TYPE_FLOAT32 || offset->u.scalar.type != VX_TYPE_FLOAT32)
+        return VX_ERROR_INVALID_TYPE;
+    else if (policy->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && policy->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+        return VX_ERROR_INVALID_VALUE;
+    else if (norm->u.scalar.u.f == 0.0f)
+        return VX_ERROR_INVALID_VALUE;
+    // output has the dimensions of the input and keeps its own data type
+    meta->data.u.tensor.num_dims = input->u.tensor.num_dims;
+    for (vx_size i = 0; i < input->u.tensor.num_dims; i++)
+        meta->data.u.tensor.dims[i] = input->u.tensor.dims[i];
+    meta->data.u.tensor.data_type = output->u.tensor.data_type;
+    meta->data.u.tensor.fixed_point_pos = output->u.tensor.fixed_point_pos;
+    return VX_SUCCESS;
+}
+
+// element-wise tensor inputs must match the output or have size 1 in each dimension
+static vx_status ValidateArguments_TensorElementwise(AgoNode * node, AgoData * input1, AgoData * input2, vx_meta_format meta)
+{
+    if (input1->u.tensor.data_type != input2->u.tensor.data_type || input1->u.tensor.fixed_point_pos != input2->u.tensor.fixed_point_pos)
+        return VX_ERROR_INVALID_TYPE;
+    vx_size num_dims = std::max(input1->u.tensor.num_dims, input2->u.tensor.num_dims);
+    for (vx_size i = 0; i < num_dims; i++) {
+        vx_size dim1 = (i < input1->u.tensor.num_dims) ? input1->u.tensor.dims[i] : 1;
+        vx_size dim2 = (i < input2->u.tensor.num_dims) ? input2->u.tensor.dims[i] : 1;
+        if (dim1 != dim2 && dim1 != 1 && dim2 != 1)
+            return VX_ERROR_INVALID_DIMENSION;
+        meta->data.u.tensor.dims[i] = std::max(dim1, dim2);
+    }
+    meta->data.u.tensor.num_dims = num_dims;
+    meta->data.u.tensor.data_type = input1->u.tensor.data_type;
+    meta->data.u.tensor.fixed_point_pos = input1->u.tensor.fixed_point_pos;
+    return VX_SUCCESS;
+}
+
+// byte strides of an element-wise input over the output dimensions, with zero strides for broadcast dimensions
+static void agoGetTensorBroadcastStrides(AgoData * input, AgoData * output, vx_size stride[])
+{
+    for (vx_size i = 0; i < output->u.tensor.num_dims; i++) {
+        bool present = (i < input->u.tensor.num_dims) && input->u.tensor.dims[i] == output->u.tensor.dims[i];
+        stride[i] = present ? input->u.tensor.stride[i] : 0;
+    }
+}
+
+// checks the image/tensor pair of ImageToTensor and TensorToImage, and gets the per-channel coefficients
+// of tensor = (image - mean) * scale
+static vx_status ValidateArguments_ImageTensor(AgoNode * node, AgoData * img, AgoData * tensor, vx_df_image format,
+    vx_uint32 * channels, vx_uint32 * batch, vx_float32 mean[3], vx_float32 scale[3])
+{
+    AgoData * mean_arr = node->paramList[2];
+    AgoData * scale_arr = node->paramList[3];
+    AgoData * nhwc_scalar = node->paramList[4];
+    AgoData * reverse_scalar = node->paramList[5];
+    if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_RGB)
+        return VX_ERROR_INVALID_FORMAT;
+    vx_uint32 C = (format == VX_DF_IMAGE_RGB) ? 3 : 1;
+    if ((mean_arr && (mean_arr->u.arr.itemtype != VX_TYPE_FLOAT32 || (mean_arr->u.arr.numitems != 1 && mean_arr->u.arr.numitems != C))) ||
+        (scale_arr && (scale_arr->u.arr.itemtype != VX_TYPE_FLOAT32 || (scale_arr->u.arr.numitems != 1 && scale_arr->u.arr.numitems != C))) ||
+        (nhwc_scalar && nhwc_scalar->u.scalar.type != VX_TYPE_BOOL) || (reverse_scalar && reverse_scalar->u.scalar.type != VX_TYPE_BOOL))
+        return VX_ERROR_INVALID_PARAMETERS;
+    vx_enum data_type = tensor->u.tensor.data_type;
+    if (data_type != VX_TYPE_FLOAT32 && data_type != VX_TYPE_FLOAT16 && data_type != VX_TYPE_INT16 && data_type != VX_TYPE_UINT8 && data_type != VX_TYPE_INT8)
+        return VX_ERROR_INVALID_TYPE;
+    if (tensor->u.tensor.num_dims != 3 && tensor->u.tensor.num_dims != 4)
+        return VX_ERROR_INVALID_DIMENSION;
+    bool nhwc = nhwc_scalar && nhwc_scalar->u.scalar.u.i ? true : false;
+    vx_size W = tensor->u.tensor.dims[nhwc ? 1 : 0], H = tensor->u.tensor.dims[nhwc ? 2 : 1], N = tensor->u.tensor.num_dims > 3 ? tensor->u.tensor.dims[3] : 1;
+    if (tensor->u.tensor.dims[nhwc ? 0 : 2] != C || W != img->u.img.width || H * N != img->u.img.height)
+        return VX_ERROR_INVALID_DIMENSION;
+    *channels = C;
+    *batch = (vx_uint32)N;
+    for (vx_uint32 c = 0; c < 3; c++) {
+        if (mean)
+            mean[c] = mean_arr && mean_arr->buffer ? ((vx_float32 *)mean_arr->buffer)[mean_arr->u.arr.numitems > 1 ? c : 0] : 0.0f;
+        if (scale)
+            scale[c] = scale_arr && scale_arr->buffer ? ((vx_float32 *)scale_arr->buffer)[scale_arr->u.arr.numitems > 1 ? c : 0] : 1.0f;
+    }
+    return VX_SUCCESS;
+}
+
 static int ValidateArguments_Img_1IN(AgoNode * node, vx_df_image fmtIn)
 {
     // validate parameters
@@ -632,7 +731,10 @@ int ovxKernel_ScaleImage(AgoNode * node, AgoKernelCommand cmd)
     }
     else if (cmd == ago_kernel_cmd_validate) {
         // validate parameters
-        if (node->paramList[0]->u.img.format != VX_DF_IMAGE_U8 || node->paramList[1]->u.img.format != VX_DF_IMAGE_U8)
+        vx_df_image format = node->paramList[0]->u.img.format;
+        if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_RGBX && format != VX_DF_IMAGE_U16 && format != VX_DF_IMAGE_S16)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (node->paramList[1]->u.img.format != format && node->paramList[1]->u.img.format != VX_DF_IMAGE_VIRT)
             return VX_ERROR_INVALID_FORMAT;
         else if (!node->paramList[0]->u.img.width || !node->paramList[0]->u.img.height || !node->paramList[1]->u.img.width || !node->paramList[1]->u.img.height)
             return VX_ERROR_INVALID_DIMENSION;
@@ -647,7 +749,7 @@ int ovxKernel_ScaleImage(AgoNode * node, AgoKernelCommand cmd)
         meta = &node->metaList[1];
         meta->data.u.img.width = node->paramList[1]->u.img.width;
         meta->data.u.img.height = node->paramList[1]->u.img.height;
-        meta->data.u.img.format = VX_DF_IMAGE_U8;
+        meta->data.u.img.format = format;
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
@@ -1785,7 +1887,10 @@ int ovxKernel_WarpAffine(AgoNode * node, AgoKernelCommand cmd)
         // validate parameters
         vx_uint32 width = node->paramList[0]->u.img.width;
         vx_uint32 height = node->paramList[0]->u.img.height;
-        if (node->paramList[0]->u.img.format != VX_DF_IMAGE_U8)
+        vx_df_image format = node->paramList[0]->u.img.format;
+        if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_RGBX && format != VX_DF_IMAGE_U16 && format != VX_DF_IMAGE_S16)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (node->paramList[3]->u.img.format != format && node->paramList[3]->u.img.format != VX_DF_IMAGE_VIRT)
             return VX_ERROR_INVALID_FORMAT;
         else if (!width || !height)
             return VX_ERROR_INVALID_DIMENSION;
@@ -1800,7 +1905,7 @@ int ovxKernel_WarpAffine(AgoNode * node, AgoKernelCommand cmd)
         meta = &node->metaList[3];
         meta->data.u.img.width = node->paramList[3]->u.img.width;
         meta->data.u.img.height = node->paramList[3]->u.img.height;
-        meta->data.u.img.format = VX_DF_IMAGE_U8;
+        meta->data.u.img.format = format;
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
@@ -1829,7 +1934,10 @@ int ovxKernel_WarpPerspective(AgoNode * node, AgoKernelCommand cmd)
         // validate parameters
         vx_uint32 width = node->paramList[0]->u.img.width;
         vx_uint32 height = node->paramList[0]->u.img.height;
-        if (node->paramList[0]->u.img.format != VX_DF_IMAGE_U8)
+        vx_df_image format = node->paramList[0]->u.img.format;
+        if (format != VX_DF_IMAGE_U8 && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_RGBX && format != VX_DF_IMAGE_U16 && format != VX_DF_IMAGE_S16)
+            return VX_ERROR_INVALID_FORMAT;
+        else if (node->paramList[3]->u.img.format != format && node->paramList[3]->u.img.format != VX_DF_IMAGE_VIRT)
             return VX_ERROR_INVALID_FORMAT;
         else if (!width || !height)
             return VX_ERROR_INVALID_DIMENSION;
@@ -1844,7 +1952,7 @@ int ovxKernel_WarpPerspective(AgoNode * node, AgoKernelCommand cmd)
         meta = &node->metaList[3];
         meta->data.u.img.width = node->paramList[3]->u.img.width;
         meta->data.u.img.height = node->paramList[3]->u.img.height;
-        meta->data.u.img.format = VX_DF_IMAGE_U8;
+        meta->data.u.img.format = format;
         status = VX_SUCCESS;
     }
     else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
@@ -2018,7 +2126,8 @@ int ovxKernel_Remap(AgoNode * node, AgoKernelCommand cmd)
         // validate parameters
         vx_uint32 width = node->paramList[0]->u.img.width;
         vx_uint32 height = node->paramList[0]->u.img.height;
-        if (node->paramList[0]->u.img.format != VX_DF_IMAGE_U8 && node->paramList[0]->u.img.format != VX_DF_IMAGE_RGB && node->paramList[0]->u.img.format != VX_DF_IMAGE_RGBX)
+        if (node->paramList[0]->u.img.format != VX_DF_IMAGE_U8 && node->paramList[0]->u.img.format != VX_DF_IMAGE_RGB && node->paramList[0]->u.img.format != VX_DF_IMAGE_RGBX &&
+            node->paramList[0]->u.img.format != VX_DF_IMAGE_U16 && node->paramList[0]->u.img.format != VX_DF_IMAGE_S16)
             return VX_ERROR_INVALID_FORMAT;
         else if (!width || !height || width != node->paramList[1]->u.remap.src_width || height != node->paramList[1]->u.remap.src_height)
             return VX_ERROR_INVALID_DIMENSION;
@@ -2357,6 +2466,52 @@ int ovxKernel_LaplacianReconstruct(AgoNode * node, AgoKernelCommand cmd)
     return status;
 }
 
+int ovxKernel_TensorTranspose(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_TRANSPOSE_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_TensorTranspose(node, node->paramList[0], node->paramList[2], node->paramList[3], &node->metaList[1]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int ovxKernel_TensorConvertDepth(AgoNode * node, AgoKernelCommand cmd)
+{
+    // INFO: use VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_* kernels
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        // TBD: not implemented yet
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_TensorConvertDepth(node, node->paramList[4], node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3], &node->metaList[4]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = AGO_KERNEL_FLAG_SUBGRAPH
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
 #if ENABLE_OPENCL
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Local OpenCL Codegen Functions
@@ -15584,7 +15739,12 @@ int agoKernel_Convolve_U8_U8(AgoNode * node, AgoKernelCommand cmd)
         AgoData * iConv = node->paramList[2];
         vx_uint32 convolutionWidth = (vx_uint32)iConv->u.conv.columns;
         vx_uint32 convolutionHeight = (vx_uint32)iConv->u.conv.rows;
-        if (convolutionWidth == 3) {
+        if (HafCpu_FactorizeConvolution((ago_separable_conv_t *)node->localDataPtr, (vx_int16 *)iConv->buffer, convolutionWidth, convolutionHeight)) {
+            status = HafCpu_ConvolveSeparable_U8_U8(oImg->u.img.width, oImg->u.img.height - convolutionHeight + 1,
+                oImg->buffer + oImg->u.img.stride_in_bytes * (convolutionHeight >> 1), oImg->u.img.stride_in_bytes,
+                iImg->buffer + iImg->u.img.stride_in_bytes * (convolutionHeight >> 1), iImg->u.img.stride_in_bytes, (ago_separable_conv_t *)node->localDataPtr, iConv->u.conv.shift);
+        }
+        else if (convolutionWidth == 3) {
             status = HafCpu_Convolve_U8_U8_3xN(oImg->u.img.width, oImg->u.img.height - convolutionHeight + 1,
                 oImg->buffer + oImg->u.img.stride_in_bytes * (convolutionHeight >> 1), oImg->u.img.stride_in_bytes,
                 iImg->buffer + iImg->u.img.stride_in_bytes * (convolutionHeight >> 1), iImg->u.img.stride_in_bytes, (vx_int16 *)iConv->buffer, convolutionHeight, iConv->u.conv.shift);
@@ -15630,8 +15790,22 @@ int agoKernel_Convolve_U8_U8(AgoNode * node, AgoKernelCommand cmd)
         meta->data.u.img.format = VX_DF_IMAGE_U8;
         status = VX_SUCCESS;
     }
-    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+    else if (cmd == ago_kernel_cmd_initialize) {
+        status = VX_SUCCESS;
+        // detect separable (rank-1) matrices once at verify time; execute only re-checks the coefficients
+        node->localDataSize = sizeof(ago_separable_conv_t);
+        node->localDataPtr = (vx_uint8 *)agoAllocMemory(node->localDataSize);
+        if (!node->localDataPtr) return VX_ERROR_NO_MEMORY;
+        memset(node->localDataPtr, 0, node->localDataSize);
+        AgoData * iConv = node->paramList[2];
+        HafCpu_FactorizeConvolution((ago_separable_conv_t *)node->localDataPtr, (vx_int16 *)iConv->buffer, (vx_uint32)iConv->u.conv.columns, (vx_uint32)iConv->u.conv.rows);
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
         status = VX_SUCCESS;
+        if (node->localDataPtr) {
+            agoReleaseMemory(node->localDataPtr);
+            node->localDataPtr = nullptr;
+        }
     }
 #if ENABLE_OPENCL
     else if (cmd == ago_kernel_cmd_opencl_codegen) {
@@ -15691,7 +15865,12 @@ int agoKernel_Convolve_S16_U8(AgoNode * node, AgoKernelCommand cmd)
         AgoData * iConv = node->paramList[2];
         vx_uint32 convolutionWidth = (vx_uint32)iConv->u.conv.columns;
         vx_uint32 convolutionHeight = (vx_uint32)iConv->u.conv.rows;
-        if (convolutionWidth == 3) {
+        if (HafCpu_FactorizeConvolution((ago_separable_conv_t *)node->localDataPtr, (vx_int16 *)iConv->buffer, convolutionWidth, convolutionHeight)) {
+            status = HafCpu_ConvolveSeparable_S16_U8(oImg->u.img.width, oImg->u.img.height - convolutionHeight + 1,
+                (vx_int16 *)(oImg->buffer + oImg->u.img.stride_in_bytes * (convolutionHeight >> 1)), oImg->u.img.stride_in_bytes,
+                iImg->buffer + iImg->u.img.stride_in_bytes * (convolutionHeight >> 1), iImg->u.img.stride_in_bytes, (ago_separable_conv_t *)node->localDataPtr, iConv->u.conv.shift);
+        }
+        else if (convolutionWidth == 3) {
             status = HafCpu_Convolve_S16_U8_3xN(oImg->u.img.width, oImg->u.img.height - convolutionHeight + 1,
                 (vx_int16 *)(oImg->buffer + oImg->u.img.stride_in_bytes * (convolutionHeight >> 1)), oImg->u.img.stride_in_bytes,
                 iImg->buffer + iImg->u.img.stride_in_bytes * (convolutionHeight >> 1), iImg->u.img.stride_in_bytes, (vx_int16 *)iConv->buffer, convolutionHeight, iConv->u.conv.shift);
@@ -15737,8 +15916,22 @@ int agoKernel_Convolve_S16_U8(AgoNode * node, AgoKernelCommand cmd)
         meta->data.u.img.format = VX_DF_IMAGE_S16;
         status = VX_SUCCESS;
     }
-    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+    else if (cmd == ago_kernel_cmd_initialize) {
+        status = VX_SUCCESS;
+        // detect separable (rank-1) matrices once at verify time; execute only re-checks the coefficients
+        node->localDataSize = sizeof(ago_separable_conv_t);
+        node->localDataPtr = (vx_uint8 *)agoAllocMemory(node->localDataSize);
+        if (!node->localDataPtr) return VX_ERROR_NO_MEMORY;
+        memset(node->localDataPtr, 0, node->localDataSize);
+        AgoData * iConv = node->paramList[2];
+        HafCpu_FactorizeConvolution((ago_separable_conv_t *)node->localDataPtr, (vx_int16 *)iConv->buffer, (vx_uint32)iConv->u.conv.columns, (vx_uint32)iConv->u.conv.rows);
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
         status = VX_SUCCESS;
+        if (node->localDataPtr) {
+            agoReleaseMemory(node->localDataPtr);
+            node->localDataPtr = nullptr;
+        }
     }
 #if ENABLE_OPENCL
     else if (cmd == ago_kernel_cmd_opencl_codegen) {
@@ -18535,7 +18728,16 @@ int agoKernel_Remap_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
     if (cmd == ago_kernel_cmd_execute) {
-        // not implemented yet
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iMap = node->paramList[2];
+        if (HafCpu_Remap_U24_U24_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes,
+            (ago_coord2d_ushort_t *)iMap->buffer, iMap->u.remap.dst_width * sizeof(ago_coord2d_ushort_t), iMap->u.remap.remap_fractional_bits))
+        {
+            status = VX_FAILURE;
+        }
     }
     else if (cmd == ago_kernel_cmd_validate) {
         status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB);
@@ -18653,6 +18855,7 @@ int agoKernel_Remap_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd)
 #endif
     else if (cmd == ago_kernel_cmd_query_target_support) {
         node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
 #if ENABLE_OPENCL
             | AGO_KERNEL_FLAG_DEVICE_GPU | AGO_KERNEL_FLAG_GPU_INTEG_M2R
 #endif
@@ -18666,7 +18869,16 @@ int agoKernel_Remap_U24_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
     if (cmd == ago_kernel_cmd_execute) {
-        // not implemented yet
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iMap = node->paramList[2];
+        if (HafCpu_Remap_U24_U32_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes,
+            (ago_coord2d_ushort_t *)iMap->buffer, iMap->u.remap.dst_width * sizeof(ago_coord2d_ushort_t), iMap->u.remap.remap_fractional_bits))
+        {
+            status = VX_FAILURE;
+        }
     }
     else if (cmd == ago_kernel_cmd_validate) {
         status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX);
@@ -18784,6 +18996,7 @@ int agoKernel_Remap_U24_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd)
 #endif
     else if (cmd == ago_kernel_cmd_query_target_support) {
         node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
 #if ENABLE_OPENCL
             | AGO_KERNEL_FLAG_DEVICE_GPU | AGO_KERNEL_FLAG_GPU_INTEG_M2R
 #endif
@@ -18797,7 +19010,16 @@ int agoKernel_Remap_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd)
 {
     vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
     if (cmd == ago_kernel_cmd_execute) {
-        // not implemented yet
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iMap = node->paramList[2];
+        if (HafCpu_Remap_U32_U32_Bilinear(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes,
+            (ago_coord2d_ushort_t *)iMap->buffer, iMap->u.remap.dst_width * sizeof(ago_coord2d_ushort_t), iMap->u.remap.remap_fractional_bits))
+        {
+            status = VX_FAILURE;
+        }
     }
     else if (cmd == ago_kernel_cmd_validate) {
         status = ValidateArguments_Img_1OUT_1IN(node, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX);
@@ -18913,6 +19135,7 @@ int agoKernel_Remap_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd)
 #endif
     else if (cmd == ago_kernel_cmd_query_target_support) {
         node->target_support_flags = 0
+            | AGO_KERNEL_FLAG_DEVICE_CPU
 #if ENABLE_OPENCL
             | AGO_KERNEL_FLAG_DEVICE_GPU | AGO_KERNEL_FLAG_GPU_INTEG_M2R
 #endif
@@ -22618,4 +22841,786 @@ int agoKernel_LaplacianReconstruct_DATA_DATA_DATA(AgoNode * node, AgoKernelComma
         status = VX_SUCCESS;
     }
     return status;
-}
\ No newline at end of file
+}
+
+int agoKernel_TensorAdd_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size stride1[AGO_MAX_TENSOR_DIMENSIONS], stride2[AGO_MAX_TENSOR_DIMENSIONS];
+        agoGetTensorBroadcastStrides(iTensor1, oTensor, stride1);
+        agoGetTensorBroadcastStrides(iTensor2, oTensor, stride2);
+        if (HafCpu_TensorAdd_DATA_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type, node->paramList[3]->u.scalar.u.e,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, stride1, iTensor2->buffer, stride2)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        AgoData * policy = node->paramList[3];
+        if (policy->u.scalar.type != VX_TYPE_ENUM)
+            return VX_ERROR_INVALID_TYPE;
+        else if (policy->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && policy->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+            return VX_ERROR_INVALID_VALUE;
+        vx_enum data_type = node->paramList[1]->u.tensor.data_type;
+        if (data_type != VX_TYPE_FLOAT32 && data_type != VX_TYPE_INT16 && data_type != VX_TYPE_INT8 && data_type != VX_TYPE_UINT8)
+            return VX_ERROR_INVALID_TYPE;
+        status = ValidateArguments_TensorElementwise(node, node->paramList[1], node->paramList[2], &node->metaList[0]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorSubtract_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size stride1[AGO_MAX_TENSOR_DIMENSIONS], stride2[AGO_MAX_TENSOR_DIMENSIONS];
+        agoGetTensorBroadcastStrides(iTensor1, oTensor, stride1);
+        agoGetTensorBroadcastStrides(iTensor2, oTensor, stride2);
+        if (HafCpu_TensorSubtract_DATA_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type, node->paramList[3]->u.scalar.u.e,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, stride1, iTensor2->buffer, stride2)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        AgoData * policy = node->paramList[3];
+        if (policy->u.scalar.type != VX_TYPE_ENUM)
+            return VX_ERROR_INVALID_TYPE;
+        else if (policy->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && policy->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+            return VX_ERROR_INVALID_VALUE;
+        vx_enum data_type = node->paramList[1]->u.tensor.data_type;
+        if (data_type != VX_TYPE_FLOAT32 && data_type != VX_TYPE_INT16 && data_type != VX_TYPE_INT8 && data_type != VX_TYPE_UINT8)
+            return VX_ERROR_INVALID_TYPE;
+        status = ValidateArguments_TensorElementwise(node, node->paramList[1], node->paramList[2], &node->metaList[0]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor1 = node->paramList[1];
+        AgoData * iTensor2 = node->paramList[2];
+        vx_size stride1[AGO_MAX_TENSOR_DIMENSIONS], stride2[AGO_MAX_TENSOR_DIMENSIONS];
+        agoGetTensorBroadcastStrides(iTensor1, oTensor, stride1);
+        agoGetTensorBroadcastStrides(iTensor2, oTensor, stride2);
+        if (HafCpu_TensorMultiply_DATA_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type, oTensor->u.tensor.fixed_point_pos,
+                node->paramList[3]->u.scalar.u.f, node->paramList[4]->u.scalar.u.e, node->paramList[5]->u.scalar.u.e,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor1->buffer, stride1, iTensor2->buffer, stride2)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        AgoData * scale = node->paramList[3];
+        AgoData * overflow_policy = node->paramList[4];
+        AgoData * rounding_policy = node->paramList[5];
+        if (scale->u.scalar.type != VX_TYPE_FLOAT32 || overflow_policy->u.scalar.type != VX_TYPE_ENUM || rounding_policy->u.scalar.type != VX_TYPE_ENUM)
+            return VX_ERROR_INVALID_TYPE;
+        else if (overflow_policy->u.scalar.u.e != VX_CONVERT_POLICY_WRAP && overflow_policy->u.scalar.u.e != VX_CONVERT_POLICY_SATURATE)
+            return VX_ERROR_INVALID_VALUE;
+        else if (rounding_policy->u.scalar.u.e != VX_ROUND_POLICY_TO_ZERO && rounding_policy->u.scalar.u.e != VX_ROUND_POLICY_TO_NEAREST_EVEN)
+            return VX_ERROR_INVALID_VALUE;
+        vx_enum data_type = node->paramList[1]->u.tensor.data_type;
+        if (data_type != VX_TYPE_FLOAT32 && data_type != VX_TYPE_INT16 && data_type != VX_TYPE_INT8 && data_type != VX_TYPE_UINT8)
+            return VX_ERROR_INVALID_TYPE;
+        status = ValidateArguments_TensorElementwise(node, node->paramList[1], node->paramList[2], &node->metaList[0]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorTableLookup_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        AgoData * iLut = node->paramList[2];
+        if (HafCpu_TensorTableLookup_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, oTensor->u.tensor.data_type,
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor->buffer, iTensor->u.tensor.stride, iLut->buffer, iLut->u.lut.offset)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        AgoData * iTensor = node->paramList[1];
+        AgoData * iLut = node->paramList[2];
+        vx_enum data_type = iTensor->u.tensor.data_type;
+        if ((data_type != VX_TYPE_UINT8 && data_type != VX_TYPE_INT16) || iLut->u.lut.type != data_type)
+            return VX_ERROR_INVALID_TYPE;
+        // set output tensor same as input
+        vx_meta_format meta;
+        meta = &node->metaList[0];
+        memcpy(&meta->data.u.tensor, &iTensor->u.tensor, sizeof(meta->data.u.tensor));
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorConvertDepth_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        // out = (in - offset) / norm on the real values of the fixed-point tensors
+        vx_float32 norm = node->paramList[3]->u.scalar.u.f, offset = node->paramList[4]->u.scalar.u.f;
+        vx_float32 outScale = ldexpf(1.0f, (int)oTensor->u.tensor.fixed_point_pos);
+        vx_float32 scale = ldexpf(outScale / norm, -(int)iTensor->u.tensor.fixed_point_pos);
+        if (HafCpu_TensorConvertDepth_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims,
+                oTensor->u.tensor.data_type, oTensor->buffer, oTensor->u.tensor.stride,
+                iTensor->u.tensor.data_type, iTensor->buffer, iTensor->u.tensor.stride,
+                scale, -offset * outScale / norm, (node->paramList[2]->u.scalar.u.e == VX_CONVERT_POLICY_SATURATE) ? vx_true_e : vx_false_e)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_TensorConvertDepth(node, node->paramList[0], node->paramList[1], node->paramList[2], node->paramList[3], node->paramList[4], &node->metaList[0]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorTranspose_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        vx_size dim1 = node->paramList[2]->u.scalar.u.s, dim2 = node->paramList[3]->u.scalar.u.s;
+        vx_size stride[AGO_MAX_TENSOR_DIMENSIONS];
+        for (vx_size i = 0; i < oTensor->u.tensor.num_dims; i++)
+            stride[i] = iTensor->u.tensor.stride[i];
+        stride[dim1] = iTensor->u.tensor.stride[dim2];
+        stride[dim2] = iTensor->u.tensor.stride[dim1];
+        if (HafCpu_TensorTranspose_DATA_DATA(oTensor->u.tensor.num_dims, oTensor->u.tensor.dims, agoType2Size(node->ref.context, oTensor->u.tensor.data_type),
+                oTensor->buffer, oTensor->u.tensor.stride, iTensor->buffer, stride)) {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        status = ValidateArguments_TensorTranspose(node, node->paramList[1], node->paramList[2], node->paramList[3], &node->metaList[0]);
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_ImageToTensor_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        vx_uint32 channels, batch;
+        vx_float32 mean[3], scale[3], offset[3];
+        status = ValidateArguments_ImageTensor(node, iImg, oTensor, iImg->u.img.format, &channels, &batch, mean, scale);
+        if (status == VX_SUCCESS) {
+            for (vx_uint32 c = 0; c < 3; c++)
+                offset[c] = -mean[c] * scale[c];
+            vx_bool nhwc = (node->paramList[4] && node->paramList[4]->u.scalar.u.i) ? vx_true_e : vx_false_e;
+            vx_bool reverse = (node->paramList[5] && node->paramList[5]->u.scalar.u.i) ? vx_true_e : vx_false_e;
+            if (HafCpu_ImageToTensor_DATA_DATA(iImg->u.img.width, iImg->u.img.height / batch, channels, batch, iImg->buffer, iImg->u.img.stride_in_bytes,
+                    oTensor->u.tensor.data_type, oTensor->buffer, oTensor->u.tensor.stride, nhwc, scale, offset, reverse)) {
+                status = VX_FAILURE;
+            }
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        AgoData * oTensor = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        vx_uint32 channels, batch;
+        status = ValidateArguments_ImageTensor(node, iImg, oTensor, iImg->u.img.format, &channels, &batch, nullptr, nullptr);
+        if (status == VX_SUCCESS) {
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            memcpy(&meta->data.u.tensor, &oTensor->u.tensor, sizeof(meta->data.u.tensor));
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_TensorToImage_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        AgoData * oImg = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        vx_uint32 channels, batch;
+        vx_float32 mean[3], scale[3], invScale[3];
+        status = ValidateArguments_ImageTensor(node, oImg, iTensor, oImg->u.img.format, &channels, &batch, mean, scale);
+        if (status == VX_SUCCESS) {
+            for (vx_uint32 c = 0; c < 3; c++)
+                invScale[c] = 1.0f / scale[c];
+            vx_bool nhwc = (node->paramList[4] && node->paramList[4]->u.scalar.u.i) ? vx_true_e : vx_false_e;
+            vx_bool reverse = (node->paramList[5] && node->paramList[5]->u.scalar.u.i) ? vx_true_e : vx_false_e;
+            if (HafCpu_TensorToImage_DATA_DATA(oImg->u.img.width, oImg->u.img.height / batch, channels, batch, oImg->buffer, oImg->u.img.stride_in_bytes,
+                    iTensor->u.tensor.data_type, iTensor->buffer, iTensor->u.tensor.stride, nhwc, invScale, mean, reverse)) {
+                status = VX_FAILURE;
+            }
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        AgoData * oImg = node->paramList[0];
+        AgoData * iTensor = node->paramList[1];
+        AgoData * nhwc_scalar = node->paramList[4];
+        bool nhwc = nhwc_scalar && nhwc_scalar->u.scalar.type == VX_TYPE_BOOL && nhwc_scalar->u.scalar.u.i;
+        vx_size C = iTensor->u.tensor.dims[nhwc ? 0 : 2];
+        vx_df_image format = oImg->u.img.format;
+        if (format == VX_DF_IMAGE_VIRT)
+            format = (C == 3) ? VX_DF_IMAGE_RGB : VX_DF_IMAGE_U8;
+        vx_uint32 width = oImg->u.img.width, height = oImg->u.img.height;
+        if (!width || !height) {
+            width = (vx_uint32)iTensor->u.tensor.dims[nhwc ? 1 : 0];
+            height = (vx_uint32)(iTensor->u.tensor.dims[nhwc ? 2 : 1] * (iTensor->u.tensor.num_dims > 3 ? iTensor->u.tensor.dims[3] : 1));
+        }
+        AgoData img;
+        img.u.img.width = width;
+        img.u.img.height = height;
+        vx_uint32 channels, batch;
+        status = ValidateArguments_ImageTensor(node, &img, iTensor, format, &channels, &batch, nullptr, nullptr);
+        if (status == VX_SUCCESS) {
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            meta->data.u.img.width = width;
+            meta->data.u.img.height = height;
+            meta->data.u.img.format = format;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_valid_rect_callback) {
+        AgoData * out = node->paramList[0];
+        out->u.img.rect_valid.start_x = 0;
+        out->u.img.rect_valid.start_y = 0;
+        out->u.img.rect_valid.end_x = out->u.img.width;
+        out->u.img.rect_valid.end_y = out->u.img.height;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+// input of ScaleCropImageToTensor: an RGB/NV12 image or an object array of them, one per tensor batch item
+static vx_status ValidateArguments_ScaleCropImageToTensor(AgoNode * node, std::vector<AgoData *>& images)
+{
+    AgoData * oTensor = node->paramList[0];
+    AgoData * input = node->paramList[1];
+    AgoData * crop_arr = node->paramList[2];
+    AgoData * mean_arr = node->paramList[3];
+    AgoData * std_arr = node->paramList[4];
+    AgoData * reverse_scalar = node->paramList[5];
+    images.clear();
+    if (input->ref.type == VX_TYPE_IMAGE)
+        images.push_back(input);
+    else if (input->ref.type == VX_TYPE_OBJECT_ARRAY && input->u.objarr.itemtype == VX_TYPE_IMAGE)
+        images.assign(input->children, input->children + input->numChildren);
+    else
+        return VX_ERROR_INVALID_TYPE;
+    for (auto img : images) {
+        if (!img || (img->u.img.format != VX_DF_IMAGE_RGB && img->u.img.format != VX_DF_IMAGE_NV12))
+            return VX_ERROR_INVALID_FORMAT;
+        if (!img->u.img.width || !img->u.img.height)
+            return VX_ERROR_INVALID_DIMENSION;
+    }
+    if ((crop_arr && (crop_arr->u.arr.itemtype != VX_TYPE_RECTANGLE)) ||
+        (mean_arr && (mean_arr->u.arr.itemtype != VX_TYPE_FLOAT32)) ||
+        (std_arr && (std_arr->u.arr.itemtype != VX_TYPE_FLOAT32)) ||
+        (reverse_scalar && reverse_scalar->u.scalar.type != VX_TYPE_BOOL))
+        return VX_ERROR_INVALID_PARAMETERS;
+    vx_enum data_type = oTensor->u.tensor.data_type;
+    if (data_type != VX_TYPE_FLOAT32 && data_type != VX_TYPE_FLOAT16)
+        return VX_ERROR_INVALID_TYPE;
+    if (oTensor->u.tensor.num_dims != 3 && oTensor->u.tensor.num_dims != 4)
+        return VX_ERROR_INVALID_DIMENSION;
+    vx_size N = oTensor->u.tensor.num_dims > 3 ? oTensor->u.tensor.dims[3] : 1;
+    if (oTensor->u.tensor.dims[2] != 3 || !oTensor->u.tensor.dims[0] || !oTensor->u.tensor.dims[1] || N != images.size())
+        return VX_ERROR_INVALID_DIMENSION;
+    return VX_SUCCESS;
+}
+
+int agoKernel_ScaleCropImageToTensor_DATA_DATA(AgoNode * node, AgoKernelCommand cmd)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        AgoData * oTensor = node->paramList[0];
+        AgoData * crop_arr = node->paramList[2];
+        AgoData * mean_arr = node->paramList[3];
+        AgoData * std_arr = node->paramList[4];
+        std::vector<AgoData *> images;
+        status = ValidateArguments_ScaleCropImageToTensor(node, images);
+        if (status == VX_SUCCESS) {
+            // normalization: (pixel - mean[c]) / std[c]
+            vx_float32 scale[3], offset[3];
+            for (vx_uint32 c = 0; c < 3; c++) {
+                vx_float32 mean = mean_arr && mean_arr->u.arr.numitems ? ((vx_float32 *)mean_arr->buffer)[mean_arr->u.arr.numitems >= 3 ? c : 0] : 0.0f;
+                vx_float32 stddev = std_arr && std_arr->u.arr.numitems ? ((vx_float32 *)std_arr->buffer)[std_arr->u.arr.numitems >= 3 ? c : 0] : 1.0f;
+                if (stddev == 0.0f)
+                    return VX_ERROR_INVALID_VALUE;
+                scale[c] = 1.0f / stddev;
+                offset[c] = -mean * scale[c];
+            }
+            vx_bool reverse = (node->paramList[5] && node->paramList[5]->u.scalar.u.i) ? vx_true_e : vx_false_e;
+            for (vx_size n = 0; n < images.size() && status == VX_SUCCESS; n++) {
+                AgoData * img = images[n];
+                vx_rectangle_t rect = { 0, 0, img->u.img.width, img->u.img.height };
+                if (crop_arr && crop_arr->u.arr.numitems)
+                    rect = ((vx_rectangle_t *)crop_arr->buffer)[crop_arr->u.arr.numitems > n ? n : 0];
+                bool nv12 = (img->u.img.format == VX_DF_IMAGE_NV12);
+                AgoData * iY = nv12 ? img->children[0] : img;
+                AgoData * iUV = nv12 ? img->children[1] : nullptr;
+                if (HafCpu_ScaleCropImageToTensor_DATA_DATA((vx_uint32)oTensor->u.tensor.dims[0], (vx_uint32)oTensor->u.tensor.dims[1],
+                        oTensor->u.tensor.data_type, oTensor->buffer + n * oTensor->u.tensor.stride[3], oTensor->u.tensor.stride,
+                        img->u.img.format, img->u.img.width, img->u.img.height, iY->buffer, iY->u.img.stride_in_bytes,
+                        iUV ? iUV->buffer : nullptr, iUV ? iUV->u.img.stride_in_bytes : 0, &rect, scale, offset, reverse)) {
+                    agoAddLogEntry(&node->ref, VX_FAILURE, "ERROR: ScaleCropImageToTensor: invalid crop (%d,%d,%d,%d) of image #%d\n",
+                        rect.start_x, rect.start_y, rect.end_x, rect.end_y, (int)n);
+                    status = VX_FAILURE;
+                }
+            }
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        // validate parameters
+        std::vector<AgoData *> images;
+        status = ValidateArguments_ScaleCropImageToTensor(node, images);
+        if (status == VX_SUCCESS) {
+            AgoData * oTensor = node->paramList[0];
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            memcpy(&meta->data.u.tensor, &oTensor->u.tensor, sizeof(meta->data.u.tensor));
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+typedef int(*HafCpuRemapFunc)(vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, ago_coord2d_ushort_t *, vx_uint32, vx_uint32);
+typedef int(*HafCpuWarpAffineFunc)(vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, ago_affine_matrix_t *);
+typedef int(*HafCpuWarpPerspectiveFunc)(vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, ago_perspective_matrix_t *);
+typedef int(*HafCpuScaleImageFunc)(vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, vx_uint32, vx_uint32, vx_uint8 *, vx_uint32, ago_scale_matrix_t *, vx_uint8 *);
+
+// common implementation of the multi-channel and 16-bit remap kernels (CPU only)
+static int agoKernel_Remap_Generic(AgoNode * node, AgoKernelCommand cmd, vx_df_image fmtOut, vx_df_image fmtIn, HafCpuRemapFunc func)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iMap = node->paramList[2];
+        if (func(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes,
+            (ago_coord2d_ushort_t *)iMap->buffer, iMap->u.remap.dst_width * sizeof(ago_coord2d_ushort_t), iMap->u.remap.remap_fractional_bits))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_1OUT_1IN(node, fmtOut, fmtIn);
+        if (!status) {
+            if (node->paramList[1]->u.img.width != node->paramList[2]->u.remap.src_width ||
+                node->paramList[1]->u.img.height != node->paramList[2]->u.remap.src_height)
+                return VX_ERROR_INVALID_DIMENSION;
+            // set output image sizes are same as remap destination size
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            meta->data.u.img.width = node->paramList[2]->u.remap.dst_width;
+            meta->data.u.img.height = node->paramList[2]->u.remap.dst_height;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+// common implementation of the multi-channel and 16-bit warp affine kernels (CPU only)
+static int agoKernel_WarpAffine_Generic(AgoNode * node, AgoKernelCommand cmd, vx_df_image fmtOut, vx_df_image fmtIn, HafCpuWarpAffineFunc func)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iMat = node->paramList[2];
+        if (func(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes, (ago_affine_matrix_t *)iMat->buffer))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_1OUT_1IN(node, fmtOut, fmtIn);
+        if (!status) {
+            if (node->paramList[2]->u.mat.type != VX_TYPE_FLOAT32)
+                return VX_ERROR_INVALID_TYPE;
+            if (node->paramList[2]->u.mat.columns != 2 || node->paramList[2]->u.mat.rows != 3)
+                return VX_ERROR_INVALID_DIMENSION;
+            // output image dimensions have no constraints
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            meta->data.u.img.width = node->paramList[0]->u.img.width;
+            meta->data.u.img.height = node->paramList[0]->u.img.height;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+// common implementation of the multi-channel and 16-bit warp perspective kernels (CPU only)
+static int agoKernel_WarpPerspective_Generic(AgoNode * node, AgoKernelCommand cmd, vx_df_image fmtOut, vx_df_image fmtIn, HafCpuWarpPerspectiveFunc func)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoData * iMat = node->paramList[2];
+        if (func(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes, (ago_perspective_matrix_t *)iMat->buffer))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_1OUT_1IN(node, fmtOut, fmtIn);
+        if (!status) {
+            if (node->paramList[2]->u.mat.type != VX_TYPE_FLOAT32)
+                return VX_ERROR_INVALID_TYPE;
+            if (node->paramList[2]->u.mat.columns != 3 || node->paramList[2]->u.mat.rows != 3)
+                return VX_ERROR_INVALID_DIMENSION;
+            // output image dimensions have no constraints
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            meta->data.u.img.width = node->paramList[0]->u.img.width;
+            meta->data.u.img.height = node->paramList[0]->u.img.height;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize || cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+// common implementation of the multi-channel and 16-bit scale image kernels (CPU only)
+static int agoKernel_ScaleImage_Generic(AgoNode * node, AgoKernelCommand cmd, vx_df_image fmtOut, vx_df_image fmtIn, HafCpuScaleImageFunc func)
+{
+    vx_status status = AGO_ERROR_KERNEL_NOT_IMPLEMENTED;
+    if (cmd == ago_kernel_cmd_execute) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        AgoConfigScaleMatrix * scalemat = (AgoConfigScaleMatrix *)node->localDataPtr;
+        if (func(oImg->u.img.width, oImg->u.img.height, oImg->buffer, oImg->u.img.stride_in_bytes,
+            iImg->u.img.width, iImg->u.img.height, iImg->buffer, iImg->u.img.stride_in_bytes, scalemat, (vx_uint8 *)(scalemat + 1)))
+        {
+            status = VX_FAILURE;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_validate) {
+        status = ValidateArguments_Img_1OUT_1IN(node, fmtOut, fmtIn);
+        if (!status) {
+            vx_meta_format meta;
+            meta = &node->metaList[0];
+            meta->data.u.img.width = node->paramList[0]->u.img.width;
+            meta->data.u.img.height = node->paramList[0]->u.img.height;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_initialize) {
+        status = VX_SUCCESS;
+        AgoData * oImg = node->paramList[0];
+        AgoData * iImg = node->paramList[1];
+        // scale matrix followed by the x-coordinates of a destination row
+        node->localDataSize = sizeof(AgoConfigScaleMatrix) + oImg->u.img.width * sizeof(vx_int32);
+        node->localDataPtr = (vx_uint8 *)agoAllocMemory(node->localDataSize);
+        if (!node->localDataPtr) return VX_ERROR_NO_MEMORY;
+        // compute scale matrix from the input and output image sizes
+        AgoConfigScaleMatrix * scalemat = (AgoConfigScaleMatrix *)node->localDataPtr;
+        scalemat->xscale = (vx_float32)((vx_float64)iImg->u.img.width / (vx_float64)oImg->u.img.width);
+        scalemat->yscale = (vx_float32)((vx_float64)iImg->u.img.height / (vx_float64)oImg->u.img.height);
+        scalemat->xoffset = (vx_float32)((vx_float64)iImg->u.img.width / (vx_float64)oImg->u.img.width * 0.5 - 0.5);
+        scalemat->yoffset = (vx_float32)((vx_float64)iImg->u.img.height / (vx_float64)oImg->u.img.height * 0.5 - 0.5);
+    }
+    else if (cmd == ago_kernel_cmd_shutdown) {
+        status = VX_SUCCESS;
+        if (node->localDataPtr) {
+            agoReleaseMemory(node->localDataPtr);
+            node->localDataPtr = nullptr;
+        }
+    }
+    else if (cmd == ago_kernel_cmd_query_target_support) {
+        node->target_support_flags = 0
+                    | AGO_KERNEL_FLAG_DEVICE_CPU
+                    ;
+        status = VX_SUCCESS;
+    }
+    return status;
+}
+
+int agoKernel_Remap_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_Remap_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB, HafCpu_Remap_U24_U24_Nearest);
+}
+
+int agoKernel_Remap_U24_U32_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_Remap_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX, HafCpu_Remap_U24_U32_Nearest);
+}
+
+int agoKernel_Remap_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_Remap_Generic(node, cmd, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, HafCpu_Remap_U32_U32_Nearest);
+}
+
+int agoKernel_Remap_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_Remap_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_Remap_U16_U16_Nearest);
+}
+
+int agoKernel_Remap_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_Remap_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_Remap_U16_U16_Bilinear);
+}
+
+int agoKernel_Remap_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_Remap_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_Remap_S16_S16_Nearest);
+}
+
+int agoKernel_Remap_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_Remap_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_Remap_S16_S16_Bilinear);
+}
+
+int agoKernel_WarpAffine_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB, HafCpu_WarpAffine_U24_U24_Nearest);
+}
+
+int agoKernel_WarpAffine_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB, HafCpu_WarpAffine_U24_U24_Bilinear);
+}
+
+int agoKernel_WarpAffine_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, HafCpu_WarpAffine_U32_U32_Nearest);
+}
+
+int agoKernel_WarpAffine_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, HafCpu_WarpAffine_U32_U32_Bilinear);
+}
+
+int agoKernel_WarpAffine_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_WarpAffine_U16_U16_Nearest);
+}
+
+int agoKernel_WarpAffine_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_WarpAffine_U16_U16_Bilinear);
+}
+
+int agoKernel_WarpAffine_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_WarpAffine_S16_S16_Nearest);
+}
+
+int agoKernel_WarpAffine_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpAffine_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_WarpAffine_S16_S16_Bilinear);
+}
+
+int agoKernel_WarpPerspective_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB, HafCpu_WarpPerspective_U24_U24_Nearest);
+}
+
+int agoKernel_WarpPerspective_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB, HafCpu_WarpPerspective_U24_U24_Bilinear);
+}
+
+int agoKernel_WarpPerspective_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, HafCpu_WarpPerspective_U32_U32_Nearest);
+}
+
+int agoKernel_WarpPerspective_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, HafCpu_WarpPerspective_U32_U32_Bilinear);
+}
+
+int agoKernel_WarpPerspective_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_WarpPerspective_U16_U16_Nearest);
+}
+
+int agoKernel_WarpPerspective_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_WarpPerspective_U16_U16_Bilinear);
+}
+
+int agoKernel_WarpPerspective_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_WarpPerspective_S16_S16_Nearest);
+}
+
+int agoKernel_WarpPerspective_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_WarpPerspective_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_WarpPerspective_S16_S16_Bilinear);
+}
+
+int agoKernel_ScaleImage_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB, HafCpu_ScaleImage_U24_U24_Nearest);
+}
+
+int agoKernel_ScaleImage_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGB, HafCpu_ScaleImage_U24_U24_Bilinear);
+}
+
+int agoKernel_ScaleImage_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, HafCpu_ScaleImage_U32_U32_Nearest);
+}
+
+int agoKernel_ScaleImage_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, HafCpu_ScaleImage_U32_U32_Bilinear);
+}
+
+int agoKernel_ScaleImage_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_ScaleImage_U16_U16_Nearest);
+}
+
+int agoKernel_ScaleImage_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_U16, VX_DF_IMAGE_U16, HafCpu_ScaleImage_U16_U16_Bilinear);
+}
+
+int agoKernel_ScaleImage_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_ScaleImage_S16_S16_Nearest);
+}
+
+int agoKernel_ScaleImage_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd)
+{
+    return agoKernel_ScaleImage_Generic(node, cmd, VX_DF_IMAGE_S16, VX_DF_IMAGE_S16, HafCpu_ScaleImage_S16_S16_Bilinear);
+}
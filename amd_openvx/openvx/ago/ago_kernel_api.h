@@ -78,6 +78,8 @@ int ovxKernel_WeightedAverage(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_NonLinearFilter(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_LaplacianPyramid(AgoNode * node, AgoKernelCommand cmd);
 int ovxKernel_LaplacianReconstruct(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorTranspose(AgoNode * node, AgoKernelCommand cmd);
+int ovxKernel_TensorConvertDepth(AgoNode * node, AgoKernelCommand cmd);
 // AMD low-level kernels
 int agoKernel_Set00_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_SetFF_U8(AgoNode * node, AgoKernelCommand cmd);
@@ -368,5 +370,45 @@ int agoKernel_WeightedAverage_U8_U8_U8(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_NonLinearFilter_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LaplacianPyramid_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
 int agoKernel_LaplacianReconstruct_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorAdd_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorSubtract_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorMultiply_DATA_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorTableLookup_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorConvertDepth_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorTranspose_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ImageToTensor_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_TensorToImage_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleCropImageToTensor_DATA_DATA(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_Remap_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_Remap_U24_U32_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_Remap_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_Remap_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_Remap_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_Remap_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_Remap_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpAffine_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_WarpPerspective_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U24_U24_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U24_U24_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U32_U32_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U32_U32_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U16_U16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_U16_U16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_S16_S16_Nearest(AgoNode * node, AgoKernelCommand cmd);
+int agoKernel_ScaleImage_S16_S16_Bilinear(AgoNode * node, AgoKernelCommand cmd);
 #endif // __ago_kernels_api_h__
 
@@ -51,6 +51,7 @@ THE SOFTWARE.
 #define AOUT_AINx2_AOPTIN                      { AOUT, AIN, AIN, AOPTIN }
 #define AOUT_AINx3                             { AOUT, AIN, AIN, AIN }
 #define AOUT_AINx4                             { AOUT, AIN, AIN, AIN, AIN }
+#define AOUT_AINx5                             { AOUT, AIN, AIN, AIN, AIN, AIN }
 #define AOUT_AINx8                             { AOUT, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN }
 #define AOUT_AINx9                             { AOUT, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN, AIN }
 #define AOUTx2_AIN                             { AOUT, AOUT, AIN }
@@ -65,6 +66,7 @@ THE SOFTWARE.
 #define AOUTx2_AIN_AOPTINx7                    { AOUT, AOUT, AIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN }
 #define AOUTx3_AIN_AOPTINx6                    { AOUT, AOUT, AOUT, AIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN }
 #define AOUTx2_AINx2_AOPTINx6                  { AOUT, AOUT, AIN, AIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN }
+#define AOUT_AIN_AOPTINx4                      { AOUT, AIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN }
 #define AOUT_AIN_AOPTINx8                      { AOUT, AIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN, AOPTIN }
 #define AINOUT_AIN                             { AINOUT, AIN }
 #define AINOUT_AINx2                           { AINOUT, AIN, AIN }
@@ -150,6 +152,15 @@ THE SOFTWARE.
 #define ATYPE_SRRR                             { VX_TYPE_SCALAR, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE }
 #define ATYPE_RSRR                             { VX_TYPE_REFERENCE, VX_TYPE_SCALAR, VX_TYPE_REFERENCE, VX_TYPE_REFERENCE }
 #define ATYPE_IMIS                             { VX_TYPE_IMAGE, VX_TYPE_MATRIX, VX_TYPE_IMAGE, VX_TYPE_SCALAR }
+#define ATYPE_TTL                              { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_LUT }
+#define ATYPE_TTSS                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_TTTS                             { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR }
+#define ATYPE_TSSST                            { VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_TENSOR }
+#define ATYPE_TTSSS                            { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_TTTSSS                           { VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_TENSOR, VX_TYPE_SCALAR, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_TIAASS                           { VX_TYPE_TENSOR, VX_TYPE_IMAGE, VX_TYPE_ARRAY, VX_TYPE_ARRAY, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_ITAASS                           { VX_TYPE_IMAGE, VX_TYPE_TENSOR, VX_TYPE_ARRAY, VX_TYPE_ARRAY, VX_TYPE_SCALAR, VX_TYPE_SCALAR }
+#define ATYPE_TRAAAS                           { VX_TYPE_TENSOR, VX_TYPE_REFERENCE, VX_TYPE_ARRAY, VX_TYPE_ARRAY, VX_TYPE_ARRAY, VX_TYPE_SCALAR }
 
 // for kernOpType & kernOpInfo
 #define KOP_UNKNOWN    AGO_KERNEL_OP_TYPE_UNKNOWN,         0,
@@ -227,6 +238,8 @@ static struct {
 	OVX_KERNEL_ENTRY( VX_KERNEL_NON_LINEAR_FILTER     , NonLinearFilter, "non_linear_filter",      		AINx3_AOUT,	     	  ATYPE_SIMI         , false ),	
 	OVX_KERNEL_ENTRY( VX_KERNEL_LAPLACIAN_PYRAMID     , LaplacianPyramid, "laplacian_pyramid",     		AINx2_AOUT,	     	  ATYPE_IPI        	 , false ),	
 	OVX_KERNEL_ENTRY( VX_KERNEL_LAPLACIAN_RECONSTRUCT , LaplacianReconstruct, "laplacian_reconstruct",  AINx2_AOUT,	     	  ATYPE_PII        	 , false ),	
+	OVX_KERNEL_ENTRY( VX_KERNEL_TENSOR_TRANSPOSE      , TensorTranspose, "tensor_transpose",            AIN_AOUT_AINx2,       ATYPE_TTSS         , false ),
+	OVX_KERNEL_ENTRY( VX_KERNEL_TENSOR_CONVERT_DEPTH  , TensorConvertDepth, "tensor_convert_depth",     AINx4_AOUT,           ATYPE_TSSST        , false ),
 	// AMD low-level kernel primitives
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SET_00_U8                                               , 1, 1, Set00_U8, { AOUT },                                           ATYPE_I                 , KOP_ELEMWISE  , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SET_FF_U8                                               , 1, 1, SetFF_U8, { AOUT },                                           ATYPE_I                 , KOP_ELEMWISE  , false ),
@@ -517,6 +530,46 @@ static struct {
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_NON_LINEAR_FILTER_DATA_DATA_DATA                        , 1, 0, NonLinearFilter_DATA_DATA_DATA, AOUT_AINx3,                   ATYPE_IMIS              , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LAPLACIAN_PYRAMID_DATA_DATA_DATA                        , 1, 0, LaplacianPyramid_DATA_DATA_DATA, AOUT_AINx2,                  ATYPE_IPI               , KOP_UNKNOWN   , false ),
 	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_LAPLACIAN_RECONSTRUCT_DATA_DATA_DATA                    , 1, 0, LaplacianReconstruct_DATA_DATA_DATA, AOUT_AINx2,              ATYPE_IIP               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA                               , 1, 0, TensorAdd_DATA_DATA_DATA, AOUT_AINx3,                         ATYPE_TTTS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA                          , 1, 0, TensorSubtract_DATA_DATA_DATA, AOUT_AINx3,                    ATYPE_TTTS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA                          , 1, 0, TensorMultiply_DATA_DATA_DATA, AOUT_AINx5,                    ATYPE_TTTSSS            , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA                           , 1, 0, TensorTableLookup_DATA_DATA, AOUT_AINx2,                      ATYPE_TTL               , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA                          , 1, 0, TensorConvertDepth_DATA_DATA, AOUT_AINx4,                     ATYPE_TTSSS             , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA                              , 1, 0, TensorTranspose_DATA_DATA, AOUT_AINx3,                        ATYPE_TTSS              , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_IMAGE_TO_TENSOR_DATA_DATA                               , 1, 0, ImageToTensor_DATA_DATA, AOUT_AIN_AOPTINx4,                   ATYPE_TIAASS            , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_TENSOR_TO_IMAGE_DATA_DATA                               , 1, 0, TensorToImage_DATA_DATA, AOUT_AIN_AOPTINx4,                   ATYPE_ITAASS            , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_CROP_IMAGE_TO_TENSOR_DATA_DATA                    , 1, 0, ScaleCropImageToTensor_DATA_DATA, AOUT_AIN_AOPTINx4,          ATYPE_TRAAAS            , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_REMAP_U24_U24_NEAREST                                   , 1, 0, Remap_U24_U24_Nearest, AOUT_AINx2,                            ATYPE_IIR               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_REMAP_U24_U32_NEAREST                                   , 1, 0, Remap_U24_U32_Nearest, AOUT_AINx2,                            ATYPE_IIR               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_REMAP_U32_U32_NEAREST                                   , 1, 0, Remap_U32_U32_Nearest, AOUT_AINx2,                            ATYPE_IIR               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_REMAP_U16_U16_NEAREST                                   , 1, 0, Remap_U16_U16_Nearest, AOUT_AINx2,                            ATYPE_IIR               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_REMAP_U16_U16_BILINEAR                                  , 1, 0, Remap_U16_U16_Bilinear, AOUT_AINx2,                           ATYPE_IIR               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_REMAP_S16_S16_NEAREST                                   , 1, 0, Remap_S16_S16_Nearest, AOUT_AINx2,                            ATYPE_IIR               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_REMAP_S16_S16_BILINEAR                                  , 1, 0, Remap_S16_S16_Bilinear, AOUT_AINx2,                           ATYPE_IIR               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_U24_U24_NEAREST                             , 1, 0, WarpAffine_U24_U24_Nearest, AOUT_AINx2,                       ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_U24_U24_BILINEAR                            , 1, 0, WarpAffine_U24_U24_Bilinear, AOUT_AINx2,                      ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_U32_U32_NEAREST                             , 1, 0, WarpAffine_U32_U32_Nearest, AOUT_AINx2,                       ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_U32_U32_BILINEAR                            , 1, 0, WarpAffine_U32_U32_Bilinear, AOUT_AINx2,                      ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_U16_U16_NEAREST                             , 1, 0, WarpAffine_U16_U16_Nearest, AOUT_AINx2,                       ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_U16_U16_BILINEAR                            , 1, 0, WarpAffine_U16_U16_Bilinear, AOUT_AINx2,                      ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_S16_S16_NEAREST                             , 1, 0, WarpAffine_S16_S16_Nearest, AOUT_AINx2,                       ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_AFFINE_S16_S16_BILINEAR                            , 1, 0, WarpAffine_S16_S16_Bilinear, AOUT_AINx2,                      ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_U24_U24_NEAREST                        , 1, 0, WarpPerspective_U24_U24_Nearest, AOUT_AINx2,                  ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_U24_U24_BILINEAR                       , 1, 0, WarpPerspective_U24_U24_Bilinear, AOUT_AINx2,                 ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_U32_U32_NEAREST                        , 1, 0, WarpPerspective_U32_U32_Nearest, AOUT_AINx2,                  ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_U32_U32_BILINEAR                       , 1, 0, WarpPerspective_U32_U32_Bilinear, AOUT_AINx2,                 ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_U16_U16_NEAREST                        , 1, 0, WarpPerspective_U16_U16_Nearest, AOUT_AINx2,                  ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_U16_U16_BILINEAR                       , 1, 0, WarpPerspective_U16_U16_Bilinear, AOUT_AINx2,                 ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_S16_S16_NEAREST                        , 1, 0, WarpPerspective_S16_S16_Nearest, AOUT_AINx2,                  ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_WARP_PERSPECTIVE_S16_S16_BILINEAR                       , 1, 0, WarpPerspective_S16_S16_Bilinear, AOUT_AINx2,                 ATYPE_IIM               , KOP_UNKNOWN   , true  ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U24_U24_NEAREST                             , 1, 0, ScaleImage_U24_U24_Nearest, AOUT_AIN,                         ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U24_U24_BILINEAR                            , 1, 0, ScaleImage_U24_U24_Bilinear, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U32_U32_NEAREST                             , 1, 0, ScaleImage_U32_U32_Nearest, AOUT_AIN,                         ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U32_U32_BILINEAR                            , 1, 0, ScaleImage_U32_U32_Bilinear, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U16_U16_NEAREST                             , 1, 0, ScaleImage_U16_U16_Nearest, AOUT_AIN,                         ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_U16_U16_BILINEAR                            , 1, 0, ScaleImage_U16_U16_Bilinear, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_S16_S16_NEAREST                             , 1, 0, ScaleImage_S16_S16_Nearest, AOUT_AIN,                         ATYPE_II                , KOP_UNKNOWN   , false ),
+	AGO_KERNEL_ENTRY( VX_KERNEL_AMD_SCALE_IMAGE_S16_S16_BILINEAR                            , 1, 0, ScaleImage_S16_S16_Bilinear, AOUT_AIN,                        ATYPE_II                , KOP_UNKNOWN   , false ),
 #undef AGO_KERNEL_ENTRY
 #undef OVX_KERNEL_ENTRY
 };
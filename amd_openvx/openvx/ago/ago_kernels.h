@@ -454,6 +454,50 @@ enum vx_kernel_amd_e {
 	VX_KERNEL_AMD_LAPLACIAN_PYRAMID_DATA_DATA_DATA,
 	VX_KERNEL_AMD_LAPLACIAN_RECONSTRUCT_DATA_DATA_DATA,
 
+	// tensor kernels
+	VX_KERNEL_AMD_TENSOR_ADD_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_SUBTRACT_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_MULTIPLY_DATA_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_TABLE_LOOKUP_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_CONVERT_DEPTH_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_TRANSPOSE_DATA_DATA,
+	VX_KERNEL_AMD_IMAGE_TO_TENSOR_DATA_DATA,
+	VX_KERNEL_AMD_TENSOR_TO_IMAGE_DATA_DATA,
+	VX_KERNEL_AMD_SCALE_CROP_IMAGE_TO_TENSOR_DATA_DATA,
+
+	// Arbitrary Neighbors: multi-channel and 16-bit remap, warp and scale
+	VX_KERNEL_AMD_REMAP_U24_U24_NEAREST,
+	VX_KERNEL_AMD_REMAP_U24_U32_NEAREST,
+	VX_KERNEL_AMD_REMAP_U32_U32_NEAREST,
+	VX_KERNEL_AMD_REMAP_U16_U16_NEAREST,
+	VX_KERNEL_AMD_REMAP_U16_U16_BILINEAR,
+	VX_KERNEL_AMD_REMAP_S16_S16_NEAREST,
+	VX_KERNEL_AMD_REMAP_S16_S16_BILINEAR,
+	VX_KERNEL_AMD_WARP_AFFINE_U24_U24_NEAREST,
+	VX_KERNEL_AMD_WARP_AFFINE_U24_U24_BILINEAR,
+	VX_KERNEL_AMD_WARP_AFFINE_U32_U32_NEAREST,
+	VX_KERNEL_AMD_WARP_AFFINE_U32_U32_BILINEAR,
+	VX_KERNEL_AMD_WARP_AFFINE_U16_U16_NEAREST,
+	VX_KERNEL_AMD_WARP_AFFINE_U16_U16_BILINEAR,
+	VX_KERNEL_AMD_WARP_AFFINE_S16_S16_NEAREST,
+	VX_KERNEL_AMD_WARP_AFFINE_S16_S16_BILINEAR,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_U24_U24_NEAREST,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_U24_U24_BILINEAR,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_U32_U32_NEAREST,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_U32_U32_BILINEAR,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_U16_U16_NEAREST,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_U16_U16_BILINEAR,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_S16_S16_NEAREST,
+	VX_KERNEL_AMD_WARP_PERSPECTIVE_S16_S16_BILINEAR,
+	VX_KERNEL_AMD_SCALE_IMAGE_U24_U24_NEAREST,
+	VX_KERNEL_AMD_SCALE_IMAGE_U24_U24_BILINEAR,
+	VX_KERNEL_AMD_SCALE_IMAGE_U32_U32_NEAREST,
+	VX_KERNEL_AMD_SCALE_IMAGE_U32_U32_BILINEAR,
+	VX_KERNEL_AMD_SCALE_IMAGE_U16_U16_NEAREST,
+	VX_KERNEL_AMD_SCALE_IMAGE_U16_U16_BILINEAR,
+	VX_KERNEL_AMD_SCALE_IMAGE_S16_S16_NEAREST,
+	VX_KERNEL_AMD_SCALE_IMAGE_S16_S16_BILINEAR,
+
 	VX_KERNEL_AMD_MAX_1_0, // Used for bounds checking in the internal conformance test
 };
 
@@ -22,6 +22,9 @@ THE SOFTWARE.
 
 
 #include "ago_platform.h"
+#if __linux__
+#include <sched.h>
+#endif
 
 // macro to port VisualStudio __cpuid to g++
 #if !_WIN32
@@ -46,6 +49,59 @@ bool agoIsCpuHardwareSupported()
 	return isHardwareSupported;
 }
 
+bool agoIsCpuAvx2Supported()
+{
+	static int supported = -1;
+	if (supported < 0) {
+		int CPUInfo[4] = { -1 };
+		bool avx2 = false;
+		__cpuid(CPUInfo, 0);
+		if (CPUInfo[0] >= 7) {
+			__cpuid(CPUInfo, 1);
+			// check for OSXSAVE, AVX and F16C support and that the OS saves the XMM/YMM state
+			if ((CPUInfo[2] & 0x18000000) == 0x18000000 && (CPUInfo[2] & 0x20000000)) {
+#if _WIN32
+				unsigned long long xcr0 = _xgetbv(0);
+				__cpuidex(CPUInfo, 7, 0);
+#else
+				unsigned int eax, edx;
+				asm("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+				unsigned long long xcr0 = ((unsigned long long)edx << 32) | eax;
+				asm("cpuid": "=a" (CPUInfo[0]), "=b" (CPUInfo[1]), "=c" (CPUInfo[2]), "=d" (CPUInfo[3]): "a" (7), "c" (0));
+#endif
+				// check for AVX2 support
+				avx2 = ((xcr0 & 6) == 6) && (CPUInfo[1] & 0x20);
+			}
+		}
+		// AGO_CPU_DISABLE_AVX2=1 forces the SSE/scalar paths (used to test both sides of the dispatch)
+		char textBuffer[16];
+		if (avx2 && agoGetEnvironmentVariable("AGO_CPU_DISABLE_AVX2", textBuffer, sizeof(textBuffer)) && atoi(textBuffer))
+			avx2 = false;
+		supported = avx2 ? 1 : 0;
+	}
+	return supported ? true : false;
+}
+
+uint32_t agoGetCpuThreadCount()
+{
+	uint32_t count = 0;
+#if _WIN32
+	DWORD_PTR processMask = 0, systemMask = 0;
+	if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+		for (; processMask; processMask &= processMask - 1)
+			count++;
+	}
+#elif __linux__
+	cpu_set_t mask;
+	CPU_ZERO(&mask);
+	if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+		count = (uint32_t)CPU_COUNT(&mask);
+#endif
+	if (count == 0)
+		count = std::thread::hardware_concurrency();
+	return std::max(count, 1u);
+}
+
 uint32_t agoControlFpSetRoundEven()
 {
 	uint32_t state;
@@ -179,7 +235,7 @@ typedef struct {
 
 typedef struct {
     int type;   // should be VX_CRITICAL_SECTION
-    mutex mtx;
+    recursive_mutex mtx; // recursive like the Windows CRITICAL_SECTION
 } vx_critical_section;
 
 
@@ -187,7 +243,7 @@ typedef struct {
 void EnterCriticalSection(CRITICAL_SECTION* cs)
 {
     vx_critical_section * crit_sec = (vx_critical_section *)*cs;
-    std::lock_guard<std::mutex> lock(crit_sec->mtx);
+    crit_sec->mtx.lock();
 }
 
 // Emulates LeaveCriticalSection for non_windows platform
@@ -49,6 +49,12 @@ THE SOFTWARE.
 #include <functional>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <deque>
+#include <atomic>
+#include <memory>
 
 #if _WIN32
 #include <Windows.h>
@@ -130,6 +136,8 @@ typedef struct _ago_module    * ago_module;
 
 // platform independent functions
 bool       agoIsCpuHardwareSupported();
+bool       agoIsCpuAvx2Supported(); // AVX2 and F16C instructions with OS support for the YMM state, unless AGO_CPU_DISABLE_AVX2 is set
+uint32_t   agoGetCpuThreadCount(); // number of logical CPUs in the affinity mask of the process
 uint32_t   agoControlFpSetRoundEven();
 void       agoControlFpReset(uint32_t state);
 int64_t    agoGetClockCounter();
@@ -2731,6 +2731,115 @@ int agoAllocData(AgoData * data)
     return 0;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
+static int agoGpuCopyImageRegion(AgoData * data, vx_uint32 x_in_bytes, vx_uint32 y, vx_uint32 width_in_bytes, vx_uint32 height, bool toDevice)
+{
+#if ENABLE_OPENCL
+    return agoGpuOclCopyImageRegion(data, x_in_bytes, y, width_in_bytes, height, toDevice);
+#else
+    return agoGpuHipCopyImageRegion(data, x_in_bytes, y, width_in_bytes, height, toDevice);
+#endif
+}
+
+static void agoGetImagePatchRegion(AgoData * img, const vx_rectangle_t * rect, vx_rectangle_t& region)
+{
+    // region of the plane buffer (of ROI master, if any) covered by an image patch
+    vx_uint32 xs = img->u.img.x_scale_factor_is_2, ys = img->u.img.y_scale_factor_is_2;
+    region.start_x = rect->start_x >> xs;
+    region.start_y = rect->start_y >> ys;
+    region.end_x = (rect->end_x + xs) >> xs;
+    region.end_y = (rect->end_y + ys) >> ys;
+    if (img->u.img.isROI) {
+        region.start_x += img->u.img.rect_roi.start_x;
+        region.start_y += img->u.img.rect_roi.start_y;
+        region.end_x += img->u.img.rect_roi.start_x;
+        region.end_y += img->u.img.rect_roi.start_y;
+    }
+}
+#endif
+
+int agoSyncImagePatchFromGpu(AgoData * img, const vx_rectangle_t * rect)
+{
+    // make sure that an image patch of the host buffer is in sync with a GPU buffer dirty by node:
+    // only the rows and bytes covered by the patch are read unless the patch covers the whole plane
+#if ENABLE_OPENCL || ENABLE_HIP
+    AgoData * dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
+#if ENABLE_OPENCL
+    if (!dataToSync->opencl_buffer)
+#else
+    if (!dataToSync->hip_memory)
+#endif
+        return 0;
+    vx_uint32 flags = dataToSync->buffer_sync_flags;
+    if ((flags & (AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL | AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED)) != AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL)
+        return 0;
+    vx_rectangle_t region;
+    agoGetImagePatchRegion(img, rect, region);
+    vx_rectangle_t& synched = dataToSync->synched_rect;
+    if ((flags & AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED_RECT) &&
+        region.start_x >= synched.start_x && region.end_x <= synched.end_x && region.start_y >= synched.start_y && region.end_y <= synched.end_y)
+        return 0;
+    if (region.start_x == 0 && region.start_y == 0 && region.end_x >= dataToSync->u.img.width && region.end_y >= dataToSync->u.img.height) {
+        vx_uint32 stride = dataToSync->u.img.stride_in_bytes;
+        if (agoGpuCopyImageRegion(dataToSync, 0, 0, stride, (vx_uint32)(dataToSync->size / stride), false))
+            return -1;
+        dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED;
+        return 0;
+    }
+    vx_uint32 x_start = ImageWidthInBytesFloor(region.start_x, dataToSync), x_end = ImageWidthInBytesCeil(region.end_x, dataToSync);
+    if (agoGpuCopyImageRegion(dataToSync, x_start, region.start_y, x_end - x_start, region.end_y - region.start_y, false))
+        return -1;
+    // remember the synched region: it grows as long as the union is a rectangle (e.g., strips of rows)
+    if ((flags & AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED_RECT) && region.start_x == synched.start_x && region.end_x == synched.end_x &&
+        region.start_y <= synched.end_y && region.end_y >= synched.start_y)
+    {
+        synched.start_y = std::min(synched.start_y, region.start_y);
+        synched.end_y = std::max(synched.end_y, region.end_y);
+    }
+    else if ((flags & AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED_RECT) && region.start_y == synched.start_y && region.end_y == synched.end_y &&
+        region.start_x <= synched.end_x && region.end_x >= synched.start_x)
+    {
+        synched.start_x = std::min(synched.start_x, region.start_x);
+        synched.end_x = std::max(synched.end_x, region.end_x);
+    }
+    else {
+        synched = region;
+    }
+    dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED_RECT;
+#endif
+    return 0;
+}
+
+int agoSyncImagePatchToGpu(AgoData * img, const vx_rectangle_t * rect)
+{
+    // copy an image patch modified by the user into the GPU buffer when the GPU buffer holds the latest data
+    // outside the patch (in sync or dirty by node): returns 1 if copied, 0 if the caller has to mark the whole
+    // buffer as dirty by commit instead, and -1 on failure
+#if ENABLE_OPENCL || ENABLE_HIP
+    AgoData * dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
+#if ENABLE_OPENCL
+    if (!dataToSync->opencl_buffer)
+#else
+    if (!dataToSync->hip_memory)
+#endif
+        return 0;
+    if (!(dataToSync->buffer_sync_flags & (AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL | AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED)))
+        return 0;
+    vx_rectangle_t region;
+    agoGetImagePatchRegion(img, rect, region);
+    // pixels that don't start and end at byte boundaries would need a read-modify-write of the GPU buffer
+    vx_uint32 bits_num = dataToSync->u.img.pixel_size_in_bits_num, bits_denom = dataToSync->u.img.pixel_size_in_bits_denom * 8;
+    if (((region.start_x * bits_num) % bits_denom) || ((region.end_x * bits_num) % bits_denom))
+        return 0;
+    vx_uint32 x_start = ImageWidthInBytesFloor(region.start_x, dataToSync), x_end = ImageWidthInBytesFloor(region.end_x, dataToSync);
+    if (agoGpuCopyImageRegion(dataToSync, x_start, region.start_y, x_end - x_start, region.end_y - region.start_y, true))
+        return -1;
+    return 1;
+#else
+    return 0;
+#endif
+}
+
 void agoRetainData(AgoGraph * graph, AgoData * data, bool isForExternalUse)
 {
     if (isForExternalUse) {
@@ -3151,7 +3260,7 @@ AgoReference::~AgoReference()
 }
 AgoData::AgoData()
     : next{ nullptr }, size{ 0 }, import_type{ VX_MEMORY_TYPE_NONE },
-      buffer{ nullptr }, buffer_allocated{ nullptr }, reserved{ nullptr }, reserved_allocated{ nullptr }, buffer_sync_flags{ 0 },
+      buffer{ nullptr }, buffer_allocated{ nullptr }, reserved{ nullptr }, reserved_allocated{ nullptr }, buffer_sync_flags{ 0 }, synched_rect{ 0, 0, 0, 0 },
 #if ENABLE_OPENCL
       opencl_buffer{ nullptr }, opencl_buffer_allocated{ nullptr },
 #if defined(CL_VERSION_2_0)
@@ -3282,7 +3391,7 @@ AgoNode::~AgoNode()
 }
 AgoGraph::AgoGraph()
     : next{ nullptr }, hThread{ nullptr }, hSemToThread{ nullptr }, hSemFromThread{ nullptr },
-      threadScheduleCount{ 0 }, threadExecuteCount{ 0 }, threadWaitCount{ 0 }, threadThreadTerminationState{ 0 },
+      threadScheduleCount{ 0 }, threadExecuteCount{ 0 }, threadWaitCount{ 0 }, threadThreadTerminationState{ 0 }, scheduleRunning{ false },
       isReadyToExecute{ vx_false_e }, detectedInvalidNode{ false }, status{ VX_SUCCESS },
       virtualDataGenerationCount{ 0 }, optimizer_flags{ AGO_GRAPH_OPTIMIZER_FLAGS_DEFAULT }, verified{ false }, enable_performance_profiling{ false }, execFrameCount{ 0 }
 #if ENABLE_OPENCL
@@ -3334,7 +3443,7 @@ AgoGraph::~AgoGraph()
 AgoContext::AgoContext()
     : perfNormFactor{ 0 }, dataGenerationCount{ 0 }, nextUserStructId{ VX_TYPE_USER_STRUCT_START }, nextUserKernelId{ 0 }, nextUserLibraryId{ 1 },
       num_active_modules{ 0 }, num_active_references{ 0 }, callback_log{ nullptr }, callback_reentrant{ vx_false_e },
-      thread_config{ CONFIG_THREAD_DEFAULT }, importing_module_index_plus1{ 0 }, graph_garbage_data{ nullptr }, graph_garbage_node{ nullptr }, graph_garbage_list{ nullptr }
+      thread_config{ CONFIG_THREAD_DEFAULT }, graph_scheduler{ nullptr }, immediate_graph_cache_size{ CONFIG_IMMEDIATE_GRAPH_CACHE_SIZE }, importing_module_index_plus1{ 0 }, graph_garbage_data{ nullptr }, graph_garbage_node{ nullptr }, graph_garbage_list{ nullptr }
 #if ENABLE_OPENCL
 #if defined(CL_VERSION_2_0)
       , opencl_svmcaps{ 0 }
@@ -3352,6 +3461,7 @@ AgoContext::AgoContext()
     memset(&dataList, 0, sizeof(dataList));
     memset(&graphList, 0, sizeof(graphList));
     memset(&immediate_border_mode, 0, sizeof(immediate_border_mode));
+    immediate_border_mode.mode = VX_BORDER_MODE_UNDEFINED;
     memset(&extensions, 0, sizeof(extensions));
 #if ENABLE_OPENCL
     memset(&opencl_extensions, 0, sizeof(opencl_extensions));
@@ -3382,13 +3492,19 @@ AgoContext::AgoContext()
 
 AgoContext::~AgoContext()
 {
+    // the cached immediate mode graphs are released with all the other graphs below
+    immediate_graph_cache.clear();
     for (AgoGraph * agraph = graphList.head; agraph;) {
         AgoGraph * next = agraph->next;
         agraph->ref.external_count = 1;
         agraph->ref.internal_count = 0;
-        agoReleaseGraph(agraph);
+        agoReleaseGraph(agraph, true);
         agraph = next;
     }
+    if (graph_scheduler) {
+        delete graph_scheduler;
+        graph_scheduler = nullptr;
+    }
 
     for (AgoNode * node = graph_garbage_node; node;) {
         AgoNode * item = node;
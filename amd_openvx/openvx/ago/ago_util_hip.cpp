@@ -318,6 +318,21 @@ int agoGpuHipAllocBuffer(AgoData * data) {
     return 0;
 }
 
+int agoGpuHipCopyImageRegion(AgoData * data, vx_uint32 x_in_bytes, vx_uint32 y, vx_uint32 width_in_bytes, vx_uint32 height, bool toDevice) {
+    // copy a rectangular region between the host buffer and the HIP memory of an image (both use the same stride)
+    vx_size offset = (vx_size)y * data->u.img.stride_in_bytes + x_in_bytes;
+    vx_uint8 * host = data->buffer + offset;
+    vx_uint8 * device = data->hip_memory + data->gpu_buffer_offset + offset;
+    hipError_t err = toDevice ?
+        hipMemcpy2D(device, data->u.img.stride_in_bytes, host, data->u.img.stride_in_bytes, width_in_bytes, height, hipMemcpyHostToDevice) :
+        hipMemcpy2D(host, data->u.img.stride_in_bytes, device, data->u.img.stride_in_bytes, width_in_bytes, height, hipMemcpyDeviceToHost);
+    if (err != hipSuccess) {
+        agoAddLogEntry(&data->ref, VX_FAILURE, "ERROR: agoGpuHipCopyImageRegion: hipMemcpy2D(%d,%d,%d,%d) => %d\n", x_in_bytes, y, width_in_bytes, height, err);
+        return -1;
+    }
+    return 0;
+}
+
 static int agoGpuHipDataInputSync(AgoGraph * graph, AgoData * data, vx_uint32 dataFlags, vx_uint32 group, bool need_access, bool need_read_access) {
     if (data->ref.type == VX_TYPE_IMAGE) {
         // only use image objects that need read access
@@ -564,6 +564,25 @@ int agoGpuOclAllocBuffer(AgoData * data)
     return 0;
 }
 
+int agoGpuOclCopyImageRegion(AgoData * data, vx_uint32 x_in_bytes, vx_uint32 y, vx_uint32 width_in_bytes, vx_uint32 height, bool toDevice)
+{
+    // copy a rectangular region between the host buffer and the OpenCL buffer of an image (both use the same stride)
+    size_t buffer_origin[3] = { data->gpu_buffer_offset + x_in_bytes, y, 0 };
+    size_t host_origin[3] = { x_in_bytes, y, 0 };
+    size_t region[3] = { width_in_bytes, height, 1 };
+    size_t pitch = data->u.img.stride_in_bytes;
+    cl_command_queue opencl_cmdq = data->ref.context->opencl_cmdq;
+    cl_int err = toDevice ?
+        clEnqueueWriteBufferRect(opencl_cmdq, data->opencl_buffer, CL_TRUE, buffer_origin, host_origin, region, pitch, 0, pitch, 0, data->buffer, 0, NULL, NULL) :
+        clEnqueueReadBufferRect(opencl_cmdq, data->opencl_buffer, CL_TRUE, buffer_origin, host_origin, region, pitch, 0, pitch, 0, data->buffer, 0, NULL, NULL);
+    if (err) {
+        agoAddLogEntry(&data->ref, VX_FAILURE, "ERROR: agoGpuOclCopyImageRegion: %s(%d,%d,%d,%d) => %d\n",
+            toDevice ? "clEnqueueWriteBufferRect" : "clEnqueueReadBufferRect", x_in_bytes, y, width_in_bytes, height, err);
+        return -1;
+    }
+    return 0;
+}
+
 int agoGpuOclSuperNodeMerge(AgoGraph * graph, AgoSuperNode * supernode, AgoNode * node)
 {
     // sanity check
@@ -2134,6 +2153,14 @@ int agoGpuOclSuperNodeFinalize(AgoGraph * graph, AgoSuperNode * supernode)
         return -1; 
     }
     // set all kernel objects
+    return agoGpuOclSuperNodeSetKernelArgs(graph, supernode);
+}
+
+int agoGpuOclSuperNodeSetKernelArgs(AgoGraph * graph, AgoSuperNode * supernode)
+{
+    cl_int err;
+    vx_uint32 width = supernode->width;
+    vx_uint32 height = supernode->height;
     vx_uint32 kernelArgIndex = 0;
     err = clSetKernelArg(supernode->opencl_kernel, (cl_uint)kernelArgIndex, sizeof(cl_uint), &width);
     if (err) { 
@@ -2284,6 +2311,11 @@ int agoGpuOclSingleNodeFinalize(AgoGraph * graph, AgoNode * node)
         return -1; 
     }
     // set all kernel objects
+    return agoGpuOclSingleNodeSetKernelArgs(graph, node);
+}
+
+int agoGpuOclSingleNodeSetKernelArgs(AgoGraph * graph, AgoNode * node)
+{
     vx_uint32 kernelArgIndex = 0;
     for (size_t index = 0; index < node->paramCount; index++) {
         if (node->paramList[index] && !(node->opencl_param_discard_mask & (1 << index))) {
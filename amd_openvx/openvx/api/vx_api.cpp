@@ -1743,36 +1743,12 @@ VX_API_ENTRY vx_status VX_API_CALL vxAccessImagePatch(vx_image image_,
                 img->mapped.push_back(item);
                 *ptr = ptr_returned;
                 if (usage == VX_READ_ONLY || usage == VX_READ_AND_WRITE) {
-#if ENABLE_OPENCL
-                    auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
-                    if (dataToSync->opencl_buffer && !(dataToSync->buffer_sync_flags & AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED)) {
-                        // make sure dirty OpenCL buffers are synched before giving access for read
-                        if (dataToSync->buffer_sync_flags & (AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL)) {
-                            cl_int err = clEnqueueReadBuffer(dataToSync->ref.context->opencl_cmdq, dataToSync->opencl_buffer, CL_TRUE, dataToSync->gpu_buffer_offset, dataToSync->size, dataToSync->buffer, 0, NULL, NULL);
-                            if (err) {
-                                status = VX_FAILURE;
-                                agoAddLogEntry(&image->ref, status, "ERROR: vxAccessImagePatch: clEnqueueReadBuffer() => %d\n", err);
-                                return status;
-                            }
-                            dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED;
-                        }
-                    }
-#elif ENABLE_HIP
-                    auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
-                    if (dataToSync->hip_memory && !(dataToSync->buffer_sync_flags & AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED)) {
-                        // make sure dirty OpenCL buffers are synched before giving access for read
-                        // copy from Device to Host
-                        if (dataToSync->buffer_sync_flags & (AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL)) {
-                            hipError_t err = hipMemcpyDtoH((void *)dataToSync->buffer, (dataToSync->hip_memory + dataToSync->gpu_buffer_offset), dataToSync->size);
-                            if (err) {
-                                status = VX_FAILURE;
-                                agoAddLogEntry(&image->ref, status, "ERROR: vxAccessImagePatch: hipMemcpyDtoH() => %d\n", err);
-                                return status;
-                            }
-                            dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED;
-                        }
+                    // make sure the patch of dirty GPU buffers is synched before giving access for read
+                    if (agoSyncImagePatchFromGpu(img, rect)) {
+                        status = VX_FAILURE;
+                        agoAddLogEntry(&image->ref, status, "ERROR: vxAccessImagePatch: agoSyncImagePatchFromGpu() failed\n");
+                        return status;
                     }
-#endif
                     if (item.used_external_ptr) {
                         // copy if read is requested with explicit external buffer
                         if (addr->stride_x == 0 || ((addr->stride_x << 3) == img->u.img.pixel_size_in_bits_num && img->u.img.pixel_size_in_bits_denom == 1))
@@ -1867,10 +1843,16 @@ VX_API_ENTRY vx_status VX_API_CALL vxCommitImagePatch(vx_image image_,
                             HafCpu_BufferCopyDisperseInSrc(((rect->end_x - rect->start_x) >> img->u.img.x_scale_factor_is_2) * addr->stride_x, ((rect->end_y - rect->start_y) >> img->u.img.y_scale_factor_is_2),
                             (img->u.img.pixel_size_in_bits_num / img->u.img.pixel_size_in_bits_denom + 7) >> 3, buffer, img->u.img.stride_in_bytes, (vx_uint8 *)ptr, addr->stride_y, addr->stride_x);
                     }
-                    // update sync flags
-                    auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
-                    dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
-                    dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    // copy the patch into the GPU buffer if possible, otherwise update sync flags
+                    int synched = agoSyncImagePatchToGpu(img, rect);
+                    if (synched < 0) {
+                        status = VX_FAILURE;
+                    }
+                    else if (!synched) {
+                        auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
+                        dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+                        dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    }
                 }
             }
         }
@@ -2109,50 +2091,23 @@ VX_API_ENTRY vx_status VX_API_CALL vxMapImagePatch(vx_image image_, const vx_rec
                 }
             }
             if (status == VX_SUCCESS) {
-#if ENABLE_OPENCL
                 if (usage == VX_READ_ONLY || usage == VX_READ_AND_WRITE) {
-                    auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
-                    if (dataToSync->opencl_buffer && !(dataToSync->buffer_sync_flags & AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED)) {
-                        // make sure dirty OpenCL buffers are synched before giving access for read
-                        if (dataToSync->buffer_sync_flags & (AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL)) {
-                            cl_int err = clEnqueueReadBuffer(dataToSync->ref.context->opencl_cmdq, dataToSync->opencl_buffer, CL_TRUE, dataToSync->gpu_buffer_offset, dataToSync->size, dataToSync->buffer, 0, NULL, NULL);
-                            if (err) {
-                                status = VX_FAILURE;
-                                agoAddLogEntry(&image->ref, status, "ERROR: vxMapImagePatch: clEnqueueReadBuffer() => %d\n", err);
-                                return status;
-                            }
-                            dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED;
-                        }
+                    // make sure the patch of dirty GPU buffers is synched before giving access for read
+                    if (agoSyncImagePatchFromGpu(img, rect)) {
+                        status = VX_FAILURE;
+                        agoAddLogEntry(&image->ref, status, "ERROR: vxMapImagePatch: agoSyncImagePatchFromGpu() failed\n");
+                        return status;
                     }
                 }
+#if ENABLE_OPENCL || ENABLE_HIP
                 else if (usage == VX_WRITE_ONLY)
                 {
                     auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
                     dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_WRITE;
                 }
-#elif ENABLE_HIP
-                    auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
-                    if (dataToSync->hip_memory && !(dataToSync->buffer_sync_flags & AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED)) {
-                        // make sure dirty OpenCL buffers are synched before giving access for read
-                        // copy from Device to Host
-                        if (dataToSync->buffer_sync_flags & (AGO_BUFFER_SYNC_FLAG_DIRTY_BY_NODE_CL)) {
-                            hipError_t err = hipMemcpyDtoH((void *)dataToSync->buffer, (dataToSync->hip_memory + dataToSync->gpu_buffer_offset), dataToSync->size);
-                            if (err) {
-                                status = VX_FAILURE;
-                                agoAddLogEntry(&image->ref, status, "ERROR: vxAccessImagePatch: hipMemcpyDtoH() => %d\n", err);
-                                return status;
-                            }
-                            dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED;
-                        }
-                    }
-                    if (usage == VX_WRITE_ONLY)
-                    {
-                        auto dataToSync = img->u.img.isROI ? img->u.img.roiMasterImage : img;
-                        dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_WRITE;
-                    }
 #endif
                 // get map id and set returned pointer
-                MappedData item = { img->nextMapId++, ptr_returned, usage, false, 0, plane_index };
+                MappedData item = { img->nextMapId++, ptr_returned, usage, false, 0, plane_index, *rect };
                 image->mapped.push_back(item);
                 *map_id = item.map_id;
                 *ptr = ptr_returned;
@@ -2192,18 +2147,26 @@ VX_API_ENTRY vx_status VX_API_CALL vxUnmapImagePatch(vx_image image_, vx_map_id
             if (i->map_id == map_id) {
                 vx_enum usage = i->usage;
                 vx_uint32 plane = i->plane;
+                vx_rectangle_t rect = i->rect;
                 image->mapped.erase(i);
+                status = VX_SUCCESS;
                 if (usage == VX_WRITE_ONLY || usage == VX_READ_AND_WRITE) {
-                    // update sync flags
-                    auto dataToSync = image->u.img.isROI ? image->u.img.roiMasterImage : image;
-                    dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
-                    dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
-                    if (dataToSync->numChildren > 0 && plane < dataToSync->numChildren && dataToSync->children[plane]) {
-                        dataToSync->children[plane]->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
-                        dataToSync->children[plane]->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                    // copy only the patch into the GPU buffer if possible, otherwise update sync flags
+                    AgoData * img = (image->children && plane < image->numChildren) ? image->children[plane] : image;
+                    int synched = agoSyncImagePatchToGpu(img, &rect);
+                    if (synched < 0) {
+                        status = VX_FAILURE;
+                    }
+                    else if (!synched) {
+                        auto dataToSync = image->u.img.isROI ? image->u.img.roiMasterImage : image;
+                        dataToSync->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+                        dataToSync->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                        if (dataToSync->numChildren > 0 && plane < dataToSync->numChildren && dataToSync->children[plane]) {
+                            dataToSync->children[plane]->buffer_sync_flags &= ~AGO_BUFFER_SYNC_FLAG_DIRTY_MASK;
+                            dataToSync->children[plane]->buffer_sync_flags |= AGO_BUFFER_SYNC_FLAG_DIRTY_BY_COMMIT;
+                        }
                     }
                 }
-                status = VX_SUCCESS;
                 break;
             }
         }
@@ -2899,7 +2862,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxReleaseGraph(vx_graph *graph)
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
     if (graph && agoIsValidGraph(*graph)) {
-        if (!agoReleaseGraph(*graph)) {
+        if (!agoReleaseGraph(*graph, true)) {
             *graph = NULL;
             status = VX_SUCCESS;
         }
@@ -2935,8 +2898,9 @@ VX_API_ENTRY vx_status VX_API_CALL vxVerifyGraph(vx_graph graph)
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
     if (agoIsValidGraph(graph)) {
+        // only the graph is locked for the whole verification: the context lock is taken just around
+        // the shared context structures, so that graphs can be verified concurrently
         CAgoLock lock(graph->cs);
-        CAgoLock lock2(graph->ref.context->cs);
 
         // mark that graph is not verified and can't be executed
         //graph->verified = vx_false_e;
@@ -2954,14 +2918,20 @@ VX_API_ENTRY vx_status VX_API_CALL vxVerifyGraph(vx_graph graph)
         }
 
         // set the AGO_DEFAULT_TARGET if it is not set by the user
-        if (!agoGetEnvironmentVariable("AGO_DEFAULT_TARGET", textBuffer, sizeof(textBuffer))) {
+        {
+            CAgoLock lock2(graph->ref.context->cs);
+            if (!agoGetEnvironmentVariable("AGO_DEFAULT_TARGET", textBuffer, sizeof(textBuffer))) {
 #if ENABLE_OPENCL || ENABLE_HIP
-            agoSetEnvironmentVariable("AGO_DEFAULT_TARGET", "GPU");
+                agoSetEnvironmentVariable("AGO_DEFAULT_TARGET", "GPU");
 #else
-            agoSetEnvironmentVariable("AGO_DEFAULT_TARGET", "CPU");
+                agoSetEnvironmentVariable("AGO_DEFAULT_TARGET", "CPU");
 #endif
+            }
         }
 
+        // claim the context objects used by the graph: graphs sharing objects are verified one at a time
+        agoAcquireGraphContextData(graph);
+
         // verify graph per OpenVX specification
         status = agoVerifyGraph(graph);
         if (status == VX_SUCCESS) {
@@ -2980,6 +2950,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxVerifyGraph(vx_graph graph)
             graph->verified = vx_true_e;
             graph->state = VX_GRAPH_STATE_VERIFIED;
         }
+        agoReleaseGraphContextData(graph);
 
         if (ago_graph_dump) {
             if (status == VX_SUCCESS) {
@@ -3269,12 +3240,24 @@ VX_API_ENTRY vx_status VX_API_CALL vxAddParameterToGraph(vx_graph graph, vx_para
 * \retval VX_ERROR_INVALID_REFERENCE The value is not a valid <tt>\ref vx_reference</tt>.
 * \retval VX_ERROR_INVALID_PARAMETER The parameter index is out of bounds or the
 * dir parameter is incorrect.
+* \note A parameter of a verified graph can be rebound without verifying the graph again when the new
+* object has the same meta-format (type, format, dimensions) as the object it replaces. The new object
+* is used by all the nodes of the optimized graph that used the object it replaces.
 * \ingroup group_graph_parameters
 */
 VX_API_ENTRY vx_status VX_API_CALL vxSetGraphParameterByIndex(vx_graph graph, vx_uint32 index, vx_reference value)
 {
     vx_status status = VX_ERROR_INVALID_REFERENCE;
-    if (agoIsValidGraph(graph) && !graph->verified) {
+    if (agoIsValidGraph(graph) && graph->verified) {
+        // rebinding a verified graph keeps the optimized graph: only objects with the same meta-format are accepted
+        status = VX_ERROR_INVALID_PARAMETERS;
+        if ((index < graph->parameters.size()) && graph->parameters[index] && value && agoIsValidReference(value)) {
+            if (!agoRebindGraphParameter(graph, index, (AgoData *)value)) {
+                status = VX_SUCCESS;
+            }
+        }
+    }
+    else if (agoIsValidGraph(graph)) {
         status = VX_ERROR_INVALID_PARAMETERS;
         if ((index < graph->parameters.size()) && graph->parameters[index] && (!value || agoIsValidReference(value))) {
             vx_parameter parameter = graph->parameters[index];
@@ -10321,3 +10304,8 @@ VX_API_ENTRY vx_bool VX_API_CALL vxIsTensorAliased(vx_tensor tensorMaster, vx_si
     }
     return status;
 }
+
+VX_API_ENTRY vx_bool VX_API_CALL vxIsCpuAvx2Supported()
+{
+    return agoIsCpuAvx2Supported() ? vx_true_e : vx_false_e;
+}
@@ -788,4 +788,61 @@ VX_API_ENTRY vx_node VX_API_CALL vxLaplacianReconstructNode(vx_graph graph, vx_p
                                            params,
                                            dimof(params));
     return node;
-}
\ No newline at end of file
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorTransposeNode(vx_graph graph, vx_tensor input, vx_tensor output, vx_size dimension1, vx_size dimension2)
+{
+    vx_context context = vxGetContext((vx_reference)graph);
+    vx_scalar dim1 = vxCreateScalar(context, VX_TYPE_SIZE, &dimension1);
+    vx_scalar dim2 = vxCreateScalar(context, VX_TYPE_SIZE, &dimension2);
+    vx_reference params[] = {
+            (vx_reference)input,
+            (vx_reference)output,
+            (vx_reference)dim1,
+            (vx_reference)dim2,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_TRANSPOSE,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&dim1);
+    vxReleaseScalar(&dim2);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxScaleCropImageToTensorNode(vx_graph graph, vx_reference input, vx_array crop, vx_array mean, vx_array stddev, vx_bool reverseChannelOrder, vx_tensor output)
+{
+    vx_scalar reverse = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_BOOL, &reverseChannelOrder);
+    vx_reference params[] = {
+            (vx_reference)output,
+            input,
+            (vx_reference)crop,
+            (vx_reference)mean,
+            (vx_reference)stddev,
+            (vx_reference)reverse,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_AMD_SCALE_CROP_IMAGE_TO_TENSOR_DATA_DATA,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&reverse);
+    return node;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL vxTensorConvertDepthNode(vx_graph graph, vx_tensor input, vx_enum policy, vx_scalar norm, vx_scalar offset, vx_tensor output)
+{
+    vx_scalar spolicy = vxCreateScalar(vxGetContext((vx_reference)graph), VX_TYPE_ENUM, &policy);
+    vx_reference params[] = {
+            (vx_reference)input,
+            (vx_reference)spolicy,
+            (vx_reference)norm,
+            (vx_reference)offset,
+            (vx_reference)output,
+    };
+    vx_node node = vxCreateNodeByStructure(graph,
+                                           VX_KERNEL_TENSOR_CONVERT_DEPTH,
+                                           params,
+                                           dimof(params));
+    vxReleaseScalar(&spolicy);
+    return node;
+}
@@ -40,7 +40,162 @@ static void vxuSetGraphAffinityDefault(vx_graph graph)
     graph->attr_affinity.device_info = 0;
 }
 
- 
+
+
+// signature of a single node graph for the immediate mode graph cache: everything that graph verification
+// depends on, so that a verified graph can be reused for another call with the same signature
+static bool vxuGetNodeSignature(vx_graph graph, vx_node node, std::string& signature)
+{
+    char desc[MAX_DESCRIPTION_DATA_SIZE * 2];
+    snprintf(desc, sizeof(desc), "%s|%d|%d,%u|%u,%u", node->akernel->name, node->akernel->id,
+             node->attr_border_mode.mode, node->attr_border_mode.mode == VX_BORDER_CONSTANT ? node->attr_border_mode.constant_value.U32 : 0,
+             graph->attr_affinity.device_type, graph->attr_affinity.device_info);
+    signature = desc;
+    for (vx_uint32 i = 0; i < node->paramCount; i++) {
+        AgoData * data = node->paramList[i];
+        if (!data) {
+            signature += "|null";
+            continue;
+        }
+        if (data->isVirtual || data->ref.type == VX_TYPE_DELAY || data->ref.type == VX_TYPE_OBJECT_ARRAY ||
+            (data->ref.type == VX_TYPE_IMAGE && data->u.img.isROI))
+        {
+            // not supported by the cache
+            return false;
+        }
+        // repeated objects
+        vx_uint32 first = i;
+        for (vx_uint32 j = 0; j < i; j++) {
+            if (node->paramList[j] == data) {
+                first = j;
+                break;
+            }
+        }
+        if (first != i) {
+            snprintf(desc, sizeof(desc), "|#%u", first);
+            signature += desc;
+            continue;
+        }
+        if (data->ref.type == VX_TYPE_SCALAR && node->parameters[i].direction != VX_INPUT) {
+            // output values don't matter
+            snprintf(desc, sizeof(desc), "|scalar:%s", agoEnum2Name(data->u.scalar.type));
+        }
+        else {
+            // input scalar values can select kernels during verification
+            desc[0] = '|';
+            agoGetDescriptionFromData(graph->ref.context, desc + 1, data);
+        }
+        signature += desc;
+        if (data->ref.type == VX_TYPE_IMAGE) {
+            snprintf(desc, sizeof(desc), ",%u", data->u.img.stride_in_bytes);
+            signature += desc;
+        }
+        else if (data->ref.type == VX_TYPE_CONVOLUTION || data->ref.type == VX_TYPE_MATRIX) {
+            // coefficients can select kernels during verification
+            if (data->size > 1024)
+                return false;
+            signature += ",";
+            for (vx_size k = 0; data->buffer && k < data->size; k++) {
+                snprintf(desc, sizeof(desc), "%02x", data->buffer[k]);
+                signature += desc;
+            }
+        }
+    }
+    return true;
+}
+
+// the cache keeps the parameter objects of a cached graph alive, since the graph can refer to their children only
+static void vxuRetainParams(const std::vector<AgoData *>& params)
+{
+    for (auto data : params) {
+        if (data)
+            agoRetainData(nullptr, data, false);
+    }
+}
+
+static void vxuReleaseParams(const std::vector<AgoData *>& params)
+{
+    for (auto data : params) {
+        if (data)
+            agoReleaseData(data, false);
+    }
+}
+
+// verify and execute a single node graph: verified graphs are kept in a per-context LRU cache and later
+// calls with the same signature execute the cached graph with the parameters of the new node
+static vx_status vxuProcessNode(vx_context context, vx_graph graph, vx_node node)
+{
+    std::string signature;
+    if (!context->immediate_graph_cache_size || !vxuGetNodeSignature(graph, node, signature)) {
+        vx_status status = vxVerifyGraph(graph);
+        if (status == VX_SUCCESS)
+            status = vxProcessGraph(graph);
+        return status;
+    }
+    std::vector<AgoData *> params(node->paramList, node->paramList + node->paramCount);
+
+    // the entry is taken out of the cache while in use, so that concurrent calls don't share the graph
+    AgoImmediateGraph entry = { signature, nullptr };
+    {
+        CAgoLock lock(context->cs);
+        for (auto it = context->immediate_graph_cache.begin(); it != context->immediate_graph_cache.end(); it++) {
+            if (it->signature == signature) {
+                entry = *it;
+                context->immediate_graph_cache.erase(it);
+                break;
+            }
+        }
+    }
+    vx_status status = VX_FAILURE;
+    std::vector<AgoImmediateGraph> evicted;
+    if (entry.graph) {
+        status = VX_FAILURE;
+        if (!agoReplaceGraphData(entry.graph, (vx_uint32)params.size(), entry.params.data(), params.data())) {
+            vxuRetainParams(params);
+            vxuReleaseParams(entry.params);
+            entry.params = params;
+            status = vxProcessGraph(entry.graph);
+        }
+        if (status != VX_SUCCESS) {
+            evicted.push_back(entry);
+            entry.graph = nullptr;
+        }
+    }
+    else {
+        status = vxVerifyGraph(graph);
+        if (status == VX_SUCCESS)
+            status = vxProcessGraph(graph);
+        bool cacheable = (status == VX_SUCCESS);
+#if (ENABLE_OPENCL||ENABLE_HIP)
+        // GPU buffers and kernel arguments are bound during verification
+        for (AgoNode * anode = graph->nodeList.head; anode && cacheable; anode = anode->next) {
+            if (anode->attr_affinity.device_type == AGO_KERNEL_FLAG_DEVICE_GPU)
+                cacheable = false;
+        }
+#endif
+        if (cacheable) {
+            // the cache keeps the graph alive after the caller releases it with an internal reference
+            CAgoLock lock(context->cs);
+            graph->ref.internal_count++;
+            entry.graph = graph;
+            entry.params = params;
+            vxuRetainParams(entry.params);
+        }
+    }
+    if (entry.graph) {
+        CAgoLock lock(context->cs);
+        context->immediate_graph_cache.push_front(entry);
+        while (context->immediate_graph_cache.size() > context->immediate_graph_cache_size) {
+            evicted.push_back(context->immediate_graph_cache.back());
+            context->immediate_graph_cache.pop_back();
+        }
+    }
+    for (auto& item : evicted) {
+        vxuReleaseParams(item.params);
+        agoReleaseGraph(item.graph, false);
+    }
+    return status;
+}
 
 VX_API_ENTRY vx_status VX_API_CALL vxuColorConvert(vx_context context, vx_image src, vx_image dst)
 {
@@ -52,11 +207,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuColorConvert(vx_context context, vx_image
 		vx_node node = vxColorConvertNode(graph, src, dst);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -74,11 +225,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuChannelExtract(vx_context context, vx_imag
 		vx_node node = vxChannelExtractNode(graph, src, channel, dst);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -101,11 +248,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuChannelCombine(vx_context context,
 		vx_node node = vxChannelCombineNode(graph, plane0, plane1, plane2, plane3, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -134,11 +277,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuSobel3x3(vx_context context, vx_image src,
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -156,11 +295,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuMagnitude(vx_context context, vx_image gra
 		vx_node node = vxMagnitudeNode(graph, grad_x, grad_y, dst);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -178,11 +313,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuPhase(vx_context context, vx_image grad_x,
 		vx_node node = vxPhaseNode(graph, grad_x, grad_y, dst);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -202,11 +333,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuScaleImage(vx_context context, vx_image sr
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -224,11 +351,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuTableLookup(vx_context context, vx_image i
 		vx_node node = vxTableLookupNode(graph, input, lut, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -246,11 +369,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuHistogram(vx_context context, vx_image inp
 		vx_node node = vxHistogramNode(graph, input, distribution);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -268,11 +387,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuEqualizeHist(vx_context context, vx_image
 		vx_node node = vxEqualizeHistNode(graph, input, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -290,11 +405,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuAbsDiff(vx_context context, vx_image in1,
 		vx_node node = vxAbsDiffNode(graph, in1, in2, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -314,10 +425,9 @@ VX_API_ENTRY vx_status VX_API_CALL vxuMeanStdDev(vx_context context, vx_image in
         vx_node node = vxMeanStdDevNode(graph, input, s_mean, s_stddev);
         if (node)
         {
-            status = vxVerifyGraph(graph);
+            status = vxuProcessNode(context, graph, node);
             if (status == VX_SUCCESS)
             {
-                status = vxProcessGraph(graph);
                 if(mean) vxReadScalarValue(s_mean, mean);
                 if(stddev) vxReadScalarValue(s_stddev, stddev);
             }
@@ -340,11 +450,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuThreshold(vx_context context, vx_image inp
 		vx_node node = vxThresholdNode(graph, input, thresh, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -362,11 +468,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuIntegralImage(vx_context context, vx_image
 		vx_node node = vxIntegralImageNode(graph, input, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -386,11 +488,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuErode3x3(vx_context context, vx_image inpu
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -410,11 +508,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuDilate3x3(vx_context context, vx_image inp
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -434,11 +528,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuMedian3x3(vx_context context, vx_image inp
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -458,11 +548,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuBox3x3(vx_context context, vx_image input,
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -482,11 +568,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuGaussian3x3(vx_context context, vx_image i
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -506,11 +588,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuConvolve(vx_context context, vx_image inpu
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -530,11 +608,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuGaussianPyramid(vx_context context, vx_ima
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -552,11 +626,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuAccumulateImage(vx_context context, vx_ima
 		vx_node node = vxAccumulateImageNode(graph, input, accum);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -574,11 +644,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuAccumulateWeightedImage(vx_context context
 		vx_node node = vxAccumulateWeightedImageNode(graph, input, scale, accum);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -596,11 +662,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuAccumulateSquareImage(vx_context context,
 		vx_node node = vxAccumulateSquareImageNode(graph, input, scale, accum);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -621,11 +683,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuMinMaxLoc(vx_context context, vx_image inp
 		vx_node node = vxMinMaxLocNode(graph, input, minVal, maxVal, minLoc, maxLoc, minCount, maxCount);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -644,11 +702,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuConvertDepth(vx_context context, vx_image
 		vx_node node = vxConvertDepthNode(graph, input, output, policy, sshift);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -669,11 +723,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuCannyEdgeDetector(vx_context context, vx_i
 		vx_node node = vxCannyEdgeDetectorNode(graph, input, hyst, gradient_size, norm_type, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -693,11 +743,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuHalfScaleGaussian(vx_context context, vx_i
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -715,11 +761,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuAnd(vx_context context, vx_image in1, vx_i
 		vx_node node = vxAndNode(graph, in1, in2, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -737,11 +779,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuOr(vx_context context, vx_image in1, vx_im
 		vx_node node = vxOrNode(graph, in1, in2, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -759,11 +797,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuXor(vx_context context, vx_image in1, vx_i
 		vx_node node = vxXorNode(graph, in1, in2, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -781,11 +815,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuNot(vx_context context, vx_image input, vx
 		vx_node node = vxNotNode(graph, input, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -804,11 +834,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuMultiply(vx_context context, vx_image in1,
 		vx_node node = vxMultiplyNode(graph, in1, in2, sscale, overflow_policy, rounding_policy, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -827,11 +853,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuAdd(vx_context context, vx_image in1, vx_i
 		vx_node node = vxAddNode(graph, in1, in2, policy, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -849,11 +871,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuSubtract(vx_context context, vx_image in1,
 		vx_node node = vxSubtractNode(graph, in1, in2, policy, out);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -873,11 +891,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuWarpAffine(vx_context context, vx_image in
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -897,11 +911,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuWarpPerspective(vx_context context, vx_ima
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -926,11 +936,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuHarrisCorners(vx_context context, vx_image
 		vx_node node = vxHarrisCornersNode(graph, input, strength_thresh, min_distance, sensitivity, gradient_size, block_size, corners, num_corners);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -948,11 +954,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuFastCorners(vx_context context, vx_image i
 		vx_node node = vxFastCornersNode(graph, input, sens, nonmax, corners, num_corners);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -980,11 +982,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuOpticalFlowPyrLK(vx_context context, vx_py
                 termination,epsilon,num_iterations,use_initial_estimate,window_dimension);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -1004,11 +1002,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuRemap(vx_context context, vx_image input,
         {
             status = vx_useImmediateBorderMode(context, node);
             if (status == VX_SUCCESS)
-                status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+                status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -1026,11 +1020,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuWeightedAverage(vx_context context, vx_ima
 		vx_node node = vxWeightedAverageNode(graph, img1, alpha, img2, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -1048,11 +1038,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuNonLinearFilter(vx_context context, vx_enu
 		vx_node node = vxNonLinearFilterNode(graph, function, input, mask, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -1070,11 +1056,7 @@ VX_API_ENTRY vx_status VX_API_CALL vxuLaplacianPyramid(vx_context context, vx_im
 		vx_node node = vxLaplacianPyramidNode(graph, input, laplacian, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
@@ -1092,14 +1074,64 @@ VX_API_ENTRY vx_status VX_API_CALL vxuLaplacianReconstruct(vx_context context, v
 		vx_node node = vxLaplacianReconstructNode(graph, laplacian, input, output);
         if (node)
         {
-            status = vxVerifyGraph(graph);
-            if (status == VX_SUCCESS)
-            {
-                status = vxProcessGraph(graph);
-            }
+            status = vxuProcessNode(context, graph, node);
+            vxReleaseNode(&node);
+        }
+        vxReleaseGraph(&graph);
+    }
+    return status;
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxuTensorTranspose(vx_context context, vx_tensor input, vx_tensor output, vx_size dimension1, vx_size dimension2)
+{
+    vx_status status = VX_FAILURE;
+    vx_graph graph = vxCreateGraph(context);
+    if (graph)
+    {
+		vxuSetGraphAffinityDefault(graph);
+		vx_node node = vxTensorTransposeNode(graph, input, output, dimension1, dimension2);
+        if (node)
+        {
+            status = vxuProcessNode(context, graph, node);
             vxReleaseNode(&node);
         }
         vxReleaseGraph(&graph);
     }
     return status;
-}
\ No newline at end of file
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxuTensorConvertDepth(vx_context context, vx_tensor input, vx_enum policy, vx_scalar norm, vx_scalar offset, vx_tensor output)
+{
+    vx_status status = VX_FAILURE;
+    vx_graph graph = vxCreateGraph(context);
+    if (graph)
+    {
+		vxuSetGraphAffinityDefault(graph);
+		vx_node node = vxTensorConvertDepthNode(graph, input, policy, norm, offset, output);
+        if (node)
+        {
+            status = vxuProcessNode(context, graph, node);
+            vxReleaseNode(&node);
+        }
+        vxReleaseGraph(&graph);
+    }
+    return status;
+}
+
+VX_API_ENTRY vx_status VX_API_CALL vxuScaleCropImageToTensor(vx_context context, vx_reference input, vx_array crop, vx_array mean, vx_array stddev, vx_bool reverseChannelOrder, vx_tensor output)
+{
+    vx_status status = VX_FAILURE;
+    vx_graph graph = vxCreateGraph(context);
+    if (graph)
+    {
+		vxuSetGraphAffinityDefault(graph);
+		vx_node node = vxScaleCropImageToTensorNode(graph, input, crop, mean, stddev, reverseChannelOrder, output);
+        if (node)
+        {
+            status = vxuProcessNode(context, graph, node);
+            vxReleaseNode(&node);
+        }
+        vxReleaseGraph(&graph);
+    }
+    return status;
+}
@@ -652,6 +652,48 @@ extern "C"
      */
     VX_API_ENTRY vx_bool VX_API_CALL vxIsTensorAliased(vx_tensor tensorMaster, vx_size offset, vx_tensor tensor);
 
+    /*!
+     * \brief [Graph] Creates a node that crops, scales and normalizes images into an NCHW tensor in a single pass (CPU only).
+     * \ingroup group_amd
+     * \param [in] graph The reference to the graph.
+     * \param [in] input A <tt>\ref VX_DF_IMAGE_RGB</tt> or <tt>\ref VX_DF_IMAGE_NV12</tt> image, or an object array of such images (one per batch item).
+     * \param [in] crop [optional] An array of <tt>\ref VX_TYPE_RECTANGLE</tt> with the crop of each image, or one crop for all images (default: the whole image).
+     * \param [in] mean [optional] An array of <tt>\ref VX_TYPE_FLOAT32</tt> with 1 or 3 values subtracted from the output channels (default: 0).
+     * \param [in] stddev [optional] An array of <tt>\ref VX_TYPE_FLOAT32</tt> with 1 or 3 values the output channels are divided by (default: 1).
+     * \param [in] reverseChannelOrder Store the channels in BGR order instead of RGB. The <tt>mean</tt> and <tt>stddev</tt> values are
+     * indexed by output channel, so with <tt>vx_true_e</tt> their first value applies to the B channel.
+     * \param [out] output A <tt>\ref VX_TYPE_FLOAT32</tt> or <tt>\ref VX_TYPE_FLOAT16</tt> tensor with dimensions [W,H,3] or [W,H,3,N].
+     * \return <tt>\ref vx_node</tt>.
+     * \retval vx_node A node reference. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>
+     */
+    VX_API_ENTRY vx_node VX_API_CALL vxScaleCropImageToTensorNode(vx_graph graph, vx_reference input, vx_array crop, vx_array mean, vx_array stddev, vx_bool reverseChannelOrder, vx_tensor output);
+
+    /*!
+     * \brief [Immediate] Crops, scales and normalizes images into an NCHW tensor (see <tt>\ref vxScaleCropImageToTensorNode</tt>).
+     * \ingroup group_amd
+     * \param [in] context The reference to the overall context.
+     * \param [in] input A <tt>\ref VX_DF_IMAGE_RGB</tt> or <tt>\ref VX_DF_IMAGE_NV12</tt> image, or an object array of such images.
+     * \param [in] crop [optional] An array of <tt>\ref VX_TYPE_RECTANGLE</tt>.
+     * \param [in] mean [optional] An array of <tt>\ref VX_TYPE_FLOAT32</tt> with 1 or 3 values, indexed by output channel.
+     * \param [in] stddev [optional] An array of <tt>\ref VX_TYPE_FLOAT32</tt> with 1 or 3 values, indexed by output channel.
+     * \param [in] reverseChannelOrder Store the channels in BGR order instead of RGB.
+     * \param [out] output A <tt>\ref VX_TYPE_FLOAT32</tt> or <tt>\ref VX_TYPE_FLOAT16</tt> tensor.
+     * \return A <tt>\ref vx_status_e</tt> enumeration.
+     * \retval VX_SUCCESS Success
+     * \retval * An error occurred. See <tt>\ref vx_status_e</tt>.
+     */
+    VX_API_ENTRY vx_status VX_API_CALL vxuScaleCropImageToTensor(vx_context context, vx_reference input, vx_array crop, vx_array mean, vx_array stddev, vx_bool reverseChannelOrder, vx_tensor output);
+
+    /*!
+     * \brief Checks whether the CPU supports AVX2 and F16C instructions and the OS saves the YMM state.
+     * \details This is the probe used to select the AVX2 code paths of the CPU kernels, so that modules
+     * which dispatch at run time make the same choice as the OpenVX library.
+     * Setting the environment variable <tt>AGO_CPU_DISABLE_AVX2=1</tt> makes it return <tt>\ref vx_false_e</tt>.
+     * \ingroup group_amd
+     * \return <tt>\ref vx_true_e</tt> if the AVX2 code paths can be used, otherwise <tt>\ref vx_false_e</tt>.
+     */
+    VX_API_ENTRY vx_bool VX_API_CALL vxIsCpuAvx2Supported();
+
 #ifdef __cplusplus
 }
 #endif
@@ -195,6 +195,20 @@ bool StitchGetEnvironmentVariable(const char * name, char * value, size_t valueS
 #endif
 }
 
+bool StitchCpuHasAVX2()
+{
+	static int hasAVX2 = -1;
+	if (hasAVX2 < 0) {
+		// same probe as the OpenVX CPU kernels
+		hasAVX2 = vxIsCpuAvx2Supported() ? 1 : 0;
+		char textBuffer[256];
+		if (StitchGetEnvironmentVariable("STITCH_CPU_DISABLE_AVX2", textBuffer, sizeof(textBuffer)) && atoi(textBuffer)) {
+			hasAVX2 = 0;
+		}
+	}
+	return hasAVX2 ? true : false;
+}
+
 /***********************************************************************************************************************************
 OVX Stich Nodes
 ************************************************************************************************************************************/
@@ -521,6 +521,15 @@ vx_reference avxGetNodeParamRef(vx_node node, vx_uint32 index);
 vx_node stitchCreateNode(vx_graph graph, vx_enum kernelEnum, vx_reference params[], vx_uint32 num);
 vx_node stitchCreateNode(vx_graph graph, const char * kernelName, vx_reference params[], vx_uint32 num);
 bool StitchGetEnvironmentVariable(const char * name, char * value, size_t valueSize);
+bool StitchCpuHasAVX2();
+
+//////////////////////////////////////////////////////////////////////
+//! \brief The function attribute for CPU code paths that use AVX2 (selected at runtime with StitchCpuHasAVX2).
+#if _WIN32
+#define STITCH_TARGET_AVX2
+#else
+#define STITCH_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
 
 //////////////////////////////////////////////////////////////////////
 //! \brief The macro for error checking from OpenVX status.
@@ -160,9 +160,11 @@ static void CalculatePaddedRegion(
 {
 	vx_uint32 camMapBit = 1 << camId;
 	vx_uint32 loopPixels = (2 * paddingPixelCount) + 1;
-	// dilate using separable filter for (N x 1) & (1 x N)
-	for (vx_uint32 y_eqr = 0, pixelPosition = 0; y_eqr < (int)eqrHeight; y_eqr++) {
-		for (vx_uint32 x_eqr = 0; x_eqr < (int)eqrWidth; x_eqr++, pixelPosition++) {
+	// dilate using separable filter for (N x 1) & (1 x N): rows are independent in both passes
+#pragma omp parallel for
+	for (vx_int32 y_eqr = 0; y_eqr < (vx_int32)eqrHeight; y_eqr++) {
+		vx_uint32 pixelPosition = y_eqr * eqrWidth;
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr++, pixelPosition++) {
 			vx_uint32 val = 0;
 			vx_int32 X = (vx_int32)x_eqr - paddingPixelCount;
 			// get the neighborhood of (x_eqr,y_eqr)
@@ -181,8 +183,10 @@ static void CalculatePaddedRegion(
 			}
 		}
 	}
-	for (vx_uint32 y_eqr = 0, pixelPosition = 0; y_eqr < (int)eqrHeight; y_eqr++) {
-		for (vx_uint32 x_eqr = 0; x_eqr < (int)eqrWidth; x_eqr++, pixelPosition++) {
+#pragma omp parallel for
+	for (vx_int32 y_eqr = 0; y_eqr < (vx_int32)eqrHeight; y_eqr++) {
+		vx_uint32 pixelPosition = y_eqr * eqrWidth;
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr++, pixelPosition++) {
 			vx_uint32 val = 0;
 			vx_int32 Y = (vx_int32)y_eqr - paddingPixelCount;
 			// get the neighborhood of (x_eqr,y_eqr)
@@ -228,11 +232,14 @@ static void CalculateLensDistortionAndWarpMapsUsingLensModel(
 	float center_x = du0 + (float)camWidth * 0.5f, center_y = dv0 + (float)camHeight * 0.5f;
 	float rightMinus1 = right - 1, right2Minus2 = rightMinus1 * 2;
 	float bottomMinus1 = bottom - 1, bottom2Minus2 = bottomMinus1 * 2;
-	for (vx_uint32 y_eqr = 0, pixelPosition=0; y_eqr < (int)eqrHeight; y_eqr++) {
+	// each output row only touches its own pixels, so rows are processed in parallel
+#pragma omp parallel for schedule(dynamic, 8)
+	for (vx_int32 y_eqr = 0; y_eqr < (vx_int32)eqrHeight; y_eqr++) {
+		vx_uint32 pixelPosition = y_eqr * eqrWidth;
 		float pe = (float)y_eqr * pi_by_h - (float)M_PI_2;
 		float sin_pe = sinf(pe);
 		float cos_pe = cosf(pe);
-		for (vx_uint32 x_eqr = 0; x_eqr < (int)eqrWidth; x_eqr++, pixelPosition++) {
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr++, pixelPosition++) {
 			float x_src = -1, y_src = -1;
 			float te = (float)x_eqr * pi_by_h - (float)M_PI;
 			float sin_te = sinf(te);
@@ -280,7 +287,7 @@ static void CalculateLensDistortionAndWarpMapsUsingLensModel(
 				}
 				else{ x_src = y_src = -1.0f; }
 				// pick default camera index
-				if (validCamIndex) {
+				if (validCamIndex && defaultCamIndex) {
 					vx_float32 zindicator = (float)fabs(Y[2]);
 					if (zindicator > internalBufferForCamIndex[pixelPosition]) {
 						defaultCamIndex[pixelPosition] = camId;
@@ -303,6 +310,177 @@ static void CalculateLensDistortionAndWarpMapsUsingLensModel(
 	}
 }
 
+//////////////////////////////////////////////////////////////////////
+// recompute default camera index from valid pixel map: the camera closest to its optical axis wins
+static void CalculateDefaultCameraIndex(
+	vx_uint32 numCamera,                     // [in] number of cameras
+	vx_uint32 eqrWidth, vx_uint32 eqrHeight, // [in] output equirectangular dimensions
+	const float * Mcam, const float * Tcam,  // [in] camera warp parameters
+	const vx_uint32 * validPixelCamMap,      // [in] valid pixel camera index map: size: [eqrWidth * eqrHeight]
+	vx_float32 * internalBufferForCamIndex,  // [tmp] buffer for internal use: size: [eqrWidth * eqrHeight]
+	vx_uint8 * defaultCamIndex               // [out] default camera index (255 refers to no camera): size: [eqrWidth * eqrHeight]
+	)
+{
+	float pi_by_h = (float)M_PI / (float)eqrHeight;
+#pragma omp parallel for schedule(dynamic, 8)
+	for (vx_int32 y_eqr = 0; y_eqr < (vx_int32)eqrHeight; y_eqr++) {
+		vx_uint32 pixelPosition = y_eqr * eqrWidth;
+		float pe = (float)y_eqr * pi_by_h - (float)M_PI_2;
+		float sin_pe = sinf(pe);
+		float cos_pe = cosf(pe);
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr++, pixelPosition++) {
+			vx_uint8 camIndex = 0xff;
+			vx_float32 zmax = 0.0f;
+			vx_uint32 validCamMap = validPixelCamMap[pixelPosition];
+			if (validCamMap) {
+				float te = (float)x_eqr * pi_by_h - (float)M_PI;
+				float sin_te = sinf(te);
+				float cos_te = cosf(te);
+				float X[3] = { sin_te*cos_pe, sin_pe, cos_te*cos_pe };
+				// same computation and camera order as CalculateLensDistortionAndWarpMapsUsingLensModel
+				for (vx_uint32 camId = 0; camId < numCamera; camId++) {
+					if (!(validCamMap & (1 << camId))) continue;
+					const float * T = &Tcam[camId * 3];
+					float Xt[3] = { X[0] - T[0], X[1] - T[1], X[2] - T[2] };
+					float nfactor = sqrtf(Xt[0] * Xt[0] + Xt[1] * Xt[1] + Xt[2] * Xt[2]);
+					Xt[0] /= nfactor;
+					Xt[1] /= nfactor;
+					Xt[2] /= nfactor;
+					float Y[3];
+					MatMul3x1(Y, &Mcam[camId * 9], Xt);
+					vx_float32 zindicator = (float)fabs(Y[2]);
+					if (zindicator > zmax) {
+						camIndex = (vx_uint8)camId;
+						zmax = zindicator;
+					}
+				}
+			}
+			defaultCamIndex[pixelPosition] = camIndex;
+			internalBufferForCamIndex[pixelPosition] = zmax;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////
+// calculate lens distorion and warp maps on CPU for a subset of cameras
+vx_status UpdateLensDistortionAndWarpMaps(
+	vx_uint32 numCamera,                     // [in] number of cameras
+	vx_uint32 camWidth, vx_uint32 camHeight, // [in] individual camera dimensions
+	vx_uint32 eqrWidth, vx_uint32 eqrHeight, // [in] output equirectangular dimensions
+	const rig_params * rigParam,             // [in] rig configuration
+	const camera_params * camParam,          // [in] individual camera configuration: size: [numCamera]
+	vx_uint32 * validPixelCamMap,            // [in/out] valid pixel camera index map: size: [eqrWidth * eqrHeight] (optional)
+	vx_uint32 paddingPixelCount,             // [in] padding pixels around valid region
+	vx_uint32 * paddedPixelCamMap,           // [in/out] padded pixel camera index map: size: [eqrWidth * eqrHeight] (optional)
+	StitchCoord2dFloat * camSrcMap,          // [in/out] camera coordinate mapping: size: [numCamera * eqrWidth * eqrHeight] (optional)
+	vx_float32 * internalBufferForCamIndex,  // [tmp] buffer for internal use: size: [eqrWidth * eqrHeight] (optional)
+	vx_uint8 * defaultCamIndex,              // [out] default camera index (255 refers to no camera): size: [eqrWidth * eqrHeight] (optional)
+	vx_uint32 updateCamMask                  // [in] cameras to recompute: bit i for camera i
+	)
+{
+	// disable defaultCamIndex if tmp buffer is not specified (and vice versa)
+	if (!internalBufferForCamIndex || !defaultCamIndex) {
+		internalBufferForCamIndex = nullptr;
+		defaultCamIndex = nullptr;
+	}
+	// supports upto 32 cameras
+	if (numCamera > 32) {
+		printf("ERROR: UpdateLensDistortionAndWarpMaps: can't support %d cameras -- 32 is the current limit\n", numCamera);
+		return VX_ERROR_NOT_SUPPORTED;
+	}
+	vx_uint32 allCamMask = (numCamera < 32) ? ((1u << numCamera) - 1) : 0xffffffff;
+	updateCamMask &= allCamMask;
+	bool fullUpdate = (updateCamMask == allCamMask);
+
+	// compute camera warp parameters and check for supported lens types
+	float Mcam[32 * 9], Tcam[32 * 3], fcam[32 * 2], Mr[3 * 3];
+	vx_status status = CalculateCameraWarpParameters(numCamera, camWidth, camHeight, rigParam, camParam, Mcam, Tcam, fcam, Mr);
+	if (status != VX_SUCCESS) return status;
+
+	// initialize buffers: only the bits of the cameras being updated are cleared on partial updates
+	size_t totSize = eqrWidth * eqrHeight;
+	if (fullUpdate) {
+		if (validPixelCamMap) {
+			memset(validPixelCamMap, 0, totSize*sizeof(vx_uint32));
+		}
+		if (paddedPixelCamMap) {
+			memset(paddedPixelCamMap, 0, totSize*sizeof(vx_uint32));
+		}
+		if (defaultCamIndex) {
+			memset(internalBufferForCamIndex, 0, totSize*sizeof(vx_uint32));
+			memset(defaultCamIndex, 0xFF, totSize);
+		}
+	}
+	else if (updateCamMask) {
+		vx_uint32 keepMask = ~updateCamMask;
+#pragma omp parallel for
+		for (vx_int32 y_eqr = 0; y_eqr < (vx_int32)eqrHeight; y_eqr++) {
+			size_t pixelPosition = (size_t)y_eqr * eqrWidth;
+			for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr++, pixelPosition++) {
+				if (validPixelCamMap) validPixelCamMap[pixelPosition] &= keepMask;
+				if (paddedPixelCamMap) paddedPixelCamMap[pixelPosition] &= keepMask;
+			}
+		}
+	}
+	else {
+		return VX_SUCCESS;
+	}
+	// compute valid pixels based on warp parameters
+	// on partial updates, the default camera index is recomputed for all cameras after the update
+	vx_float32 * camIndexTmp = fullUpdate ? internalBufferForCamIndex : nullptr;
+	vx_uint8 * camIndex = fullUpdate ? defaultCamIndex : nullptr;
+	const float * T = Tcam, *M = Mcam, *f = fcam;
+	for (vx_uint32 cam = 0; cam < numCamera; cam++, T += 3, M += 9, f += 2) {
+		if (!(updateCamMask & (1 << cam)))
+			continue;
+		// perform lens distortion and warp for each pixel in the equirectangular destination image
+		const camera_lens_params * lens = &camParam[cam].lens;
+		float k0 = 1.0f - (lens->k1 + lens->k2 + lens->k3);
+		float left = 0, top = 0, right = (float)camWidth, bottom = (float)camHeight;
+		if (lens->lens_type <= ptgui_lens_fisheye_circ && (lens->reserved[3] != 0 || lens->reserved[4] != 0 || lens->reserved[5] != 0 || lens->reserved[6] != 0)) {
+			left = std::max(left, lens->reserved[3]);
+			top = std::max(top, lens->reserved[4]);
+			right = std::min(right, lens->reserved[5]);
+			bottom = std::min(bottom, lens->reserved[6]);
+		}
+		if (lens->lens_type == ptgui_lens_rectilinear) {
+			CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
+				validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
+				camIndexTmp, camIndex,
+				cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
+				left, top, right, bottom, ptgui_lens_rectilinear_model, lens->lens_type);
+		}
+		else if (lens->lens_type == ptgui_lens_fisheye_ff || lens->lens_type == ptgui_lens_fisheye_circ) {
+			CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
+				validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
+				camIndexTmp, camIndex,
+				cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
+				left, top, right, bottom, ptgui_lens_fisheye_model, lens->lens_type);
+		}
+		else if (lens->lens_type == adobe_lens_rectilinear) {
+			CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
+				validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
+				camIndexTmp, camIndex,
+				cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
+				left, top, right, bottom, adobe_lens_rectilinear_model, lens->lens_type);
+		}
+		else if (lens->lens_type == adobe_lens_fisheye) {
+			CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
+				validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
+				camIndexTmp, camIndex,
+				cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
+				left, top, right, bottom, adobe_lens_fisheye_model, lens->lens_type);
+		}
+	}
+	if (defaultCamIndex && validPixelCamMap && !fullUpdate) {
+		CalculateDefaultCameraIndex(numCamera, eqrWidth, eqrHeight, Mcam, Tcam, validPixelCamMap, internalBufferForCamIndex, defaultCamIndex);
+	}
+#if DUMP_BUFFERS_INITIALIZE
+	DumpBuffer((vx_uint8 *)paddedPixelCamMap, eqrWidth*eqrHeight * 4, "PaddedCamMap.bin");
+#endif
+	return VX_SUCCESS;
+}
+
 //////////////////////////////////////////////////////////////////////
 // calculate lens distorion and warp maps from rig and camera configuration
 vx_status CalculateLensDistortionAndWarpMaps(
@@ -413,69 +591,10 @@ vx_status CalculateLensDistortionAndWarpMaps(
 	}
 	else
 	{
-		// compute camera warp parameters and check for supported lens types
-		float Mcam[32 * 9], Tcam[32 * 3], fcam[32 * 2], Mr[3 * 3];
-		vx_status status = CalculateCameraWarpParameters(numCamera, camWidth, camHeight, rigParam, camParam, Mcam, Tcam, fcam, Mr);
+		vx_status status = UpdateLensDistortionAndWarpMaps(numCamera, camWidth, camHeight, eqrWidth, eqrHeight, rigParam, camParam,
+			validPixelCamMap, paddingPixelCount, paddedPixelCamMap, camSrcMap, internalBufferForCamIndex, defaultCamIndex,
+			(numCamera < 32) ? ((1u << numCamera) - 1) : 0xffffffff);
 		if (status != VX_SUCCESS) return status;
-
-		// cpu version
-		// initialize buffers
-		size_t totSize = eqrWidth * eqrHeight;
-		if (validPixelCamMap) {
-			memset(validPixelCamMap, 0, totSize*sizeof(vx_uint32));
-		}
-		if (paddedPixelCamMap) {
-			memset(paddedPixelCamMap, 0, totSize*sizeof(vx_uint32));
-		}
-		if (defaultCamIndex) {
-			memset(internalBufferForCamIndex, 0, totSize*sizeof(vx_uint32));
-			memset(defaultCamIndex, 0xFF, totSize);
-		}
-		// compute valid pixels based on warp parameters
-		const float * T = Tcam, *M = Mcam, *f = fcam;
-		for (vx_uint32 cam = 0; cam < numCamera; cam++, T += 3, M += 9, f += 2) {
-			// perform lens distortion and warp for each pixel in the equirectangular destination image
-			const camera_lens_params * lens = &camParam[cam].lens;
-			float k0 = 1.0f - (lens->k1 + lens->k2 + lens->k3);
-			float left = 0, top = 0, right = (float)camWidth, bottom = (float)camHeight;
-			if (lens->lens_type <= ptgui_lens_fisheye_circ && (lens->reserved[3] != 0 || lens->reserved[4] != 0 || lens->reserved[5] != 0 || lens->reserved[6] != 0)) {
-				left = std::max(left, lens->reserved[3]);
-				top = std::max(top, lens->reserved[4]);
-				right = std::min(right, lens->reserved[5]);
-				bottom = std::min(bottom, lens->reserved[6]);
-			}
-			if (lens->lens_type == ptgui_lens_rectilinear) {
-				CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
-					validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
-					internalBufferForCamIndex, defaultCamIndex,
-					cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
-					left, top, right, bottom, ptgui_lens_rectilinear_model, lens->lens_type);
-			}
-			else if (lens->lens_type == ptgui_lens_fisheye_ff || lens->lens_type == ptgui_lens_fisheye_circ) {
-				CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
-					validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
-					internalBufferForCamIndex, defaultCamIndex,
-					cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
-					left, top, right, bottom, ptgui_lens_fisheye_model, lens->lens_type);
-			}
-			else if (lens->lens_type == adobe_lens_rectilinear) {
-				CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
-					validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
-					internalBufferForCamIndex, defaultCamIndex,
-					cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
-					left, top, right, bottom, adobe_lens_rectilinear_model, lens->lens_type);
-			}
-			else if (lens->lens_type == adobe_lens_fisheye) {
-				CalculateLensDistortionAndWarpMapsUsingLensModel(camWidth, camHeight, eqrWidth, eqrHeight,
-					validPixelCamMap, paddingPixelCount, paddedPixelCamMap, &camSrcMap[cam * eqrWidth * eqrHeight],
-					internalBufferForCamIndex, defaultCamIndex,
-					cam, M, T, f, lens->k1, lens->k2, lens->k3, k0, lens->du0, lens->dv0, lens->r_crop,
-					left, top, right, bottom, adobe_lens_fisheye_model, lens->lens_type);
-			}
-		}
-#if DUMP_BUFFERS_INITIALIZE
-		DumpBuffer((vx_uint8 *)paddedPixelCamMap, eqrWidth*eqrHeight * 4, "PaddedCamMap.bin");
-#endif
 	}
 #if PROFILE_STARTUP_TIME
 	QueryPerformanceCounter(&v);
@@ -621,14 +740,14 @@ vx_status GenerateValidMaskImage(
 	vx_uint8 * maskBuf                    // [out] valid mask image buffer: size: [eqrWidth * eqrHeight * numCamera]
 	)
 {
-	vx_uint32 maskPosition = 0;
-	for (vx_uint32 camId = 0; camId < numCamera; camId++) {
-		vx_uint32 camMaskBit = 1 << camId;
-		for (vx_uint32 y = 0, pixelPosition = 0; y < eqrHeight; y++) {
-			for (vx_uint32 x = 0; x < eqrWidth; x++, pixelPosition++) {
-				maskBuf[maskPosition + x] = (validPixelCamMap[pixelPosition] & camMaskBit) ? 255 : 0;
-			}
-			maskPosition += maskStride;
+	// one mask row per (camera, row) pair
+#pragma omp parallel for
+	for (vx_int32 row = 0; row < (vx_int32)(numCamera * eqrHeight); row++) {
+		vx_uint32 camMaskBit = 1 << (row / eqrHeight);
+		const vx_uint32 * validRow = validPixelCamMap + (size_t)(row % eqrHeight) * eqrWidth;
+		vx_uint8 * maskRow = maskBuf + (size_t)row * maskStride;
+		for (vx_uint32 x = 0; x < eqrWidth; x++) {
+			maskRow[x] = (validRow[x] & camMaskBit) ? 255 : 0;
 		}
 	}
 	return VX_SUCCESS;
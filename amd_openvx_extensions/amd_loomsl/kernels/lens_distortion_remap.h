@@ -90,6 +90,24 @@ vx_status CalculateLensDistortionAndWarpMaps(
 	vx_uint8 * defaultCamIndex               // [out] default camera index (255 refers to no camera): size: [eqrWidth * eqrHeight] (optional)
 	);
 
+//////////////////////////////////////////////////////////////////////
+// calculate lens distorion and warp maps on CPU for a subset of cameras:
+// bits of other cameras in validPixelCamMap/paddedPixelCamMap and their camSrcMap are kept as is
+vx_status UpdateLensDistortionAndWarpMaps(
+	vx_uint32 numCamera,                     // [in] number of cameras
+	vx_uint32 camWidth, vx_uint32 camHeight, // [in] individual camera dimensions
+	vx_uint32 eqrWidth, vx_uint32 eqrHeight, // [in] output equirectangular dimensions
+	const rig_params * rigParam,             // [in] rig configuration
+	const camera_params * camParam,          // [in] individual camera configuration: size: [numCamera]
+	vx_uint32 * validPixelCamMap,            // [in/out] valid pixel camera index map: size: [eqrWidth * eqrHeight] (optional)
+	vx_uint32 paddingPixelCount,             // [in] padding pixels around valid region
+	vx_uint32 * paddedPixelCamMap,           // [in/out] padded pixel camera index map: size: [eqrWidth * eqrHeight] (optional)
+	StitchCoord2dFloat * camSrcMap,          // [in/out] camera coordinate mapping: size: [numCamera * eqrWidth * eqrHeight] (optional)
+	vx_float32 * internalBufferForCamIndex,  // [tmp] buffer for internal use: size: [eqrWidth * eqrHeight] (optional)
+	vx_uint8 * defaultCamIndex,              // [out] default camera index (255 refers to no camera): size: [eqrWidth * eqrHeight] (optional)
+	vx_uint32 updateCamMask                  // [in] cameras to recompute: bit i for camera i
+	);
+
 //////////////////////////////////////////////////////////////////////
 // calculate overlap regions and returns number of overlaps
 vx_uint32 CalculateValidOverlapRegions(
@@ -178,7 +178,7 @@ static vx_status VX_CALLBACK merge_query_target_support(vx_graph graph, vx_node
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	supported_target_affinity = AGO_TARGET_AFFINITY_GPU | AGO_TARGET_AFFINITY_CPU;
 	return VX_SUCCESS;
 }
 
@@ -361,10 +361,189 @@ static vx_status VX_CALLBACK merge_deinitialize(vx_node node, const vx_reference
 	return VX_SUCCESS;
 }
 
+//! \brief The CPU merge configuration shared by all the rows of a frame.
+struct MergeCpuConfig {
+	vx_uint32 width, height;       // output dimensions
+	bool outputRGBX;
+	const vx_uint8 * camIdBuf; vx_uint32 camIdStride;
+	const vx_uint8 * group1Buf; vx_uint32 group1Stride;
+	const vx_uint8 * group2Buf; vx_uint32 group2Stride;
+	const vx_uint8 * ipBuf; vx_uint32 ipStride;
+	const vx_uint8 * wtBuf; vx_uint32 wtStride;
+	vx_uint8 * opBuf; vx_uint32 opStride;
+};
+
+// list the cameras contributing to a blended 8-pixel block (same selection rules as the OpenCL kernel)
+static inline int merge_get_blend_cameras(const MergeCpuConfig& cfg, vx_uint32 y, vx_uint32 block, vx_uint8 camIdSelect, vx_uint32 camList[6])
+{
+	vx_uint16 g1 = *(const vx_uint16 *)(cfg.group1Buf + y * cfg.group1Stride + block * 2);
+	vx_uint16 g2 = *(const vx_uint16 *)(cfg.group2Buf + y * cfg.group2Stride + block * 2);
+	vx_uint32 cams[6] = { (vx_uint32)(g1 & 0x1f), (vx_uint32)((g1 >> 5) & 0x1f), (vx_uint32)((g1 >> 10) & 0x1f),
+	                      (vx_uint32)(g2 & 0x1f), (vx_uint32)((g2 >> 5) & 0x1f), (vx_uint32)((g2 >> 10) & 0x1f) };
+	int count = 2 + (camIdSelect > 128) + (camIdSelect > 129) + (camIdSelect > 130) + (camIdSelect > 131), n = 0;
+	for (int i = 0; i < count; i++) {
+		if (cams[i] < 31) camList[n++] = cams[i];
+	}
+	return n;
+}
+
+// pack 8 RGBX float pixels with round-to-nearest-even and saturation and store them
+static inline void merge_store_pixels(const MergeCpuConfig& cfg, vx_uint8 * op, const vx_float32 * acc, vx_uint32 count)
+{
+	vx_uint32 pix[8];
+	for (int i = 0; i < 8; i += 2) {
+		__m128i p0 = _mm_cvtps_epi32(_mm_loadu_ps(acc + i * 4)), p1 = _mm_cvtps_epi32(_mm_loadu_ps(acc + i * 4 + 4));
+		_mm_storel_epi64((__m128i *)&pix[i], _mm_packus_epi16(_mm_packs_epi32(p0, p1), p0));
+	}
+	if (cfg.outputRGBX) {
+		for (vx_uint32 i = 0; i < count; i++) pix[i] |= 0xff000000;
+		memcpy(op, pix, count * 4);
+	}
+	else {
+		for (vx_uint32 i = 0; i < count; i++, op += 3) {
+			op[0] = (vx_uint8)pix[i]; op[1] = (vx_uint8)(pix[i] >> 8); op[2] = (vx_uint8)(pix[i] >> 16);
+		}
+	}
+}
+
+static void merge_rows_sse(const MergeCpuConfig& cfg)
+{
+	const __m128 wtScale = _mm_set1_ps(1.0f / 255.0f);
+#pragma omp parallel for schedule(dynamic, 4)
+	for (vx_int32 y = 0; y < (vx_int32)cfg.height; y++) {
+		const vx_uint8 * camIdRow = cfg.camIdBuf + y * cfg.camIdStride;
+		vx_uint8 * opRow = cfg.opBuf + y * cfg.opStride;
+		for (vx_uint32 x = 0, block = 0; x < cfg.width; x += 8, block++) {
+			vx_uint8 camIdSelect = camIdRow[block];
+			if (camIdSelect == 31)
+				continue;
+			vx_uint32 count = std::min(8u, cfg.width - x);
+			__m128 acc[8];
+			for (int i = 0; i < 8; i++) acc[i] = _mm_setzero_ps();
+			if (camIdSelect < 31) {
+				const vx_uint8 * ip = cfg.ipBuf + (y + cfg.height * camIdSelect) * cfg.ipStride + x * 4;
+				for (vx_uint32 i = 0; i < count; i++)
+					acc[i] = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int *)(ip + i * 4))));
+			}
+			else {
+				vx_uint32 camList[6];
+				int numCams = merge_get_blend_cameras(cfg, y, block, camIdSelect, camList);
+				for (int c = 0; c < numCams; c++) {
+					const vx_uint8 * ip = cfg.ipBuf + (y + cfg.height * camList[c]) * cfg.ipStride + x * 4;
+					const vx_uint8 * wt = cfg.wtBuf + (y + cfg.height * camList[c]) * cfg.wtStride + x;
+					for (vx_uint32 i = 0; i < count; i++) {
+						__m128 f = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int *)(ip + i * 4))));
+						acc[i] = _mm_add_ps(acc[i], _mm_mul_ps(f, _mm_mul_ps(_mm_set1_ps((vx_float32)wt[i]), wtScale)));
+					}
+				}
+			}
+			vx_float32 accBuf[32];
+			for (int i = 0; i < 8; i++) _mm_storeu_ps(accBuf + i * 4, acc[i]);
+			merge_store_pixels(cfg, opRow + x * (cfg.outputRGBX ? 4 : 3), accBuf, count);
+		}
+	}
+}
+
+// AVX2 variant: two RGBX pixels per register and full 8-pixel loads for the complete blocks
+static STITCH_TARGET_AVX2 void merge_rows_avx2(const MergeCpuConfig& cfg)
+{
+	const __m256 wtScale = _mm256_set1_ps(1.0f / 255.0f);
+	const __m256i pairIdx[4] = {
+		_mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1), _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3),
+		_mm256_setr_epi32(4, 4, 4, 4, 5, 5, 5, 5), _mm256_setr_epi32(6, 6, 6, 6, 7, 7, 7, 7) };
+#pragma omp parallel for schedule(dynamic, 4)
+	for (vx_int32 y = 0; y < (vx_int32)cfg.height; y++) {
+		const vx_uint8 * camIdRow = cfg.camIdBuf + y * cfg.camIdStride;
+		vx_uint8 * opRow = cfg.opBuf + y * cfg.opStride;
+		for (vx_uint32 x = 0, block = 0; x < cfg.width; x += 8, block++) {
+			vx_uint8 camIdSelect = camIdRow[block];
+			if (camIdSelect == 31)
+				continue;
+			vx_uint32 count = std::min(8u, cfg.width - x);
+			__m256 acc[4];
+			for (int i = 0; i < 4; i++) acc[i] = _mm256_setzero_ps();
+			vx_uint8 ipPix[32], wtPix[8];
+			if (camIdSelect < 31) {
+				const vx_uint8 * ip = cfg.ipBuf + (y + cfg.height * camIdSelect) * cfg.ipStride + x * 4;
+				if (count < 8) { memset(ipPix, 0, sizeof(ipPix)); memcpy(ipPix, ip, count * 4); ip = ipPix; }
+				for (int i = 0; i < 4; i++)
+					acc[i] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(ip + i * 8))));
+			}
+			else {
+				vx_uint32 camList[6];
+				int numCams = merge_get_blend_cameras(cfg, y, block, camIdSelect, camList);
+				for (int c = 0; c < numCams; c++) {
+					const vx_uint8 * ip = cfg.ipBuf + (y + cfg.height * camList[c]) * cfg.ipStride + x * 4;
+					const vx_uint8 * wt = cfg.wtBuf + (y + cfg.height * camList[c]) * cfg.wtStride + x;
+					if (count < 8) {
+						memset(ipPix, 0, sizeof(ipPix)); memcpy(ipPix, ip, count * 4); ip = ipPix;
+						memset(wtPix, 0, sizeof(wtPix)); memcpy(wtPix, wt, count); wt = wtPix;
+					}
+					__m256 w = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)wt))), wtScale);
+					for (int i = 0; i < 4; i++) {
+						__m256 f = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(ip + i * 8))));
+						acc[i] = _mm256_add_ps(acc[i], _mm256_mul_ps(f, _mm256_permutevar8x32_ps(w, pairIdx[i])));
+					}
+				}
+			}
+			vx_float32 accBuf[32];
+			for (int i = 0; i < 4; i++) _mm256_storeu_ps(accBuf + i * 8, acc[i]);
+			merge_store_pixels(cfg, opRow + x * (cfg.outputRGBX ? 4 : 3), accBuf, count);
+		}
+	}
+}
+
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK merge_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_IMPLEMENTED;
+	vx_image camid_image = (vx_image)parameters[0], group1_image = (vx_image)parameters[1], group2_image = (vx_image)parameters[2];
+	vx_image input_image = (vx_image)parameters[3], weight_image = (vx_image)parameters[4], output_image = (vx_image)parameters[5];
+	MergeCpuConfig cfg = { 0 };
+	vx_df_image output_format = VX_DF_IMAGE_VIRT;
+	vx_uint32 input_width = 0, input_height = 0, camid_width = 0;
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &cfg.width, sizeof(cfg.width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &cfg.height, sizeof(cfg.height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(camid_image, VX_IMAGE_ATTRIBUTE_WIDTH, &camid_width, sizeof(camid_width)));
+	cfg.outputRGBX = (output_format == VX_DF_IMAGE_RGBX);
+	cfg.width = std::min(cfg.width, camid_width * 8);
+
+	// get the images
+	vx_rectangle_t camid_rect = { 0, 0, camid_width, cfg.height };
+	vx_rectangle_t input_rect = { 0, 0, input_width, input_height };
+	vx_rectangle_t output_rect = { 0, 0, cfg.width, cfg.height };
+	vx_imagepatch_addressing_t camid_addr, group1_addr, group2_addr, input_addr, weight_addr, output_addr;
+	void * camid_ptr = nullptr, * group1_ptr = nullptr, * group2_ptr = nullptr, * input_ptr = nullptr, * weight_ptr = nullptr, * output_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(camid_image, &camid_rect, 0, &camid_addr, &camid_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(group1_image, &camid_rect, 0, &group1_addr, &group1_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(group2_image, &camid_rect, 0, &group2_addr, &group2_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &input_rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(weight_image, &input_rect, 0, &weight_addr, &weight_ptr, VX_READ_ONLY));
+	// blocks with camIdSelect == 31 leave the output untouched, so the output is accessed read-write
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &output_rect, 0, &output_addr, &output_ptr, VX_READ_AND_WRITE));
+	cfg.camIdBuf = (const vx_uint8 *)camid_ptr; cfg.camIdStride = camid_addr.stride_y;
+	cfg.group1Buf = (const vx_uint8 *)group1_ptr; cfg.group1Stride = group1_addr.stride_y;
+	cfg.group2Buf = (const vx_uint8 *)group2_ptr; cfg.group2Stride = group2_addr.stride_y;
+	cfg.ipBuf = (const vx_uint8 *)input_ptr; cfg.ipStride = input_addr.stride_y;
+	cfg.wtBuf = (const vx_uint8 *)weight_ptr; cfg.wtStride = weight_addr.stride_y;
+	cfg.opBuf = (vx_uint8 *)output_ptr; cfg.opStride = output_addr.stride_y;
+
+	// merge
+	if (StitchCpuHasAVX2())
+		merge_rows_avx2(cfg);
+	else
+		merge_rows_sse(cfg);
+
+	ERROR_CHECK_STATUS(vxCommitImagePatch(camid_image, nullptr, 0, &camid_addr, camid_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(group1_image, nullptr, 0, &group1_addr, group1_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(group2_image, nullptr, 0, &group2_addr, group2_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, nullptr, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(weight_image, nullptr, 0, &weight_addr, weight_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &output_rect, 0, &output_addr, output_ptr));
+
+	return VX_SUCCESS;
 }
 
 //! \brief The kernel publisher.
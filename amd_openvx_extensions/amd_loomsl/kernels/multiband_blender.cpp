@@ -144,7 +144,7 @@ static vx_status VX_CALLBACK multiband_blend_query_target_support(vx_graph graph
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	supported_target_affinity = AGO_TARGET_AFFINITY_GPU | AGO_TARGET_AFFINITY_CPU;
 	return VX_SUCCESS;
 }
 
@@ -297,10 +297,170 @@ static vx_status VX_CALLBACK multiband_blend_opencl_codegen(
 	return VX_SUCCESS;
 }
 
+//! \brief The CPU blend configuration shared by all the 64x16 blocks of a level.
+struct BlendCpuConfig {
+	bool inputRGBX;                // false: RGB4 input; true: RGBX input
+	bool weightU8;                 // false: S16 weights; true: U8 weights
+	vx_float32 divFactor;
+	vx_uint32 camHeight;           // rows per camera
+	const vx_uint8 * ipBuf; vx_uint32 ipStride;
+	const vx_uint8 * wtBuf; vx_uint32 wtStride;
+	vx_uint8 * opBuf; vx_uint32 opStride;
+};
+
+// weight 4 RGBX pixels, normalize and store them as 4 S16x3 pixels
+static inline void blend_rgbx_quad_sse(const BlendCpuConfig& cfg, const vx_uint8 * ip, const vx_uint8 * wt, vx_int16 * op)
+{
+	__m128 w;
+	if (cfg.weightU8) w = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int *)wt)));
+	else w = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)wt)));
+	vx_float32 wf[4];
+	_mm_storeu_ps(wf, _mm_mul_ps(w, _mm_set1_ps(cfg.divFactor)));
+	vx_int16 v[4][8];
+	for (int i = 0; i < 4; i++) {
+		__m128 f = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int *)(ip + 4 * i)))), _mm_set1_ps(wf[i]));
+		__m128i s = _mm_cvtps_epi32(f);
+		_mm_storeu_si128((__m128i *)v[i], _mm_packs_epi32(s, s));
+	}
+	for (int i = 0; i < 4; i++, op += 3) {
+		op[0] = v[i][0]; op[1] = v[i][1]; op[2] = v[i][2];
+	}
+}
+
+static inline STITCH_TARGET_AVX2 void blend_rgbx_quad_avx2(const BlendCpuConfig& cfg, const vx_uint8 * ip, const vx_uint8 * wt, vx_int16 * op)
+{
+	__m128i pix = _mm_loadu_si128((const __m128i *)ip);
+	__m256 w;
+	if (cfg.weightU8) w = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_cvtsi32_si128(*(const int *)wt)));
+	else w = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)wt)));
+	w = _mm256_mul_ps(w, _mm256_set1_ps(cfg.divFactor));
+	__m256 f0 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pix)), _mm256_permutevar8x32_ps(w, _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1)));
+	__m256 f1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(pix, 8))), _mm256_permutevar8x32_ps(w, _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3)));
+	// packs_epi32 works within 128-bit lanes: result is {p0, p2, p1, p3} as S16x4 each
+	__m256i s = _mm256_packs_epi32(_mm256_cvtps_epi32(f0), _mm256_cvtps_epi32(f1));
+	// drop the X channel: gather {R,G,B} of p0..p3 into the low 12 shorts
+	s = _mm256_permutevar8x32_epi32(s, _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));
+	s = _mm256_shuffle_epi8(s, _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1, 0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1));
+	vx_int16 v[16];
+	_mm256_storeu_si256((__m256i *)v, s);
+	memcpy(op, v, 12);
+	memcpy(op + 6, v + 8, 12);
+}
+
+// normalize 4 S16x3 pixels
+static inline void blend_rgb4_quad(const BlendCpuConfig& cfg, const vx_uint8 * ip, vx_int16 * op)
+{
+	vx_int16 v[12];
+	memcpy(v, ip, sizeof(v));
+	__m128 m = _mm_set1_ps(cfg.divFactor);
+	__m128i s0 = _mm_loadu_si128((const __m128i *)v);
+	__m128i s1 = _mm_loadl_epi64((const __m128i *)(v + 8));
+	__m128i r0 = _mm_packs_epi32(_mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(s0)), m)),
+	                             _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(s0, 8))), m)));
+	__m128i r1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(s1)), m));
+	r1 = _mm_packs_epi32(r1, r1);
+	_mm_storeu_si128((__m128i *)v, r0);
+	_mm_storel_epi64((__m128i *)(v + 8), r1);
+	memcpy(op, v, sizeof(v));
+}
+
+//! \brief Blend one 64x16 block described by a StitchBlendValidEntry.
+template <bool AVX2>
+static inline void blend_block(const BlendCpuConfig& cfg, const StitchBlendValidEntry& entry)
+{
+	vx_uint32 camOffset = entry.camId * cfg.camHeight;
+	vx_uint32 numQuads = std::min(16u, entry.last_x / 4 + 1u), numRows = std::min(16u, entry.last_y + 1u);
+	vx_uint32 wtBytes = cfg.weightU8 ? 1 : 2;
+	for (vx_uint32 ly = 0; ly < numRows; ly++) {
+		vx_uint32 gy = camOffset + entry.dstY + ly;
+		const vx_uint8 * ip = cfg.ipBuf + gy * cfg.ipStride;
+		const vx_uint8 * wt = cfg.wtBuf + gy * cfg.wtStride;
+		vx_int16 * op = (vx_int16 *)(cfg.opBuf + gy * cfg.opStride);
+		for (vx_uint32 lx = 0; lx < numQuads; lx++) {
+			vx_uint32 gx = entry.dstX + lx * 4;
+			if (!cfg.inputRGBX)
+				blend_rgb4_quad(cfg, ip + gx * 6, op + gx * 3);
+			else if (AVX2)
+				blend_rgbx_quad_avx2(cfg, ip + gx * 4, wt + gx * wtBytes, op + gx * 3);
+			else
+				blend_rgbx_quad_sse(cfg, ip + gx * 4, wt + gx * wtBytes, op + gx * 3);
+		}
+	}
+}
+
+static void blend_blocks_sse(const BlendCpuConfig& cfg, const StitchBlendValidEntry * entries, vx_int32 numEntries)
+{
+#pragma omp parallel for schedule(dynamic, 16)
+	for (vx_int32 i = 0; i < numEntries; i++)
+		blend_block<false>(cfg, entries[i]);
+}
+
+static STITCH_TARGET_AVX2 void blend_blocks_avx2(const BlendCpuConfig& cfg, const StitchBlendValidEntry * entries, vx_int32 numEntries)
+{
+#pragma omp parallel for schedule(dynamic, 16)
+	for (vx_int32 i = 0; i < numEntries; i++)
+		blend_block<true>(cfg, entries[i]);
+}
+
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK multiband_blend_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_IMPLEMENTED;
+	vx_uint32 numCam = 0, arr_offset = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &numCam));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[1], &arr_offset));
+	vx_image input_image = (vx_image)parameters[2], weight_image = (vx_image)parameters[3], output_image = (vx_image)parameters[5];
+	vx_array arr = (vx_array)parameters[4];
+	if (!numCam || !arr_offset)
+		return VX_ERROR_INVALID_PARAMETERS;
+
+	// get the number of valid entries of this level: stored in the entry just before arr_offset
+	vx_size arr_numitems = 0, stride_blend_arr = sizeof(StitchBlendValidEntry);
+	ERROR_CHECK_STATUS(vxQueryArray(arr, VX_ARRAY_ATTRIBUTE_NUMITEMS, &arr_numitems, sizeof(arr_numitems)));
+	if (arr_numitems < arr_offset)
+		return VX_ERROR_INVALID_PARAMETERS;
+	StitchBlendValidEntry * pBlendArr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessArrayRange(arr, arr_offset - 1, arr_offset, &stride_blend_arr, (void **)&pBlendArr, VX_READ_ONLY));
+	vx_size numEntries = std::min((vx_size)*((vx_uint32 *)pBlendArr), arr_numitems - arr_offset);
+	ERROR_CHECK_STATUS(vxCommitArrayRange(arr, arr_offset - 1, arr_offset, pBlendArr));
+	if (numEntries == 0)
+		return VX_SUCCESS;
+
+	// get the images
+	BlendCpuConfig cfg = { 0 };
+	vx_uint32 width = 0, height = 0;
+	vx_df_image in_format = VX_DF_IMAGE_VIRT, wt_format = VX_DF_IMAGE_VIRT;
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_FORMAT, &in_format, sizeof(in_format)));
+	ERROR_CHECK_STATUS(vxQueryImage(weight_image, VX_IMAGE_ATTRIBUTE_FORMAT, &wt_format, sizeof(wt_format)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &width, sizeof(width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &height, sizeof(height)));
+	cfg.inputRGBX = (in_format == VX_DF_IMAGE_RGBX);
+	cfg.weightU8 = (wt_format == VX_DF_IMAGE_U8);
+	cfg.divFactor = cfg.weightU8 ? 0.0627451f : 0.000490196f;
+	cfg.camHeight = height / numCam;
+	vx_rectangle_t rect = { 0, 0, width, height };
+	vx_imagepatch_addressing_t input_addr, weight_addr, output_addr;
+	void * input_ptr = nullptr, * weight_ptr = nullptr, * output_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(weight_image, &rect, 0, &weight_addr, &weight_ptr, VX_READ_ONLY));
+	// only the valid blocks are written, so the output is accessed read-write
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &rect, 0, &output_addr, &output_ptr, VX_READ_AND_WRITE));
+	cfg.ipBuf = (const vx_uint8 *)input_ptr; cfg.ipStride = input_addr.stride_y;
+	cfg.wtBuf = (const vx_uint8 *)weight_ptr; cfg.wtStride = weight_addr.stride_y;
+	cfg.opBuf = (vx_uint8 *)output_ptr; cfg.opStride = output_addr.stride_y;
+
+	// blend all valid blocks of this level
+	ERROR_CHECK_STATUS(vxAccessArrayRange(arr, arr_offset, arr_offset + numEntries, &stride_blend_arr, (void **)&pBlendArr, VX_READ_ONLY));
+	if (StitchCpuHasAVX2())
+		blend_blocks_avx2(cfg, pBlendArr, (vx_int32)numEntries);
+	else
+		blend_blocks_sse(cfg, pBlendArr, (vx_int32)numEntries);
+	ERROR_CHECK_STATUS(vxCommitArrayRange(arr, arr_offset, arr_offset + numEntries, pBlendArr));
+
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, nullptr, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(weight_image, nullptr, 0, &weight_addr, weight_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &rect, 0, &output_addr, output_ptr));
+
+	return VX_SUCCESS;
 }
 
 //! \brief The OpenCL global work updater callback.
@@ -219,7 +219,7 @@ static vx_status VX_CALLBACK warp_query_target_support(vx_graph graph, vx_node n
 	vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
 	)
 {
-	supported_target_affinity = AGO_TARGET_AFFINITY_GPU;
+	supported_target_affinity = AGO_TARGET_AFFINITY_GPU | AGO_TARGET_AFFINITY_CPU;
 	return VX_SUCCESS;
 }
 
@@ -1896,10 +1896,271 @@ static vx_status VX_CALLBACK warp_opencl_codegen(
 	return VX_SUCCESS;
 }
 
+//! \brief The CPU warp configuration shared by all the entries of a frame.
+struct WarpCpuConfig {
+	bool bicubic;                  // false: bilinear; true: bicubic interpolation
+	bool inputRGBX;                // false: RGB input; true: RGBX input
+	bool outputRGBX;               // false: RGB output; true: RGBX output
+	bool useAlphaValue;            // RGB input: use alpha_value instead of gray for X channel
+	vx_float32 alphaValue;
+	vx_enum grayscaleComputeMethod;
+	vx_uint32 numCameraColumns;
+	vx_uint32 ipImageHeightOffset; // input rows per camera row
+	vx_uint32 opImageHeightOffset; // output rows per camera
+	const vx_uint8 * ipBuf; vx_uint32 ipStride;
+	vx_uint8 * opBuf; vx_uint32 opStride;
+	vx_uint8 * opU8Buf; vx_uint32 opU8Stride;
+};
+
+static inline void compute_bicubic_coeffs(vx_float32 x, vx_float32 mf[4])
+{
+	mf[0] = -0.5f*x + x*x - 0.5f*x*x*x;
+	mf[1] = 1.0f - 2.5f*x*x + 1.5f*x*x*x;
+	mf[2] = 0.5f*x + 2.0f*x*x - 1.5f*x*x*x;
+	mf[3] = 0.5f*(-x*x + x*x*x);
+}
+
+// load two consecutive pixels as 8 bytes {R0,G0,B0,X0,R1,G1,B1,X1}: the X bytes are zero for RGB input
+static inline __m128i warp_load_pixel_pair(const vx_uint8 * pt, bool rgbx)
+{
+	if (rgbx) {
+		return _mm_loadl_epi64((const __m128i *)pt);
+	}
+	vx_uint64 v = 0;
+	memcpy(&v, pt, 6);
+	return _mm_shuffle_epi8(_mm_cvtsi64_si128((long long)v), _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1));
+}
+
+// load four consecutive pixels as 16 bytes in RGBX order: the X bytes are zero for RGB input
+static inline __m128i warp_load_pixel_quad(const vx_uint8 * pt, bool rgbx)
+{
+	if (rgbx) {
+		return _mm_loadu_si128((const __m128i *)pt);
+	}
+	vx_uint8 v[16];
+	memcpy(v, pt, 12);
+	return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)v), _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+}
+
+static inline __m128 warp_bilinear_sse(const vx_uint8 * pt, vx_uint32 stride, bool rgbx, vx_float32 fx, vx_float32 fy)
+{
+	__m128i p0 = warp_load_pixel_pair(pt, rgbx);
+	__m128i p1 = warp_load_pixel_pair(pt + stride, rgbx);
+	__m128 fx0 = _mm_set1_ps(1.0f - fx), fx1 = _mm_set1_ps(fx);
+	__m128 r0 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(p0)), fx0), _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(p0, 4))), fx1));
+	__m128 r1 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(p1)), fx0), _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(p1, 4))), fx1));
+	return _mm_add_ps(_mm_mul_ps(r0, _mm_set1_ps(1.0f - fy)), _mm_mul_ps(r1, _mm_set1_ps(fy)));
+}
+
+static inline __m128 warp_bicubic_sse(const vx_uint8 * pt, vx_uint32 stride, bool rgbx, vx_float32 fx, vx_float32 fy)
+{
+	vx_float32 mx[4], my[4];
+	compute_bicubic_coeffs(fx, mx);
+	compute_bicubic_coeffs(fy, my);
+	__m128 f = _mm_setzero_ps();
+	for (int row = 0; row < 4; row++, pt += stride) {
+		__m128i px = warp_load_pixel_quad(pt, rgbx);
+		__m128 r = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(px)), _mm_set1_ps(mx[0]));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(px, 4))), _mm_set1_ps(mx[1])));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(px, 8))), _mm_set1_ps(mx[2])));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(px, 12))), _mm_set1_ps(mx[3])));
+		f = _mm_add_ps(f, _mm_mul_ps(r, _mm_set1_ps(my[row])));
+	}
+	return f;
+}
+
+// AVX2 variants: both pixels of a row pair are converted and weighted in one register
+static inline STITCH_TARGET_AVX2 __m128 warp_bilinear_avx2(const vx_uint8 * pt, vx_uint32 stride, bool rgbx, vx_float32 fx, vx_float32 fy)
+{
+	__m256 wx = _mm256_setr_ps(1.0f - fx, 1.0f - fx, 1.0f - fx, 1.0f - fx, fx, fx, fx, fx);
+	__m256 r0 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(warp_load_pixel_pair(pt, rgbx))), wx);
+	__m256 r1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(warp_load_pixel_pair(pt + stride, rgbx))), wx);
+	__m256 f = _mm256_add_ps(_mm256_mul_ps(r0, _mm256_set1_ps(1.0f - fy)), _mm256_mul_ps(r1, _mm256_set1_ps(fy)));
+	return _mm_add_ps(_mm256_castps256_ps128(f), _mm256_extractf128_ps(f, 1));
+}
+
+static inline STITCH_TARGET_AVX2 __m128 warp_bicubic_avx2(const vx_uint8 * pt, vx_uint32 stride, bool rgbx, vx_float32 fx, vx_float32 fy)
+{
+	vx_float32 mx[4], my[4];
+	compute_bicubic_coeffs(fx, mx);
+	compute_bicubic_coeffs(fy, my);
+	__m256 wx01 = _mm256_setr_ps(mx[0], mx[0], mx[0], mx[0], mx[1], mx[1], mx[1], mx[1]);
+	__m256 wx23 = _mm256_setr_ps(mx[2], mx[2], mx[2], mx[2], mx[3], mx[3], mx[3], mx[3]);
+	__m256 f = _mm256_setzero_ps();
+	for (int row = 0; row < 4; row++, pt += stride) {
+		__m128i px = warp_load_pixel_quad(pt, rgbx);
+		__m256 r = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(px)), wx01),
+			_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(px, 8))), wx23));
+		f = _mm256_add_ps(f, _mm256_mul_ps(r, _mm256_set1_ps(my[row])));
+	}
+	return _mm_add_ps(_mm256_castps256_ps128(f), _mm256_extractf128_ps(f, 1));
+}
+
+// fill in the X channel, pack and store the 8 pixels of an entry
+static inline void warp_store_pixels(const WarpCpuConfig& cfg, __m128 f[8], vx_uint32 invalidMask, vx_uint32 camId, vx_uint32 op_x, vx_uint32 op_y)
+{
+	vx_uint32 outpix[8];
+	vx_uint8 luma[8];
+	for (int i = 0; i < 8; i++) {
+		if (invalidMask & (1 << i)) {
+			outpix[i] = cfg.outputRGBX ? 0x80000000 : 0;
+			luma[i] = 0;
+			continue;
+		}
+		vx_float32 v[4];
+		_mm_storeu_ps(v, f[i]);
+		if (!cfg.inputRGBX) {
+			if (cfg.useAlphaValue)
+				v[3] = cfg.alphaValue;
+			else if (cfg.grayscaleComputeMethod == STITCH_GRAY_SCALE_COMPUTE_METHOD_AVG)
+				v[3] = (v[0] + v[1] + v[2]) * 0.3333333333f;
+			else
+				v[3] = sqrtf((v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) * 0.3333333333f);
+		}
+		__m128i pix = _mm_cvtps_epi32(_mm_loadu_ps(v));
+		pix = _mm_packus_epi16(_mm_packs_epi32(pix, pix), pix);
+		outpix[i] = (vx_uint32)_mm_cvtsi128_si32(pix);
+		vx_float32 y = v[0] * 0.2126f + v[1] * 0.7152f + v[2] * 0.0722f;
+		luma[i] = (vx_uint8)std::min(255, std::max(0, (int)lrintf(y)));
+	}
+	vx_uint8 * op = cfg.opBuf + (camId * cfg.opImageHeightOffset + op_y) * cfg.opStride;
+	if (cfg.outputRGBX) {
+		memcpy(op + (op_x << 5), outpix, sizeof(outpix));
+	}
+	else {
+		op += op_x * 24;
+		for (int i = 0; i < 8; i++, op += 3) {
+			op[0] = (vx_uint8)outpix[i]; op[1] = (vx_uint8)(outpix[i] >> 8); op[2] = (vx_uint8)(outpix[i] >> 16);
+		}
+	}
+	if (cfg.opU8Buf) {
+		memcpy(cfg.opU8Buf + (camId * cfg.opImageHeightOffset + op_y) * cfg.opU8Stride + (op_x << 3), luma, sizeof(luma));
+	}
+}
+
+//! \brief Warp one StitchValidPixelEntry (8 consecutive output pixels).
+template <bool AVX2>
+static inline void warp_entry(const WarpCpuConfig& cfg, vx_uint32 pixelEntry, const vx_uint16 * map)
+{
+	vx_uint32 camId = pixelEntry & 0x1f, op_x = (pixelEntry >> 8) & 0x7ff, op_y = (pixelEntry >> 19) & 0x1fff;
+	const vx_uint8 * ip = cfg.ipBuf + (camId / cfg.numCameraColumns) * cfg.ipImageHeightOffset * cfg.ipStride;
+	vx_uint32 bpp = cfg.inputRGBX ? 4 : 3;
+	__m128 f[8];
+	vx_uint32 invalidMask = 0;
+	for (int i = 0; i < 8; i++) {
+		vx_uint32 sx = map[2 * i], sy = map[2 * i + 1];
+		if (sx == 0xffff && sy == 0xffff) {
+			invalidMask |= 1 << i;
+			continue;
+		}
+		vx_float32 fx = (sx & 7) * 0.125f, fy = (sy & 7) * 0.125f;
+		if (cfg.bicubic) {
+			const vx_uint8 * pt = ip + ((sy >> 3) - 1) * cfg.ipStride + ((sx >> 3) - 1) * bpp;
+			f[i] = AVX2 ? warp_bicubic_avx2(pt, cfg.ipStride, cfg.inputRGBX, fx, fy) : warp_bicubic_sse(pt, cfg.ipStride, cfg.inputRGBX, fx, fy);
+		}
+		else {
+			const vx_uint8 * pt = ip + (sy >> 3) * cfg.ipStride + (sx >> 3) * bpp;
+			f[i] = AVX2 ? warp_bilinear_avx2(pt, cfg.ipStride, cfg.inputRGBX, fx, fy) : warp_bilinear_sse(pt, cfg.ipStride, cfg.inputRGBX, fx, fy);
+		}
+	}
+	warp_store_pixels(cfg, f, invalidMask, camId, op_x, op_y);
+}
+
+static void warp_entries_sse(const WarpCpuConfig& cfg, const vx_uint32 * validEntries, const StitchWarpRemapEntry * remapEntries, vx_int32 numEntries)
+{
+#pragma omp parallel for schedule(static, 256)
+	for (vx_int32 i = 0; i < numEntries; i++) {
+		if (validEntries[i] != 0xffffffff)
+			warp_entry<false>(cfg, validEntries[i], (const vx_uint16 *)&remapEntries[i]);
+	}
+}
+
+static STITCH_TARGET_AVX2 void warp_entries_avx2(const WarpCpuConfig& cfg, const vx_uint32 * validEntries, const StitchWarpRemapEntry * remapEntries, vx_int32 numEntries)
+{
+#pragma omp parallel for schedule(static, 256)
+	for (vx_int32 i = 0; i < numEntries; i++) {
+		if (validEntries[i] != 0xffffffff)
+			warp_entry<true>(cfg, validEntries[i], (const vx_uint16 *)&remapEntries[i]);
+	}
+}
+
 //! \brief The kernel execution.
 static vx_status VX_CALLBACK warp_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
-	return VX_ERROR_NOT_SUPPORTED;
+	// get configuration
+	WarpCpuConfig cfg = { 0 };
+	vx_uint32 num_cameras = 0, num_camera_columns = 1;
+	vx_uint8 flags = 0, alpha = 0;
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[0], &cfg.grayscaleComputeMethod));
+	ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[1], &num_cameras));
+	if (parameters[7]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[7], &num_camera_columns));
+	if (parameters[8]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[8], &alpha));
+	if (parameters[9]) ERROR_CHECK_STATUS(vxReadScalarValue((vx_scalar)parameters[9], &flags));
+	if (!num_cameras || !num_camera_columns)
+		return VX_ERROR_INVALID_PARAMETERS;
+	vx_image input_image = (vx_image)parameters[4], output_image = (vx_image)parameters[5], output_u8_image = (vx_image)parameters[6];
+	vx_uint32 input_width = 0, input_height = 0, output_width = 0, output_height = 0;
+	vx_df_image input_format = VX_DF_IMAGE_VIRT, output_format = VX_DF_IMAGE_VIRT;
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_WIDTH, &input_width, sizeof(input_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &input_height, sizeof(input_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_FORMAT, &input_format, sizeof(input_format)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_WIDTH, &output_width, sizeof(output_width)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_HEIGHT, &output_height, sizeof(output_height)));
+	ERROR_CHECK_STATUS(vxQueryImage(output_image, VX_IMAGE_ATTRIBUTE_FORMAT, &output_format, sizeof(output_format)));
+	cfg.bicubic = (flags & 1) ? true : false;
+	cfg.inputRGBX = (input_format == VX_DF_IMAGE_RGBX);
+	cfg.outputRGBX = (output_format == VX_DF_IMAGE_RGBX);
+	cfg.useAlphaValue = parameters[8] ? true : false;
+	cfg.alphaValue = (vx_float32)alpha;
+	cfg.numCameraColumns = num_camera_columns;
+	cfg.ipImageHeightOffset = input_height / (num_cameras / num_camera_columns);
+	cfg.opImageHeightOffset = output_height / num_cameras;
+
+	// get the tables
+	vx_array valid_array = (vx_array)parameters[2], remap_array = (vx_array)parameters[3];
+	vx_size numEntries = 0, numRemapEntries = 0;
+	ERROR_CHECK_STATUS(vxQueryArray(valid_array, VX_ARRAY_ATTRIBUTE_NUMITEMS, &numEntries, sizeof(numEntries)));
+	ERROR_CHECK_STATUS(vxQueryArray(remap_array, VX_ARRAY_ATTRIBUTE_NUMITEMS, &numRemapEntries, sizeof(numRemapEntries)));
+	numEntries = std::min(numEntries, numRemapEntries);
+	if (numEntries == 0)
+		return VX_SUCCESS;
+	vx_size valid_stride = sizeof(StitchValidPixelEntry), remap_stride = sizeof(StitchWarpRemapEntry);
+	vx_uint32 * validEntries = nullptr;
+	StitchWarpRemapEntry * remapEntries = nullptr;
+	ERROR_CHECK_STATUS(vxAccessArrayRange(valid_array, 0, numEntries, &valid_stride, (void **)&validEntries, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessArrayRange(remap_array, 0, numEntries, &remap_stride, (void **)&remapEntries, VX_READ_ONLY));
+
+	// get the images
+	vx_rectangle_t input_rect = { 0, 0, input_width, input_height }, output_rect = { 0, 0, output_width, output_height };
+	vx_imagepatch_addressing_t input_addr, output_addr, output_u8_addr;
+	void * input_ptr = nullptr, * output_ptr = nullptr, * output_u8_ptr = nullptr;
+	ERROR_CHECK_STATUS(vxAccessImagePatch(input_image, &input_rect, 0, &input_addr, &input_ptr, VX_READ_ONLY));
+	ERROR_CHECK_STATUS(vxAccessImagePatch(output_image, &output_rect, 0, &output_addr, &output_ptr, VX_WRITE_ONLY));
+	if (output_u8_image) {
+		ERROR_CHECK_STATUS(vxAccessImagePatch(output_u8_image, &output_rect, 0, &output_u8_addr, &output_u8_ptr, VX_WRITE_ONLY));
+		cfg.opU8Buf = (vx_uint8 *)output_u8_ptr;
+		cfg.opU8Stride = output_u8_addr.stride_y;
+	}
+	cfg.ipBuf = (const vx_uint8 *)input_ptr;
+	cfg.ipStride = input_addr.stride_y;
+	cfg.opBuf = (vx_uint8 *)output_ptr;
+	cfg.opStride = output_addr.stride_y;
+
+	// warp all entries
+	if (StitchCpuHasAVX2())
+		warp_entries_avx2(cfg, validEntries, remapEntries, (vx_int32)numEntries);
+	else
+		warp_entries_sse(cfg, validEntries, remapEntries, (vx_int32)numEntries);
+
+	ERROR_CHECK_STATUS(vxCommitImagePatch(input_image, nullptr, 0, &input_addr, input_ptr));
+	ERROR_CHECK_STATUS(vxCommitImagePatch(output_image, &output_rect, 0, &output_addr, output_ptr));
+	if (output_u8_image) {
+		ERROR_CHECK_STATUS(vxCommitImagePatch(output_u8_image, &output_rect, 0, &output_u8_addr, output_u8_ptr));
+	}
+	ERROR_CHECK_STATUS(vxCommitArrayRange(valid_array, 0, numEntries, validEntries));
+	ERROR_CHECK_STATUS(vxCommitArrayRange(remap_array, 0, numEntries, remapEntries));
+
+	return VX_SUCCESS;
 }
 
 //! \brief The kernel publisher.
@@ -2012,69 +2273,88 @@ vx_status GenerateWarpBuffers(
 	vx_size * mapEntryCount                      // [out] number of entries added to warp/valid map table
 	)
 {
-	vx_uint32  entryCount = 0;
-	for (vx_uint32 camId = 0; camId < numCamera; camId++)
+	// entries are ordered by camera, row, and column: count the entries of each (camera, row) pair
+	// first so that all rows can be generated in parallel at their final position in the table
+	vx_int32 numRows = (vx_int32)(numCamera * eqrHeight);
+	std::vector<vx_size> rowStart(numRows + 1, 0);
+#pragma omp parallel for
+	for (vx_int32 row = 0; row < numRows; row++)
 	{
+		vx_uint32 camMapBit = 1 << (row / eqrHeight);
+		vx_uint32 pixelPosition = (row % eqrHeight) * eqrWidth;
+		vx_size count = 0;
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr += 8, pixelPosition += 8)
+		{
+			vx_uint32 validMaskFor8Pixels = 0;
+			for (vx_uint32 i = 0; i < 8; i++) {
+				validMaskFor8Pixels |= validPixelCamMap[pixelPosition + i];
+				if (paddedPixelCamMap) validMaskFor8Pixels |= paddedPixelCamMap[pixelPosition + i];
+			}
+			if (validMaskFor8Pixels & camMapBit) count++;
+		}
+		rowStart[row + 1] = count;
+	}
+	for (vx_int32 row = 0; row < numRows; row++)
+		rowStart[row + 1] += rowStart[row];
+	vx_size entryCount = rowStart[numRows];
+
+#pragma omp parallel for schedule(dynamic, 16)
+	for (vx_int32 row = 0; row < numRows; row++)
+	{
+		vx_size entryIndex = rowStart[row];
+		if (entryIndex == rowStart[row + 1] || entryIndex >= mapTableSize)
+			continue;
+		vx_uint32 camId = row / eqrHeight, y_eqr = row % eqrHeight;
 		float xSrcOffset = (float)((camId % numCameraColumns) * camWidth) * 8.0f;
 		vx_uint32 camMapBit = 1 << camId;
 		const StitchCoord2dFloat * camSrcMapCurrent = camSrcMap + camId * eqrWidth * eqrHeight;
-		for (vx_uint32 y_eqr = 0, pixelPosition = 0; y_eqr < eqrHeight; y_eqr++)
+		vx_uint32 pixelPosition = y_eqr * eqrWidth;
+		for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth && entryIndex < mapTableSize; x_eqr += 8, pixelPosition += 8)
 		{
-			for (vx_uint32 x_eqr = 0; x_eqr < eqrWidth; x_eqr += 8, pixelPosition += 8)
-			{
-				// get camera use mask for consecutive 8 pixels from current pixel position
-				vx_uint32 validMask[8];
-				vx_uint32 validMaskFor8Pixels = 0;
-				if (paddedPixelCamMap) {
-					for (vx_uint32 i = 0; i < 8; i++) {
-						validMask[i] = validPixelCamMap[pixelPosition + i] | paddedPixelCamMap[pixelPosition + i];
-						validMaskFor8Pixels |= validMask[i];
-					}
+			// get camera use mask for consecutive 8 pixels from current pixel position
+			vx_uint32 validMask[8];
+			vx_uint32 validMaskFor8Pixels = 0;
+			if (paddedPixelCamMap) {
+				for (vx_uint32 i = 0; i < 8; i++) {
+					validMask[i] = validPixelCamMap[pixelPosition + i] | paddedPixelCamMap[pixelPosition + i];
+					validMaskFor8Pixels |= validMask[i];
 				}
-				else {
-					for (vx_uint32 i = 0; i < 8; i++) {
-						validMask[i] = validPixelCamMap[pixelPosition + i];
-						validMaskFor8Pixels |= validMask[i];
-					}
+			}
+			else {
+				for (vx_uint32 i = 0; i < 8; i++) {
+					validMask[i] = validPixelCamMap[pixelPosition + i];
+					validMaskFor8Pixels |= validMask[i];
 				}
-				if (validMaskFor8Pixels & camMapBit)
-				{
-					if (entryCount < mapTableSize)
-					{
-						// get mask to check if all pixels are valid and set validMap entry
-						vx_uint32 allValidMaskFor8Pixels = validMask[0];
-						for (vx_uint32 i = 1; i < 8; i++) {
-							allValidMaskFor8Pixels &= validMask[i];
-						}
-						StitchValidPixelEntry validEntry = { 0 };
-						validEntry.camId = camId;
-						validEntry.allValid = (allValidMaskFor8Pixels & camMapBit) ? 1 : 0;
-						validEntry.dstX = x_eqr >> 3;
-						validEntry.dstY = y_eqr;
-						validMap[entryCount] = validEntry;
-						// set warpMap entry: NOTE: assumes that current structure of StitchWarpRemapEntry to be consetive (x,y) value pairs
-						const StitchCoord2dFloat * srcEntry = &camSrcMapCurrent[pixelPosition];
-						vx_uint16 * warpEntry = (vx_uint16 *)&warpMap[entryCount];
-						for (vx_uint32 i = 0; i < 8; i++, warpEntry += 2, srcEntry++) {
-							warpEntry[0] = !(validMask[i] & camMapBit) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->x * 8.0f + 0.5f + xSrcOffset);
-							warpEntry[1] = !(validMask[i] & camMapBit) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->y * 8.0f + 0.5f);
-						}
-					}
-					entryCount++;
+			}
+			if (validMaskFor8Pixels & camMapBit)
+			{
+				// get mask to check if all pixels are valid and set validMap entry
+				vx_uint32 allValidMaskFor8Pixels = validMask[0];
+				for (vx_uint32 i = 1; i < 8; i++) {
+					allValidMaskFor8Pixels &= validMask[i];
+				}
+				StitchValidPixelEntry validEntry = { 0 };
+				validEntry.camId = camId;
+				validEntry.allValid = (allValidMaskFor8Pixels & camMapBit) ? 1 : 0;
+				validEntry.dstX = x_eqr >> 3;
+				validEntry.dstY = y_eqr;
+				validMap[entryIndex] = validEntry;
+				// set warpMap entry: NOTE: assumes that current structure of StitchWarpRemapEntry to be consetive (x,y) value pairs
+				const StitchCoord2dFloat * srcEntry = &camSrcMapCurrent[pixelPosition];
+				vx_uint16 * warpEntry = (vx_uint16 *)&warpMap[entryIndex];
+				for (vx_uint32 i = 0; i < 8; i++, warpEntry += 2, srcEntry++) {
+					warpEntry[0] = !(validMask[i] & camMapBit) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->x * 8.0f + 0.5f + xSrcOffset);
+					warpEntry[1] = !(validMask[i] & camMapBit) ? (vx_uint16)0xffff : (vx_uint16)(srcEntry->y * 8.0f + 0.5f);
 				}
+				entryIndex++;
 			}
 		}
 	}
 
-	while (entryCount < mapTableSize) {
-		vx_uint32 * validEntry = (vx_uint32 *) &validMap[entryCount];
-		*validEntry = 0xFFFFFFFF;
-
-		vx_uint16 * warpEntry = (vx_uint16 *)&warpMap[entryCount];
-		for (int i = 0; i < 16; i++)	
-			warpEntry[i] = (vx_uint16)0xffff;
-
-		entryCount++;
+	if (entryCount < mapTableSize) {
+		memset(&validMap[entryCount], 0xff, (mapTableSize - entryCount) * sizeof(StitchValidPixelEntry));
+		memset(&warpMap[entryCount], 0xff, (mapTableSize - entryCount) * sizeof(StitchWarpRemapEntry));
+		entryCount = mapTableSize;
 	}
 	*mapEntryCount = entryCount;
 
@@ -215,6 +215,12 @@ struct ls_context_t {
 	// data for Initialize tables
 	vx_uint32   USE_CPU_INIT;
 	StitchInitializeData *stitchInitData;
+	// setup table cache and incremental reinitialize
+	char        table_cache_dir[256];                   // setup table cache directory from LOOM_TABLE_CACHE_DIR (empty: disabled)
+	vx_uint64   table_cache_key;                        // content hash of the parameters used for the camera tables
+	bool        table_cache_hit;                        // true if the camera tables have been loaded from the cache
+	vx_uint32   camera_maps_valid_mask;                 // cameras with up-to-date entries in camSrcMap and camera maps
+	vx_uint32   camera_params_updated_mask;             // cameras whose parameters changed since last initialize
 	// attributes
 	vx_float32  live_stitch_attr[LIVE_STITCH_ATTR_MAX_COUNT];
 };
@@ -1105,6 +1111,188 @@ static vx_status InitializeInternalTablesForRemap(ls_context stitch, vx_remap re
 
 	return VX_SUCCESS;
 }
+//////////////////////////////////////////////////////////////////////
+//! \brief The on-disk setup table cache: one file per set of rig, camera, and output
+//  parameters with the camera maps and the warp tables generated from them.
+#define LS_TABLE_CACHE_MAGIC   0x4354534c // "LSTC"
+#define LS_TABLE_CACHE_VERSION 1
+struct ls_table_cache_header {
+	vx_uint32 magic;
+	vx_uint32 version;
+	vx_uint64 key;
+	vx_uint32 eqrWidth, eqrHeight;
+	vx_uint32 numCamera, hasPaddedMap;
+	vx_uint64 warpEntryCount;
+};
+#if _WIN32
+#define ls_fseek64 _fseeki64
+#define ls_ftell64 _ftelli64
+#else
+#define ls_fseek64 fseeko
+#define ls_ftell64 ftello
+#endif
+static vx_uint64 TableCacheHash(vx_uint64 hash, const void * data, size_t size)
+{
+	// FNV-1a
+	const vx_uint8 * p = (const vx_uint8 *)data;
+	for (size_t i = 0; i < size; i++) {
+		hash ^= p[i];
+		hash *= 0x100000001b3ull;
+	}
+	return hash;
+}
+static vx_uint64 ComputeTableCacheKey(ls_context stitch)
+{
+	vx_uint32 config[] = {
+		LS_TABLE_CACHE_VERSION, stitch->num_cameras, stitch->num_camera_columns,
+		stitch->camera_rgb_buffer_width / stitch->num_camera_columns, stitch->camera_rgb_buffer_height / stitch->num_camera_rows,
+		stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height, stitch->paddingPixelCount,
+		stitch->paddedPixelCamMap ? 1u : 0u, (!stitch->USE_CPU_INIT && stitch->stitchInitData) ? 1u : 0u,
+	};
+	vx_uint64 hash = 0xcbf29ce484222325ull;
+	hash = TableCacheHash(hash, config, sizeof(config));
+	hash = TableCacheHash(hash, &stitch->rig_par, sizeof(rig_params));
+	hash = TableCacheHash(hash, stitch->camera_par, stitch->num_cameras * sizeof(camera_params));
+	return hash;
+}
+static void GetTableCacheFileName(ls_context stitch, char * fileName, size_t size)
+{
+	snprintf(fileName, size, "%s/loom-tables-%016llx.bin", stitch->table_cache_dir, (unsigned long long)stitch->table_cache_key);
+}
+static FILE * OpenTableCacheFile(ls_context stitch, ls_table_cache_header& hdr)
+{
+	char fileName[512]; GetTableCacheFileName(stitch, fileName, sizeof(fileName));
+	FILE * fp = fopen(fileName, "rb");
+	if (!fp) return nullptr;
+	vx_uint64 pixelCount = (vx_uint64)stitch->output_rgb_buffer_width * stitch->output_rgb_buffer_height;
+	vx_uint64 expectedSize = 0;
+	if (fread(&hdr, sizeof(hdr), 1, fp) == 1 && hdr.magic == LS_TABLE_CACHE_MAGIC && hdr.version == LS_TABLE_CACHE_VERSION &&
+		hdr.key == stitch->table_cache_key && hdr.numCamera == stitch->num_cameras &&
+		hdr.eqrWidth == stitch->output_rgb_buffer_width && hdr.eqrHeight == stitch->output_rgb_buffer_height &&
+		hdr.hasPaddedMap == (stitch->paddedPixelCamMap ? 1u : 0u))
+	{
+		expectedSize = sizeof(hdr) + pixelCount * (sizeof(vx_uint32) * (hdr.hasPaddedMap ? 2 : 1) + sizeof(vx_uint8)) +
+			hdr.warpEntryCount * (sizeof(StitchValidPixelEntry) + sizeof(StitchWarpRemapEntry));
+		if (!ls_fseek64(fp, 0, SEEK_END) && (vx_uint64)ls_ftell64(fp) == expectedSize && !ls_fseek64(fp, sizeof(hdr), SEEK_SET))
+			return fp;
+	}
+	ls_printf("WARNING: ignoring invalid setup table cache file: %s\n", fileName);
+	fclose(fp);
+	return nullptr;
+}
+static bool LoadCameraMapsFromTableCache(ls_context stitch)
+{
+	ls_table_cache_header hdr = { 0 };
+	FILE * fp = OpenTableCacheFile(stitch, hdr);
+	if (!fp) return false;
+	size_t pixelCount = (size_t)stitch->output_rgb_buffer_width * stitch->output_rgb_buffer_height;
+	bool ok = fread(stitch->validPixelCamMap, sizeof(vx_uint32), pixelCount, fp) == pixelCount;
+	if (ok && stitch->paddedPixelCamMap) ok = fread(stitch->paddedPixelCamMap, sizeof(vx_uint32), pixelCount, fp) == pixelCount;
+	if (ok) ok = fread(stitch->camIndexBuf, sizeof(vx_uint8), pixelCount, fp) == pixelCount;
+	fclose(fp);
+	return ok;
+}
+static vx_status LoadWarpTablesFromTableCache(ls_context stitch, vx_size tableSize, StitchValidPixelEntry * validMap, StitchWarpRemapEntry * warpMap, vx_size * entryCount)
+{
+	ls_table_cache_header hdr = { 0 };
+	FILE * fp = OpenTableCacheFile(stitch, hdr);
+	if (!fp) return VX_FAILURE;
+	vx_uint64 pixelCount = (vx_uint64)stitch->output_rgb_buffer_width * stitch->output_rgb_buffer_height;
+	vx_uint64 offset = sizeof(hdr) + pixelCount * (sizeof(vx_uint32) * (hdr.hasPaddedMap ? 2 : 1) + sizeof(vx_uint8));
+	size_t count = (size_t)hdr.warpEntryCount;
+	bool ok = (count <= tableSize) && !ls_fseek64(fp, offset, SEEK_SET) &&
+		fread(validMap, sizeof(StitchValidPixelEntry), count, fp) == count &&
+		fread(warpMap, sizeof(StitchWarpRemapEntry), count, fp) == count;
+	fclose(fp);
+	if (!ok) {
+		ls_printf("ERROR: LoadWarpTablesFromTableCache: unable to load " VX_FMT_SIZE " warp entries into a table of " VX_FMT_SIZE "\n", count, tableSize);
+		return VX_FAILURE;
+	}
+	// pad the table with invalid entries same as GenerateWarpBuffers
+	memset(&validMap[count], 0xff, (tableSize - count) * sizeof(StitchValidPixelEntry));
+	memset(&warpMap[count], 0xff, (tableSize - count) * sizeof(StitchWarpRemapEntry));
+	*entryCount = tableSize;
+	return VX_SUCCESS;
+}
+static void SaveTablesToTableCache(ls_context stitch, const StitchValidPixelEntry * validMap, const StitchWarpRemapEntry * warpMap, vx_size entryCount)
+{
+	// the trailing invalid entries are regenerated when loading
+	while (entryCount > 0 && *(const vx_uint32 *)&validMap[entryCount - 1] == 0xffffffff)
+		entryCount--;
+	ls_table_cache_header hdr = { 0 };
+	hdr.magic = LS_TABLE_CACHE_MAGIC;
+	hdr.version = LS_TABLE_CACHE_VERSION;
+	hdr.key = stitch->table_cache_key;
+	hdr.eqrWidth = stitch->output_rgb_buffer_width;
+	hdr.eqrHeight = stitch->output_rgb_buffer_height;
+	hdr.numCamera = stitch->num_cameras;
+	hdr.hasPaddedMap = stitch->paddedPixelCamMap ? 1 : 0;
+	hdr.warpEntryCount = entryCount;
+	size_t pixelCount = (size_t)stitch->output_rgb_buffer_width * stitch->output_rgb_buffer_height;
+	// write to a temporary file first, so that concurrent readers never see a partial file
+	char fileName[512], tmpFileName[600];
+	GetTableCacheFileName(stitch, fileName, sizeof(fileName));
+	snprintf(tmpFileName, sizeof(tmpFileName), "%s.%p.tmp", fileName, (void *)stitch);
+	FILE * fp = fopen(tmpFileName, "wb");
+	if (!fp) {
+		ls_printf("WARNING: SaveTablesToTableCache: unable to create: %s\n", tmpFileName);
+		return;
+	}
+	bool ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1 &&
+		fwrite(stitch->validPixelCamMap, sizeof(vx_uint32), pixelCount, fp) == pixelCount &&
+		(!stitch->paddedPixelCamMap || fwrite(stitch->paddedPixelCamMap, sizeof(vx_uint32), pixelCount, fp) == pixelCount) &&
+		fwrite(stitch->camIndexBuf, sizeof(vx_uint8), pixelCount, fp) == pixelCount &&
+		fwrite(validMap, sizeof(StitchValidPixelEntry), entryCount, fp) == entryCount &&
+		fwrite(warpMap, sizeof(StitchWarpRemapEntry), entryCount, fp) == entryCount;
+	ok = (fclose(fp) == 0) && ok;
+	if (!ok || rename(tmpFileName, fileName) != 0) {
+		if (!ok) ls_printf("WARNING: SaveTablesToTableCache: unable to write: %s\n", tmpFileName);
+		remove(tmpFileName);
+	}
+}
+//////////////////////////////////////////////////////////////////////
+//! \brief Calculate camera maps (valid/padded pixel maps, source coordinates, and default camera index).
+//  Only the cameras in updateCamMask and the ones without up-to-date maps are recomputed on CPU.
+static vx_status CalculateCameraMaps(ls_context stitch, vx_uint32 updateCamMask)
+{
+	vx_uint32 allCamMask = (stitch->num_cameras < 32) ? ((1u << stitch->num_cameras) - 1) : 0xffffffff;
+	stitch->table_cache_hit = false;
+	if (stitch->table_cache_dir[0]) {
+		stitch->table_cache_key = ComputeTableCacheKey(stitch);
+		if (LoadCameraMapsFromTableCache(stitch)) {
+			// camSrcMap is not part of the cache: mark it for recompute on next update
+			stitch->camera_maps_valid_mask = 0;
+			stitch->table_cache_hit = true;
+			return VX_SUCCESS;
+		}
+	}
+	vx_status status;
+	if (!stitch->USE_CPU_INIT && stitch->stitchInitData && stitch->stitchInitData->graphInitialize) {
+		status = CalculateLensDistortionAndWarpMaps(stitch->stitchInitData, stitch->num_cameras,
+			stitch->camera_rgb_buffer_width / stitch->num_camera_columns,
+			stitch->camera_rgb_buffer_height / stitch->num_camera_rows,
+			stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
+			&stitch->rig_par, stitch->camera_par,
+			stitch->validPixelCamMap, stitch->paddingPixelCount, stitch->paddedPixelCamMap,
+			stitch->camSrcMap, stitch->camIndexTmpBuf, stitch->camIndexBuf);
+	}
+	else {
+		status = UpdateLensDistortionAndWarpMaps(stitch->num_cameras,
+			stitch->camera_rgb_buffer_width / stitch->num_camera_columns,
+			stitch->camera_rgb_buffer_height / stitch->num_camera_rows,
+			stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
+			&stitch->rig_par, stitch->camera_par,
+			stitch->validPixelCamMap, stitch->paddingPixelCount, stitch->paddedPixelCamMap,
+			stitch->camSrcMap, stitch->camIndexTmpBuf, stitch->camIndexBuf,
+			updateCamMask | (allCamMask & ~stitch->camera_maps_valid_mask));
+	}
+	if (status != VX_SUCCESS) {
+		stitch->camera_maps_valid_mask = 0;
+		return status;
+	}
+	stitch->camera_maps_valid_mask = allCamMask;
+	return VX_SUCCESS;
+}
 static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 {
 	vx_uint32 numCamera = stitch->num_cameras;
@@ -1121,14 +1309,9 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 
 	if (stitch->feature_enable_reinitialize)
 	{
-		// compute lens distortion and warp models
-		vx_status status = CalculateLensDistortionAndWarpMaps(!stitch->USE_CPU_INIT ? stitch->stitchInitData : nullptr, stitch->num_cameras,
-			stitch->camera_rgb_buffer_width / stitch->num_camera_columns,
-			stitch->camera_rgb_buffer_height / stitch->num_camera_rows,
-			stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
-			&stitch->rig_par, stitch->camera_par,
-			stitch->validPixelCamMap, stitch->paddingPixelCount, stitch->paddedPixelCamMap,
-			stitch->camSrcMap, stitch->camIndexTmpBuf, stitch->camIndexBuf);
+		// compute lens distortion and warp models: only for the cameras that changed unless rig changed
+		vx_uint32 updateCamMask = stitch->rig_params_updated ? 0xffffffff : stitch->camera_params_updated_mask;
+		vx_status status = CalculateCameraMaps(stitch, updateCamMask);
 		if (status != VX_SUCCESS) {
 			vxAddLogEntry((vx_reference)stitch->context, status, "ERROR: AllocateInternalTablesForCamera: CalculateLensDistortionAndWarpMaps() failed (%d)\n", status);
 			return status;
@@ -1153,10 +1336,19 @@ static vx_status InitializeInternalTablesForCamera(ls_context stitch)
 		vx_size stride = 0, warpEntryCount = 0; vx_map_id map_id_valid = 0, map_id_warp = 0;
 		ERROR_CHECK_STATUS_(vxMapArrayRange(stitch->ValidPixelEntry, 0, stitch->table_sizes.warpTableSize, &map_id_valid, &stride, (void **)&validPixelBuf, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, 0));
 		ERROR_CHECK_STATUS_(vxMapArrayRange(stitch->WarpRemapEntry, 0, stitch->table_sizes.warpTableSize, &map_id_warp, &stride, (void **)&warpRemapBuf, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, 0));
-		vx_status status = GenerateWarpBuffers(numCamera, eqrWidth, eqrHeight,
-			validPixelCamMap, paddedPixelCamMap, camSrcMap,
-			stitch->num_camera_columns, stitch->camera_rgb_buffer_width / stitch->num_camera_columns,
-			stitch->table_sizes.warpTableSize, validPixelBuf, warpRemapBuf, &warpEntryCount);
+		vx_status status;
+		if (stitch->table_cache_hit) {
+			status = LoadWarpTablesFromTableCache(stitch, stitch->table_sizes.warpTableSize, validPixelBuf, warpRemapBuf, &warpEntryCount);
+		}
+		else {
+			status = GenerateWarpBuffers(numCamera, eqrWidth, eqrHeight,
+				validPixelCamMap, paddedPixelCamMap, camSrcMap,
+				stitch->num_camera_columns, stitch->camera_rgb_buffer_width / stitch->num_camera_columns,
+				stitch->table_sizes.warpTableSize, validPixelBuf, warpRemapBuf, &warpEntryCount);
+			if (status == VX_SUCCESS && stitch->table_cache_dir[0]) {
+				SaveTablesToTableCache(stitch, validPixelBuf, warpRemapBuf, warpEntryCount);
+			}
+		}
 		ERROR_CHECK_STATUS_(vxUnmapArrayRange(stitch->ValidPixelEntry, map_id_valid));
 		ERROR_CHECK_STATUS_(vxUnmapArrayRange(stitch->WarpRemapEntry, map_id_warp));
 		if (status != VX_SUCCESS) {
@@ -1441,13 +1633,7 @@ static vx_status AllocateInternalTablesForCamera(ls_context stitch)
 			// when re-initialize support is not required, only allocate smallest buffers needed
 			// ------
 			// compute lens distortion and warp models
-			vx_status status = CalculateLensDistortionAndWarpMaps(!stitch->USE_CPU_INIT ? stitch->stitchInitData : nullptr, stitch->num_cameras,
-				stitch->camera_rgb_buffer_width / stitch->num_camera_columns,
-				stitch->camera_rgb_buffer_height / stitch->num_camera_rows,
-				stitch->output_rgb_buffer_width, stitch->output_rgb_buffer_height,
-				&stitch->rig_par, stitch->camera_par,
-				stitch->validPixelCamMap, stitch->paddingPixelCount, stitch->paddedPixelCamMap,
-				stitch->camSrcMap, stitch->camIndexTmpBuf, stitch->camIndexBuf);
+			vx_status status = CalculateCameraMaps(stitch, 0xffffffff);
 			if (status != VX_SUCCESS) {
 				vxAddLogEntry((vx_reference)stitch->context, status, "ERROR: AllocateInternalTablesForCamera: CalculateLensDistortionAndWarpMaps() failed (%d)\n", status);
 				return status;
@@ -2071,12 +2257,14 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsSetCameraParams(ls_context stitch,
 		ls_printf("ERROR: lsSetCameraParams: lsReinitialize has been disabled\n");
 		return VX_ERROR_NOT_SUPPORTED;
 	}
-	memcpy(&stitch->camera_par[cam_index], par, sizeof(camera_params));
 	// check and mark whether reinitialize is required
 	if (stitch->initialized) {
 		stitch->reinitialize_required = true;
 		stitch->camera_params_updated = true;
+		if (memcmp(&stitch->camera_par[cam_index], par, sizeof(camera_params)))
+			stitch->camera_params_updated_mask |= (cam_index < 32) ? (1u << cam_index) : 0xffffffff;
 	}
+	memcpy(&stitch->camera_par[cam_index], par, sizeof(camera_params));
 	return VX_SUCCESS;
 }
 
@@ -2652,6 +2840,10 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsInitialize(ls_context stitch)
 			}
 		}
 
+		// setup table cache directory
+		if (!StitchGetEnvironmentVariable("LOOM_TABLE_CACHE_DIR", stitch->table_cache_dir, sizeof(stitch->table_cache_dir)))
+			stitch->table_cache_dir[0] = 0;
+
 		// allocate internal tables
 		vx_status status = AllocateInternalTablesForCamera(stitch);
 		if (status != VX_SUCCESS)
@@ -2841,6 +3033,7 @@ LIVE_STITCH_API_ENTRY vx_status VX_API_CALL lsReinitialize(ls_context stitch)
 	stitch->reinitialize_required = false;
 	stitch->rig_params_updated = false;
 	stitch->camera_params_updated = false;
+	stitch->camera_params_updated_mask = 0;
 	stitch->overlay_params_updated = false;
 	PROFILER_STOP(LoomSL, ReinitializeGraph);
 	return VX_SUCCESS;
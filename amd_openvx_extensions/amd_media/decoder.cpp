@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <fstream>
 #include <sstream>
 #include <stdlib.h>
+#include <cmath>
 
 // Performance measurement option
 #define ENABLE_PERF_MEASURE        1
@@ -79,9 +80,12 @@ public:
     vx_status SetRepeatMode(vx_int32 bRepeat);
     vx_status SetEnableUserBufferGPUMode(vx_bool bEnable);
     vx_status SetDeviceId(vx_int32 device_id);
+    vx_status SetEnableZeroCopyMode(vx_bool bEnable);
+    vx_status SetDecodeMode(const char * mode);
 
 protected:
     typedef enum { cmd_abort, cmd_decode } command;
+    typedef enum { decode_all, decode_keyframes, decode_step, decode_seek } decode_mode;
     void DecodeLoop(int mediaIndex);
     void PushCommand(int mediaIndex, command cmd);
     void PushAck(int mediaIndex, int ack);
@@ -89,6 +93,13 @@ protected:
     int PopAck(int mediaIndex);
     void PushFrame(int mediaIndex, AVFrame *frame);
     AVFrame * PopFrame(int mediaIndex);
+    bool CanSwapOutputFrame(vx_image output, AVFrame *frame);
+    vx_status SwapOutputFrame(vx_image output, AVFrame *frame);
+    vx_status ReleaseOutputFrame();
+    int64_t GetFrameIndex(int mediaIndex, int64_t ts);
+    int SeekFrame(int mediaIndex, double seconds);
+    bool WantPacket(int mediaIndex, const AVPacket *pkt);
+    bool WantFrame(int mediaIndex, const AVFrame *frame);
 
 private:
     vx_node node;
@@ -103,6 +114,13 @@ private:
     AVPixelFormat outputFormat, decoderFormat;
     vx_uint8 * decodeBuffer[DECODE_BUFFER_POOL_SIZE];
     vx_bool m_enableUserBufferGPU;
+    vx_bool m_enableZeroCopy;
+    int zeroCopyState;                  // -1: not checked yet, 0: copy to output, 1: swap decoded frames into output
+    int zeroCopyPlanes;
+    int zeroCopyStride[4];              // stride of each plane of the output image
+    void * zeroCopyAppPtrs[4];          // buffers of the output image before the first swap
+    AVFrame * zeroCopyFrame;            // decoded frame currently held by the output image
+    vx_image zeroCopyOutput;
 //#if DECODE_ENABLE_OPENCL
 #if ENABLE_OPENCL
     cl_command_queue cmdq;
@@ -130,6 +148,12 @@ private:
     int outputFrameCount;
     std::vector<int> LoopDec;
     std::vector<int> hwDeviceID;
+    decode_mode decodeMode;
+    int decodeStep;                     // output every Nth frame in decode_step mode
+    std::vector<double> seekTimes;      // timestamps (in seconds) to output in decode_seek mode
+    std::vector<size_t> seekIndex;      // next timestamp to seek to
+    std::vector<int64_t> seekTarget;    // pts of the frame to output after a seek: AV_NOPTS_VALUE if not seeking
+    std::vector<int64_t> sourceFrameCount;
 #if ENABLE_PERF_MEASURE
     std::chrono::duration<double> totalDecodeTime = {};
     std::chrono::duration<double> totalTransferTime = {};
@@ -273,7 +297,8 @@ CLoomIoMediaDecoder::CLoomIoMediaDecoder(vx_node node_, vx_uint32 mediaCount_, c
       videoCodecContext(mediaCount_), conversionContext(mediaCount_), videoStreamIndex(mediaCount_),
       mutexCmd(mediaCount_), cvCmd(mediaCount_), queueCmd(mediaCount_), mutexAck(mediaCount_), cvAck(mediaCount_), queueAck(mediaCount_),
       thread(mediaCount_), eof(mediaCount_), decodeFrameCount(mediaCount_), useVaapi(mediaCount_), mutexFrame(mediaCount_), cvFrame(mediaCount_), queueFrames(mediaCount_), 
-      LoopDec(mediaCount_), hwDeviceID(mediaCount_) {
+      LoopDec(mediaCount_), hwDeviceID(mediaCount_), decodeMode{ decode_all }, decodeStep{ 1 },
+      seekIndex(mediaCount_), seekTarget(mediaCount_), sourceFrameCount(mediaCount_) {
 
     memset(decodeBuffer, 0, sizeof(decodeBuffer));
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
@@ -284,6 +309,13 @@ CLoomIoMediaDecoder::CLoomIoMediaDecoder(vx_node node_, vx_uint32 mediaCount_, c
         hwDeviceID[mediaIndex] = -1;    //use default device ID
     }
     m_enableUserBufferGPU = false;   // use host buffers by default
+    m_enableZeroCopy = false;        // copy decoded frames into output by default
+    zeroCopyState = -1;
+    zeroCopyPlanes = 0;
+    memset(zeroCopyStride, 0, sizeof(zeroCopyStride));
+    memset(zeroCopyAppPtrs, 0, sizeof(zeroCopyAppPtrs));
+    zeroCopyFrame = nullptr;
+    zeroCopyOutput = nullptr;
     memset(mem, 0, sizeof(mem));
 
 #if ENABLE_OPENCL
@@ -315,6 +347,8 @@ CLoomIoMediaDecoder::~CLoomIoMediaDecoder()
             delete thread[mediaIndex];
         }
     }
+    // give the output image its own buffers back
+    ReleaseOutputFrame();
 
     // release buffers
 #if ENABLE_OPENCL
@@ -374,6 +408,38 @@ vx_status CLoomIoMediaDecoder::SetEnableUserBufferGPUMode(vx_bool bEnable) {
     return VX_SUCCESS;
 }
 
+vx_status CLoomIoMediaDecoder::SetEnableZeroCopyMode(vx_bool bEnable) {
+    m_enableZeroCopy = bEnable;
+    return VX_SUCCESS;
+}
+
+// decode mode: "keyframes" | "step:<N>" | "seek:<t1>,<t2>,..." (timestamps in seconds)
+vx_status CLoomIoMediaDecoder::SetDecodeMode(const char * mode) {
+    std::string decode(mode ? mode : "");
+    if (decode.empty() || decode == "all") {
+        decodeMode = decode_all;
+    }
+    else if (decode == "keyframes") {
+        decodeMode = decode_keyframes;
+    }
+    else if (!decode.compare(0, 5, "step:")) {
+        decodeMode = decode_step;
+        decodeStep = atoi(decode.c_str() + 5);
+    }
+    else if (!decode.compare(0, 5, "seek:")) {
+        decodeMode = decode_seek;
+        std::vector<std::string> times = split(decode.substr(5), ',');
+        for (size_t i = 0; i < times.size(); i++) {
+            seekTimes.push_back(atof(times[i].c_str()));
+        }
+    }
+    if ((decodeMode == decode_all && !decode.empty() && decode != "all") || (decodeMode == decode_step && decodeStep < 1) || (decodeMode == decode_seek && seekTimes.empty())) {
+        vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_VALUE, "ERROR: invalid decode mode: %s: valid syntax: keyframes|step:<N>|seek:<t1>,<t2>,...\n", decode.c_str());
+        return VX_ERROR_INVALID_VALUE;
+    }
+    return VX_SUCCESS;
+}
+
 vx_status CLoomIoMediaDecoder::SetDeviceId(vx_int32 device_id_mask) {
     // use default of device_id_mask is -1
     bool use_default = (device_id_mask == -1);
@@ -405,6 +471,10 @@ vx_status CLoomIoMediaDecoder::Initialize()
         outputFormat = AV_PIX_FMT_RGB24;
         stride = width*3;
     }
+    else if (format == VX_DF_IMAGE_IYUV && !m_enableUserBufferGPU) {
+        outputFormat = AV_PIX_FMT_YUV420P;
+        stride = width;
+    }
     else {
         vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_FORMAT, "ERROR: output image format %4.4s not supported", &format);
         return VX_ERROR_INVALID_FORMAT;
@@ -529,6 +599,8 @@ vx_status CLoomIoMediaDecoder::Initialize()
                 decoderFormat = AV_PIX_FMT_NV12;
         } else
             decoderFormat = codecContext->pix_fmt;    // correct format will be set after
+        if (decodeMode == decode_keyframes)
+            codecContext->skip_frame = AVDISCARD_NONKEY;
 
         ERROR_CHECK_STATUS(avcodec_open2(codecContext, decoder, nullptr));
         SwsContext * swsContext = NULL;
@@ -598,11 +670,26 @@ vx_status CLoomIoMediaDecoder::Initialize()
 #endif
     }
 
+    // decoded frames can be swapped into the output image only when they are used as is
+    zeroCopyState = -1;
+    if (m_enableZeroCopy) {
+        if (mediaCount != 1 || m_enableUserBufferGPU || conversionContext[0] != NULL || (outputFormat != AV_PIX_FMT_NV12 && outputFormat != AV_PIX_FMT_YUV420P)) {
+            vxAddLogEntry((vx_reference)node, VX_SUCCESS, "INFO: zero-copy decode needs one stream decoded into a host NV12/IYUV image of the same size: using copy");
+            zeroCopyState = 0;
+        }
+    }
+    else {
+        zeroCopyState = 0;
+    }
+
     // start decoder thread and wait until first frame is decoded
     outputFrameCount = 0;
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
         decodeFrameCount[mediaIndex] = 0;
         eof[mediaIndex] = false;
+        seekIndex[mediaIndex] = 0;
+        seekTarget[mediaIndex] = AV_NOPTS_VALUE;
+        sourceFrameCount[mediaIndex] = 0;
     }
     for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
         thread[mediaIndex] = new std::thread(&CLoomIoMediaDecoder::DecodeLoop, this, mediaIndex);
@@ -615,6 +702,76 @@ vx_status CLoomIoMediaDecoder::Initialize()
     return VX_SUCCESS;
 }
 
+// check if the decoded frame can be used as the buffer of the output image: the output image
+// must be created from host handles and the frame planes must have the strides of the image
+bool CLoomIoMediaDecoder::CanSwapOutputFrame(vx_image output, AVFrame *frame)
+{
+    if (zeroCopyState < 0) {
+        zeroCopyState = 0;
+        vx_enum memoryType = VX_MEMORY_TYPE_NONE;
+        vx_size planes = 0;
+        if (vxQueryImage(output, VX_IMAGE_MEMORY_TYPE, &memoryType, sizeof(memoryType)) != VX_SUCCESS || memoryType != VX_MEMORY_TYPE_HOST ||
+            vxQueryImage(output, VX_IMAGE_PLANES, &planes, sizeof(planes)) != VX_SUCCESS || planes > 4)
+        {
+            vxAddLogEntry((vx_reference)node, VX_SUCCESS, "INFO: zero-copy decode needs an output image created from host handles: using copy");
+            return false;
+        }
+        for (vx_uint32 plane = 0; plane < (vx_uint32)planes; plane++) {
+            vx_rectangle_t rect = { 0, 0, (vx_uint32)width, (vx_uint32)height };
+            vx_map_id map_id;
+            vx_imagepatch_addressing_t addr = { 0 };
+            uint8_t * ptr = nullptr;
+            if (vxMapImagePatch(output, &rect, plane, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X) != VX_SUCCESS)
+                return false;
+            zeroCopyStride[plane] = addr.stride_y;
+            vxUnmapImagePatch(output, map_id);
+        }
+        zeroCopyPlanes = (int)planes;
+        zeroCopyOutput = output;
+        zeroCopyState = 1;
+    }
+    if (zeroCopyState == 0 || output != zeroCopyOutput || frame->format != outputFormat || frame->width != width || frame->height != height)
+        return false;
+    for (int plane = 0; plane < zeroCopyPlanes; plane++) {
+        if (!frame->data[plane] || frame->linesize[plane] != zeroCopyStride[plane])
+            return false;
+    }
+    return true;
+}
+
+// hand the decoded frame over to the output image: the frame stays referenced until the next one arrives
+vx_status CLoomIoMediaDecoder::SwapOutputFrame(vx_image output, AVFrame *frame)
+{
+    void * ptrs[4] = { nullptr }, * prev_ptrs[4] = { nullptr };
+    for (int plane = 0; plane < zeroCopyPlanes; plane++)
+        ptrs[plane] = frame->data[plane];
+    vx_status status = vxSwapImageHandle(output, ptrs, prev_ptrs, zeroCopyPlanes);
+    if (status != VX_SUCCESS) {
+        vxAddLogEntry((vx_reference)node, status, "ERROR: vxSwapImageHandle() failed (%d)\n", status);
+        av_frame_free(&frame);
+        return status;
+    }
+    if (zeroCopyFrame) {
+        // the previous frame is no longer used by the graph
+        av_frame_free(&zeroCopyFrame);
+    }
+    else {
+        memcpy(zeroCopyAppPtrs, prev_ptrs, sizeof(zeroCopyAppPtrs));
+    }
+    zeroCopyFrame = frame;
+    return VX_SUCCESS;
+}
+
+// give the output image its own buffers back and release the frame held by it
+vx_status CLoomIoMediaDecoder::ReleaseOutputFrame()
+{
+    if (zeroCopyFrame) {
+        ERROR_CHECK_STATUS(vxSwapImageHandle(zeroCopyOutput, zeroCopyAppPtrs, nullptr, zeroCopyPlanes));
+        av_frame_free(&zeroCopyFrame);
+    }
+    return VX_SUCCESS;
+}
+
 static int frame_num = 0;
 
 vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
@@ -655,9 +812,15 @@ vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
     } else {
         for (int mediaIndex = 0; mediaIndex < mediaCount; mediaIndex++) {
             AVFrame *frame = PopFrame(mediaIndex);       // assuming only one stream to decode
+            if (zeroCopyState != 0 && CanSwapOutputFrame(output, frame)) {
+                ERROR_CHECK_STATUS(SwapOutputFrame(output, frame));
+                continue;
+            }
+            // don't write into a decoded frame still held by the output image
+            ERROR_CHECK_STATUS(ReleaseOutputFrame());
             if (conversionContext[mediaIndex] != NULL) {
                 vx_rectangle_t rect = { 0, (vx_uint32)(mediaIndex * decoderImageHeight), (vx_uint32)width, (vx_uint32)(mediaIndex * decoderImageHeight + decoderImageHeight) };
-                vx_map_id map_id, map_id1;
+                vx_map_id map_id, map_id1, map_id2;
                 vx_imagepatch_addressing_t addr = {0};
                 uint8_t * ptr = nullptr;
 
@@ -666,13 +829,20 @@ vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
                 ERROR_CHECK_STATUS(vxMapImagePatch(output, &rect, 0, &map_id, &addr, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
                 dst_data[0] = ptr;
                 dst_linesize[0] = addr.stride_y;
-                if (outputFormat == AV_PIX_FMT_NV12) {
+                if (outputFormat == AV_PIX_FMT_NV12 || outputFormat == AV_PIX_FMT_YUV420P) {
                     uint8_t *ptr_uv = nullptr;
                     vx_imagepatch_addressing_t addr1 = {0};
                     ERROR_CHECK_STATUS(vxMapImagePatch(output, &rect, 1, &map_id1, &addr1, (void **)&ptr_uv, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
                     dst_data[1] = ptr_uv;
                     dst_linesize[1]  = addr1.stride_y;
                 }
+                if (outputFormat == AV_PIX_FMT_YUV420P) {
+                    uint8_t *ptr_v = nullptr;
+                    vx_imagepatch_addressing_t addr2 = {0};
+                    ERROR_CHECK_STATUS(vxMapImagePatch(output, &rect, 2, &map_id2, &addr2, (void **)&ptr_v, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+                    dst_data[2] = ptr_v;
+                    dst_linesize[2]  = addr2.stride_y;
+                }
                 // do sws_scale
                 int ret = sws_scale(conversionContext[mediaIndex], frame->data, frame->linesize, 0, frame->height, dst_data, dst_linesize);
                 if (ret < decoderImageHeight) {
@@ -688,16 +858,22 @@ vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
                 #endif
                 // commit image patch
                 ERROR_CHECK_STATUS(vxUnmapImagePatch(output, map_id));
-                if (outputFormat == AV_PIX_FMT_NV12) ERROR_CHECK_STATUS(vxUnmapImagePatch(output, map_id1));
+                if (outputFormat == AV_PIX_FMT_NV12 || outputFormat == AV_PIX_FMT_YUV420P) ERROR_CHECK_STATUS(vxUnmapImagePatch(output, map_id1));
+                if (outputFormat == AV_PIX_FMT_YUV420P) ERROR_CHECK_STATUS(vxUnmapImagePatch(output, map_id2));
             } else {
                 // copy AV frame to output
                 vx_rectangle_t rect = { 0, (vx_uint32)(mediaIndex * decoderImageHeight), (vx_uint32)width, (vx_uint32)decoderImageHeight };
                 vx_rectangle_t rect1 = { 0, (vx_uint32)(mediaIndex * (decoderImageHeight>>1)), (vx_uint32)width, (vx_uint32)(decoderImageHeight) }; // UV
                 vx_imagepatch_addressing_t addr = { 0 };
                 addr.stride_x = stride / width;
-                addr.stride_y = stride;
+                addr.stride_y = frame->linesize[0];
                 ERROR_CHECK_STATUS(vxCopyImagePatch(output, &rect, 0, &addr, frame->data[0], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+                addr.stride_y = frame->linesize[1];
                 ERROR_CHECK_STATUS(vxCopyImagePatch(output, &rect1, 1, &addr, frame->data[1], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+                if (outputFormat == AV_PIX_FMT_YUV420P) {
+                    addr.stride_y = frame->linesize[2];
+                    ERROR_CHECK_STATUS(vxCopyImagePatch(output, &rect1, 2, &addr, frame->data[2], VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+                }
             }
             av_frame_free(&frame);
         }
@@ -706,6 +882,70 @@ vx_status CLoomIoMediaDecoder::ProcessFrame(vx_image output, vx_array aux_data)
     return VX_SUCCESS;
 }
 
+// index of the frame with timestamp ts in the stream: -1 if it can't be derived from the frame rate
+int64_t CLoomIoMediaDecoder::GetFrameIndex(int mediaIndex, int64_t ts)
+{
+    AVStream * stream = inputMediaFormatContext[mediaIndex]->streams[videoStreamIndex[mediaIndex]];
+    if (ts == AV_NOPTS_VALUE || stream->avg_frame_rate.num <= 0 || stream->avg_frame_rate.den <= 0)
+        return -1;
+    if (stream->start_time != AV_NOPTS_VALUE)
+        ts -= stream->start_time;
+    return av_rescale_q(ts, stream->time_base, av_inv_q(stream->avg_frame_rate));
+}
+
+// seek to the key frame at or before the timestamp: frames are decoded from there until the timestamp is reached
+int CLoomIoMediaDecoder::SeekFrame(int mediaIndex, double seconds)
+{
+    AVFormatContext * formatContext = inputMediaFormatContext[mediaIndex];
+    AVStream * stream = formatContext->streams[videoStreamIndex[mediaIndex]];
+    int64_t target = (int64_t)llround(seconds / av_q2d(stream->time_base));
+    if (stream->start_time != AV_NOPTS_VALUE)
+        target += stream->start_time;
+    int status = av_seek_frame(formatContext, videoStreamIndex[mediaIndex], target, AVSEEK_FLAG_BACKWARD);
+    if (status < 0)
+        return status;
+    avcodec_flush_buffers(videoCodecContext[mediaIndex]);
+    seekTarget[mediaIndex] = target;
+    return 0;
+}
+
+// check if the packet needs to be sent to the decoder: the decoder is allowed to
+// skip the non-reference frames that won't be output
+bool CLoomIoMediaDecoder::WantPacket(int mediaIndex, const AVPacket *pkt)
+{
+    AVCodecContext * codecContext = videoCodecContext[mediaIndex];
+    if (decodeMode == decode_keyframes) {
+        return (pkt->flags & AV_PKT_FLAG_KEY) != 0;
+    }
+    else if (decodeMode == decode_step) {
+        int64_t frameIndex = GetFrameIndex(mediaIndex, pkt->pts);
+        codecContext->skip_frame = (frameIndex >= 0 && (frameIndex % decodeStep) != 0) ? AVDISCARD_NONREF : AVDISCARD_DEFAULT;
+    }
+    else if (decodeMode == decode_seek) {
+        codecContext->skip_frame = (pkt->pts != AV_NOPTS_VALUE && pkt->pts < seekTarget[mediaIndex]) ? AVDISCARD_NONREF : AVDISCARD_DEFAULT;
+    }
+    return true;
+}
+
+// check if the decoded frame is output
+bool CLoomIoMediaDecoder::WantFrame(int mediaIndex, const AVFrame *frame)
+{
+    int64_t ts = frame->best_effort_timestamp;
+    if (decodeMode == decode_step) {
+        int64_t frameIndex = GetFrameIndex(mediaIndex, ts);
+        if (frameIndex < 0)
+            frameIndex = sourceFrameCount[mediaIndex];
+        sourceFrameCount[mediaIndex]++;
+        return (frameIndex % decodeStep) == 0;
+    }
+    else if (decodeMode == decode_seek) {
+        if (ts != AV_NOPTS_VALUE && ts < seekTarget[mediaIndex])
+            return false;
+        seekTarget[mediaIndex] = AV_NOPTS_VALUE;
+    }
+    return true;
+}
+
 void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
 {
     // decode loop
@@ -716,9 +956,28 @@ void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
         int gotPicture = 0;
         while (!gotPicture && !eof[mediaIndex]) 
         {
+            if (decodeMode == decode_seek && seekTarget[mediaIndex] == AV_NOPTS_VALUE) {
+                // seek to the next timestamp in the list
+                if (seekIndex[mediaIndex] >= seekTimes.size() && LoopDec[mediaIndex])
+                    seekIndex[mediaIndex] = 0;
+                if (seekIndex[mediaIndex] >= seekTimes.size())
+                    goto end;
+                double seconds = seekTimes[seekIndex[mediaIndex]++];
+                if ((status = SeekFrame(mediaIndex, seconds)) < 0) {
+                    vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: av_seek_frame(%.3f) failed (%x)\n", seconds, AVERROR(status));
+                    goto end;
+                }
+            }
+            bool seekPastEnd = false;
             for (;;) {
                 status = av_read_frame(inputMediaFormatContext[mediaIndex], &avpkt);
                 if (status < 0) {
+                    if ((status == AVERROR_EOF) && decodeMode == decode_seek && (seekIndex[mediaIndex] < seekTimes.size() || LoopDec[mediaIndex])) {
+                        // timestamp is beyond the end of the stream: continue with the next one
+                        seekTarget[mediaIndex] = AV_NOPTS_VALUE;
+                        seekPastEnd = true;
+                        break;
+                    }
                     if ((status == AVERROR_EOF) && LoopDec[mediaIndex]) {
                         auto stream = inputMediaFormatContext[mediaIndex]->streams[videoStreamIndex[mediaIndex]];
                         avio_seek(inputMediaFormatContext[mediaIndex]->pb, 0, SEEK_SET);
@@ -739,19 +998,23 @@ void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
 
                     return;
                 }
-                else if (avpkt.stream_index == videoStreamIndex[mediaIndex]) {
+                else if (avpkt.stream_index == videoStreamIndex[mediaIndex] && WantPacket(mediaIndex, &avpkt)) {
                     // send packet to decoder
 #if ENABLE_PERF_MEASURE
                     startTime = std::chrono::high_resolution_clock::now();
 #endif
                     status = avcodec_send_packet(videoCodecContext[mediaIndex], &avpkt);
+                    av_packet_unref(&avpkt);
                     if (status < 0) {
                         vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: Sending packet to video decoder status:%x", AVERROR(status));
                         return;
                     }
                    break;
                 }
+                av_packet_unref(&avpkt);
             }
+            if (seekPastEnd)
+                continue;
             AVFrame *frame = NULL, *sw_frame = NULL, *tmp_frame = NULL;
             if (!(frame = av_frame_alloc()) || !(sw_frame = av_frame_alloc())) {
                 vxAddLogEntry((vx_reference)node, VX_ERROR_NO_MEMORY, "ERROR: Can not alloc frame(%d)");
@@ -772,6 +1035,12 @@ void CLoomIoMediaDecoder::DecodeLoop(int mediaIndex)
                 av_frame_free(&sw_frame);
                 return;
             }
+            if (!WantFrame(mediaIndex, frame)) {
+                // frame is not sampled: continue to decode the next frame.
+                av_frame_free(&frame);
+                av_frame_free(&sw_frame);
+                continue;
+            }
             gotPicture = true;
 #if ENABLE_PERF_MEASURE           
             endTime = std::chrono::high_resolution_clock::now();
@@ -947,6 +1216,14 @@ static vx_status VX_CALLBACK amd_media_decode_initialize(vx_node node, const vx_
     if (parameters[5]) {
         ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[5], &device_id, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
     }
+    vx_bool enableZeroCopy = false;
+    if (parameters[6]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[6], &enableZeroCopy, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    char decodeMode[VX_MAX_STRING_BUFFER_SIZE_AMD] = "";
+    if (parameters[7]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[7], decodeMode, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
 
     // create and initialize decoder
     const char * s = inputMediaConfig;
@@ -972,6 +1249,8 @@ static vx_status VX_CALLBACK amd_media_decode_initialize(vx_node node, const vx_
     if (parameters[5]) {
         ERROR_CHECK_STATUS(decoder->SetDeviceId(device_id));
     }
+    ERROR_CHECK_STATUS(decoder->SetEnableZeroCopyMode(enableZeroCopy));
+    ERROR_CHECK_STATUS(decoder->SetDecodeMode(decodeMode));
     ERROR_CHECK_STATUS(decoder->Initialize());
 
     return VX_SUCCESS;
@@ -1000,18 +1279,24 @@ static vx_status VX_CALLBACK amd_media_decode_validate(vx_node node, const vx_re
     ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)parameters[0], VX_SCALAR_TYPE, &type, sizeof(type)));
     if (type != VX_TYPE_STRING_AMD)
         return VX_ERROR_INVALID_FORMAT;
-    // make sure output format is UYVY/YUYV/RGB/NV12
+    // make sure output format is UYVY/YUYV/RGB/NV12/IYUV
     vx_uint32 width = 0, height = 0;
     vx_df_image format = VX_DF_IMAGE_VIRT;
     ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_WIDTH, &width, sizeof(width)));
     ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_HEIGHT, &height, sizeof(height)));
     ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
-    if (format != VX_DF_IMAGE_UYVY && format != VX_DF_IMAGE_YUYV && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_NV12)
+    if (format != VX_DF_IMAGE_UYVY && format != VX_DF_IMAGE_YUYV && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_NV12 && format != VX_DF_IMAGE_IYUV)
         return VX_ERROR_INVALID_FORMAT;
     // set output image meta
     ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[1], VX_IMAGE_WIDTH, &width, sizeof(width)));
     ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[1], VX_IMAGE_HEIGHT, &height, sizeof(height)));
     ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+    // make sure decode mode is a string
+    if (parameters[7]) {
+        ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)parameters[7], VX_SCALAR_TYPE, &type, sizeof(type)));
+        if (type != VX_TYPE_STRING_AMD)
+            return VX_ERROR_INVALID_TYPE;
+    }
     vx_bool enableUserBufferGPU = false;
     if (parameters[4]) {
         ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[4], &enableUserBufferGPU, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
@@ -1040,7 +1325,7 @@ vx_status amd_media_decode_publish(vx_context context)
 {
     // add kernel to the context with callbacks
     vx_kernel kernel = vxAddUserKernel(context, "com.amd.amd_media.decode", AMDOVX_KERNEL_AMD_MEDIA_DECODE,
-                            amd_media_decode_kernel, 5, amd_media_decode_validate,
+                            amd_media_decode_kernel, 8, amd_media_decode_validate,
                             amd_media_decode_initialize, amd_media_decode_deinitialize);
     ERROR_CHECK_OBJECT(kernel);
 
@@ -1051,6 +1336,8 @@ vx_status amd_media_decode_publish(vx_context context)
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL)); // input repeat decoding at eof (optional)
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 4, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL)); // input: to set enableUserBufferGPU flag
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL)); // input: to set device_id
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL)); // input: to swap decoded frames into output image (optional)
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 7, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL)); // input: decode mode: keyframes|step:<N>|seek:<t1>,<t2>,... (optional)
 
     // finalize and release kernel object
     ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
@@ -1059,7 +1346,7 @@ vx_status amd_media_decode_publish(vx_context context)
     return VX_SUCCESS;
 }
 
-VX_API_ENTRY vx_node VX_API_CALL amdMediaDecoderNode(vx_graph graph, const char *input_str, vx_image output, vx_array aux_data, vx_int32 loop_decode, vx_bool enable_gpu_output, vx_int32 device_id_mask) {
+VX_API_ENTRY vx_node VX_API_CALL amdMediaDecoderNode(vx_graph graph, const char *input_str, vx_image output, vx_array aux_data, vx_int32 loop_decode, vx_bool enable_gpu_output, vx_int32 device_id_mask, vx_bool enable_zero_copy, const char *decode_mode) {
 
     vx_node node = NULL;
     vx_context context = vxGetContext((vx_reference)graph);
@@ -1068,6 +1355,8 @@ VX_API_ENTRY vx_node VX_API_CALL amdMediaDecoderNode(vx_graph graph, const char
         vx_scalar s_loop = vxCreateScalar(context, VX_TYPE_INT32, &loop_decode);
         vx_scalar s_enable_gpu_out = vxCreateScalar(context, VX_TYPE_BOOL, &enable_gpu_output);
         vx_scalar s_device_id_mask = vxCreateScalar(context, VX_TYPE_INT32, &device_id_mask);
+        vx_scalar s_zero_copy = vxCreateScalar(context, VX_TYPE_BOOL, &enable_zero_copy);
+        vx_scalar s_decode_mode = decode_mode ? vxCreateScalar(context, VX_TYPE_STRING_AMD, decode_mode) : nullptr;
         vx_reference params[] = {
             (vx_reference)s_input,
             (vx_reference)output,
@@ -1075,6 +1364,8 @@ VX_API_ENTRY vx_node VX_API_CALL amdMediaDecoderNode(vx_graph graph, const char
             (vx_reference)s_loop,
             (vx_reference)s_enable_gpu_out,
             (vx_reference)s_device_id_mask,
+            (vx_reference)s_zero_copy,
+            (vx_reference)s_decode_mode,
         };
         if (vxGetStatus((vx_reference)s_input) == VX_SUCCESS) {
             node = createMediaNode(graph, "com.amd.amd_media.decode", params, sizeof(params) / sizeof(params[0])); // added node to graph
@@ -1082,6 +1373,8 @@ VX_API_ENTRY vx_node VX_API_CALL amdMediaDecoderNode(vx_graph graph, const char
             vxReleaseScalar(&s_loop);
             vxReleaseScalar(&s_enable_gpu_out);
             vxReleaseScalar(&s_device_id_mask);
+            vxReleaseScalar(&s_zero_copy);
+            if (s_decode_mode) vxReleaseScalar(&s_decode_mode);
         }
     }
 
@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include <mutex>
 #include <condition_variable>
 #include <deque>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -47,7 +48,7 @@ THE SOFTWARE.
 #define DEFAULT_FPS                30.0f
 #define DEFAULT_BFRAMES            0
 #define DEFAULT_GOPSIZE            60
-#define ENCODE_BUFFER_POOL_SIZE    4         // number of buffers in encoder queue: keep it atleast 2
+#define ENCODE_BUFFER_POOL_SIZE    4         // number of buffers in encoder queue (bframes are added to it): keep it atleast 2
 
 typedef struct {
     vx_uint32 size;
@@ -61,6 +62,11 @@ typedef struct {
     int64_t cpuTimestamp;
 } LoomIoMediaEncoderAuxInfo;
 
+typedef struct {
+    uint8_t * data[4];
+    int linesize[4];
+} LoomIoMediaEncoderInputBuffer;
+
 class CLoomIoMediaEncoder {
 public:
     CLoomIoMediaEncoder(vx_node node, const char ioConfig[], vx_uint32 width, vx_uint32 height, vx_df_image format, vx_uint32 stride, vx_uint32 offset, vx_size input_aux_data_max_size);
@@ -74,6 +80,7 @@ public:
 protected:
     typedef enum { cmd_abort, cmd_encode } command;
     void EncodeLoop();
+    int WritePackets(AVPacket * pkt);
     void PushCommand(command cmd);
     void PushAck(int ack);
     command PopCommand();
@@ -93,14 +100,16 @@ private:
     const AVCodec * videoCodec;
     const AVOutputFormat *outputFmt;
     SwsContext * conversionContext;
-    void* mem[ENCODE_BUFFER_POOL_SIZE];
+    int poolSize;
+    std::vector<void *> mem;
+    std::vector<LoomIoMediaEncoderInputBuffer> inputBuffer;
 #if ENABLE_OPENCL
     cl_command_queue cmdq;
 #elif ENABLE_HIP
     hipDeviceProp_t hip_dev_prop;
     uint8_t *hostBuffer;
 #endif
-    AVFrame * videoFrame[ENCODE_BUFFER_POOL_SIZE];
+    std::vector<AVFrame *> videoFrame;
     uint8_t * outputAuxBuffer;
     vx_size outputAuxLength;
     FILE * fpOutput;
@@ -156,15 +165,13 @@ CLoomIoMediaEncoder::CLoomIoMediaEncoder(vx_node node_, const char ioConfig_[],
       stride{ static_cast<int>(stride_) }, offset{ static_cast<int>(offset_) }, input_aux_data_max_size{ input_aux_data_max_size_ },
       inputFrameCount{ 0 }, encodeFrameCount{ 0 }, threadTerminated{ false }, inputFormat{ AV_PIX_FMT_UYVY422 }, 
       fpOutput{ nullptr }, formatContext{ nullptr }, videoStream{ nullptr }, outputAuxBuffer{ nullptr }, outputAuxLength{ 0 },
-      videoCodecContext{ nullptr }, videoCodec{ nullptr }, conversionContext{ nullptr }, thread{ nullptr },
+      videoCodecContext{ nullptr }, videoCodec{ nullptr }, conversionContext{ nullptr }, poolSize{ ENCODE_BUFFER_POOL_SIZE }, thread{ nullptr },
       mbps{ DEFAULT_MBPS }, fps{ DEFAULT_FPS }, gopsize{ DEFAULT_GOPSIZE }, bframes{ DEFAULT_BFRAMES }
 {
     m_enableUserBufferGPU = false;   // use host buffers by default
 #if ENABLE_OPENCL
     cmdq = nullptr;
 #endif
-    memset(mem, 0, sizeof(mem));
-    memset(videoFrame, 0, sizeof(videoFrame));
     outputAuxBuffer = new uint8_t[input_aux_data_max_size + sizeof(LoomIoMediaEncoderAuxInfo)]();
     // initialize freq inside GetTimeInMicroseconds()
     GetTimeInMicroseconds();
@@ -199,11 +206,19 @@ CLoomIoMediaEncoder::~CLoomIoMediaEncoder()
     #endif
     }
 
-    for (int i = 0; i < ENCODE_BUFFER_POOL_SIZE; i++) {
+    for (size_t i = 0; i < videoFrame.size(); i++) {
         if (videoFrame[i]) {
             av_frame_free(&videoFrame[i]);
         }
     }
+    for (size_t i = 0; i < inputBuffer.size(); i++) {
+        if (inputBuffer[i].data[0]) {
+            av_freep(&inputBuffer[i].data[0]);
+        }
+    }
+    if (conversionContext) {
+        sws_freeContext(conversionContext);
+    }
     if (videoCodecContext) {
         avcodec_free_context(&videoCodecContext);
     }
@@ -284,7 +299,24 @@ vx_status CLoomIoMediaEncoder::Initialize()
 
     ERROR_CHECK_STATUS(avcodec_open2(videoCodecContext, videoCodec, nullptr));
     ERROR_CHECK_NULLPTR(conversionContext = sws_getContext(width, height, inputFormat, width, height, videoCodecContext->pix_fmt, SWS_BICUBIC, NULL, NULL, NULL));
-    for (int i = 0; i < ENCODE_BUFFER_POOL_SIZE; i++) {
+    // the graph can run ahead of the encoder by the pool size: the frames held back by the encoder for
+    // B-frame reordering are counted in, so that the graph doesn't wait for them
+    poolSize = ENCODE_BUFFER_POOL_SIZE + std::max(bframes, 0);
+    mem.assign(poolSize, nullptr);
+    videoFrame.assign(poolSize, nullptr);
+    if (!m_enableUserBufferGPU) {
+        // input images are copied into these buffers and converted on the encoder thread
+        LoomIoMediaEncoderInputBuffer buf = { { nullptr }, { 0 } };
+        inputBuffer.assign(poolSize, buf);
+        for (int i = 0; i < poolSize; i++) {
+            int status = av_image_alloc(inputBuffer[i].data, inputBuffer[i].linesize, width, height, inputFormat, 32);
+            if (status < 0) {
+                vxAddLogEntry((vx_reference)node, VX_ERROR_NO_MEMORY, "ERROR: CLoomIoMediaEncoder::Initialize: av_image_alloc() failed (%d)", status);
+                return VX_ERROR_NO_MEMORY;
+            }
+        }
+    }
+    for (int i = 0; i < poolSize; i++) {
         ERROR_CHECK_NULLPTR(videoFrame[i] = av_frame_alloc());
         videoFrame[i]->format = videoCodecContext->pix_fmt;
         videoFrame[i]->width = width;
@@ -385,7 +417,7 @@ vx_status CLoomIoMediaEncoder::UpdateBufferGPU(vx_image input_image, vx_array in
     outputAuxLength += auxInfo->h0.size;
 
     // pick the OpenCL buffer frame from pool
-    int bufId = inputFrameCount % ENCODE_BUFFER_POOL_SIZE; inputFrameCount++;
+    int bufId = inputFrameCount % poolSize; inputFrameCount++;
     if (m_enableUserBufferGPU) {
     #if ENABLE_OPENCL
         ERROR_CHECK_STATUS(vxQueryImage(input_image, VX_IMAGE_ATTRIBUTE_AMD_OPENCL_BUFFER, &mem[bufId], sizeof(void*)));
@@ -411,18 +443,13 @@ vx_status CLoomIoMediaEncoder::ProcessFrame(vx_image input_image, vx_array input
        // just submit GPU buffer for encoding
         PushCommand(cmd_encode);
     } else {
-        // format convert input image into encode buffer
-        int bufId = inputFrameCount % ENCODE_BUFFER_POOL_SIZE; inputFrameCount++;
-        int ret = av_frame_make_writable(videoFrame[bufId]);
-        if (ret < 0) {
-            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::ProcessFrame failed to write data(%d)\n", ret);
-            return VX_FAILURE;
-        }
+        // copy input image into a buffer of the pool: the format conversion is done on the encoder thread
+        int bufId = inputFrameCount % poolSize; inputFrameCount++;
         vx_rectangle_t rect = { 0, 0, width, height };
         vx_map_id map_id, map_id1;
         vx_imagepatch_addressing_t addr;
         uint8_t * ptr = nullptr;
-        uint8_t *src_data[4] = {0};
+        const uint8_t *src_data[4] = {0};
         int src_linesize[4] = {0};
         ERROR_CHECK_STATUS(vxMapImagePatch(input_image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
         src_data[0] = ptr;
@@ -432,11 +459,7 @@ vx_status CLoomIoMediaEncoder::ProcessFrame(vx_image input_image, vx_array input
             src_data[1] = ptr;
             src_linesize[1] = addr.stride_y;
         }
-        int status = sws_scale(conversionContext, src_data, src_linesize, 0, height, videoFrame[bufId]->data, videoFrame[bufId]->linesize);
-        if (status < 0) {
-            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::ProcessFrame: sws_scale() failed (%d)\n", status);
-            return VX_FAILURE;
-        }
+        av_image_copy(inputBuffer[bufId].data, inputBuffer[bufId].linesize, src_data, src_linesize, inputFormat, width, height);
         ERROR_CHECK_STATUS(vxUnmapImagePatch(input_image, map_id));
         if (inputFormat == AV_PIX_FMT_NV12) {
             ERROR_CHECK_STATUS(vxUnmapImagePatch(input_image, map_id1));
@@ -454,10 +477,36 @@ vx_status CLoomIoMediaEncoder::ProcessFrame(vx_image input_image, vx_array input
     return VX_SUCCESS;
 }
 
+// receive all the packets available from the encoder and write them into the output
+int CLoomIoMediaEncoder::WritePackets(AVPacket * pkt)
+{
+    for (;;) {
+        int status = avcodec_receive_packet(videoCodecContext, pkt);
+        if (status == AVERROR(EAGAIN) || status == AVERROR_EOF)
+            return 0;
+        if (status < 0)
+            return status;
+        if (formatContext) {
+            av_packet_rescale_ts(pkt, videoCodecContext->time_base, videoStream->time_base);
+            pkt->stream_index = videoStream->index;
+            status = av_interleaved_write_frame(formatContext, pkt);
+            if (status < 0) {
+                vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::WritePackets: av_interleaved_write_frame() failed (%4.4s:0x%08x:%d) for frame:%d\n", &status, status, status, encodeFrameCount);
+                av_packet_unref(pkt);
+                return status;
+            }
+        } else if (fpOutput)
+        {
+            fwrite(pkt->data, 1, pkt->size, fpOutput);
+        }
+        av_packet_unref(pkt);
+    }
+}
+
 void CLoomIoMediaEncoder::EncodeLoop()
 {
     // initial ACK to inform producer for readiness
-    for (int i = 1; i < ENCODE_BUFFER_POOL_SIZE; i++)
+    for (int i = 1; i < poolSize; i++)
         PushAck(0);
 
     // initialize packet and start encoding
@@ -465,14 +514,18 @@ void CLoomIoMediaEncoder::EncodeLoop()
     pkt = av_packet_alloc();
     if (!pkt) return;
 
-    int64_t pts = 0;
+    int status = 0;
     for (command cmd; !threadTerminated && ((cmd = PopCommand()) != cmd_abort);) {
-        int status;
         // get the bufId to process
-        int bufId = (encodeFrameCount % ENCODE_BUFFER_POOL_SIZE);
-        int got_output = 0;
+        int bufId = (encodeFrameCount % poolSize);
+        // the encoder may still hold a reference to the frame (B-frames and lookahead)
+        status = av_frame_make_writable(videoFrame[m_enableUserBufferGPU ? 0 : bufId]);
+        if (status < 0) {
+            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::EncodeLoop: av_frame_make_writable() failed (%d) for frame:%d\n", status, encodeFrameCount);
+            break;
+        }
         // format convert input image into encode buffer
-        if ( m_enableUserBufferGPU) {
+        if (m_enableUserBufferGPU) {
             int mapHeight = (inputFormat == AV_PIX_FMT_NV12)? (height + (height>>1)) : height;
     #if ENABLE_OPENCL
             cl_int err = -1;
@@ -529,70 +582,36 @@ void CLoomIoMediaEncoder::EncodeLoop()
             // reset bufId to zero because only videoFrame[0] is valid
             bufId = 0;
         }
-        // encode video frame and write output to file
-        videoFrame[bufId]->pts = pts;
-        int status_send = avcodec_send_frame(videoCodecContext, videoFrame[bufId]);
-        got_output = avcodec_receive_packet(videoCodecContext, pkt);
-        status = std::min(status_send, got_output);
-        if (status == AVERROR(EAGAIN)) {
-            PushAck(0);
-            continue;
+        else {
+            status = sws_scale(conversionContext, inputBuffer[bufId].data, inputBuffer[bufId].linesize, 0, height, videoFrame[bufId]->data, videoFrame[bufId]->linesize);
+            if (status < 0) {
+                vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::EncodeLoop: sws_scale() failed (%d)\n", status);
+                break;
+            }
+        }
+        // the input buffer is consumed, so the producer can reuse it
+        PushAck(0);
+
+        // encode video frame and write all the packets available
+        videoFrame[bufId]->pts = encodeFrameCount++;
+        status = avcodec_send_frame(videoCodecContext, videoFrame[bufId]);
+        if (status >= 0) {
+            status = WritePackets(pkt);
         }
         if (status < 0) {
             vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::EncodeLoop: avcodec_send_frame/receive_packet() failed (%4.4s:0x%08x:%d) for frame:%d\n", &status, status, status, encodeFrameCount);
-            threadTerminated = true;
-            PushAck(-1);
-            return;
+            break;
         }
-        if (pkt->size > 0) {
-            if (formatContext) {
-                av_packet_rescale_ts(pkt, videoCodecContext->time_base, videoStream->time_base);
-                pkt->stream_index = videoStream->index;
-                status = av_interleaved_write_frame(formatContext, pkt);
-                if (status < 0) {
-                    vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::EncodeLoop: av_interleaved_write_frame() failed (%4.4s:0x%08x:%d) for frame:%d\n", &status, status, status, encodeFrameCount);
-                    threadTerminated = true;
-                    PushAck(-1);
-                    return;
-                }
-            } else if (fpOutput)
-            {
-                fwrite(pkt->data, 1, pkt->size, fpOutput);
-            }
-            pts++;
-            encodeFrameCount++;
-        }
-        av_packet_unref(pkt);
-        PushAck(0);
     }
     // process the delayed frames
-    for (int got_output = !0; got_output;) {
-        int status_send = avcodec_send_frame(videoCodecContext, nullptr);
-        got_output = avcodec_receive_packet(videoCodecContext, pkt);
-        int status = std::min(status_send, got_output);
+    if (status >= 0) {
+        status = avcodec_send_frame(videoCodecContext, nullptr);
+        if (status >= 0) {
+            status = WritePackets(pkt);
+        }
         if (status < 0) {
             vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: avcodec_send_frame/receive_packet() failed (%4.4s:%d) at the end\n", &status, status);
-            threadTerminated = true;
-            PushAck(-1);
-            return;
         }
-        if (pkt->size > 0) {
-            if (formatContext) {
-                pkt->stream_index = videoStream->index;
-                av_packet_rescale_ts(pkt, videoCodecContext->time_base, videoStream->time_base);
-                status = av_interleaved_write_frame(formatContext, pkt);
-                if (status < 0) {
-                    vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaEncoder::EncodeLoop: av_interleaved_write_frame() failed (%4.4s:0x%08x:%d) for frame:%d\n", &status, status, status, encodeFrameCount);
-                    threadTerminated = true;
-                    PushAck(-1);
-                    return;
-                }
-            } else if (fpOutput)
-            {
-                fwrite(pkt->data, 1, pkt->size, fpOutput);
-            }
-        }
-        av_packet_unref(pkt);
     }
     // mark termination and send ACK
     threadTerminated = true;
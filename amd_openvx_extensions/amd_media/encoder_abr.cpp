@@ -0,0 +1,688 @@
+/*
+Copyright (c) 2015 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "vx_amd_media.h"
+#include "kernels.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#define DEFAULT_MBPS               4.0f
+#define DEFAULT_FPS                30.0f
+#define DEFAULT_BFRAMES            0
+#define DEFAULT_GOPSIZE            60
+#define ENCODE_BUFFER_POOL_SIZE    4         // number of buffers in each queue (bframes are added to rendition queues): keep it atleast 2
+
+typedef struct {
+    uint8_t * data[4];
+    int linesize[4];
+} LoomIoMediaAbrEncoderInputBuffer;
+
+// one output of the ABR ladder: the renditions are sorted by decreasing resolution and each rendition
+// is scaled from the frame of the previous one, so the input is color converted only once
+class CLoomIoMediaRendition {
+public:
+    CLoomIoMediaRendition(vx_node node, const std::string& fileName, int width, int height, float mbps, float fps, int bframes, int gopsize);
+    ~CLoomIoMediaRendition();
+    vx_status Initialize(AVPixelFormat srcFormat, int srcWidth, int srcHeight);
+    vx_status Start();
+    int Scale(const uint8_t * const srcData[], const int srcLinesize[], int srcHeight);
+    void Submit();
+    void Stop();
+    AVFrame * Frame() const { return frame; }
+    int Width() const { return width; }
+    int Height() const { return height; }
+    bool Failed() const { return failed; }
+
+protected:
+    void EncodeLoop();
+    int WritePackets(AVPacket * pkt);
+
+private:
+    vx_node node;
+    std::string fileName;
+    int width, height;
+    float mbps, fps;
+    int bframes, gopsize;
+    const AVCodec * videoCodec;
+    AVCodecContext * videoCodecContext;
+    AVFormatContext * formatContext;
+    AVStream * videoStream;
+    FILE * fpOutput;
+    SwsContext * scaleContext;
+    std::vector<AVFrame *> framePool;  // frames reused round-robin for the scaled output
+    size_t frameIndex;
+    AVFrame * frame;                    // most recently scaled frame of framePool
+    std::mutex mutexQueue;
+    std::condition_variable cvQueue;
+    std::deque<AVFrame *> queueFrame;   // frames of framePool waiting for the encoder: nullptr marks the end of the stream
+    size_t queueDepth;
+    std::thread * thread;
+    std::atomic<bool> failed;
+    int encodeFrameCount;
+};
+
+class CLoomIoMediaAbrEncoder {
+public:
+    CLoomIoMediaAbrEncoder(vx_node node, const char ioConfig[], vx_uint32 width, vx_uint32 height, vx_df_image format);
+    ~CLoomIoMediaAbrEncoder();
+    vx_status Initialize();
+    vx_status ProcessFrame(vx_image input_image, vx_array input_aux, vx_array output_aux);
+
+protected:
+    typedef enum { cmd_abort, cmd_encode } command;
+    void ScaleLoop();
+    void PushCommand(command cmd);
+    void PushAck(int ack);
+    command PopCommand();
+    int PopAck();
+
+private:
+    vx_node node;
+    std::string ioConfig;
+    vx_uint32 width, height;
+    vx_df_image format;
+    AVPixelFormat inputFormat;
+    std::vector<CLoomIoMediaRendition *> renditions;
+    std::vector<LoomIoMediaAbrEncoderInputBuffer> inputBuffer;
+    std::mutex mutexCmd, mutexAck;
+    std::condition_variable cvCmd, cvAck;
+    std::deque<command> queueCmd;
+    std::deque<int> queueAck;
+    std::thread * thread;
+    bool threadTerminated;
+    int inputFrameCount;
+    int scaleFrameCount;
+};
+
+// helper function for spliting streams.
+extern std::vector<std::string> split(const std::string& s, char delimiter);
+
+CLoomIoMediaRendition::CLoomIoMediaRendition(vx_node node_, const std::string& fileName_, int width_, int height_, float mbps_, float fps_, int bframes_, int gopsize_)
+    : node{ node_ }, fileName(fileName_), width{ width_ }, height{ height_ }, mbps{ mbps_ }, fps{ fps_ }, bframes{ bframes_ }, gopsize{ gopsize_ },
+      videoCodec{ nullptr }, videoCodecContext{ nullptr }, formatContext{ nullptr }, videoStream{ nullptr }, fpOutput{ nullptr },
+      scaleContext{ nullptr }, frameIndex{ 0 }, frame{ nullptr }, queueDepth{ ENCODE_BUFFER_POOL_SIZE }, thread{ nullptr }, failed{ false }, encodeFrameCount{ 0 }
+{
+}
+
+CLoomIoMediaRendition::~CLoomIoMediaRendition()
+{
+    Stop();
+    if (fpOutput) {
+        fclose(fpOutput);
+    }
+    if (formatContext) {
+        av_write_trailer(formatContext);
+        av_free(formatContext);
+    }
+    for (AVFrame *& poolFrame : framePool) {
+        av_frame_free(&poolFrame);
+    }
+    if (scaleContext) {
+        sws_freeContext(scaleContext);
+    }
+    if (videoCodecContext) {
+        avcodec_free_context(&videoCodecContext);
+    }
+}
+
+vx_status CLoomIoMediaRendition::Initialize(AVPixelFormat srcFormat, int srcWidth, int srcHeight)
+{
+    ERROR_CHECK_NULLPTR(videoCodec = avcodec_find_encoder(AV_CODEC_ID_H264));
+    ERROR_CHECK_NULLPTR(videoCodecContext = avcodec_alloc_context3(videoCodec));
+    videoCodecContext->bit_rate = (int)(mbps * 1000000);
+    videoCodecContext->width = width;
+    videoCodecContext->height = height;
+    videoCodecContext->time_base.num = (int)(60000.0f / fps);
+    videoCodecContext->time_base.den = 60000;
+    videoCodecContext->gop_size = gopsize;
+    videoCodecContext->max_b_frames = bframes;
+    videoCodecContext->pix_fmt = AV_PIX_FMT_YUV420P;
+    if (videoCodec->id == AV_CODEC_ID_H264)
+        av_opt_set(videoCodecContext->priv_data, "preset", "slow", 0);
+    ERROR_CHECK_NULLPTR(scaleContext = sws_getContext(srcWidth, srcHeight, srcFormat, width, height, videoCodecContext->pix_fmt, SWS_BICUBIC, NULL, NULL, NULL));
+    // frames held back by the encoder for B-frame reordering don't stall the ladder
+    queueDepth = ENCODE_BUFFER_POOL_SIZE + std::max(bframes, 0);
+    // besides the queued frames, one frame can be in the encoder and one is the latest scaled frame
+    framePool.resize(queueDepth + 2, nullptr);
+    for (AVFrame *& poolFrame : framePool) {
+        ERROR_CHECK_NULLPTR(poolFrame = av_frame_alloc());
+        poolFrame->format = videoCodecContext->pix_fmt;
+        poolFrame->width = width;
+        poolFrame->height = height;
+        ERROR_CHECK_STATUS(av_frame_get_buffer(poolFrame, 0));
+    }
+
+    // open output file
+    const char * outFileName = fileName.c_str();
+    if (strlen(outFileName) > 4 && !strcmp(outFileName + strlen(outFileName) - 4, ".264")) {
+        ERROR_CHECK_STATUS(avcodec_open2(videoCodecContext, videoCodec, nullptr));
+        fpOutput = fopen(outFileName, "wb");
+        if (!fpOutput) {
+            vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_LINK, "ERROR: CLoomIoMediaRendition::Initialize: unable to create: %s", outFileName);
+            return VX_ERROR_INVALID_LINK;
+        }
+    }
+    else {
+        int status = avformat_alloc_output_context2(&formatContext, nullptr, nullptr, outFileName);
+        if (status < 0) {
+            vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_LINK, "ERROR: CLoomIoMediaRendition::Initialize: avformat_alloc_output_context2(...,%s) failed (%d)", outFileName, status);
+            return VX_ERROR_INVALID_LINK;
+        }
+        ERROR_CHECK_NULLPTR(videoStream = avformat_new_stream(formatContext, videoCodec));
+        videoStream->time_base = (AVRational){ 1, (int)fps };
+        videoCodecContext->time_base = videoStream->time_base;
+        videoStream->id = formatContext->nb_streams - 1;
+        if (formatContext->oformat->flags & AVFMT_GLOBALHEADER)
+            videoCodecContext->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
+        ERROR_CHECK_STATUS(avcodec_open2(videoCodecContext, videoCodec, nullptr));
+        if (!(formatContext->oformat->flags & AVFMT_NOFILE)) {
+            if ((status = avio_open(&formatContext->pb, outFileName, AVIO_FLAG_WRITE)) < 0) {
+                vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_LINK, "ERROR: CLoomIoMediaRendition::Initialize: avio_open(...,%s) failed (%d)", outFileName, status);
+                return VX_ERROR_INVALID_LINK;
+            }
+        }
+        ERROR_CHECK_STATUS(avcodec_parameters_from_context(videoStream->codecpar, videoCodecContext));
+        ERROR_CHECK_STATUS(avformat_write_header(formatContext, nullptr));
+    }
+
+    vxAddLogEntry((vx_reference)node, VX_SUCCESS, "INFO: writing %dx%d %.2fmbps %.2ffps gopsize=%d bframes=%d video into %s", width, height, mbps, fps, gopsize, bframes, outFileName);
+    return VX_SUCCESS;
+}
+
+vx_status CLoomIoMediaRendition::Start()
+{
+    thread = new std::thread(&CLoomIoMediaRendition::EncodeLoop, this);
+    ERROR_CHECK_NULLPTR(thread);
+    return VX_SUCCESS;
+}
+
+// scale the source (input image or the frame of the previous rendition) into the next frame of the pool:
+// the queue holds at most queueDepth frames, so the frame reused here has already been encoded
+int CLoomIoMediaRendition::Scale(const uint8_t * const srcData[], const int srcLinesize[], int srcHeight)
+{
+    frame = framePool[frameIndex];
+    frameIndex = (frameIndex + 1) % framePool.size();
+    // the encoder may still reference the buffers for its lookahead: they are reallocated only in that case
+    int status = av_frame_make_writable(frame);
+    if (status < 0)
+        return status;
+    return sws_scale(scaleContext, srcData, srcLinesize, 0, srcHeight, frame->data, frame->linesize);
+}
+
+void CLoomIoMediaRendition::Submit()
+{
+    std::unique_lock<std::mutex> lock(mutexQueue);
+    cvQueue.wait(lock, [=] { return queueFrame.size() < queueDepth || failed; });
+    if (failed) {
+        return;
+    }
+    queueFrame.push_front(frame);
+    cvQueue.notify_all();
+}
+
+void CLoomIoMediaRendition::Stop()
+{
+    if (thread) {
+        {
+            std::unique_lock<std::mutex> lock(mutexQueue);
+            queueFrame.push_front(nullptr);
+            cvQueue.notify_all();
+        }
+        thread->join();
+        delete thread;
+        thread = nullptr;
+    }
+}
+
+// receive all the packets available from the encoder and write them into the output
+int CLoomIoMediaRendition::WritePackets(AVPacket * pkt)
+{
+    for (;;) {
+        int status = avcodec_receive_packet(videoCodecContext, pkt);
+        if (status == AVERROR(EAGAIN) || status == AVERROR_EOF)
+            return 0;
+        if (status < 0)
+            return status;
+        if (formatContext) {
+            av_packet_rescale_ts(pkt, videoCodecContext->time_base, videoStream->time_base);
+            pkt->stream_index = videoStream->index;
+            status = av_interleaved_write_frame(formatContext, pkt);
+            if (status < 0) {
+                av_packet_unref(pkt);
+                return status;
+            }
+        } else if (fpOutput)
+        {
+            fwrite(pkt->data, 1, pkt->size, fpOutput);
+        }
+        av_packet_unref(pkt);
+    }
+}
+
+void CLoomIoMediaRendition::EncodeLoop()
+{
+    AVPacket * pkt = av_packet_alloc();
+    int status = pkt ? 0 : AVERROR(ENOMEM);
+    for (;;) {
+        AVFrame * input = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutexQueue);
+            cvQueue.wait(lock, [=] { return !queueFrame.empty(); });
+            input = queueFrame.back();
+            queueFrame.pop_back();
+            cvQueue.notify_all();
+        }
+        if (!input)
+            break;
+        if (status >= 0) {
+            input->pts = encodeFrameCount++;
+            status = avcodec_send_frame(videoCodecContext, input);
+            if (status >= 0) {
+                status = WritePackets(pkt);
+            }
+            if (status < 0) {
+                vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaRendition::EncodeLoop: %dx%d encode failed (%4.4s:0x%08x:%d) for frame:%d\n", width, height, &status, status, status, encodeFrameCount);
+                std::unique_lock<std::mutex> lock(mutexQueue);
+                failed = true;
+                cvQueue.notify_all();
+            }
+        }
+    }
+    // process the delayed frames
+    if (status >= 0) {
+        status = avcodec_send_frame(videoCodecContext, nullptr);
+        if (status >= 0) {
+            status = WritePackets(pkt);
+        }
+        if (status < 0) {
+            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaRendition::EncodeLoop: %dx%d encode failed (%4.4s:%d) at the end\n", width, height, &status, status);
+            failed = true;
+        }
+    }
+    av_packet_free(&pkt);
+}
+
+void CLoomIoMediaAbrEncoder::PushCommand(CLoomIoMediaAbrEncoder::command cmd)
+{
+    std::unique_lock<std::mutex> lock(mutexCmd);
+    queueCmd.push_front(cmd);
+    cvCmd.notify_one();
+}
+
+CLoomIoMediaAbrEncoder::command CLoomIoMediaAbrEncoder::PopCommand()
+{
+    std::unique_lock<std::mutex> lock(mutexCmd);
+    cvCmd.wait(lock, [=] { return !queueCmd.empty(); });
+    command cmd = std::move(queueCmd.back());
+    queueCmd.pop_back();
+    return cmd;
+}
+
+void CLoomIoMediaAbrEncoder::PushAck(int ack)
+{
+    std::unique_lock<std::mutex> lock(mutexAck);
+    queueAck.push_front(ack);
+    cvAck.notify_one();
+}
+
+int CLoomIoMediaAbrEncoder::PopAck()
+{
+    std::unique_lock<std::mutex> lock(mutexAck);
+    cvAck.wait(lock, [=] { return !queueAck.empty(); });
+    int ack = std::move(queueAck.back());
+    queueAck.pop_back();
+    return ack;
+}
+
+CLoomIoMediaAbrEncoder::CLoomIoMediaAbrEncoder(vx_node node_, const char ioConfig_[], vx_uint32 width_, vx_uint32 height_, vx_df_image format_)
+    : node{ node_ }, ioConfig(ioConfig_), width{ width_ }, height{ height_ }, format{ format_ }, inputFormat{ AV_PIX_FMT_UYVY422 },
+      thread{ nullptr }, threadTerminated{ false }, inputFrameCount{ 0 }, scaleFrameCount{ 0 }
+{
+}
+
+CLoomIoMediaAbrEncoder::~CLoomIoMediaAbrEncoder()
+{
+    // terminate the thread
+    if (thread) {
+        PushCommand(cmd_abort);
+        while (!threadTerminated) {
+            if (PopAck() < 0)
+                break;
+        }
+        thread->join();
+        delete thread;
+    }
+    // flush and close all renditions
+    for (size_t i = 0; i < renditions.size(); i++) {
+        delete renditions[i];
+    }
+    for (size_t i = 0; i < inputBuffer.size(); i++) {
+        if (inputBuffer[i].data[0]) {
+            av_freep(&inputBuffer[i].data[0]);
+        }
+    }
+}
+
+vx_status CLoomIoMediaAbrEncoder::Initialize()
+{
+    if (format == VX_DF_IMAGE_NV12) {
+        inputFormat = AV_PIX_FMT_NV12;
+    }
+    else if (format == VX_DF_IMAGE_UYVY) {
+        inputFormat = AV_PIX_FMT_UYVY422;
+    }
+    else if (format == VX_DF_IMAGE_YUYV) {
+        inputFormat = AV_PIX_FMT_YUYV422;
+    }
+    else if (format == VX_DF_IMAGE_RGB) {
+        inputFormat = AV_PIX_FMT_RGB24;
+    }
+    else {
+        vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_FORMAT, "ERROR: input image format %4.4s not supported", &format);
+        return VX_ERROR_INVALID_FORMAT;
+    }
+
+    // get the renditions: "filename,width,height[,mbps,fps,bframes,gopsize]" separated by ';'
+    ERROR_CHECK_STATUS(initialize_ffmpeg());
+    std::vector<std::string> outputs = split(ioConfig, ';');
+    for (size_t i = 0; i < outputs.size(); i++) {
+        std::vector<std::string> mediainfo = split(outputs[i], ',');
+        if (mediainfo.size() != 3 && mediainfo.size() != 7) {
+            vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_LINK, "ERROR: invalid rendition: %s\nERROR: valid syntax: filename,width,height[,mbps,fps,bframes,gopsize]", outputs[i].c_str());
+            return VX_ERROR_INVALID_LINK;
+        }
+        int outWidth = atoi(mediainfo[1].c_str()), outHeight = atoi(mediainfo[2].c_str());
+        float mbps = DEFAULT_MBPS, fps = DEFAULT_FPS;
+        int bframes = DEFAULT_BFRAMES, gopsize = DEFAULT_GOPSIZE;
+        if (mediainfo.size() == 7) {
+            mbps = atof(mediainfo[3].c_str());
+            fps = atof(mediainfo[4].c_str());
+            bframes = atoi(mediainfo[5].c_str());
+            gopsize = atoi(mediainfo[6].c_str());
+        }
+        if (outWidth <= 0 || outHeight <= 0 || (outWidth & 1) || (outHeight & 1) || outWidth > (int)width || outHeight > (int)height) {
+            vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_DIMENSION, "ERROR: invalid rendition size %dx%d for %dx%d input", outWidth, outHeight, width, height);
+            return VX_ERROR_INVALID_DIMENSION;
+        }
+        renditions.push_back(new CLoomIoMediaRendition(node, mediainfo[0], outWidth, outHeight, mbps, fps, bframes, gopsize));
+    }
+    if (renditions.empty()) {
+        vxAddLogEntry((vx_reference)node, VX_ERROR_INVALID_LINK, "ERROR: invalid input arguments");
+        return VX_ERROR_INVALID_LINK;
+    }
+
+    // build the scaling pyramid: only the largest rendition is converted from the input image
+    std::stable_sort(renditions.begin(), renditions.end(), [](const CLoomIoMediaRendition * a, const CLoomIoMediaRendition * b) {
+        return a->Width() * a->Height() > b->Width() * b->Height();
+    });
+    for (size_t i = 0; i < renditions.size(); i++) {
+        if (i == 0) {
+            ERROR_CHECK_STATUS(renditions[i]->Initialize(inputFormat, width, height));
+        }
+        else {
+            ERROR_CHECK_STATUS(renditions[i]->Initialize(AV_PIX_FMT_YUV420P, renditions[i - 1]->Width(), renditions[i - 1]->Height()));
+        }
+    }
+
+    // input images are copied into these buffers and converted on the scaler thread
+    LoomIoMediaAbrEncoderInputBuffer buf = { { nullptr }, { 0 } };
+    inputBuffer.assign(ENCODE_BUFFER_POOL_SIZE, buf);
+    for (size_t i = 0; i < inputBuffer.size(); i++) {
+        int status = av_image_alloc(inputBuffer[i].data, inputBuffer[i].linesize, width, height, inputFormat, 32);
+        if (status < 0) {
+            vxAddLogEntry((vx_reference)node, VX_ERROR_NO_MEMORY, "ERROR: CLoomIoMediaAbrEncoder::Initialize: av_image_alloc() failed (%d)", status);
+            return VX_ERROR_NO_MEMORY;
+        }
+    }
+
+    // start encoder threads and scaler thread
+    for (size_t i = 0; i < renditions.size(); i++) {
+        ERROR_CHECK_STATUS(renditions[i]->Start());
+    }
+    inputFrameCount = 0;
+    scaleFrameCount = 0;
+    threadTerminated = false;
+    thread = new std::thread(&CLoomIoMediaAbrEncoder::ScaleLoop, this);
+    ERROR_CHECK_NULLPTR(thread);
+
+    return VX_SUCCESS;
+}
+
+vx_status CLoomIoMediaAbrEncoder::ProcessFrame(vx_image input_image, vx_array input_aux, vx_array output_aux)
+{
+    // wait until there is an ACK from scaler thread
+    int ack = PopAck();
+    if ((ack < 0) || threadTerminated)
+    { // nothing to process, so abandon the graph execution
+        return VX_ERROR_GRAPH_ABANDONED;
+    }
+
+    // copy input image into a buffer of the pool
+    int bufId = inputFrameCount % (int)inputBuffer.size(); inputFrameCount++;
+    vx_rectangle_t rect = { 0, 0, width, height };
+    vx_map_id map_id, map_id1;
+    vx_imagepatch_addressing_t addr;
+    uint8_t * ptr = nullptr;
+    const uint8_t *src_data[4] = {0};
+    int src_linesize[4] = {0};
+    ERROR_CHECK_STATUS(vxMapImagePatch(input_image, &rect, 0, &map_id, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    src_data[0] = ptr;
+    src_linesize[0] = addr.stride_y;
+    if (inputFormat == AV_PIX_FMT_NV12) {
+        ERROR_CHECK_STATUS(vxMapImagePatch(input_image, &rect, 1, &map_id1, &addr, (void **)&ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        src_data[1] = ptr;
+        src_linesize[1] = addr.stride_y;
+    }
+    av_image_copy(inputBuffer[bufId].data, inputBuffer[bufId].linesize, src_data, src_linesize, inputFormat, width, height);
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(input_image, map_id));
+    if (inputFormat == AV_PIX_FMT_NV12) {
+        ERROR_CHECK_STATUS(vxUnmapImagePatch(input_image, map_id1));
+    }
+    // submit encoding
+    PushCommand(cmd_encode);
+
+    // copy input aux data to output, if there is input aux data.
+    if (output_aux) {
+        ERROR_CHECK_STATUS(vxTruncateArray(output_aux, 0));
+        vx_size auxLength = 0;
+        if (input_aux) {
+            ERROR_CHECK_STATUS(vxQueryArray(input_aux, VX_ARRAY_NUMITEMS, &auxLength, sizeof(auxLength)));
+        }
+        if (auxLength > 0) {
+            vx_map_id aux_map_id;
+            vx_size aux_stride = 0;
+            void * aux_ptr = nullptr;
+            ERROR_CHECK_STATUS(vxMapArrayRange(input_aux, 0, auxLength, &aux_map_id, &aux_stride, &aux_ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, 0));
+            vx_status addStatus = vxAddArrayItems(output_aux, auxLength, aux_ptr, aux_stride);
+            ERROR_CHECK_STATUS(vxUnmapArrayRange(input_aux, aux_map_id));
+            ERROR_CHECK_STATUS(addStatus);
+        }
+    }
+
+    return VX_SUCCESS;
+}
+
+void CLoomIoMediaAbrEncoder::ScaleLoop()
+{
+    // initial ACK to inform producer for readiness
+    for (size_t i = 1; i < inputBuffer.size(); i++)
+        PushAck(0);
+
+    for (command cmd; !threadTerminated && ((cmd = PopCommand()) != cmd_abort);) {
+        int bufId = scaleFrameCount % (int)inputBuffer.size(); scaleFrameCount++;
+        int status = 0;
+        for (size_t i = 0; i < renditions.size() && status >= 0; i++) {
+            if (i == 0) {
+                status = renditions[i]->Scale(inputBuffer[bufId].data, inputBuffer[bufId].linesize, height);
+                // the input buffer is consumed, so the producer can reuse it
+                PushAck(0);
+            }
+            else {
+                AVFrame * src = renditions[i - 1]->Frame();
+                status = renditions[i]->Scale(src->data, src->linesize, src->height);
+            }
+        }
+        if (status < 0) {
+            vxAddLogEntry((vx_reference)node, VX_FAILURE, "ERROR: CLoomIoMediaAbrEncoder::ScaleLoop: sws_scale() failed (%d) for frame:%d\n", status, scaleFrameCount);
+            break;
+        }
+        // the renditions are encoded in parallel
+        bool failed = false;
+        for (size_t i = 0; i < renditions.size(); i++) {
+            renditions[i]->Submit();
+            failed = failed || renditions[i]->Failed();
+        }
+        if (failed)
+            break;
+    }
+    // mark termination and send ACK
+    threadTerminated = true;
+    PushAck(-1);
+}
+
+//! \brief The kernel execution.
+static vx_status VX_CALLBACK amd_media_encode_abr_kernel(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    // get encoder and input image
+    CLoomIoMediaAbrEncoder * encoder = nullptr;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &encoder, sizeof(encoder)));
+    if (!encoder) return VX_FAILURE;
+    return encoder->ProcessFrame((vx_image)parameters[1], (vx_array)parameters[2], (vx_array)parameters[3]);
+}
+
+//! \brief The kernel initializer.
+static vx_status VX_CALLBACK amd_media_encode_abr_initialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    // get input parameters
+    char ioConfig[VX_MAX_STRING_BUFFER_SIZE_AMD];
+    vx_uint32 width = 0, height = 0;
+    vx_df_image format = VX_DF_IMAGE_VIRT;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[0], ioConfig, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+
+    // create and initialize encoder
+    CLoomIoMediaAbrEncoder * encoder = new CLoomIoMediaAbrEncoder(node, ioConfig, width, height, format);
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &encoder, sizeof(encoder)));
+    ERROR_CHECK_STATUS(encoder->Initialize());
+
+    return VX_SUCCESS;
+}
+
+//! \brief The kernel deinitializer.
+static vx_status VX_CALLBACK amd_media_encode_abr_deinitialize(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+    // get encoder
+    CLoomIoMediaAbrEncoder * encoder = nullptr;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &encoder, sizeof(encoder)));
+
+    if (encoder) {
+        // release the resources
+        delete encoder;
+    }
+
+    return VX_SUCCESS;
+}
+
+//! \brief The input validator callback.
+static vx_status VX_CALLBACK amd_media_encode_abr_validate(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
+{
+    // make sure output renditions string
+    vx_enum type;
+    ERROR_CHECK_STATUS(vxQueryScalar((vx_scalar)parameters[0], VX_SCALAR_TYPE, &type, sizeof(type)));
+    if (type != VX_TYPE_STRING_AMD)
+        return VX_ERROR_INVALID_FORMAT;
+    // make sure input format is UYVY/YUYV/RGB/NV12
+    vx_df_image format = VX_DF_IMAGE_VIRT;
+    ERROR_CHECK_STATUS(vxQueryImage((vx_image)parameters[1], VX_IMAGE_FORMAT, &format, sizeof(format)));
+    if (format != VX_DF_IMAGE_UYVY && format != VX_DF_IMAGE_YUYV && format != VX_DF_IMAGE_RGB && format != VX_DF_IMAGE_NV12)
+        return VX_ERROR_INVALID_FORMAT;
+    // check input auxiliary data parameter
+    if (parameters[2]) {
+        vx_enum itemtype = VX_TYPE_INVALID;
+        ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[2], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+        if (itemtype != VX_TYPE_UINT8)
+            return VX_ERROR_INVALID_TYPE;
+    }
+    // check and set output auxiliary data parameter
+    if (parameters[3]) {
+        vx_enum itemtype = VX_TYPE_INVALID;
+        vx_size capacity = 0;
+        ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[3], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+        ERROR_CHECK_STATUS(vxQueryArray((vx_array)parameters[3], VX_ARRAY_CAPACITY, &capacity, sizeof(capacity)));
+        if (itemtype != VX_TYPE_UINT8)
+            return VX_ERROR_INVALID_TYPE;
+        ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[3], VX_ARRAY_ITEMTYPE, &itemtype, sizeof(itemtype)));
+        ERROR_CHECK_STATUS(vxSetMetaFormatAttribute(metas[3], VX_ARRAY_CAPACITY, &capacity, sizeof(capacity)));
+    }
+
+    return VX_SUCCESS;
+}
+
+//! \brief The kernel publisher.
+vx_status amd_media_encode_abr_publish(vx_context context)
+{
+    // add kernel to the context with callbacks
+    vx_kernel kernel = vxAddUserKernel(context, "com.amd.amd_media.encode_abr", AMDOVX_KERNEL_AMD_MEDIA_ENCODE_ABR,
+                            amd_media_encode_abr_kernel, 4, amd_media_encode_abr_validate,
+                            amd_media_encode_abr_initialize, amd_media_encode_abr_deinitialize);
+    ERROR_CHECK_OBJECT(kernel);
+
+    // set kernel parameters
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));  // renditions: "filename,width,height[,mbps,fps,bframes,gopsize];..."
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 1, VX_INPUT, VX_TYPE_IMAGE, VX_PARAMETER_STATE_REQUIRED));   // input image
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 2, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_OPTIONAL));   // input auxiliary data (optional)
+    ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 3, VX_OUTPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_OPTIONAL));  // output auxiliary data (optional)
+
+    // finalize and release kernel object
+    ERROR_CHECK_STATUS(vxFinalizeKernel(kernel));
+    ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+
+    return VX_SUCCESS;
+}
+
+VX_API_ENTRY vx_node VX_API_CALL amdMediaAbrEncoderNode(vx_graph graph, const char *output_str, vx_image input, vx_array aux_data_in, vx_array aux_data_out)
+{
+    vx_node node = NULL;
+    vx_context context = vxGetContext((vx_reference)graph);
+    if (vxGetStatus((vx_reference)context) == VX_SUCCESS) {
+        vx_scalar s_output = vxCreateScalar(context, VX_TYPE_STRING_AMD, output_str);
+        vx_reference params[] = {
+            (vx_reference)s_output,
+            (vx_reference)input,
+            (vx_reference)aux_data_in,
+            (vx_reference)aux_data_out,
+        };
+        if (vxGetStatus((vx_reference)s_output) == VX_SUCCESS) {
+            node = createMediaNode(graph, "com.amd.amd_media.encode_abr", params, sizeof(params) / sizeof(params[0])); // added node to graph
+            vxReleaseScalar(&s_output);
+        }
+    }
+    return node;
+}
@@ -40,12 +40,16 @@ extern "C"
 
     /*! \brief [Graph] Creates a decoder Node.
      * \ingroup group_amd_media
-     * @note - TBD
+     * @note - With enable_zero_copy, decoded NV12/IYUV frames are swapped into an output image created with
+     * vxCreateImageFromHandle instead of being copied, when no conversion or scaling is needed. Each frame
+     * stays valid until the next frame is decoded into the output image.
+     * @note - decode_mode selects the frames to output: "keyframes", "step:<N>" for every Nth frame or
+     * "seek:<t1>,<t2>,..." for the frames at the given timestamps in seconds. All frames are output by default.
      * \return <tt> vx_node</tt>.
      * \returns A node reference <tt>\ref vx_node</tt>. Any possible errors preventing a
      * successful creation should be checked using <tt>\ref vxGetStatus</tt>.
      */
-    VX_API_ENTRY vx_node VX_API_CALL amdMediaDecoderNode(vx_graph graph, const char *input_str, vx_image output, vx_array aux_data, vx_int32 loop_decode = 0, vx_bool enable_opencl_output = false, vx_int32 device_id = -1);
+    VX_API_ENTRY vx_node VX_API_CALL amdMediaDecoderNode(vx_graph graph, const char *input_str, vx_image output, vx_array aux_data, vx_int32 loop_decode = 0, vx_bool enable_opencl_output = false, vx_int32 device_id = -1, vx_bool enable_zero_copy = false, const char *decode_mode = nullptr);
 
     /*! \brief [Graph] Creates a encoder Layer Node.
      * \ingroup group_amd_media
@@ -56,6 +60,17 @@ extern "C"
      */
     VX_API_ENTRY vx_node VX_API_CALL amdMediaEncoderNode(vx_graph graph, const char *output_str, vx_image input, vx_array aux_data_in, vx_array aux_data_out, vx_bool enable_gpu_input = false);
 
+    /*! \brief [Graph] Creates an ABR ladder encoder Node that encodes one input image into several renditions.
+     * \ingroup group_amd_media
+     * @note - The renditions are given as "filename,width,height[,mbps,fps,bframes,gopsize]" separated by ';'.
+     * The input is color converted once and every rendition is scaled from the next larger one, and
+     * the renditions are encoded in parallel.
+     * \return <tt> vx_node</tt>.
+     * \returns A node reference <tt>\ref vx_node</tt>. Any possible errors preventing a
+     * successful creation should be checked using <tt>\ref vxGetStatus</tt>.
+     */
+    VX_API_ENTRY vx_node VX_API_CALL amdMediaAbrEncoderNode(vx_graph graph, const char *output_str, vx_image input, vx_array aux_data_in, vx_array aux_data_out);
+
 #ifdef __cplusplus
 }
 #endif
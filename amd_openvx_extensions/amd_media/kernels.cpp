@@ -34,6 +34,7 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
 	// register kernels
     ERROR_CHECK_STATUS(amd_media_decode_publish(context));
     ERROR_CHECK_STATUS(amd_media_encode_publish(context));
+    ERROR_CHECK_STATUS(amd_media_encode_abr_publish(context));
 	return VX_SUCCESS;
 }
 
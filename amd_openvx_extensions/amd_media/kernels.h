@@ -57,6 +57,8 @@ enum vx_kernel_amd_media_e {
     AMDOVX_KERNEL_AMD_MEDIA_DECODE = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_AMD_MEDIA) + 0x001,
     //! \brief The LOOMIO Media Encoder kernel. Kernel name is "com.amd.amd_media.encode".
     AMDOVX_KERNEL_AMD_MEDIA_ENCODE = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_AMD_MEDIA) + 0x002,
+    //! \brief The LOOMIO Media ABR ladder Encoder kernel. Kernel name is "com.amd.amd_media.encode_abr".
+    AMDOVX_KERNEL_AMD_MEDIA_ENCODE_ABR = VX_KERNEL_BASE(VX_ID_AMD, AMDOVX_LIBRARY_AMD_MEDIA) + 0x003,
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -71,6 +73,7 @@ enum vx_kernel_amd_media_e {
 //! \brief The kernel registration functions.
 vx_status amd_media_decode_publish(vx_context context);
 vx_status amd_media_encode_publish(vx_context context);
+vx_status amd_media_encode_abr_publish(vx_context context);
 vx_node createMediaNode(vx_graph graph, const char * kernelName, vx_reference params[], vx_uint32 num);
 
 //////////////////////////////////////////////////////////////////////
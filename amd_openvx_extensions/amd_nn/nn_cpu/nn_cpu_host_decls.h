@@ -0,0 +1,124 @@
+/*
+Copyright (c) 2015 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef NN_CPU_HOST_DECLS_H
+#define NN_CPU_HOST_DECLS_H
+#include <VX/vx.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// ----------------------------------------------------------------------------
+// Neural Network kernels for the CPU backend (FP32, NCHW tensors)
+// ----------------------------------------------------------------------------
+
+// instruction set used by the GEMM micro-kernels (selected at runtime, can be
+// capped with the NN_CPU_ISA environment variable: sse, avx2, or avx512)
+enum NNCpuIsa {
+    NN_CPU_ISA_SSE    = 0,
+    NN_CPU_ISA_AVX2   = 1,
+    NN_CPU_ISA_AVX512 = 2,
+};
+
+// activation fused into the GEMM epilogue
+enum NNCpuActivation {
+    NN_CPU_ACTIVATION_NONE       = 0,
+    NN_CPU_ACTIVATION_RELU       = 1,
+    NN_CPU_ACTIVATION_LEAKY_RELU = 2,
+};
+
+//! \brief Fixed-size worker pool shared by all CPU nodes of a graph.
+//  The thread count defaults to std::thread::hardware_concurrency() and can be
+//  overridden with the NN_CPU_NUM_THREADS environment variable.
+class NNCpuThreadPool {
+public:
+    explicit NNCpuThreadPool(int numThreads);
+    ~NNCpuThreadPool();
+    int numThreads() const { return (int)m_workers.size() + 1; }
+    // run func(item) for item in [0, count) on all workers and the calling thread
+    void parallelFor(int count, const std::function<void(int)>& func);
+private:
+    void workerLoop();
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::mutex m_runLock;
+    std::condition_variable m_cvWork;
+    std::condition_variable m_cvDone;
+    const std::function<void(int)> * m_func;
+    int m_count;
+    int m_next;
+    int m_pending;
+    bool m_exit;
+};
+
+//! \brief Convolution layer configuration (dims follow the OpenVX WHCN order of the tensors).
+struct NNCpuConvolutionConfig {
+    int N, IC, IH, IW;
+    int OC, OH, OW;
+    int KH, KW;
+    int stride_h, stride_w;
+    int pad_h, pad_w;
+    int dilation_h, dilation_w;
+    int groups;
+    int activation;         // NNCpuActivation
+    float leaky_alpha;
+};
+
+//! \brief Convolution engine: weights are packed once into output-channel blocked
+//  panels (OIhw[MR]o) and the input is gathered into [K][NR] pixel panels per tile,
+//  so the micro-kernel streams both operands contiguously.
+struct NNCpuConvolution {
+    NNCpuConvolutionConfig cfg;
+    int isa;
+    int K;                  // (IC/groups) * KH * KW
+    int OCg;                // output channels per group
+    int ocBlocks;           // ceil(OCg/MR) per group
+    bool direct;            // 1x1, stride 1, no padding: pixel panels are plain row copies
+    std::vector<float> packedWeights;
+    std::vector<float> bias;
+};
+
+//! \brief Fully connected layer engine: weights are packed into [K][NR] output-neuron panels.
+struct NNCpuFullyConnected {
+    int N, K, OC;
+    int isa;
+    int ocBlocks;
+    std::vector<float> packedWeights;
+    std::vector<float> bias;
+};
+
+int nnCpuGetIsa();
+int nnCpuGetNumThreads();
+
+int CpuInit_Convolution_layer(NNCpuConvolution * conv, const NNCpuConvolutionConfig& cfg, const float * weights, const float * bias);
+int CpuExec_Convolution_layer(NNCpuThreadPool * pool, const NNCpuConvolution * conv, const float * in, float * out);
+
+int CpuInit_FullyConnected_layer(NNCpuFullyConnected * fc, int N, int K, int OC, const float * weights, const float * bias);
+int CpuExec_FullyConnected_layer(NNCpuThreadPool * pool, const NNCpuFullyConnected * fc, const float * in, float * out);
+
+int CpuExec_Pooling_layer(NNCpuThreadPool * pool, bool maxPool, int N, int C, int IH, int IW, int OH, int OW,
+    int kernel_h, int kernel_w, int stride_h, int stride_w, int pad_h, int pad_w, bool relu, const float * in, float * out);
+
+int CpuExec_Activation_layer(NNCpuThreadPool * pool, vx_enum function, float a, float b, size_t count, const float * in, float * out);
+
+#endif //NN_CPU_HOST_DECLS_H
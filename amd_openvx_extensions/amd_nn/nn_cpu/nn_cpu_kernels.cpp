@@ -0,0 +1,573 @@
+/*
+Copyright (c) 2015 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "nn_cpu_host_decls.h"
+#include <VX/vx_khr_nn.h>
+#include <vx_ext_amd.h>
+#include <immintrin.h>
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+#include <algorithm>
+
+// ----------------------------------------------------------------------------
+// Neural Network kernels for CPU backend
+// ----------------------------------------------------------------------------
+
+// micro-kernel tile: MR output channels (rows) x NR pixels (columns)
+#define NN_CPU_GEMM_MR        4
+#define NN_CPU_GEMM_NR_MAX    32
+
+#if defined(__GNUC__) && !_WIN32
+#define NN_CPU_TARGET_AVX2    __attribute__((target("avx2,fma")))
+#define NN_CPU_TARGET_AVX512  __attribute__((target("avx512f")))
+#define NN_CPU_ENABLE_AVX     1
+#else
+#define NN_CPU_ENABLE_AVX     0
+#endif
+
+// ----------------------------------------------------------------------------
+// thread pool
+// ----------------------------------------------------------------------------
+
+NNCpuThreadPool::NNCpuThreadPool(int numThreads)
+    : m_func(nullptr), m_count(0), m_next(0), m_pending(0), m_exit(false)
+{
+    for (int i = 1; i < numThreads; i++) {
+        m_workers.emplace_back(&NNCpuThreadPool::workerLoop, this);
+    }
+}
+
+NNCpuThreadPool::~NNCpuThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+    }
+    m_cvWork.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void NNCpuThreadPool::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_cvWork.wait(lock, [this] { return m_exit || m_next < m_count; });
+        if (m_exit)
+            return;
+        while (m_next < m_count) {
+            int item = m_next++;
+            const std::function<void(int)> * func = m_func;
+            lock.unlock();
+            (*func)(item);
+            lock.lock();
+            if (--m_pending == 0)
+                m_cvDone.notify_all();
+        }
+    }
+}
+
+void NNCpuThreadPool::parallelFor(int count, const std::function<void(int)>& func)
+{
+    if (count <= 0)
+        return;
+    if (m_workers.empty() || count == 1) {
+        for (int item = 0; item < count; item++)
+            func(item);
+        return;
+    }
+    // nodes of a graph execute one at a time, but keep the pool safe for concurrent callers
+    std::lock_guard<std::mutex> run(m_runLock);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_func = &func;
+    m_next = 0;
+    m_pending = count;
+    m_count = count;
+    m_cvWork.notify_all();
+    while (m_next < m_count) {
+        int item = m_next++;
+        lock.unlock();
+        func(item);
+        lock.lock();
+        --m_pending;
+    }
+    m_cvDone.wait(lock, [this] { return m_pending == 0; });
+    m_func = nullptr;
+    m_count = 0;
+    m_next = 0;
+}
+
+// ----------------------------------------------------------------------------
+// runtime configuration
+// ----------------------------------------------------------------------------
+
+static int nnCpuDetectIsa()
+{
+    int isa = NN_CPU_ISA_SSE;
+#if NN_CPU_ENABLE_AVX
+    // AVX2 is detected with the same probe as the OpenVX CPU kernels, the wider ISA only extends it
+    __builtin_cpu_init();
+    if (vxIsCpuAvx2Supported() && __builtin_cpu_supports("fma")) {
+        isa = __builtin_cpu_supports("avx512f") ? NN_CPU_ISA_AVX512 : NN_CPU_ISA_AVX2;
+    }
+#endif
+    const char * text = getenv("NN_CPU_ISA");
+    if (text) {
+        int cap = isa;
+        if (!strcmp(text, "sse")) cap = NN_CPU_ISA_SSE;
+        else if (!strcmp(text, "avx2")) cap = NN_CPU_ISA_AVX2;
+        else if (!strcmp(text, "avx512")) cap = NN_CPU_ISA_AVX512;
+        isa = std::min(isa, cap);
+    }
+    return isa;
+}
+
+int nnCpuGetIsa()
+{
+    static int isa = nnCpuDetectIsa();
+    return isa;
+}
+
+int nnCpuGetNumThreads()
+{
+    int numThreads = (int)std::thread::hardware_concurrency();
+    const char * text = getenv("NN_CPU_NUM_THREADS");
+    if (text && atoi(text) > 0) {
+        numThreads = atoi(text);
+    }
+    return std::max(numThreads, 1);
+}
+
+static inline int nnCpuGemmNR(int isa)
+{
+    return (isa == NN_CPU_ISA_AVX512) ? 32 : ((isa == NN_CPU_ISA_AVX2) ? 16 : 8);
+}
+
+// ----------------------------------------------------------------------------
+// GEMM micro-kernels: c[MR][NR] = sum_k a[k][MR] * b[k][NR]
+// ----------------------------------------------------------------------------
+
+static void nnCpuGemmKernel_SSE(int K, const float * a, const float * b, float * c)
+{
+    __m128 c00 = _mm_setzero_ps(), c01 = _mm_setzero_ps();
+    __m128 c10 = _mm_setzero_ps(), c11 = _mm_setzero_ps();
+    __m128 c20 = _mm_setzero_ps(), c21 = _mm_setzero_ps();
+    __m128 c30 = _mm_setzero_ps(), c31 = _mm_setzero_ps();
+    for (int k = 0; k < K; k++, a += NN_CPU_GEMM_MR, b += 8) {
+        __m128 b0 = _mm_loadu_ps(b), b1 = _mm_loadu_ps(b + 4);
+        __m128 a0 = _mm_set1_ps(a[0]);
+        c00 = _mm_add_ps(c00, _mm_mul_ps(a0, b0)); c01 = _mm_add_ps(c01, _mm_mul_ps(a0, b1));
+        __m128 a1 = _mm_set1_ps(a[1]);
+        c10 = _mm_add_ps(c10, _mm_mul_ps(a1, b0)); c11 = _mm_add_ps(c11, _mm_mul_ps(a1, b1));
+        __m128 a2 = _mm_set1_ps(a[2]);
+        c20 = _mm_add_ps(c20, _mm_mul_ps(a2, b0)); c21 = _mm_add_ps(c21, _mm_mul_ps(a2, b1));
+        __m128 a3 = _mm_set1_ps(a[3]);
+        c30 = _mm_add_ps(c30, _mm_mul_ps(a3, b0)); c31 = _mm_add_ps(c31, _mm_mul_ps(a3, b1));
+    }
+    _mm_storeu_ps(c +  0, c00); _mm_storeu_ps(c +  4, c01);
+    _mm_storeu_ps(c +  8, c10); _mm_storeu_ps(c + 12, c11);
+    _mm_storeu_ps(c + 16, c20); _mm_storeu_ps(c + 20, c21);
+    _mm_storeu_ps(c + 24, c30); _mm_storeu_ps(c + 28, c31);
+}
+
+#if NN_CPU_ENABLE_AVX
+NN_CPU_TARGET_AVX2 static void nnCpuGemmKernel_AVX2(int K, const float * a, const float * b, float * c)
+{
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    for (int k = 0; k < K; k++, a += NN_CPU_GEMM_MR, b += 16) {
+        __m256 b0 = _mm256_loadu_ps(b), b1 = _mm256_loadu_ps(b + 8);
+        __m256 a0 = _mm256_broadcast_ss(a + 0);
+        c00 = _mm256_fmadd_ps(a0, b0, c00); c01 = _mm256_fmadd_ps(a0, b1, c01);
+        __m256 a1 = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(a1, b0, c10); c11 = _mm256_fmadd_ps(a1, b1, c11);
+        __m256 a2 = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(a2, b0, c20); c21 = _mm256_fmadd_ps(a2, b1, c21);
+        __m256 a3 = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(a3, b0, c30); c31 = _mm256_fmadd_ps(a3, b1, c31);
+    }
+    _mm256_storeu_ps(c +  0, c00); _mm256_storeu_ps(c +  8, c01);
+    _mm256_storeu_ps(c + 16, c10); _mm256_storeu_ps(c + 24, c11);
+    _mm256_storeu_ps(c + 32, c20); _mm256_storeu_ps(c + 40, c21);
+    _mm256_storeu_ps(c + 48, c30); _mm256_storeu_ps(c + 56, c31);
+}
+
+NN_CPU_TARGET_AVX512 static void nnCpuGemmKernel_AVX512(int K, const float * a, const float * b, float * c)
+{
+    __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+    __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+    __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+    __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+    for (int k = 0; k < K; k++, a += NN_CPU_GEMM_MR, b += 32) {
+        __m512 b0 = _mm512_loadu_ps(b), b1 = _mm512_loadu_ps(b + 16);
+        __m512 a0 = _mm512_set1_ps(a[0]);
+        c00 = _mm512_fmadd_ps(a0, b0, c00); c01 = _mm512_fmadd_ps(a0, b1, c01);
+        __m512 a1 = _mm512_set1_ps(a[1]);
+        c10 = _mm512_fmadd_ps(a1, b0, c10); c11 = _mm512_fmadd_ps(a1, b1, c11);
+        __m512 a2 = _mm512_set1_ps(a[2]);
+        c20 = _mm512_fmadd_ps(a2, b0, c20); c21 = _mm512_fmadd_ps(a2, b1, c21);
+        __m512 a3 = _mm512_set1_ps(a[3]);
+        c30 = _mm512_fmadd_ps(a3, b0, c30); c31 = _mm512_fmadd_ps(a3, b1, c31);
+    }
+    _mm512_storeu_ps(c +  0, c00); _mm512_storeu_ps(c +  16, c01);
+    _mm512_storeu_ps(c + 32, c10); _mm512_storeu_ps(c +  48, c11);
+    _mm512_storeu_ps(c + 64, c20); _mm512_storeu_ps(c +  80, c21);
+    _mm512_storeu_ps(c + 96, c30); _mm512_storeu_ps(c + 112, c31);
+}
+#endif
+
+static inline void nnCpuGemmKernel(int isa, int K, const float * a, const float * b, float * c)
+{
+#if NN_CPU_ENABLE_AVX
+    if (isa == NN_CPU_ISA_AVX512)
+        nnCpuGemmKernel_AVX512(K, a, b, c);
+    else if (isa == NN_CPU_ISA_AVX2)
+        nnCpuGemmKernel_AVX2(K, a, b, c);
+    else
+#endif
+        nnCpuGemmKernel_SSE(K, a, b, c);
+}
+
+static inline float nnCpuActivate(float v, int activation, float alpha)
+{
+    if (activation == NN_CPU_ACTIVATION_RELU)
+        return v > 0.0f ? v : 0.0f;
+    else if (activation == NN_CPU_ACTIVATION_LEAKY_RELU)
+        return v > 0.0f ? v : v * alpha;
+    return v;
+}
+
+// write the valid part of a micro-kernel tile with bias (per row or per column) and activation
+static void nnCpuStoreTile(const float * tile, int NR, float * dst, size_t ldd, int rows, int cols,
+    const float * biasRow, const float * biasCol, int activation, float alpha)
+{
+    for (int r = 0; r < rows; r++) {
+        const float * src = tile + r * NR;
+        float * out = dst + r * ldd;
+        float br = biasRow ? biasRow[r] : 0.0f;
+        for (int j = 0; j < cols; j++) {
+            float v = src[j] + br + (biasCol ? biasCol[j] : 0.0f);
+            out[j] = nnCpuActivate(v, activation, alpha);
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// convolution
+// ----------------------------------------------------------------------------
+
+int CpuInit_Convolution_layer(NNCpuConvolution * conv, const NNCpuConvolutionConfig& cfg, const float * weights, const float * bias)
+{
+    if (cfg.groups < 1 || (cfg.IC % cfg.groups) || (cfg.OC % cfg.groups))
+        return -1;
+    conv->cfg = cfg;
+    conv->isa = nnCpuGetIsa();
+    conv->K = (cfg.IC / cfg.groups) * cfg.KH * cfg.KW;
+    conv->OCg = cfg.OC / cfg.groups;
+    conv->ocBlocks = (conv->OCg + NN_CPU_GEMM_MR - 1) / NN_CPU_GEMM_MR;
+    conv->direct = (cfg.KH == 1 && cfg.KW == 1 && cfg.stride_h == 1 && cfg.stride_w == 1 && cfg.pad_h == 0 && cfg.pad_w == 0);
+
+    // pack weights [OC][K] into [groups][ocBlocks][K][MR] panels (zero padded)
+    const int K = conv->K, MR = NN_CPU_GEMM_MR;
+    conv->packedWeights.assign((size_t)cfg.groups * conv->ocBlocks * K * MR, 0.0f);
+    for (int g = 0; g < cfg.groups; g++) {
+        for (int ob = 0; ob < conv->ocBlocks; ob++) {
+            float * panel = &conv->packedWeights[((size_t)g * conv->ocBlocks + ob) * K * MR];
+            for (int r = 0; r < MR; r++) {
+                int oc = ob * MR + r;
+                if (oc >= conv->OCg)
+                    break;
+                const float * w = weights + (size_t)(g * conv->OCg + oc) * K;
+                for (int k = 0; k < K; k++) {
+                    panel[k * MR + r] = w[k];
+                }
+            }
+        }
+    }
+    conv->bias.assign(cfg.OC, 0.0f);
+    if (bias) {
+        memcpy(conv->bias.data(), bias, cfg.OC * sizeof(float));
+    }
+    return 0;
+}
+
+// gather the [K][NR] input panel for pixels [p0, p0+cols) of image plane set 'in'
+static void nnCpuConvPackInput(const NNCpuConvolution * conv, const float * in, int p0, int cols, int NR, float * panel)
+{
+    const NNCpuConvolutionConfig& cfg = conv->cfg;
+    const int KHW = cfg.KH * cfg.KW;
+    const size_t planeSize = (size_t)cfg.IH * cfg.IW;
+    if (conv->direct) {
+        for (int k = 0; k < conv->K; k++) {
+            float * dst = panel + k * NR;
+            memcpy(dst, in + k * planeSize + p0, cols * sizeof(float));
+            if (cols < NR)
+                memset(dst + cols, 0, (NR - cols) * sizeof(float));
+        }
+        return;
+    }
+    const int oh0 = p0 / cfg.OW, ow0 = p0 % cfg.OW;
+    for (int k = 0; k < conv->K; k++) {
+        int ic = k / KHW, r = k % KHW;
+        int kh = r / cfg.KW, kw = r % cfg.KW;
+        const float * src = in + ic * planeSize;
+        float * dst = panel + k * NR;
+        int oh = oh0, ow = ow0;
+        for (int j = 0; j < cols; j++) {
+            int ih = oh * cfg.stride_h - cfg.pad_h + kh * cfg.dilation_h;
+            int iw = ow * cfg.stride_w - cfg.pad_w + kw * cfg.dilation_w;
+            dst[j] = (ih >= 0 && ih < cfg.IH && iw >= 0 && iw < cfg.IW) ? src[ih * cfg.IW + iw] : 0.0f;
+            if (++ow == cfg.OW) {
+                ow = 0;
+                oh++;
+            }
+        }
+        for (int j = cols; j < NR; j++) {
+            dst[j] = 0.0f;
+        }
+    }
+}
+
+int CpuExec_Convolution_layer(NNCpuThreadPool * pool, const NNCpuConvolution * conv, const float * in, float * out)
+{
+    const NNCpuConvolutionConfig& cfg = conv->cfg;
+    const int MR = NN_CPU_GEMM_MR, NR = nnCpuGemmNR(conv->isa);
+    const int P = cfg.OH * cfg.OW;
+    const int pBlocks = (P + NR - 1) / NR;
+    const int ICg = cfg.IC / cfg.groups;
+
+    // work items: batch x group x pixel tile, split further over output channel blocks
+    // when there are not enough pixel tiles to keep every thread busy
+    int ocSplit = 1;
+    const int numThreads = pool ? pool->numThreads() : 1;
+    while ((cfg.N * cfg.groups * pBlocks * ocSplit) < 2 * numThreads && ocSplit * 2 <= conv->ocBlocks)
+        ocSplit *= 2;
+    const int ocBlocksPerSplit = (conv->ocBlocks + ocSplit - 1) / ocSplit;
+    const int numItems = cfg.N * cfg.groups * pBlocks * ocSplit;
+
+    auto work = [&](int item) {
+        int os = item % ocSplit; item /= ocSplit;
+        int pb = item % pBlocks; item /= pBlocks;
+        int g = item % cfg.groups;
+        int n = item / cfg.groups;
+        int p0 = pb * NR, cols = std::min(NR, P - p0);
+
+        thread_local std::vector<float> panel;
+        if (panel.size() < (size_t)conv->K * NR)
+            panel.resize((size_t)conv->K * NR);
+        float tile[NN_CPU_GEMM_MR * NN_CPU_GEMM_NR_MAX];
+
+        const float * src = in + ((size_t)n * cfg.IC + g * ICg) * cfg.IH * cfg.IW;
+        nnCpuConvPackInput(conv, src, p0, cols, NR, panel.data());
+
+        int obEnd = std::min(conv->ocBlocks, (os + 1) * ocBlocksPerSplit);
+        for (int ob = os * ocBlocksPerSplit; ob < obEnd; ob++) {
+            const float * weights = &conv->packedWeights[((size_t)g * conv->ocBlocks + ob) * conv->K * MR];
+            nnCpuGemmKernel(conv->isa, conv->K, weights, panel.data(), tile);
+            int oc = g * conv->OCg + ob * MR;
+            int rows = std::min(MR, conv->OCg - ob * MR);
+            float * dst = out + ((size_t)n * cfg.OC + oc) * P + p0;
+            nnCpuStoreTile(tile, NR, dst, P, rows, cols, &conv->bias[oc], nullptr, cfg.activation, cfg.leaky_alpha);
+        }
+    };
+    if (pool) {
+        pool->parallelFor(numItems, work);
+    }
+    else {
+        for (int item = 0; item < numItems; item++)
+            work(item);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// fully connected
+// ----------------------------------------------------------------------------
+
+int CpuInit_FullyConnected_layer(NNCpuFullyConnected * fc, int N, int K, int OC, const float * weights, const float * bias)
+{
+    fc->N = N;
+    fc->K = K;
+    fc->OC = OC;
+    fc->isa = nnCpuGetIsa();
+    const int NR = nnCpuGemmNR(fc->isa);
+    fc->ocBlocks = (OC + NR - 1) / NR;
+
+    // pack weights [OC][K] into [ocBlocks][K][NR] panels (zero padded)
+    fc->packedWeights.assign((size_t)fc->ocBlocks * K * NR, 0.0f);
+    for (int o = 0; o < OC; o++) {
+        float * panel = &fc->packedWeights[(size_t)(o / NR) * K * NR + (o % NR)];
+        const float * w = weights + (size_t)o * K;
+        for (int k = 0; k < K; k++) {
+            panel[k * NR] = w[k];
+        }
+    }
+    fc->bias.assign(OC, 0.0f);
+    if (bias) {
+        memcpy(fc->bias.data(), bias, OC * sizeof(float));
+    }
+    return 0;
+}
+
+int CpuExec_FullyConnected_layer(NNCpuThreadPool * pool, const NNCpuFullyConnected * fc, const float * in, float * out)
+{
+    const int MR = NN_CPU_GEMM_MR, NR = nnCpuGemmNR(fc->isa);
+    const int K = fc->K;
+    const int nBlocks = (fc->N + MR - 1) / MR;
+    const int numItems = nBlocks * fc->ocBlocks;
+
+    auto work = [&](int item) {
+        int ob = item % fc->ocBlocks;
+        int nb = item / fc->ocBlocks;
+        int rows = std::min(MR, fc->N - nb * MR);
+        int cols = std::min(NR, fc->OC - ob * NR);
+
+        thread_local std::vector<float> panel;
+        if (panel.size() < (size_t)K * MR)
+            panel.resize((size_t)K * MR);
+        float tile[NN_CPU_GEMM_MR * NN_CPU_GEMM_NR_MAX];
+
+        // pack the input rows of this batch block into [K][MR]
+        for (int r = 0; r < MR; r++) {
+            const float * src = in + (size_t)(nb * MR + r) * K;
+            for (int k = 0; k < K; k++) {
+                panel[k * MR + r] = (r < rows) ? src[k] : 0.0f;
+            }
+        }
+        nnCpuGemmKernel(fc->isa, K, panel.data(), &fc->packedWeights[(size_t)ob * K * NR], tile);
+        float * dst = out + (size_t)nb * MR * fc->OC + ob * NR;
+        nnCpuStoreTile(tile, NR, dst, fc->OC, rows, cols, nullptr, &fc->bias[ob * NR], NN_CPU_ACTIVATION_NONE, 0.0f);
+    };
+    if (pool) {
+        pool->parallelFor(numItems, work);
+    }
+    else {
+        for (int item = 0; item < numItems; item++)
+            work(item);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// pooling
+// ----------------------------------------------------------------------------
+
+int CpuExec_Pooling_layer(NNCpuThreadPool * pool, bool maxPool, int N, int C, int IH, int IW, int OH, int OW,
+    int kernel_h, int kernel_w, int stride_h, int stride_w, int pad_h, int pad_w, bool relu, const float * in, float * out)
+{
+    auto work = [&](int plane) {
+        const float * src = in + (size_t)plane * IH * IW;
+        float * dst = out + (size_t)plane * OH * OW;
+        for (int oh = 0; oh < OH; oh++) {
+            int hstart = oh * stride_h - pad_h;
+            int hend = std::min(hstart + kernel_h, IH);
+            hstart = std::max(hstart, 0);
+            for (int ow = 0; ow < OW; ow++) {
+                int wstart = ow * stride_w - pad_w;
+                int wend = std::min(wstart + kernel_w, IW);
+                wstart = std::max(wstart, 0);
+                float v;
+                if (maxPool) {
+                    v = -FLT_MAX;
+                    for (int ih = hstart; ih < hend; ih++)
+                        for (int iw = wstart; iw < wend; iw++)
+                            v = std::max(v, src[ih * IW + iw]);
+                }
+                else {
+                    // average excludes the padded elements
+                    float sum = 0.0f;
+                    for (int ih = hstart; ih < hend; ih++)
+                        for (int iw = wstart; iw < wend; iw++)
+                            sum += src[ih * IW + iw];
+                    int count = (hend - hstart) * (wend - wstart);
+                    v = (count > 0) ? sum / count : 0.0f;
+                }
+                dst[oh * OW + ow] = (relu && v < 0.0f) ? 0.0f : v;
+            }
+        }
+    };
+    if (pool) {
+        pool->parallelFor(N * C, work);
+    }
+    else {
+        for (int plane = 0; plane < N * C; plane++)
+            work(plane);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// activation
+// ----------------------------------------------------------------------------
+
+static void nnCpuActivationRange(vx_enum function, float a, const float * in, float * out, size_t count)
+{
+    size_t i = 0;
+    if (function == VX_NN_ACTIVATION_RELU || function == VX_NN_ACTIVATION_LEAKY_RELU) {
+        float slope = (function == VX_NN_ACTIVATION_LEAKY_RELU) ? a : 0.0f;
+        __m128 zero = _mm_setzero_ps(), mslope = _mm_set1_ps(slope);
+        for (; i + 4 <= count; i += 4) {
+            __m128 v = _mm_loadu_ps(in + i);
+            __m128 pos = _mm_max_ps(v, zero);
+            __m128 neg = _mm_mul_ps(_mm_min_ps(v, zero), mslope);
+            _mm_storeu_ps(out + i, _mm_add_ps(pos, neg));
+        }
+        for (; i < count; i++) {
+            out[i] = in[i] > 0.0f ? in[i] : in[i] * slope;
+        }
+    }
+    else if (function == VX_NN_ACTIVATION_ABS) {
+        for (; i < count; i++) out[i] = fabsf(in[i]);
+    }
+    else if (function == VX_NN_ACTIVATION_LOGISTIC) {
+        for (; i < count; i++) out[i] = 1.0f / (1.0f + expf(-in[i]));
+    }
+    else if (function == VX_NN_ACTIVATION_HYPERBOLIC_TAN) {
+        for (; i < count; i++) out[i] = tanhf(in[i]);
+    }
+    else if (function == VX_NN_ACTIVATION_SOFTRELU) {
+        for (; i < count; i++) out[i] = log1pf(expf(in[i]));
+    }
+}
+
+int CpuExec_Activation_layer(NNCpuThreadPool * pool, vx_enum function, float a, float b, size_t count, const float * in, float * out)
+{
+    const size_t chunk = 64 * 1024;
+    int numItems = (int)((count + chunk - 1) / chunk);
+    auto work = [&](int item) {
+        size_t start = item * chunk;
+        nnCpuActivationRange(function, a, in + start, out + start, std::min(chunk, count - start));
+    };
+    if (pool) {
+        pool->parallelFor(numItems, work);
+    }
+    else {
+        for (int item = 0; item < numItems; item++)
+            work(item);
+    }
+    return 0;
+}
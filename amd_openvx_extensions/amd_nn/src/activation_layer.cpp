@@ -21,6 +21,7 @@ THE SOFTWARE.
 */
 
 #include "kernels.h"
+#if ENABLE_OPENCL || ENABLE_HIP
 struct ActivationLayerLocalData {
     NeuralNetworkCommonHandle * handle;
     miopenActivationMode_t mode;
@@ -34,6 +35,15 @@ struct ActivationLayerLocalData {
     void* input_mem;
     void* output_mem;
 };
+#else
+struct ActivationLayerLocalData {
+    NeuralNetworkCommonHandle * handle;
+    vx_enum mode;
+    vx_float32 activAlpha;
+    vx_float32 activBeta;
+    size_t count;
+};
+#endif
 
 static vx_status VX_CALLBACK validateActivationLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
 {
@@ -74,6 +84,7 @@ static vx_status VX_CALLBACK validateActivationLayer(vx_node node, const vx_refe
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processActivationLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Activation_Layer)
@@ -177,15 +188,97 @@ static vx_status VX_CALLBACK uninitializeActivationLayer(vx_node node, const vx_
     return VX_SUCCESS;
 }
 
+#else
+static vx_status VX_CALLBACK processActivationLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Activation_Layer)
+    ActivationLayerLocalData * data= NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem = nullptr, * output_mem = nullptr;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_BUFFER_HOST, &input_mem, sizeof(input_mem)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_BUFFER_HOST, &output_mem, sizeof(output_mem)));
+
+    if(CpuExec_Activation_layer(data->handle->cpu_pool, data->mode, data->activAlpha, data->activBeta, data->count, input_mem, output_mem) != 0) {
+        return VX_FAILURE;
+    }
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("activation_%04d.bin", (vx_tensor)parameters[4]);
+    #endif
+PROFILER_STOP(VX_NN, Activation_Layer)
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeActivationLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_size output_dims[4];
+    vx_enum out_type;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_DIMS, output_dims, sizeof(output_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if(out_type != VX_TYPE_FLOAT32)
+        return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: activation: output type=%d (CPU backend supports only VX_TYPE_FLOAT32)\n", out_type);
+    vx_enum mode;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[1], &mode, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    if(mode != VX_NN_ACTIVATION_RELU && mode != VX_NN_ACTIVATION_LEAKY_RELU && mode != VX_NN_ACTIVATION_ABS &&
+       mode != VX_NN_ACTIVATION_LOGISTIC && mode != VX_NN_ACTIVATION_HYPERBOLIC_TAN && mode != VX_NN_ACTIVATION_SOFTRELU)
+        return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: activation: mode=%d not supported by CPU backend\n", mode);
+
+    ActivationLayerLocalData * data = new ActivationLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+    data->mode = mode;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[2], &data->activAlpha, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[3], &data->activBeta, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    data->count = output_dims[0] * output_dims[1] * output_dims[2] * output_dims[3];
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "activation param active_alpha: " << data->activAlpha << "active_beta: " << data->activBeta << "activationmode: " << data->mode << std::endl;
+    std::cout << "activation output " << output_dims[3] << " " << output_dims[2] << " " << output_dims[1] << " " << output_dims[0] << std::endl;
+#endif
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeActivationLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    ActivationLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+
+//! \brief The kernel target support callback.
+static vx_status VX_CALLBACK query_target_support(vx_graph graph, vx_node node,
+    vx_bool use_opencl_1_2,              // [input]  false: OpenCL driver is 2.0+; true: OpenCL driver is 1.2
+    vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
+    )
+{
+    supported_target_affinity = AGO_TARGET_AFFINITY_CPU;
+    return VX_SUCCESS;
+}
+#endif
+
 vx_status publishActivationLayer(vx_context context)
 {
     // add kernel to the context with callbacks
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.activation_layer", VX_KERNEL_ACTIVATION_LAYER, processActivationLayer, 5, validateActivationLayer, initializeActivationLayer, uninitializeActivationLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable GPU buffer access since the kernel_f callback uses GPU buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#else
+    // kernel_f callback runs on host buffers
+    amd_kernel_query_target_support_f query_target_support_f = query_target_support;
+    ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_QUERY_TARGET_SUPPORT, &query_target_support_f, sizeof(query_target_support_f)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
@@ -32,6 +32,7 @@ enum {
     BIAS_ACTIVATION_FUSED       //both bias and activation are fused.
 };
 
+#if ENABLE_OPENCL || ENABLE_HIP
 struct ConvolutionLayerLocalData {
     NeuralNetworkCommonHandle * handle;
     float conv_alpha;
@@ -65,6 +66,12 @@ struct ConvolutionLayerLocalData {
     miopenFusionOpDescriptor_t activOp;
     miopenOperatorArgs_t fusionArgs;
 };
+#else
+struct ConvolutionLayerLocalData {
+    NeuralNetworkCommonHandle * handle;
+    NNCpuConvolution conv;
+};
+#endif
 
 static vx_status VX_CALLBACK validateConvolutionLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
 {
@@ -129,6 +136,7 @@ static vx_status VX_CALLBACK validateConvolutionLayer(vx_node node, const vx_ref
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processConvolutionLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Convolution_Layer)
@@ -469,15 +477,140 @@ static vx_status VX_CALLBACK uninitializeConvolutionLayer(vx_node node, const vx
     return VX_SUCCESS;
 }
 
+#else
+static vx_status VX_CALLBACK processConvolutionLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Convolution_Layer)
+    ConvolutionLayerLocalData * data= NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem = nullptr, * output_mem = nullptr;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_BUFFER_HOST, &input_mem, sizeof(input_mem)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_BUFFER_HOST, &output_mem, sizeof(output_mem)));
+
+    // convolution with bias and activation fused into the GEMM epilogue
+    if(CpuExec_Convolution_layer(data->handle->cpu_pool, &data->conv, input_mem, output_mem) != 0) {
+        return VX_FAILURE;
+    }
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("conv_%04d.bin", (vx_tensor)parameters[4]);
+    #endif
+PROFILER_STOP(VX_NN, Convolution_Layer)
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeConvolutionLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_enum out_type;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if(out_type != VX_TYPE_FLOAT32)
+        return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: conv: output type=%d (CPU backend supports only VX_TYPE_FLOAT32)\n", out_type);
+
+    //convolution params.
+    vx_nn_convolution_params_t params;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[3], &params, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_int32 groupCount = 1;
+    if(parameters[6]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[6], &groupCount, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    if(groupCount < 1) groupCount = 1;
+
+    vx_size input_dims[4], weights_dims[4], output_dims[4];
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_DIMS, weights_dims, sizeof(weights_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[4], VX_TENSOR_DIMS, output_dims, sizeof(output_dims)));
+    if(input_dims[2] != (weights_dims[2] * groupCount) || (output_dims[2] % groupCount) != 0)
+        return ERRMSG(VX_ERROR_INVALID_DIMENSION, "initialize: conv: input[%ldx%ldx%ldx%ld] weights[%ldx%ldx%ldx%ld] output[%ldx%ldx%ldx%ld]\n",
+            input_dims[3], input_dims[2], input_dims[1], input_dims[0],
+            weights_dims[3], weights_dims[2], weights_dims[1], weights_dims[0],
+            output_dims[3], output_dims[2], output_dims[1], output_dims[0]);
+
+    NNCpuConvolutionConfig cfg;
+    cfg.N = (int)input_dims[3]; cfg.IC = (int)input_dims[2]; cfg.IH = (int)input_dims[1]; cfg.IW = (int)input_dims[0];
+    cfg.OC = (int)output_dims[2]; cfg.OH = (int)output_dims[1]; cfg.OW = (int)output_dims[0];
+    cfg.KH = (int)weights_dims[1]; cfg.KW = (int)weights_dims[0];
+    cfg.pad_h = (int)params.padding_y; cfg.pad_w = (int)params.padding_x;
+    cfg.dilation_h = (int)params.dilation_y + 1; cfg.dilation_w = (int)params.dilation_x + 1;
+    cfg.stride_w = (cfg.OW > 1) ? ((cfg.IW + 2 * cfg.pad_w - cfg.KW - (cfg.KW - 1) * (cfg.dilation_w - 1) + ((cfg.OW - 1) / 2)) / (cfg.OW - 1)) : 1;
+    cfg.stride_h = (cfg.OH > 1) ? ((cfg.IH + 2 * cfg.pad_h - cfg.KH - (cfg.KH - 1) * (cfg.dilation_h - 1) + ((cfg.OH - 1) / 2)) / (cfg.OH - 1)) : 1;
+    cfg.groups = groupCount;
+    cfg.activation = NN_CPU_ACTIVATION_NONE;
+    cfg.leaky_alpha = 0.0f;
+    if(parameters[5]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[5], &cfg.leaky_alpha, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        if(cfg.leaky_alpha >= 0 && cfg.leaky_alpha <= 1) {
+            cfg.activation = cfg.leaky_alpha ? NN_CPU_ACTIVATION_LEAKY_RELU : NN_CPU_ACTIVATION_RELU;
+        }
+    }
+
+    // weights and bias are packed once here, so they must be initialized before vxVerifyGraph
+    float * weight_mem = nullptr, * bias_mem = nullptr;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_BUFFER_HOST, &weight_mem, sizeof(weight_mem)));
+    if(parameters[2]) {
+        ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[2], VX_TENSOR_BUFFER_HOST, &bias_mem, sizeof(bias_mem)));
+    }
+    if(!weight_mem)
+        return ERRMSG(VX_ERROR_NOT_ALLOCATED, "initialize: conv: weights buffer is not allocated%s\n", "");
+
+    ConvolutionLayerLocalData * data = new ConvolutionLayerLocalData;
+    if(CpuInit_Convolution_layer(&data->conv, cfg, weight_mem, bias_mem) != 0) {
+        delete data;
+        return VX_FAILURE;
+    }
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "conv input " << input_dims[0] << " " << input_dims[1] << " " << input_dims[2] << " " << input_dims[3] << " ";
+    std::cout << "weights " << weights_dims[0] << " " << weights_dims[1] << " "<< weights_dims[2] <<" " <<  weights_dims[3] << " ";
+    std::cout << "stride " << cfg.stride_h << " " << cfg.stride_w << " " << "pad " << cfg.pad_h << " " << cfg.pad_w << " ";
+    std::cout << "activation " << cfg.activation << " isa " << data->conv.isa << " direct " << data->conv.direct;
+    std::cout << " output " << output_dims[0] << " " << output_dims[1] << " " << output_dims[2] << " " << output_dims[3] << std::endl;
+#endif
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeConvolutionLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    ConvolutionLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+
+//! \brief The kernel target support callback.
+static vx_status VX_CALLBACK query_target_support(vx_graph graph, vx_node node,
+    vx_bool use_opencl_1_2,              // [input]  false: OpenCL driver is 2.0+; true: OpenCL driver is 1.2
+    vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
+    )
+{
+    supported_target_affinity = AGO_TARGET_AFFINITY_CPU;
+    return VX_SUCCESS;
+}
+#endif
+
 vx_status publishConvolutionLayer(vx_context context)
 {
     // add kernel to the context with callbacks
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.convolution_layer", VX_KERNEL_CONVOLUTION_LAYER, processConvolutionLayer, 7, validateConvolutionLayer, initializeConvolutionLayer, uninitializeConvolutionLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#else
+    // kernel_f callback runs on host buffers
+    amd_kernel_query_target_support_f query_target_support_f = query_target_support;
+    ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_QUERY_TARGET_SUPPORT, &query_target_support_f, sizeof(query_target_support_f)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #include "kernels.h"
 
+#if ENABLE_OPENCL || ENABLE_HIP
 struct FullyConnectedLayerLocalData {
     NeuralNetworkCommonHandle * handle;
     miopenConvolutionDescriptor_t convdesc;
@@ -41,6 +42,12 @@ struct FullyConnectedLayerLocalData {
     void *workspace;
 
 };
+#else
+struct FullyConnectedLayerLocalData {
+    NeuralNetworkCommonHandle * handle;
+    NNCpuFullyConnected fc;
+};
+#endif
 
 static vx_status VX_CALLBACK validateFullyConnectedLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
 {
@@ -92,6 +99,7 @@ static vx_status VX_CALLBACK validateFullyConnectedLayer(vx_node node, const vx_
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processFullyConnectedLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Fully_Connected_Layer)
@@ -269,15 +277,109 @@ static vx_status VX_CALLBACK uninitializeFullyConnectedLayer(vx_node node, const
     return VX_SUCCESS;
 }
 
+#else
+static vx_status VX_CALLBACK processFullyConnectedLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Fully_Connected_Layer)
+    FullyConnectedLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem = nullptr, * output_mem = nullptr;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_BUFFER_HOST, &input_mem, sizeof(input_mem)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[5], VX_TENSOR_BUFFER_HOST, &output_mem, sizeof(output_mem)));
+
+    if(CpuExec_FullyConnected_layer(data->handle->cpu_pool, &data->fc, input_mem, output_mem) != 0) {
+        return VX_FAILURE;
+    }
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("conv_%04d.bin", (vx_tensor)parameters[5]);
+    #endif
+
+PROFILER_STOP(VX_NN, Fully_Connected_Layer)
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializeFullyConnectedLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_size num_dims;
+    vx_enum out_type;
+    vx_size input_dims[4], weights_dims[4] = { 1, 1, 0, 0 };
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_NUMBER_OF_DIMS, &num_dims, sizeof(vx_size)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_DIMS, &weights_dims[4 - num_dims], num_dims * sizeof(vx_size)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[5], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if(out_type != VX_TYPE_FLOAT32)
+        return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: FC: output type=%d (CPU backend supports only VX_TYPE_FLOAT32)\n", out_type);
+
+    // weights and bias are packed once here, so they must be initialized before vxVerifyGraph
+    float * weight_mem = nullptr, * bias_mem = nullptr;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[1], VX_TENSOR_BUFFER_HOST, &weight_mem, sizeof(weight_mem)));
+    if(parameters[2]) {
+        ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[2], VX_TENSOR_BUFFER_HOST, &bias_mem, sizeof(bias_mem)));
+    }
+    if(!weight_mem)
+        return ERRMSG(VX_ERROR_NOT_ALLOCATED, "initialize: FC: weights buffer is not allocated%s\n", "");
+
+    int N = (int)input_dims[3];
+    int K = (int)(weights_dims[2] * weights_dims[1] * weights_dims[0]);
+    int OC = (int)weights_dims[3];
+    FullyConnectedLayerLocalData * data = new FullyConnectedLayerLocalData;
+    if(CpuInit_FullyConnected_layer(&data->fc, N, K, OC, weight_mem, bias_mem) != 0) {
+        delete data;
+        return VX_FAILURE;
+    }
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "fullyconnected input " << input_dims[3] << " " << input_dims[2] << " " << input_dims[1] << " " << input_dims[0] << " ";
+    std::cout << "weights " << weights_dims[3] << weights_dims[2] << weights_dims[1] << weights_dims[0] << " ";
+    std::cout << "N " << N << " K " << K << " OC " << OC << " isa " << data->fc.isa << std::endl;
+#endif
+
+    //add to node attribute.
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializeFullyConnectedLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    FullyConnectedLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+
+//! \brief The kernel target support callback.
+static vx_status VX_CALLBACK query_target_support(vx_graph graph, vx_node node,
+    vx_bool use_opencl_1_2,              // [input]  false: OpenCL driver is 2.0+; true: OpenCL driver is 1.2
+    vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
+    )
+{
+    supported_target_affinity = AGO_TARGET_AFFINITY_CPU;
+    return VX_SUCCESS;
+}
+#endif
+
 vx_status publishFullyConnectedLayer(vx_context context)
 {
     // add kernel to the context with callbacks
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.fully_connected_layer", VX_KERNEL_FULLY_CONNECTED_LAYER, processFullyConnectedLayer, 6, validateFullyConnectedLayer, initializeFullyConnectedLayer, uninitializeFullyConnectedLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#else
+    // kernel_f callback runs on host buffers
+    amd_kernel_query_target_support_f query_target_support_f = query_target_support;
+    ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_QUERY_TARGET_SUPPORT, &query_target_support_f, sizeof(query_target_support_f)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
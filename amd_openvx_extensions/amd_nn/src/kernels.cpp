@@ -123,8 +123,13 @@ vx_status createGraphHandle(vx_node node, NeuralNetworkCommonHandle ** pHandle)
         ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_ATTRIBUTE_AMD_HIP_STREAM, &handle->cmdq, sizeof(handle->cmdq)));
 #endif
 
+#if ENABLE_OPENCL || ENABLE_HIP
         //create miopen_handle from cmdq
         ERROR_CHECK_MIOPEN_STATUS(miopenCreateWithStream(&handle->miopen_handle, handle->cmdq));
+#else
+        //create worker pool shared by all CPU nodes in the graph
+        handle->cpu_pool = new NNCpuThreadPool(nnCpuGetNumThreads());
+#endif
 
         ERROR_CHECK_STATUS(vxSetModuleHandle(node, OPENVX_KHR_NN, handle));
     }
@@ -137,6 +142,9 @@ vx_status releaseGraphHandle(vx_node node, NeuralNetworkCommonHandle * handle)
     handle->count--;
     if(handle->count == 0) {
         //TBD: release miopen_handle
+#if !ENABLE_OPENCL && !ENABLE_HIP
+        delete handle->cpu_pool;
+#endif
         delete handle;
         ERROR_CHECK_STATUS(vxSetModuleHandle(node, OPENVX_KHR_NN, NULL));
     }
@@ -228,10 +236,11 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
     ERROR_CHECK_STATUS(publishConvolutionLayer(context));
     ERROR_CHECK_STATUS(publishFullyConnectedLayer(context));
     ERROR_CHECK_STATUS(publishPoolingLayer(context));
+    ERROR_CHECK_STATUS(publishActivationLayer(context));
+#if ENABLE_OPENCL || ENABLE_HIP
     ERROR_CHECK_STATUS(publishSoftmaxLayer(context));
     ERROR_CHECK_STATUS(publishNormalizationLayer(context));
     ERROR_CHECK_STATUS(publishLocalResponseNormalizationLayer(context));
-    ERROR_CHECK_STATUS(publishActivationLayer(context));
     ERROR_CHECK_STATUS(publishROIPoolingLayer(context));
     ERROR_CHECK_STATUS(publishDeconvolutionLayer(context));
     ERROR_CHECK_STATUS(publishBatchNormalizationLayer(context));
@@ -276,6 +285,7 @@ SHARED_PUBLIC vx_status VX_API_CALL vxPublishKernels(vx_context context)
         }
     };
     ERROR_CHECK_STATUS(vxSetContextAttribute(context, VX_CONTEXT_ATTRIBUTE_AMD_SET_MERGE_RULE, &softmax_rule, sizeof(softmax_rule)));
+#endif
 
     return VX_SUCCESS;
 }
@@ -38,7 +38,9 @@ THE SOFTWARE.
 #include <VX/vx_khr_nn.h>
 #include <VX/vx_compatibility.h>
 #include <vx_ext_amd.h>
+#if ENABLE_OPENCL || ENABLE_HIP
 #include <miopen/miopen.h>
+#endif
 #include <iostream>
 #include <string.h>
 #include <vector>
@@ -52,6 +54,8 @@ THE SOFTWARE.
 #include <CL/cl.h>
 #elif ENABLE_HIP
 #include "../nn_hip/nn_hip_host_decls.h"
+#else
+#include "../nn_cpu/nn_cpu_host_decls.h"
 #endif
 #endif
 #if _WIN32
@@ -128,11 +132,15 @@ enum user_kernel_e
 //! \brief Common data shared across all nodes in a graph
 struct NeuralNetworkCommonHandle {
     int count;
+#if ENABLE_OPENCL || ENABLE_HIP
     miopenHandle_t  miopen_handle;
+#endif
 #if ENABLE_OPENCL
     cl_command_queue cmdq;
 #elif ENABLE_HIP
     hipStream_t cmdq;
+#else
+    NNCpuThreadPool * cpu_pool;
 #endif
     bool exhaustiveSearch;
 };
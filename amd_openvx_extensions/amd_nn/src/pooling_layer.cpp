@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #include "kernels.h"
 
+#if ENABLE_OPENCL || ENABLE_HIP
 struct PoolingLayerLocalData {
     NeuralNetworkCommonHandle * handle;
     miopenPoolingDescriptor_t pool_desc;
@@ -42,6 +43,17 @@ struct PoolingLayerLocalData {
     double activation_power;
     miopenActivationDescriptor_t activation_desc;
 };
+#else
+struct PoolingLayerLocalData {
+    NeuralNetworkCommonHandle * handle;
+    bool maxPool;
+    bool relu;
+    int N, C, IH, IW, OH, OW;
+    int kernel_h, kernel_w;
+    int stride_h, stride_w;
+    int pad_h, pad_w;
+};
+#endif
 
 static vx_status VX_CALLBACK validatePoolingLayer(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[])
 {
@@ -104,6 +116,7 @@ static vx_status VX_CALLBACK validatePoolingLayer(vx_node node, const vx_referen
     return VX_SUCCESS;
 }
 
+#if ENABLE_OPENCL || ENABLE_HIP
 static vx_status VX_CALLBACK processPoolingLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
 {
 PROFILER_START(VX_NN, Pooling_Layer)
@@ -247,15 +260,114 @@ static vx_status VX_CALLBACK uninitializePoolingLayer(vx_node node, const vx_ref
     return VX_SUCCESS;
 }
 
+#else
+static vx_status VX_CALLBACK processPoolingLayer(vx_node node, const vx_reference * parameters, vx_uint32 num)
+{
+PROFILER_START(VX_NN, Pooling_Layer)
+    PoolingLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    float * input_mem = nullptr, * output_mem = nullptr;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_BUFFER_HOST, &input_mem, sizeof(input_mem)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[7], VX_TENSOR_BUFFER_HOST, &output_mem, sizeof(output_mem)));
+
+    if(CpuExec_Pooling_layer(data->handle->cpu_pool, data->maxPool, data->N, data->C, data->IH, data->IW, data->OH, data->OW,
+                             data->kernel_h, data->kernel_w, data->stride_h, data->stride_w, data->pad_h, data->pad_w,
+                             data->relu, input_mem, output_mem) != 0) {
+        return VX_FAILURE;
+    }
+
+    /*DUMP LAYER BUFFER*/
+    #if ENABLE_DEBUG_DUMP_NN_LAYER_BUFFERS
+        //dump the output layer
+        nn_layer_test_dumpBuffer("pooling_%04d.bin", (vx_tensor)parameters[7]);
+    #endif
+
+PROFILER_STOP(VX_NN, Pooling_Layer)
+
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK initializePoolingLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    vx_size kernel_w, kernel_h, pad_w, pad_h;
+    vx_size input_dims[4], output_dims[4];
+    vx_enum out_type;
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[0], VX_TENSOR_DIMS, input_dims, sizeof(input_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[7], VX_TENSOR_DIMS, output_dims, sizeof(output_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor((vx_tensor)parameters[7], VX_TENSOR_DATA_TYPE, &out_type, sizeof(out_type)));
+    if(out_type != VX_TYPE_FLOAT32)
+        return ERRMSG(VX_ERROR_NOT_SUPPORTED, "initialize: POOL: output type=%d (CPU backend supports only VX_TYPE_FLOAT32)\n", out_type);
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[2], &kernel_w, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[3], &kernel_h, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[4], &pad_w, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[5], &pad_h, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_nn_pooling_type_e modeType;
+    ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[1], &modeType, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_int32 activation_mode = 0;
+    if(parameters[9]) {
+        ERROR_CHECK_STATUS(vxCopyScalar((vx_scalar)parameters[9], &activation_mode, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+
+    PoolingLayerLocalData * data = new PoolingLayerLocalData;
+    memset(data, 0, sizeof(*data));
+    ERROR_CHECK_STATUS(createGraphHandle(node, &data->handle));
+    data->maxPool = (modeType == VX_NN_POOLING_MAX);
+    data->relu = (activation_mode == 1);
+    data->N = (int)input_dims[3]; data->C = (int)input_dims[2]; data->IH = (int)input_dims[1]; data->IW = (int)input_dims[0];
+    data->OH = (int)output_dims[1]; data->OW = (int)output_dims[0];
+    data->kernel_h = (int)kernel_h; data->kernel_w = (int)kernel_w;
+    data->pad_h = (int)pad_h; data->pad_w = (int)pad_w;
+    data->stride_w = (output_dims[0] > 1) ? (int)((input_dims[0] + 2 * pad_w - kernel_w + ((output_dims[0] - 1) / 2)) / (output_dims[0] - 1)) : 1;
+    data->stride_h = (output_dims[1] > 1) ? (int)((input_dims[1] + 2 * pad_h - kernel_h + ((output_dims[1] - 1) / 2)) / (output_dims[1] - 1)) : 1;
+
+#if ENABLE_DEBUG_PRINT_DIMS
+    std::cout << "pooling input " << input_dims[3] << " " << input_dims[2] << " " << input_dims[1] << " " << input_dims[0] << " ";
+    std::cout << "kernel " << kernel_h << " " << kernel_w << " ";
+    std::cout << "stride " << data->stride_h << " " << data->stride_w << " " << "pad " << pad_h << " " << pad_w;
+    std::cout << " output " << output_dims[3] << " " << output_dims[2] << " " << output_dims[1] << " " << output_dims[0] << std::endl;
+#endif
+
+    ERROR_CHECK_STATUS(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    return VX_SUCCESS;
+}
+
+static vx_status VX_CALLBACK uninitializePoolingLayer(vx_node node, const vx_reference *parameters, vx_uint32 num)
+{
+    PoolingLayerLocalData * data = NULL;
+    ERROR_CHECK_STATUS(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
+    if (data) {
+        ERROR_CHECK_STATUS(releaseGraphHandle(node, data->handle));
+        delete data;
+    }
+    return VX_SUCCESS;
+}
+
+//! \brief The kernel target support callback.
+static vx_status VX_CALLBACK query_target_support(vx_graph graph, vx_node node,
+    vx_bool use_opencl_1_2,              // [input]  false: OpenCL driver is 2.0+; true: OpenCL driver is 1.2
+    vx_uint32& supported_target_affinity // [output] must be set to AGO_TARGET_AFFINITY_CPU or AGO_TARGET_AFFINITY_GPU or (AGO_TARGET_AFFINITY_CPU | AGO_TARGET_AFFINITY_GPU)
+    )
+{
+    supported_target_affinity = AGO_TARGET_AFFINITY_CPU;
+    return VX_SUCCESS;
+}
+#endif
+
 vx_status publishPoolingLayer(vx_context context)
 {
     // add kernel to the context with callbacks
     vx_kernel kernel = vxAddUserKernel(context, "org.khronos.nn_extension.pooling_layer", VX_KERNEL_POOLING_LAYER, processPoolingLayer, 10, validatePoolingLayer, initializePoolingLayer, uninitializePoolingLayer);
     ERROR_CHECK_OBJECT(kernel);
 
+#if ENABLE_OPENCL || ENABLE_HIP
     // enable OpenCL buffer access since the kernel_f callback uses OpenCL buffers instead of host accessible buffers
     vx_bool enableBufferAccess = vx_true_e;
     ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_GPU_BUFFER_ACCESS_ENABLE, &enableBufferAccess, sizeof(enableBufferAccess)));
+#else
+    // kernel_f callback runs on host buffers
+    amd_kernel_query_target_support_f query_target_support_f = query_target_support;
+    ERROR_CHECK_STATUS(vxSetKernelAttribute(kernel, VX_KERNEL_ATTRIBUTE_AMD_QUERY_TARGET_SUPPORT, &query_target_support_f, sizeof(query_target_support_f)));
+#endif
 
     // set kernel parameters
     ERROR_CHECK_STATUS(vxAddParameterToKernel(kernel, 0, VX_INPUT, VX_TYPE_TENSOR, VX_PARAMETER_STATE_REQUIRED));
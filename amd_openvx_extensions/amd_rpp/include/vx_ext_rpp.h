@@ -1877,6 +1877,20 @@ extern "C"
 	 */
 	SHARED_PUBLIC vx_node VX_API_CALL vxExtRppPreemphasisFilter(vx_graph graph, vx_tensor pSrc, vx_tensor pSrcRoi, vx_tensor pDst, vx_array pPreemphCoeff, vx_scalar borderType);
 
+	/*! \brief [Graph] Applies preemphasis filter to consecutive chunks of audio streams.
+	 * \ingroup group_amd_rpp
+	 * \details Each sample of the batch is a stream: the last input sample of a chunk is used to filter the first sample of the next chunk of the same stream, so the output of the chunks matches the output of the whole signal.
+	 * \param [in] graph The handle to the graph.
+	 * \param [in] pSrc The input tensor in <tt>\ref VX_TYPE_FLOAT32</tt> format data.
+	 * \param [in] pSrcRoi The input tensor of batch size in <tt>unsigned int</tt> containing the roi values for the input in xywh (w- samples, h - channels) format.
+	 * \param [out] pDst The output tensor in <tt>\ref VX_TYPE_FLOAT32</tt> format data.
+	 * \param [in] pPreemphCoeff The input array in <tt>\ref VX_TYPE_FLOAT32</tt> format containing the preEmphasis co-efficient.
+	 * \param [in] borderType The type of border <tt>\ref VX_TYPE_INT32</tt> used for the first chunk of a stream.
+	 * \param [in] resetState The input scalar in <tt>\ref VX_TYPE_BOOL</tt> format; when true the streams start over with this chunk.
+	 * \return A node reference <tt>\ref vx_node</tt>. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>.
+	 */
+	SHARED_PUBLIC vx_node VX_API_CALL vxExtRppPreemphasisFilterStream(vx_graph graph, vx_tensor pSrc, vx_tensor pSrcRoi, vx_tensor pDst, vx_array pPreemphCoeff, vx_scalar borderType, vx_scalar resetState);
+
 	/*! \brief [Graph] Produces a spectrogram from a 1D signal.
 	* \ingroup group_amd_rpp
 	* \param [in] graph The handle to the graph.
@@ -1896,6 +1910,28 @@ extern "C"
 	*/
 	SHARED_PUBLIC vx_node VX_API_CALL vxExtRppSpectrogram(vx_graph graph, vx_tensor pSrc, vx_tensor pSrcRoi, vx_tensor pDst, vx_tensor pDstRoi, vx_array windowFunction, vx_scalar centerWindow, vx_scalar reflectPadding, vx_scalar spectrogramLayout, vx_scalar power, vx_scalar nfft, vx_scalar windowLength, vx_scalar windowStep);
 
+	/*! \brief [Graph] Produces a spectrogram from consecutive chunks of 1D signal streams.
+	* \ingroup group_amd_rpp
+	* \details Each sample of the batch is a stream: the samples of a chunk that do not complete a window are kept and prepended to the next chunk of the same stream, so pDstRoi holds only the complete windows and the frames of the chunks match the frames of the whole signal.
+	* The output must hold ((chunk length - 1) / windowStep) + 1 frames. centerWindow must be false.
+	* \param [in] graph The handle to the graph.
+	* \param [in] pSrc The input tensor in <tt>\ref VX_TYPE_FLOAT32</tt> format data.
+	* \param [in] pSrcRoi The input tensor of batch size in <tt>unsigned int<tt> containing the roi values for the input in xywh/ltrb format.
+	* \param [out] pDst The output tensor (begin) in <tt>\ref VX_TYPE_FLOAT32</tt> format data.
+	* \param [in] pDstRoi The input tensor of batch size in <tt>unsigned int<tt> containing the roi values for the output tensor in xywh/ltrb format.
+	* \param [in] windowFunction The input array in <tt>\ref VX_TYPE_FLOAT32</tt> format containing the samples of the window function.
+	* \param [in] centerWindow The input scalar in <tt>\ref VX_TYPE_BOOL</tt> format, must be false.
+	* \param [in] reflectPadding The input scalar in <tt>\ref VX_TYPE_BOOL</tt> format indicates the padding policy when sampling outside the bounds of the signal.
+	* \param [in] spectrogramLayout The input scalar in <tt>\ref VX_TYPE_INT32</tt> format containing the Output spectrogram layout.
+	* \param [in] power The input scalar in <tt>\ref VX_TYPE_INT32</tt> format containing the exponent of the magnitude of the spectrum.
+	* \param [in] nfft The input scalar in <tt>\ref VX_TYPE_INT32</tt> format containing the size of the FFT.
+	* \param [in] windowLength The input scalar in <tt>\ref VX_TYPE_INT32</tt> format containing Window size in number of samples.
+	* \param [in] windowStep The input array in <tt>\ref VX_TYPE_INT32</tt> format containing the step between the STFT windows in number of samples.
+	* \param [in] resetState The input scalar in <tt>\ref VX_TYPE_BOOL</tt> format; when true the samples kept from the previous chunks are discarded.
+	* \return A node reference <tt>\ref vx_node</tt>. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>.
+	*/
+	SHARED_PUBLIC vx_node VX_API_CALL vxExtRppSpectrogramStream(vx_graph graph, vx_tensor pSrc, vx_tensor pSrcRoi, vx_tensor pDst, vx_tensor pDstRoi, vx_array windowFunction, vx_scalar centerWindow, vx_scalar reflectPadding, vx_scalar spectrogramLayout, vx_scalar power, vx_scalar nfft, vx_scalar windowLength, vx_scalar windowStep, vx_scalar resetState);
+
 	/*! \brief [Graph] Applies downmixing to the input tensor.
 	 * \ingroup group_amd_rpp
 	 * \param [in] graph The handle to the graph.
@@ -1935,6 +1971,23 @@ extern "C"
 	 */
 	SHARED_PUBLIC vx_node VX_API_CALL vxExtRppResample(vx_graph graph, vx_tensor pSrc, vx_tensor pDst, vx_tensor pSrcRoi, vx_tensor pDstRoi, vx_array pInRateTensor, vx_tensor pOutRateTensor, vx_scalar quality);
 
+	/*! \brief [Graph] Resamples consecutive chunks of audio streams.
+	 * \ingroup group_amd_rpp
+	 * \details Each sample of the batch is a stream: the filter history and the phase of the output samples are kept across chunks of the same stream, so the output of the chunks matches the output of the whole signal, delayed by the half-width of the filter.
+	 * pDstRoi holds the number of output samples produced for each chunk. The rates of a stream must not change between chunks unless the stream is reset.
+	 * \param [in] graph The handle to the graph.
+	 * \param [in] pSrc The input tensor in <tt>\ref VX_TYPE_FLOAT32</tt> format data.
+	 * \param [out] pDst The output tensor in <tt>\ref VX_TYPE_FLOAT32</tt> format data.
+	 * \param [in] pSrcRoi The input tensor of batch size in <tt>unsigned int<tt> containing the roi values for the input.
+	 * \param [in] pDstRoi The input tensor of batch size in <tt>unsigned int<tt> containing the roi values for the output.
+	 * \param [in] pInRateTensor The input array in <tt>\ref VX_TYPE_FLOAT32<tt> format containing the input sample rate data.
+	 * \param [in] pOutRateTensor The input tensor in <tt>\ref VX_TYPE_FLOAT32<tt> format containing the output sample rate data.
+	 * \param [in] quality The resampling is achieved by applying a sinc filter with Hann window with an extent controlled by the quality argument.
+	 * \param [in] resetState The input scalar in <tt>\ref VX_TYPE_BOOL</tt> format; when true the streams start over with this chunk.
+	 * \return A node reference <tt>\ref vx_node</tt>. Any possible errors preventing a successful creation should be checked using <tt>\ref vxGetStatus</tt>.
+	 */
+	SHARED_PUBLIC vx_node VX_API_CALL vxExtRppResampleStream(vx_graph graph, vx_tensor pSrc, vx_tensor pDst, vx_tensor pSrcRoi, vx_tensor pDstRoi, vx_array pInRateTensor, vx_tensor pOutRateTensor, vx_scalar quality, vx_scalar resetState);
+
 	/*! \brief [Graph] Multiples a tensor and a scalar and returns the output.
 	 * \ingroup group_amd_rpp
 	 * \param [in] graph The handle to the graph.
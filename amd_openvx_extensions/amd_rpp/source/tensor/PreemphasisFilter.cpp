@@ -32,6 +32,11 @@ struct PreemphasisFilterLocalData {
     RpptDescPtr pSrcDesc;
     RpptDescPtr pDstDesc;
     Rpp32u *pSampleSize;
+    bool streaming;             // chunks of long streams: the filter history is carried across executions
+    Rpp32f *pHistory;           // last input sample of the previous chunk
+    bool *pHistoryValid;
+    Rpp32f *pFirstSample;       // first and last input samples of the current chunk (saved before in-place filtering)
+    Rpp32f *pLastSample;
     size_t inputTensorDims[RPP_MAX_TENSOR_DIMS];
     size_t outputTensorDims[RPP_MAX_TENSOR_DIMS];
 };
@@ -53,16 +58,50 @@ static vx_status VX_CALLBACK refreshPreemphasisFilter(vx_node node, const vx_ref
     RpptROI *src_roi = reinterpret_cast<RpptROI *>(roi_tensor_ptr_src);
     for (int n = 0; n < data->inputTensorDims[0]; n++)
         data->pSampleSize[n] = src_roi[n].xywhROI.roiWidth * src_roi[n].xywhROI.roiHeight;
+    if (data->streaming) {
+        vx_bool reset = vx_false_e;
+        STATUS_ERROR_CHECK(vxCopyScalar((vx_scalar)parameters[6], &reset, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        if (reset)
+            memset(data->pHistoryValid, 0, sizeof(bool) * data->pSrcDesc->n);
+    }
 
     return status;
 }
 
+// the first output sample of a chunk is filtered with the last input sample of the previous chunk instead of the border
+static void saveStreamSamples(PreemphasisFilterLocalData *data) {
+    Rpp32f *src = static_cast<Rpp32f *>(data->pSrc);
+    for (unsigned n = 0; n < data->pSrcDesc->n; n++) {
+        if (data->pSampleSize[n] > 0) {
+            data->pFirstSample[n] = src[n * data->pSrcDesc->strides.nStride];
+            data->pLastSample[n] = src[n * data->pSrcDesc->strides.nStride + data->pSampleSize[n] - 1];
+        }
+    }
+}
+
+static void updateStreamHistory(PreemphasisFilterLocalData *data) {
+    Rpp32f *dst = static_cast<Rpp32f *>(data->pDst);
+    for (unsigned n = 0; n < data->pSrcDesc->n; n++) {
+        if (data->pSampleSize[n] > 0) {
+            if (data->pHistoryValid[n])
+                dst[n * data->pDstDesc->strides.nStride] = data->pFirstSample[n] - data->pPreemphCoeff[n] * data->pHistory[n];
+            data->pHistory[n] = data->pLastSample[n];
+            data->pHistoryValid[n] = true;
+        }
+    }
+}
+
 static vx_status VX_CALLBACK validatePreemphasisFilter(vx_node node, const vx_reference parameters[], vx_uint32 num, vx_meta_format metas[]) {
     vx_status status = VX_SUCCESS;
     vx_enum scalar_type;
     STATUS_ERROR_CHECK(vxQueryScalar((vx_scalar)parameters[4], VX_SCALAR_TYPE, &scalar_type, sizeof(scalar_type)));
     if (scalar_type != VX_TYPE_INT32)
         return ERRMSG(VX_ERROR_INVALID_TYPE, "validate: Paramter: #4 type=%d (must be size)\n", scalar_type);
+    if (parameters[6]) {
+        STATUS_ERROR_CHECK(vxQueryScalar((vx_scalar)parameters[6], VX_SCALAR_TYPE, &scalar_type, sizeof(scalar_type)));
+        if (scalar_type != VX_TYPE_BOOL)
+            return ERRMSG(VX_ERROR_INVALID_TYPE, "validate: Paramter: #6 type=%d (must be bool)\n", scalar_type);
+    }
 
     // Check for input parameters
     size_t num_tensor_dims;
@@ -99,8 +138,12 @@ static vx_status VX_CALLBACK processPreemphasisFilter(vx_node node, const vx_ref
     }
     if (data->deviceType == AGO_TARGET_AFFINITY_CPU) {
 #if RPP_AUDIO
+        if (data->streaming)
+            saveStreamSamples(data);
         rpp_status = rppt_pre_emphasis_filter_host((float *)data->pSrc, data->pSrcDesc, (float *)data->pDst, data->pDstDesc, (Rpp32s *)data->pSampleSize, data->pPreemphCoeff, RpptAudioBorderType(data->borderType), data->handle->rppHandle);
         return_status = (rpp_status == RPP_SUCCESS) ? VX_SUCCESS : VX_FAILURE;
+        if (data->streaming && return_status == VX_SUCCESS)
+            updateStreamHistory(data);
 #else
         return_status = VX_ERROR_NOT_SUPPORTED;
 #endif
@@ -137,6 +180,13 @@ static vx_status VX_CALLBACK initializePreemphasisFilter(vx_node node, const vx_
 
         data->pSampleSize = new unsigned[data->pSrcDesc->n];
         data->pPreemphCoeff = new float[data->pSrcDesc->n];
+        data->streaming = (parameters[6] != nullptr);
+        if (data->streaming) {
+            data->pHistory = new float[data->pSrcDesc->n];
+            data->pHistoryValid = new bool[data->pSrcDesc->n]();
+            data->pFirstSample = new float[data->pSrcDesc->n];
+            data->pLastSample = new float[data->pSrcDesc->n];
+        }
 
         refreshPreemphasisFilter(node, parameters, data);
         STATUS_ERROR_CHECK(createRPPHandle(node, &data->handle, data->pSrcDesc->n, data->deviceType));
@@ -152,6 +202,10 @@ static vx_status VX_CALLBACK uninitializePreemphasisFilter(vx_node node, const v
     STATUS_ERROR_CHECK(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
     if (data->pSampleSize) delete[] data->pSampleSize;
     if (data->pPreemphCoeff) delete[] data->pPreemphCoeff;
+    if (data->pHistory) delete[] data->pHistory;
+    if (data->pHistoryValid) delete[] data->pHistoryValid;
+    if (data->pFirstSample) delete[] data->pFirstSample;
+    if (data->pLastSample) delete[] data->pLastSample;
     if (data->pSrcDesc) delete data->pSrcDesc;
     if (data->pDstDesc) delete data->pDstDesc;
     STATUS_ERROR_CHECK(releaseRPPHandle(node, data->handle, data->deviceType));
@@ -182,7 +236,7 @@ vx_status PreemphasisFilter_Register(vx_context context) {
     vx_kernel kernel = vxAddUserKernel(context, "org.rpp.PreemphasisFilter",
                                        VX_KERNEL_RPP_PREEMPHASISFILTER,
                                        processPreemphasisFilter,
-                                       6,
+                                       7,
                                        validatePreemphasisFilter,
                                        initializePreemphasisFilter,
                                        uninitializePreemphasisFilter);
@@ -207,6 +261,7 @@ vx_status PreemphasisFilter_Register(vx_context context) {
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 3, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 4, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+        PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
         PARAM_ERROR_CHECK(vxFinalizeKernel(kernel));
     }
     if (status != VX_SUCCESS) {
@@ -36,6 +36,18 @@ struct ResampleLocalData {
 #if RPP_AUDIO
     RpptResamplingWindow window;
 #endif
+    bool streaming;                 // chunks of long streams: filter history and output phase are carried across executions
+    Rpp32s lobes;
+    Rpp32s streamWindowSize;
+    Rpp32f *pStreamWindow;          // windowed sinc sampled at STREAM_WINDOW_RESOLUTION points per lobe
+    Rpp32f **ppStreamHistory;       // last input frames of the previous chunk
+    Rpp32s *pStreamHistoryCapacity;
+    Rpp64f *pStreamOutPos;          // position of the next output sample relative to the start of the chunk
+    Rpp32f *pStreamInRate;
+    Rpp32f *pStreamOutRate;
+    Rpp32s *pStreamChannels;
+    RpptROI *pStreamSrcRoi;
+    RpptROI *pStreamDstRoi;
     size_t inputTensorDims[RPP_MAX_TENSOR_DIMS];
     size_t outputTensorDims[RPP_MAX_TENSOR_DIMS];
 };
@@ -74,6 +86,93 @@ inline void windowed_sinc(RpptResamplingWindow &window, int32_t coeffs, int32_t
 }
 #endif
 
+#define STREAM_WINDOW_RESOLUTION 64
+
+inline void stream_windowed_sinc(ResampleLocalData *data) {
+    data->streamWindowSize = 2 * data->lobes * STREAM_WINDOW_RESOLUTION + 1;
+    data->pStreamWindow = new float[data->streamWindowSize];
+    for (int32_t i = 0; i < data->streamWindowSize; i++) {
+        double x = static_cast<double>(i) / STREAM_WINDOW_RESOLUTION - data->lobes;
+        data->pStreamWindow[i] = sinc(x) * hann(x / data->lobes);
+    }
+}
+
+inline float stream_window(ResampleLocalData *data, double x) {
+    double f = (x + data->lobes) * STREAM_WINDOW_RESOLUTION;
+    int32_t i = static_cast<int32_t>(std::floor(f));
+    if (i < 0 || i >= data->streamWindowSize - 1)
+        return 0.0f;
+    float frac = static_cast<float>(f - i);
+    return data->pStreamWindow[i] + frac * (data->pStreamWindow[i + 1] - data->pStreamWindow[i]);
+}
+
+// resamples one chunk of a stream on the host: an output sample is produced only once all the input samples under
+// its filter are available, the remaining ones are produced from the history kept for the next chunk
+static void resample_stream(vx_node node, ResampleLocalData *data, uint32_t n) {
+    RpptROI &src_roi = data->pStreamSrcRoi[n];
+    RpptROI &dst_roi = data->pStreamDstRoi[n];
+    dst_roi.xywhROI.roiWidth = 0;
+    dst_roi.xywhROI.roiHeight = src_roi.xywhROI.roiHeight;
+    float in_rate = data->pInRateTensor[n], out_rate = data->pOutRateTensor[n];
+    int32_t length = src_roi.xywhROI.roiWidth, channels = src_roi.xywhROI.roiHeight;
+    if (in_rate <= 0 || out_rate <= 0 || channels <= 0)
+        return;
+    double cutoff = std::min(1.0, static_cast<double>(out_rate) / in_rate);
+    double radius = data->lobes / cutoff;
+    int32_t history = static_cast<int32_t>(std::ceil(2 * radius)) + 1;
+    if (in_rate != data->pStreamInRate[n] || out_rate != data->pStreamOutRate[n] || channels != data->pStreamChannels[n]) {
+        // start of a stream (or a change of its format): the signal is zero before the first chunk
+        if (history * channels > data->pStreamHistoryCapacity[n]) {
+            if (data->ppStreamHistory[n]) delete[] data->ppStreamHistory[n];
+            data->ppStreamHistory[n] = new float[history * channels];
+            data->pStreamHistoryCapacity[n] = history * channels;
+        }
+        memset(data->ppStreamHistory[n], 0, sizeof(float) * history * channels);
+        data->pStreamOutPos[n] = 0;
+        data->pStreamInRate[n] = in_rate;
+        data->pStreamOutRate[n] = out_rate;
+        data->pStreamChannels[n] = channels;
+    }
+    const float *src = static_cast<float *>(data->pSrc) + n * data->pSrcDesc->strides.nStride;
+    float *dst = static_cast<float *>(data->pDst) + n * data->pDstDesc->strides.nStride;
+    float *hist = data->ppStreamHistory[n];
+    const int32_t src_stride = data->pSrcDesc->strides.hStride, dst_stride = data->pDstDesc->strides.hStride;
+    const int32_t capacity = static_cast<int32_t>(data->outputTensorDims[1]);
+    const double step = static_cast<double>(in_rate) / out_rate;
+    double pos = data->pStreamOutPos[n];
+    int32_t count = 0, dropped = 0;
+    std::vector<float> acc(channels);
+    for (; pos + radius < length; pos += step) {
+        if (count >= capacity) {
+            dropped++;
+            continue;
+        }
+        std::fill(acc.begin(), acc.end(), 0.0f);
+        int32_t k0 = std::max(static_cast<int32_t>(std::ceil(pos - radius)), -history);
+        int32_t k1 = static_cast<int32_t>(std::floor(pos + radius));
+        for (int32_t k = k0; k <= k1; k++) {
+            float w = cutoff * stream_window(data, (k - pos) * cutoff);
+            const float *in = (k < 0) ? (hist + (history + k) * channels) : (src + k * src_stride);
+            for (int32_t c = 0; c < channels; c++)
+                acc[c] += w * in[c];
+        }
+        for (int32_t c = 0; c < channels; c++)
+            dst[count * dst_stride + c] = acc[c];
+        count++;
+    }
+    if (dropped)
+        vxAddLogEntry((vx_reference)node, VX_FAILURE, "Resample: output too small for the stream, dropping %d samples\n", dropped);
+    dst_roi.xywhROI.roiWidth = count;
+    data->pStreamOutPos[n] = pos - length;
+
+    // keep the last input frames of the stream for the next chunk
+    int32_t keep = std::min(length, history);
+    if (keep < history)
+        memmove(hist, hist + keep * channels, sizeof(float) * (history - keep) * channels);
+    for (int32_t k = 0; k < keep; k++)
+        memcpy(hist + (history - keep + k) * channels, src + (length - keep + k) * src_stride, sizeof(float) * channels);
+}
+
 void update_destination_roi(ResampleLocalData *data, RpptROI *src_roi, RpptROI *dst_roi) {
     float scale_ratio;
     for (uint32_t i = 0; i < data->pSrcDesc->n; i++) {
@@ -105,6 +204,14 @@ static vx_status VX_CALLBACK refreshResample(vx_node node, const vx_reference *p
         RpptROI *src_roi = reinterpret_cast<RpptROI *>(roi_tensor_ptr_src);
         RpptROI *dst_roi = reinterpret_cast<RpptROI *>(roi_tensor_ptr_dst);
         update_destination_roi(data, src_roi, dst_roi);
+        data->pStreamSrcRoi = src_roi;
+        data->pStreamDstRoi = dst_roi;
+        if (data->streaming) {
+            vx_bool reset = vx_false_e;
+            STATUS_ERROR_CHECK(vxCopyScalar((vx_scalar)parameters[8], &reset, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+            if (reset)
+                memset(data->pStreamInRate, 0, sizeof(float) * data->pSrcDesc->n);
+        }
         for (uint32_t i = 0; i < data->pSrcDesc->n; i++) {
             data->pSrcRoi[i * nDim] = src_roi[i].xywhROI.roiWidth;
             data->pSrcRoi[i * nDim + 1] = src_roi[i].xywhROI.roiHeight;
@@ -124,6 +231,11 @@ static vx_status VX_CALLBACK validateResample(vx_node node, const vx_reference p
     STATUS_ERROR_CHECK(vxQueryScalar((vx_scalar)parameters[7], VX_SCALAR_TYPE, &scalar_type, sizeof(scalar_type)));
     if (scalar_type != VX_TYPE_UINT32)
         return ERRMSG(VX_ERROR_INVALID_TYPE, "validate: Paramter: #7 type=%d (must be size)\n", scalar_type);
+    if (parameters[8]) {
+        STATUS_ERROR_CHECK(vxQueryScalar((vx_scalar)parameters[8], VX_SCALAR_TYPE, &scalar_type, sizeof(scalar_type)));
+        if (scalar_type != VX_TYPE_BOOL)
+            return ERRMSG(VX_ERROR_INVALID_TYPE, "validate: Paramter: #8 type=%d (must be bool)\n", scalar_type);
+    }
 
     // Validate for input parameters
     size_t num_tensor_dims;
@@ -161,6 +273,11 @@ static vx_status VX_CALLBACK processResample(vx_node node, const vx_reference *p
 #endif
     }
     if (data->deviceType == AGO_TARGET_AFFINITY_CPU) {
+        if (data->streaming) {
+            for (uint32_t n = 0; n < data->pSrcDesc->n; n++)
+                resample_stream(node, data, n);
+            return return_status;
+        }
 #if RPP_AUDIO
         rpp_status = rppt_resample_host(data->pSrc, data->pSrcDesc, data->pDst, data->pDstDesc,
                                         data->pInRateTensor, data->pOutRateTensor, data->pSrcRoi, data->window, data->handle->rppHandle);
@@ -204,6 +321,17 @@ static vx_status VX_CALLBACK initializeResample(vx_node node, const vx_reference
 #if RPP_AUDIO
         windowed_sinc(data->window, lookupSize, lobes);
 #endif
+        data->lobes = lobes;
+        data->streaming = (parameters[8] != nullptr);
+        if (data->streaming) {
+            stream_windowed_sinc(data);
+            data->ppStreamHistory = new float *[data->pSrcDesc->n]();
+            data->pStreamHistoryCapacity = new int[data->pSrcDesc->n]();
+            data->pStreamOutPos = new double[data->pSrcDesc->n]();
+            data->pStreamInRate = new float[data->pSrcDesc->n]();
+            data->pStreamOutRate = new float[data->pSrcDesc->n]();
+            data->pStreamChannels = new int[data->pSrcDesc->n]();
+        }
         refreshResample(node, parameters, num, data);
         STATUS_ERROR_CHECK(createRPPHandle(node, &data->handle, data->pSrcDesc->n, data->deviceType));
         STATUS_ERROR_CHECK(vxSetNodeAttribute(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
@@ -218,6 +346,17 @@ static vx_status VX_CALLBACK uninitializeResample(vx_node node, const vx_referen
     STATUS_ERROR_CHECK(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
     if (data->pInRateTensor) delete[] data->pInRateTensor;
     if (data->pSrcRoi) delete[] data->pSrcRoi;
+    if (data->ppStreamHistory) {
+        for (uint32_t n = 0; n < data->pSrcDesc->n; n++)
+            if (data->ppStreamHistory[n]) delete[] data->ppStreamHistory[n];
+        delete[] data->ppStreamHistory;
+    }
+    if (data->pStreamWindow) delete[] data->pStreamWindow;
+    if (data->pStreamHistoryCapacity) delete[] data->pStreamHistoryCapacity;
+    if (data->pStreamOutPos) delete[] data->pStreamOutPos;
+    if (data->pStreamInRate) delete[] data->pStreamInRate;
+    if (data->pStreamOutRate) delete[] data->pStreamOutRate;
+    if (data->pStreamChannels) delete[] data->pStreamChannels;
     if (data->pSrcDesc) delete data->pSrcDesc;
     if (data->pDstDesc) delete data->pDstDesc;
     STATUS_ERROR_CHECK(releaseRPPHandle(node, data->handle, data->deviceType));
@@ -247,7 +386,7 @@ vx_status Resample_Register(vx_context context) {
     vx_kernel kernel = vxAddUserKernel(context, "org.rpp.Resample",
                                        VX_KERNEL_RPP_RESAMPLE,
                                        processResample,
-                                       8,
+                                       9,
                                        validateResample,
                                        initializeResample,
                                        uninitializeResample);
@@ -273,6 +412,7 @@ vx_status Resample_Register(vx_context context) {
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 5, VX_INPUT, VX_TYPE_ARRAY, VX_PARAMETER_STATE_REQUIRED));
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 6, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 7, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+        PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 8, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
         PARAM_ERROR_CHECK(vxFinalizeKernel(kernel));
     }
     if (status != VX_SUCCESS) {
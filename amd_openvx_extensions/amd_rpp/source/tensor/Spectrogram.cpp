@@ -39,6 +39,12 @@ struct SpectrogramLocalData {
     RpptDescPtr pDstDesc;
     Rpp32s *pSrcLength;
     Rpp32f *pWindowFn;
+    bool streaming;                 // chunks of long streams: samples of the last partial window are carried across executions
+    RpptDescPtr pStreamDesc;
+    Rpp32f *pStreamSrc;             // per sample: unconsumed tail of the previous chunk followed by the current chunk
+    Rpp32s *pStreamTail;
+    Rpp32s streamCapacity;
+    Rpp32s maxDstFrames;
     size_t inputTensorDims[RPP_MAX_TENSOR_DIMS];
     size_t outputTensorDims[RPP_MAX_TENSOR_DIMS];
 };
@@ -57,6 +63,48 @@ void updateDstRoi(SpectrogramLocalData *data, RpptROI *src_roi, RpptROI *dst_roi
     }
 }
 
+// appends each chunk to the unconsumed tail of its stream and emits only the complete windows,
+// so that the frames of consecutive chunks are identical to the frames of the whole signal
+static void updateStreamDstRoi(vx_node node, SpectrogramLocalData *data, RpptROI *src_roi, RpptROI *dst_roi) {
+    const Rpp32s num_frames = ((data->nfft / 2) + 1);
+    Rpp32f *src = static_cast<Rpp32f *>(data->pSrc);
+    for (unsigned i = 0; i < data->inputTensorDims[0]; i++) {
+        Rpp32f *stream = data->pStreamSrc + i * data->streamCapacity;
+        Rpp32s chunk_length = static_cast<int>(src_roi[i].xywhROI.roiWidth);
+        if (data->pStreamTail[i] + chunk_length > data->streamCapacity) {
+            Rpp32s drop = data->pStreamTail[i] + chunk_length - data->streamCapacity;
+            vxAddLogEntry((vx_reference)node, VX_FAILURE, "Spectrogram: output too small for the stream, dropping %d samples\n", drop);
+            memmove(stream, stream + drop, sizeof(Rpp32f) * (data->pStreamTail[i] - drop));
+            data->pStreamTail[i] -= drop;
+        }
+        memcpy(stream + data->pStreamTail[i], src + i * data->pSrcDesc->strides.nStride, sizeof(Rpp32f) * chunk_length);
+        Rpp32s length = data->pStreamTail[i] + chunk_length;
+        Rpp32s frames = (length >= data->windowLength) ? ((length - data->windowLength) / data->windowStep) + 1 : 0;
+        frames = std::min(frames, data->maxDstFrames);
+        data->pSrcLength[i] = (frames > 0) ? ((frames - 1) * data->windowStep + data->windowLength) : 0;
+        data->pStreamTail[i] = length;
+        if (data->spectrogramLayout == vxTensorLayout::VX_NTF) {
+            dst_roi[i].xywhROI.roiWidth = frames;
+            dst_roi[i].xywhROI.roiHeight = num_frames;
+        } else if (data->spectrogramLayout == vxTensorLayout::VX_NFT) {
+            dst_roi[i].xywhROI.roiWidth = num_frames;
+            dst_roi[i].xywhROI.roiHeight = frames;
+        }
+    }
+}
+
+// keeps the samples that did not complete a window for the next chunk
+static void consumeStreamFrames(SpectrogramLocalData *data) {
+    for (unsigned i = 0; i < data->inputTensorDims[0]; i++) {
+        Rpp32f *stream = data->pStreamSrc + i * data->streamCapacity;
+        Rpp32s consumed = (data->pSrcLength[i] > 0) ? (data->pSrcLength[i] - data->windowLength + data->windowStep) : 0;
+        consumed = std::min(consumed, data->pStreamTail[i]);
+        data->pStreamTail[i] -= consumed;
+        if (consumed > 0 && data->pStreamTail[i] > 0)
+            memmove(stream, stream + consumed, sizeof(Rpp32f) * data->pStreamTail[i]);
+    }
+}
+
 static vx_status VX_CALLBACK refreshSpectrogram(vx_node node, const vx_reference *parameters, SpectrogramLocalData *data) {
     vx_status status = VX_SUCCESS;
     vx_status return_status = VX_SUCCESS;
@@ -71,7 +119,15 @@ static vx_status VX_CALLBACK refreshSpectrogram(vx_node node, const vx_reference
         STATUS_ERROR_CHECK(vxQueryTensor((vx_tensor)parameters[2], VX_TENSOR_BUFFER_HOST, &data->pDst, sizeof(data->pDst)));
         STATUS_ERROR_CHECK(vxQueryTensor((vx_tensor)parameters[3], VX_TENSOR_BUFFER_HOST, &roi_tensor_ptr_dst, sizeof(roi_tensor_ptr_dst)));
     }
-    updateDstRoi(data, reinterpret_cast<RpptROI *>(roi_tensor_ptr_src), reinterpret_cast<RpptROI *>(roi_tensor_ptr_dst));
+    if (data->streaming) {
+        vx_bool reset = vx_false_e;
+        STATUS_ERROR_CHECK(vxCopyScalar((vx_scalar)parameters[13], &reset, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        if (reset)
+            memset(data->pStreamTail, 0, sizeof(Rpp32s) * data->pSrcDesc->n);
+        updateStreamDstRoi(node, data, reinterpret_cast<RpptROI *>(roi_tensor_ptr_src), reinterpret_cast<RpptROI *>(roi_tensor_ptr_dst));
+    } else {
+        updateDstRoi(data, reinterpret_cast<RpptROI *>(roi_tensor_ptr_src), reinterpret_cast<RpptROI *>(roi_tensor_ptr_dst));
+    }
     return status;
 }
 
@@ -102,6 +158,15 @@ static vx_status VX_CALLBACK validateSpectrogram(vx_node node, const vx_referenc
     STATUS_ERROR_CHECK(vxQueryScalar((vx_scalar)parameters[12], VX_SCALAR_TYPE, &scalar_type, sizeof(scalar_type)));
     if (scalar_type != VX_TYPE_UINT32)
         return ERRMSG(VX_ERROR_INVALID_TYPE, "validate: Parameter: #12 type=%d (must be size)\n", scalar_type);
+    if (parameters[13]) {
+        STATUS_ERROR_CHECK(vxQueryScalar((vx_scalar)parameters[13], VX_SCALAR_TYPE, &scalar_type, sizeof(scalar_type)));
+        if (scalar_type != VX_TYPE_BOOL)
+            return ERRMSG(VX_ERROR_INVALID_TYPE, "validate: Parameter: #13 type=%d (must be bool)\n", scalar_type);
+        vx_bool center_windows = vx_false_e;
+        STATUS_ERROR_CHECK(vxCopyScalar((vx_scalar)parameters[5], &center_windows, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+        if (center_windows)
+            return ERRMSG(VX_ERROR_INVALID_VALUE, "validate: Spectrogram: centerWindows=%d (must be false for streaming)\n", center_windows);
+    }
 
     // Check for input parameters
     size_t num_tensor_dims;
@@ -136,8 +201,14 @@ static vx_status VX_CALLBACK processSpectrogram(vx_node node, const vx_reference
 #endif
     } else if (data->deviceType == AGO_TARGET_AFFINITY_CPU) {
 #if RPP_AUDIO
-        rpp_status = rppt_spectrogram_host(data->pSrc, data->pSrcDesc, data->pDst, data->pDstDesc, data->pSrcLength, data->centerWindows, data->reflectPadding,
-                                           data->pWindowFn, data->nfft, data->power, data->windowLength, data->windowStep, data->handle->rppHandle);
+        if (data->streaming) {
+            rpp_status = rppt_spectrogram_host(data->pStreamSrc, data->pStreamDesc, data->pDst, data->pDstDesc, data->pSrcLength, data->centerWindows, data->reflectPadding,
+                                               data->pWindowFn, data->nfft, data->power, data->windowLength, data->windowStep, data->handle->rppHandle);
+            consumeStreamFrames(data);
+        } else {
+            rpp_status = rppt_spectrogram_host(data->pSrc, data->pSrcDesc, data->pDst, data->pDstDesc, data->pSrcLength, data->centerWindows, data->reflectPadding,
+                                               data->pWindowFn, data->nfft, data->power, data->windowLength, data->windowStep, data->handle->rppHandle);
+        }
         return_status = (rpp_status == RPP_SUCCESS) ? VX_SUCCESS : VX_FAILURE;
 #else
         return_status = VX_ERROR_NOT_SUPPORTED; 
@@ -184,6 +255,18 @@ static vx_status VX_CALLBACK initializeSpectrogram(vx_node node, const vx_refere
 
         data->pSrcLength = new int[data->pSrcDesc->n];
         data->pWindowFn = new float[data->windowLength];
+        data->streaming = (parameters[13] != nullptr);
+        if (data->streaming) {
+            // the output must hold the frames of a full chunk plus the partial window carried over from the previous one
+            data->maxDstFrames = static_cast<Rpp32s>((data->spectrogramLayout == vxTensorLayout::VX_NTF) ? data->outputTensorDims[1] : data->outputTensorDims[2]);
+            data->streamCapacity = static_cast<Rpp32s>(data->inputTensorDims[1]) + data->windowLength;
+            data->pStreamDesc = new RpptDesc;
+            *data->pStreamDesc = *data->pSrcDesc;
+            data->pStreamDesc->h = data->streamCapacity;
+            data->pStreamDesc->strides.nStride = data->streamCapacity * data->pStreamDesc->strides.hStride;
+            data->pStreamSrc = new float[data->pSrcDesc->n * data->streamCapacity]();
+            data->pStreamTail = new int[data->pSrcDesc->n]();
+        }
 
         STATUS_ERROR_CHECK(vxCopyArrayRange((vx_array)parameters[4], 0, data->windowLength, sizeof(float), data->pWindowFn, VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
         STATUS_ERROR_CHECK(createRPPHandle(node, &data->handle, data->pSrcDesc->n, data->deviceType));
@@ -199,6 +282,9 @@ static vx_status VX_CALLBACK uninitializeSpectrogram(vx_node node, const vx_refe
     STATUS_ERROR_CHECK(vxQueryNode(node, VX_NODE_LOCAL_DATA_PTR, &data, sizeof(data)));
     if (data->pSrcLength) delete[] data->pSrcLength;
     if (data->pWindowFn) delete[] data->pWindowFn;
+    if (data->pStreamSrc) delete[] data->pStreamSrc;
+    if (data->pStreamTail) delete[] data->pStreamTail;
+    if (data->pStreamDesc) delete data->pStreamDesc;
     if (data->pSrcDesc) delete data->pSrcDesc;
     if (data->pDstDesc) delete data->pDstDesc;
     STATUS_ERROR_CHECK(releaseRPPHandle(node, data->handle, data->deviceType));
@@ -229,7 +315,7 @@ vx_status Spectrogram_Register(vx_context context) {
     vx_kernel kernel = vxAddUserKernel(context, "org.rpp.Spectrogram",
                                        VX_KERNEL_RPP_SPECTROGRAM,
                                        processSpectrogram,
-                                       13,
+                                       14,
                                        validateSpectrogram,
                                        initializeSpectrogram,
                                        uninitializeSpectrogram);
@@ -260,6 +346,7 @@ vx_status Spectrogram_Register(vx_context context) {
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 10, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 11, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
         PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 12, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_REQUIRED));
+        PARAM_ERROR_CHECK(vxAddParameterToKernel(kernel, 13, VX_INPUT, VX_TYPE_SCALAR, VX_PARAMETER_STATE_OPTIONAL));
         PARAM_ERROR_CHECK(vxFinalizeKernel(kernel));
     }
     if (status != VX_SUCCESS) {
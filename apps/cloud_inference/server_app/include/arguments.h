@@ -24,6 +24,7 @@ THE SOFTWARE.
 #define ARGUMENTS_H
 
 #include "common.h"
+#include "modelcache.h"
 #include <vector>
 #include <string>
 #include <tuple>
@@ -33,7 +34,7 @@ THE SOFTWARE.
 #include <stdio.h>
 #if ENABLE_OPENCL
 #include <CL/cl.h>
-#else
+#elif ENABLE_HIP
 #ifndef __HIP_PLATFORM_AMD__
 #define __HIP_PLATFORM_AMD__
 #endif
@@ -59,6 +60,9 @@ public:
     int getNumGPUs() {
         return numGPUs;
     }
+    int getNumSessionWorkers() {
+        return numSessionWorkers;
+    }
     const std::string& getConfigurationDir() {
         return configurationDir;
     }
@@ -77,6 +81,10 @@ public:
         return modelCompilerPath;
     }
 
+    ModelCache * getModelCache() {
+        return modelCache;
+    }
+
     // global mutex
     void lock() {
         mutex.lock();
@@ -148,6 +156,14 @@ public:
     {
         return numDecThreads;
     }
+    bool cpuInference()
+    {
+        return (numGPUs < 1 || num_devices < 1) ? true : false;
+    }
+    int getNumCpuWorkers()
+    {
+        return numCpuWorkers;
+    }
 #if ENABLE_OPENCL
     // device resources
     int lockGpuDevices(int GPUs, cl_device_id * device_id_);
@@ -174,6 +190,8 @@ private:
     int numGPUs;
     int useFp16Inference;
     int numDecThreads;
+    int numSessionWorkers;
+    int numCpuWorkers;
     int gpuIdList[MAX_NUM_GPU];
     std::string password;
     // derived configuration
@@ -192,6 +210,7 @@ private:
     std::string configurationDir;
     std::string localShadowRootDir;
     std::string modelCompilerPath;
+    ModelCache * modelCache;
     std::vector<std::tuple<std::string,int,int,int,int,int,int,int,float,float,float,float,float,float,std::string>> configuredModels;
     std::vector<std::tuple<std::string,int,int,int,int,int,int,int,float,float,float,float,float,float>> uploadedModels;
     // misc
@@ -33,6 +33,7 @@ THE SOFTWARE.
 #include <vector>
 #include <mutex>
 #include <thread>
+#include <atomic>
 #include <unordered_map>
 #include <condition_variable>
 #include <VX/vx.h>
@@ -87,6 +88,7 @@ extern "C" {
 
 extern "C" {
     typedef VX_API_ENTRY vx_status VX_API_CALL type_annAddToGraph(vx_graph graph, vx_tensor input, vx_tensor output, const char * binaryFilename);
+    typedef VX_API_ENTRY vx_status VX_API_CALL type_annReleaseGraph(vx_graph * graph);
 };
 
 template<typename T>
@@ -256,6 +258,7 @@ protected:
     void * moduleHandle;
     type_annCreateGraph * annCreateGraph;
     type_annAddToGraph  * annAddtoGraph;
+    type_annReleaseGraph * annReleaseGraph;
     int batchSize;
     int inputSizeInBytes;
     int outputSizeInBytes;
@@ -271,7 +274,8 @@ protected:
 
     vx_status DecodeScaleAndConvertToTensor(vx_size width, vx_size height, int size, unsigned char *inp, float *out, int use_fp16=0);
     void DecodeScaleAndConvertToTensorBatch(std::vector<std::tuple<char*, int>>& batch_Q, int start, int end, int dim[3], float *tens_buf);
-    void RGB_resize(unsigned char *Rgb_in, unsigned char *Rgb_out, unsigned int swidth, unsigned int sheight, unsigned int sstride, unsigned int dwidth, unsigned int dheight);
+    // context used by the decoder threads for the immediate-mode preprocessing node
+    vx_context preprocess_context;
 
 #if INFERENCE_SCHEDULER_MODE == NO_INFERENCE_SCHEDULER && !DONOT_RUN_INFERENCE
     // OpenVX resources
@@ -325,6 +329,36 @@ private:
 
 };
 
+#if INFERENCE_SCHEDULER_MODE == LIBRE_INFERENCE_SCHEDULER
+// CPU inference engine: runs the compiled module with host tensors using one scheduler
+// pipeline per CPU worker; the threads and buffers of a worker stay on its NUMA node
+class InferenceEngineCpu:public InferenceEngine
+{
+public:
+    InferenceEngineCpu(int sock_, Arguments * args, const std::string clientName, InfComCommand * cmd);
+    ~InferenceEngineCpu();
+    int run();
+
+protected:
+    virtual void workMasterInputQ();
+    virtual void workDeviceInputCopy(int worker);
+    virtual void workDeviceProcess(int worker);
+    virtual void workDeviceOutputCopy(int worker);
+
+private:
+    void bindWorker(int worker);
+    void initializeWorker(int worker);
+    MessageQueue<void *>                 * queueDeviceInputMemIdle[MAX_NUM_GPU];
+    MessageQueue<void *>                 * queueDeviceInputMemBusy[MAX_NUM_GPU];
+    MessageQueue<void *>                 * queueDeviceOutputMemIdle[MAX_NUM_GPU];
+    MessageQueue<void *>                 * queueDeviceOutputMemBusy[MAX_NUM_GPU];
+    // scheduler resources
+    int                 workerNode[MAX_NUM_GPU];
+    std::vector<int>    workerCpus[MAX_NUM_GPU];
+    std::atomic<int>    activeOutputWorkers;
+};
+#endif
+
 #if ENABLE_HIP
 class InferenceEngineHip:public InferenceEngine
 {
@@ -0,0 +1,89 @@
+/*
+Copyright (c) 2017 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef MODELCACHE_H
+#define MODELCACHE_H
+
+#include <string>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <tuple>
+#include <stdint.h>
+
+// Module cache information file (output dimensions of a cached module)
+#define MODULE_CACHE_INFO  "annmodule.cache"
+// Module cache format version: part of every cache key, bump when the layout of cached modules changes
+#define MODULE_CACHE_VERSION  1
+
+// SHA-256 digest of model files and compiler options used as cache key
+class ModelHash {
+public:
+    ModelHash();
+    void update(const void * data, size_t size);
+    void update(int value);
+    void update(const std::string& value);
+    // hash the name, size and content of a file: returns -1 if the file can't be read
+    int updateFile(const std::string& fileName);
+    std::string hexdigest();
+
+private:
+    void transform(const uint8_t * block);
+    uint32_t state[8];
+    uint8_t buffer[64];
+    uint64_t length;
+};
+
+// content-hash keyed cache of compiled modules under <configurationDir>/cache/<key>:
+// each entry is a complete model folder (model files, weights, build/libannmodule.so)
+// and model folders of repeat uploads are populated with links into the entry.
+// The cache has no size bound: entries are kept until removed from the cache folder
+// while the server is not running.
+class ModelCache {
+public:
+    ModelCache(const std::string& cacheDir);
+    ~ModelCache();
+    // scan cache folder and pre-load cached modules
+    int preload();
+    // get output dimensions of a cached module: returns true on cache hit
+    bool lookup(const std::string& key, int dimOutput[3]);
+    // move a compiled model folder into the cache and link it back to modelFolder: returns -1 when
+    // the module is not cached and modelFolder is left as it was, -2 when modelFolder could not be restored
+    int insert(const std::string& key, const std::string& modelFolder, const int dimOutput[3]);
+    // populate modelFolder with links to the cached entry
+    int link(const std::string& key, const std::string& modelFolder);
+
+protected:
+    std::string getEntryFolder(const std::string& key) {
+        return cacheDir + "/" + key;
+    }
+    void loadModule(const std::string& key);
+
+private:
+    std::string cacheDir;
+    std::mutex mutex;
+    std::map<std::string,std::tuple<int,int,int>> entries;
+    std::vector<void *> moduleHandles;
+};
+
+#endif
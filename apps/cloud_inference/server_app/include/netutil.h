@@ -44,6 +44,11 @@ int recvCommand(int sock,       InfComCommand& cmd, std::string& clientName, int
 
 void dumpCommand(const char * info, const InfComCommand& cmd);
 
+// pooled buffers for received byte streams: the buffers are recycled
+// after decode instead of being allocated and released for each image
+char * allocBuffer(size_t size);
+void releaseBuffer(char * buf);
+
 int error_close(int sock, const char * format, ...);
 
 #endif
@@ -32,8 +32,8 @@ Arguments::Arguments()
         : workFolder{ "~" }, modelFileDownloadCounter{ 0 },
           password{ "radeon" },
           modelCompilerPath{ "/opt/rocm/libexec/mivisionx/model_compiler/python" },
-          port{ 28282 }, batchSize{ 64 }, maxPendingBatches{ 4 }, numGPUs{ 1 }, gpuIdList{ 0 },
-          maxGpuId{ 0 }, platform_id{ NULL }, num_devices{ 0 },  deviceUseCount{ 0 }
+          port{ 28282 }, batchSize{ 64 }, maxPendingBatches{ 4 }, numGPUs{ 1 }, numSessionWorkers{ 16 }, numCpuWorkers{ 0 }, gpuIdList{ 0 },
+          maxGpuId{ 0 }, platform_id{ NULL }, num_devices{ 0 },  deviceUseCount{ 0 }, modelCache{ nullptr }
 {
     ////////
     /// \brief set default configuration file
@@ -84,20 +84,26 @@ Arguments::Arguments()
     ///
     size_t size;
     status = clGetDeviceIDs(platform_id, CL_DEVICE_TYPE_GPU, MAX_NUM_GPU, device_id, &num_devices);
-    if (status != CL_SUCCESS) {
+    if (status == CL_DEVICE_NOT_FOUND) {
+        warning("didn't find any GPU: using CPU inference engine");
+        num_devices = 0;
+    }
+    else if (status != CL_SUCCESS) {
         fatal("clGetDeviceIDs(*,CL_DEVICE_TYPE_GPU,%d,...) => %d", MAX_NUM_GPU, status);
     }
     info("using OpenCL platform#%d with %d GPU devices ...", platform_index, num_devices);
 #elif ENABLE_HIP
     hipError_t status;
     status = hipGetDeviceCount(&num_devices);
-    if (status != hipSuccess) {
-        fatal("ERROR: hipGetDeviceCount => %d (failed)\n", status);
+    if (status != hipSuccess || num_devices < 1) {
+        warning("didn't find any GPU: using CPU inference engine");
+        num_devices = 0;
     }
-    if (num_devices < 1) {
-        fatal("ERROR: didn't find any GPU!\n", status);
+    else {
+        info("using HIP with %d GPU devices ...", num_devices);
     }
-    info("using HIP with %d GPU devices ...", num_devices);
+#else
+    info("using CPU inference engine ...");
 #endif
     // set default config to use all GPUs
     numGPUs = num_devices;
@@ -116,6 +122,9 @@ Arguments::Arguments()
 
 Arguments::~Arguments()
 {
+    if(modelCache) {
+        delete modelCache;
+    }
 #if ENABLE_OPENCL
     // release OpenCL resources
     for(int gpuId = 0; gpuId < num_devices; gpuId++) {
@@ -282,6 +291,8 @@ static void show_usage()
     printf("\t\t\t\t[-fp16 \t<ON:1 or OFF:0>\t\t\t default:0]\n");
     printf("\t\t\t\t[-w \t<server working directory>\t default:~/]\n");
     printf("\t\t\t\t[-t \t<num cpu decoder threads [2-64]> default:1]\n");
+    printf("\t\t\t\t[-c \t<num session worker threads>\t default:16]\n");
+    printf("\t\t\t\t[-cpu \t<num cpu inference workers>\t default:one per NUMA node]\n");
     printf("\t\t\t\t[-gpu \t<comma separated list of GPUs>]\n");
     printf("\t\t\t\t[-q \t<max pending batches>]\n");
     printf("\t\t\t\t[-s \t<local shadow folder full path>]\n\n");
@@ -368,6 +379,16 @@ int Arguments::initializeConfig(int argc, char * argv[])
             argc -= 2;
             argv += 2;
         }
+        else if(!strcmp(argv[1], "-c")) {
+            numSessionWorkers = std::max(1, atoi(argv[2]));
+            argc -= 2;
+            argv += 2;
+        }
+        else if(!strcmp(argv[1], "-cpu")) {
+            numCpuWorkers = std::min(std::max(0, atoi(argv[2])), MAX_NUM_GPU);
+            argc -= 2;
+            argv += 2;
+        }
         else if(!strcmp(argv[1], "-t")) {
             numDecThreads = atoi(argv[2]);
             if (numDecThreads < 2) numDecThreads=0;
@@ -389,6 +410,12 @@ int Arguments::initializeConfig(int argc, char * argv[])
     ///
     getPreConfiguredModels();
 
+    ////////
+    /// \brief pre-load compiled model cache
+    ///
+    modelCache = new ModelCache(configurationDir + "/cache");
+    modelCache->preload();
+
     ////////
     /// \brief save configuration
     ///
@@ -440,7 +467,7 @@ void Arguments::releaseGpuDevices(int GPUs, const cl_device_id * device_id_)
     }
 }
 
-#elif ENABLE_HIP
+#else
 int Arguments::lockGpuDevices(int GPUs, int * device_id_)
 {
     std::lock_guard<std::mutex> lock(mutex);
@@ -44,167 +44,21 @@ THE SOFTWARE.
 #include "compiler.h"
 #include "netutil.h"
 #include "common.h"
+#include "modelcache.h"
 #include <sstream>
+#include <algorithm>
+#include <dirent.h>
 
-int runCompiler(int sock, Arguments * args, std::string& clientName, InfComCommand * cmdMode)
+static int buildModule(int sock, Arguments * args, std::string& clientName, const char * modelName,
+                       const std::string& modelFolder, const std::string& buildFolder, const int dimInput[3], int dimOutput[3])
 {
-    //////
-    /// \brief get and check parameters
-    ///
-    int dimInput[3] = { cmdMode->data[1], cmdMode->data[2], cmdMode->data[3] };
-    int modelType = cmdMode->data[4];
-    int reverseInputChannelOrder = cmdMode->data[5];
-    float preprocessMpy[3] = { *(float *)&cmdMode->data[6], *(float *)&cmdMode->data[7], *(float *)&cmdMode->data[8] };
-    float preprocessAdd[3] = { *(float *)&cmdMode->data[9], *(float *)&cmdMode->data[10], *(float *)&cmdMode->data[11] };
-    bool overrideModel = false;
-    std::string saveModelAs;
-    std::string password;
-    if(dimInput[0] <= 0 || dimInput[1] <= 0 || dimInput[2] != 3) {
-        dumpCommand("X", *cmdMode);
-        return error_close(sock, "unsupported input dimensions %dx%dx%d", dimInput[2], dimInput[1], dimInput[0]);
-    }
-    if(modelType != 0) {
-        dumpCommand("X", *cmdMode);
-        return error_close(sock, "unsupported compiler model type = %d", modelType);
-    }
-    if(strlen(cmdMode->message) > 0) {
-        std::stringstream ss(cmdMode->message);
-        std::string option;
-        while (std::getline(ss, option, ',')) {
-            info("option %s", option.c_str());
-            if(option == "override") {
-                overrideModel = true;
-            }
-            else if(option.size() > 5 && option.substr(0, 5) == "save=") {
-                saveModelAs = option.substr(5);
-            }
-            else if(option.size() > 7 && option.substr(0, 7) == "passwd=") {
-                password = option.substr(7);
-            }
-            else {
-                return error_close(sock, "unsupported compiler options [%s]", option.c_str());
-            }
-        }
-    }
-    if(saveModelAs.length() > 0) {
-        for(size_t i = 0; i < saveModelAs.length(); i++) {
-            if((i >= 32) ||
-               !((saveModelAs[i] >= 'a' && saveModelAs[i] <= 'z') ||
-                 (saveModelAs[i] >= 'A' && saveModelAs[i] <= 'Z') ||
-                 (saveModelAs[i] >= '0' && saveModelAs[i] <= '9') ||
-                 (saveModelAs[i] == '-') ||
-                 (saveModelAs[i] == '_')))
-            {
-                return error_close(sock, "invalid options: modelName is not valid [%s]", saveModelAs.c_str());
-            }
-        }
-        bool found = false;
-        for(size_t i = 0; i < args->getNumConfigureddModels(); i++) {
-            if(std::get<0>(args->getConfiguredModelInfo(i)) == saveModelAs ||
-               std::get<14>(args->getConfiguredModelInfo(i)) == saveModelAs)
-            {
-                found = true;
-                break;
-            }
-        }
-        if(!found) {
-            for(size_t i = 0; i < args->getNumUploadedModels(); i++) {
-                if(std::get<0>(args->getUploadedModelInfo(i)) == saveModelAs) {
-                    found = true;
-                    break;
-                }
-            }
-        }
-        if(found && !overrideModel) {
-            return error_close(sock, "modelName already in use [%s]", saveModelAs.c_str());
-        }
-        if(!args->checkPassword(password)) {
-            return error_close(sock, "invalid password");
-        }
-    }
-
-    //////
-    /// \brief generate new model name for this download and create model folders
-    ///
-    char modelName[64];
-    if(saveModelAs.length() > 0) {
-        sprintf(modelName, "%s", saveModelAs.c_str());
-    }
-    else {
-        sprintf(modelName, "upload/model-%08d", args->getNextModelUploadCounter());
-    }
-    std::string modelFolder = args->getConfigurationDir() + "/" + modelName;
-    std::string buildFolder = modelFolder + "/build";
-    // remove modelFolder if exists
-    std::string command = "/bin/rm -rf ";
-    command += modelFolder;
-    info("executing: %% %s", command.c_str());
-    if(system(command.c_str()) < 0) {
-        return error_close(sock, "unable to remove folder %s", modelName);
-    }
-    // make folders
-    if(mkdir(modelFolder.c_str(), 0700) < 0 || mkdir(buildFolder.c_str(), 0700) < 0) {
-        fatal("unable to create folders: %s and %s", modelFolder.c_str(), buildFolder.c_str());
-    }
-
-    //////
-    /// \brief download model files
-    ///
-    int modelFileCommand[2] = {
-        INFCOM_CMD_SEND_MODELFILE1, INFCOM_CMD_SEND_MODELFILE2
-    };
-    for(int i = 0; i < 2; i++) {
-        // send INFCOM_CMD_SEND_MODELFILE1 or INFCOM_CMD_SEND_MODELFILE2
-        InfComCommand cmd = {
-            INFCOM_MAGIC, modelFileCommand[i], { 0 }, { 0 }
-        };
-        ERRCHK(sendCommand(sock, cmd, clientName));
-        // wait for reply with same command and fileSize in bytes
-        ERRCHK(recvCommand(sock, cmd, clientName, modelFileCommand[i]));
-        // receive the modelFile byte stream
-        int size = cmd.data[0];
-        char * byteStream = nullptr;
-        if(size > 0) {
-            byteStream = new char [size];
-            int remaining = size;
-            while(remaining > 0) {
-                int n = recv(sock, byteStream + size - remaining, remaining, 0);
-                if(n < 1)
-                    break;
-                remaining -= n;
-            }
-            if(remaining > 0) {
-                delete[] byteStream;
-                return error_close(sock, "INFCOM_CMD_SEND_MODELFILE%d: could only received %d bytes out of %d bytes from %s", i + 1, size - remaining, size, clientName.c_str());
-            }
-            int eofMarker = 0;
-            recv(sock, &eofMarker, sizeof(eofMarker), 0);
-            if(eofMarker != INFCOM_EOF_MARKER) {
-                delete[] byteStream;
-                return error_close(sock, "INFCOM_CMD_SEND_MODELFILE%d: eofMarker 0x%08x (incorrect) from %s", i + 1, eofMarker, clientName.c_str());
-            }
-        }
-        if(byteStream) {
-            std::string fileName = modelFolder + ((i == 0) ? "/deploy.prototxt" : "/weights.caffemodel");
-            info("saving INFCOM_CMD_SEND_MODELFILE%d with %d bytes from %s into %s", i + 1, size, clientName.c_str(), fileName.c_str());
-            FILE * fp = fopen(fileName.c_str(), "wb");
-            if(fp) {
-                fwrite(byteStream, 1, size, fp);
-                fclose(fp);
-            }
-            else {
-                fatal("unable to create: %s", fileName.c_str());
-            }
-            delete[] byteStream;
-        }
-    }
-
     //////
     /// \brief start inference generator
     ///
     InfComCommand cmdUpdate = {
         INFCOM_MAGIC, INFCOM_CMD_COMPILER_STATUS, { 0 }, { 0 }
     };
+    std::string command;
     int status = chdir(modelFolder.c_str());
     if(status < 0) {
         cmdUpdate.data[0] = -1;
@@ -311,7 +165,6 @@ int runCompiler(int sock, Arguments * args, std::string& clientName, InfComComma
         }
     }
     // step-2: get output dimensions
-    int dimOutput[3] = { 0 };
     FILE * fp = fopen("caffe2openvx.log", "r");
     if(!fp) {
         return error_close(sock, "unable to open: caffe2openvx.log");
@@ -371,7 +224,236 @@ int runCompiler(int sock, Arguments * args, std::string& clientName, InfComComma
         return error_close(sock, "could not locate built module: %s", modulePath.c_str());
     }
 
+    return 0;
+}
+
+// add the model compiler to the model cache key, so that cached modules are rebuilt when it changes:
+// the python scripts of the model compiler folder, or the caffe2openvx executable found in PATH
+static void hashModelCompiler(ModelHash& modelHash, const std::string& modelCompilerPath)
+{
+    std::vector<std::string> fileList;
+    if(!modelCompilerPath.empty()) {
+        DIR * dir = opendir(modelCompilerPath.c_str());
+        if(dir) {
+            for(struct dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+                std::string name = entry->d_name;
+                if(name.size() > 3 && name.compare(name.size() - 3, 3, ".py") == 0)
+                    fileList.push_back(modelCompilerPath + "/" + name);
+            }
+            closedir(dir);
+        }
+    }
+    else if(getenv("PATH")) {
+        std::stringstream path(getenv("PATH"));
+        for(std::string folder; std::getline(path, folder, ':');) {
+            std::string fileName = folder + "/caffe2openvx";
+            if(access(fileName.c_str(), X_OK) == 0) {
+                fileList.push_back(fileName);
+                break;
+            }
+        }
+    }
+    std::sort(fileList.begin(), fileList.end());
+    for(auto& fileName : fileList) {
+        if(modelHash.updateFile(fileName) < 0)
+            warning("unable to read %s for model cache key", fileName.c_str());
+    }
+    modelHash.update((int)fileList.size());
+}
+
+int runCompiler(int sock, Arguments * args, std::string& clientName, InfComCommand * cmdMode)
+{
+    //////
+    /// \brief get and check parameters
+    ///
+    int dimInput[3] = { cmdMode->data[1], cmdMode->data[2], cmdMode->data[3] };
+    int modelType = cmdMode->data[4];
+    int reverseInputChannelOrder = cmdMode->data[5];
+    float preprocessMpy[3] = { *(float *)&cmdMode->data[6], *(float *)&cmdMode->data[7], *(float *)&cmdMode->data[8] };
+    float preprocessAdd[3] = { *(float *)&cmdMode->data[9], *(float *)&cmdMode->data[10], *(float *)&cmdMode->data[11] };
+    bool overrideModel = false;
+    std::string saveModelAs;
+    std::string password;
+    if(dimInput[0] <= 0 || dimInput[1] <= 0 || dimInput[2] != 3) {
+        dumpCommand("X", *cmdMode);
+        return error_close(sock, "unsupported input dimensions %dx%dx%d", dimInput[2], dimInput[1], dimInput[0]);
+    }
+    if(modelType != 0) {
+        dumpCommand("X", *cmdMode);
+        return error_close(sock, "unsupported compiler model type = %d", modelType);
+    }
+    if(strlen(cmdMode->message) > 0) {
+        std::stringstream ss(cmdMode->message);
+        std::string option;
+        while (std::getline(ss, option, ',')) {
+            info("option %s", option.c_str());
+            if(option == "override") {
+                overrideModel = true;
+            }
+            else if(option.size() > 5 && option.substr(0, 5) == "save=") {
+                saveModelAs = option.substr(5);
+            }
+            else if(option.size() > 7 && option.substr(0, 7) == "passwd=") {
+                password = option.substr(7);
+            }
+            else {
+                return error_close(sock, "unsupported compiler options [%s]", option.c_str());
+            }
+        }
+    }
+    if(saveModelAs.length() > 0) {
+        for(size_t i = 0; i < saveModelAs.length(); i++) {
+            if((i >= 32) ||
+               !((saveModelAs[i] >= 'a' && saveModelAs[i] <= 'z') ||
+                 (saveModelAs[i] >= 'A' && saveModelAs[i] <= 'Z') ||
+                 (saveModelAs[i] >= '0' && saveModelAs[i] <= '9') ||
+                 (saveModelAs[i] == '-') ||
+                 (saveModelAs[i] == '_')))
+            {
+                return error_close(sock, "invalid options: modelName is not valid [%s]", saveModelAs.c_str());
+            }
+        }
+        bool found = false;
+        for(size_t i = 0; i < args->getNumConfigureddModels(); i++) {
+            if(std::get<0>(args->getConfiguredModelInfo(i)) == saveModelAs ||
+               std::get<14>(args->getConfiguredModelInfo(i)) == saveModelAs)
+            {
+                found = true;
+                break;
+            }
+        }
+        if(!found) {
+            for(size_t i = 0; i < args->getNumUploadedModels(); i++) {
+                if(std::get<0>(args->getUploadedModelInfo(i)) == saveModelAs) {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        if(found && !overrideModel) {
+            return error_close(sock, "modelName already in use [%s]", saveModelAs.c_str());
+        }
+        if(!args->checkPassword(password)) {
+            return error_close(sock, "invalid password");
+        }
+    }
+
+    //////
+    /// \brief generate new model name for this download and create model folders
+    ///
+    char modelName[64];
+    if(saveModelAs.length() > 0) {
+        sprintf(modelName, "%s", saveModelAs.c_str());
+    }
+    else {
+        sprintf(modelName, "upload/model-%08d", args->getNextModelUploadCounter());
+    }
+    std::string modelFolder = args->getConfigurationDir() + "/" + modelName;
+    std::string buildFolder = modelFolder + "/build";
+    // remove modelFolder if exists
+    std::string command = "/bin/rm -rf ";
+    command += modelFolder;
+    info("executing: %% %s", command.c_str());
+    if(system(command.c_str()) < 0) {
+        return error_close(sock, "unable to remove folder %s", modelName);
+    }
+    // make folders
+    if(mkdir(modelFolder.c_str(), 0700) < 0 || mkdir(buildFolder.c_str(), 0700) < 0) {
+        fatal("unable to create folders: %s and %s", modelFolder.c_str(), buildFolder.c_str());
+    }
+
+    //////
+    /// \brief download model files
+    ///
+    // model cache key: content of model files and everything else that affects the generated module
+    ModelHash modelHash;
+    modelHash.update(modelType);
+    modelHash.update(dimInput[0]);
+    modelHash.update(dimInput[1]);
+    modelHash.update(dimInput[2]);
+    modelHash.update(args->getBatchSize());
+    modelHash.update(args->fp16Inference() ? 1 : 0);
+    modelHash.update(args->getModelCompilerPath());
+    modelHash.update(MODULE_CACHE_VERSION);
+    hashModelCompiler(modelHash, args->getModelCompilerPath());
+    int modelFileCommand[2] = {
+        INFCOM_CMD_SEND_MODELFILE1, INFCOM_CMD_SEND_MODELFILE2
+    };
+    for(int i = 0; i < 2; i++) {
+        // send INFCOM_CMD_SEND_MODELFILE1 or INFCOM_CMD_SEND_MODELFILE2
+        InfComCommand cmd = {
+            INFCOM_MAGIC, modelFileCommand[i], { 0 }, { 0 }
+        };
+        ERRCHK(sendCommand(sock, cmd, clientName));
+        // wait for reply with same command and fileSize in bytes
+        ERRCHK(recvCommand(sock, cmd, clientName, modelFileCommand[i]));
+        // receive the modelFile byte stream
+        int size = cmd.data[0];
+        char * byteStream = nullptr;
+        modelHash.update(size);
+        if(size > 0) {
+            byteStream = new char [size];
+            int remaining = size;
+            while(remaining > 0) {
+                int n = recv(sock, byteStream + size - remaining, remaining, 0);
+                if(n < 1)
+                    break;
+                remaining -= n;
+            }
+            if(remaining > 0) {
+                delete[] byteStream;
+                return error_close(sock, "INFCOM_CMD_SEND_MODELFILE%d: could only received %d bytes out of %d bytes from %s", i + 1, size - remaining, size, clientName.c_str());
+            }
+            int eofMarker = 0;
+            recv(sock, &eofMarker, sizeof(eofMarker), 0);
+            if(eofMarker != INFCOM_EOF_MARKER) {
+                delete[] byteStream;
+                return error_close(sock, "INFCOM_CMD_SEND_MODELFILE%d: eofMarker 0x%08x (incorrect) from %s", i + 1, eofMarker, clientName.c_str());
+            }
+        }
+        if(byteStream) {
+            modelHash.update(byteStream, size);
+            std::string fileName = modelFolder + ((i == 0) ? "/deploy.prototxt" : "/weights.caffemodel");
+            info("saving INFCOM_CMD_SEND_MODELFILE%d with %d bytes from %s into %s", i + 1, size, clientName.c_str(), fileName.c_str());
+            FILE * fp = fopen(fileName.c_str(), "wb");
+            if(fp) {
+                fwrite(byteStream, 1, size, fp);
+                fclose(fp);
+            }
+            else {
+                fatal("unable to create: %s", fileName.c_str());
+            }
+            delete[] byteStream;
+        }
+    }
+
+    //////
+    /// \brief reuse the cached module of a repeat upload or build a new one
+    ///
+    std::string modelKey = modelHash.hexdigest();
+    ModelCache * modelCache = args->getModelCache();
+    int dimOutput[3] = { 0 };
+    if(modelCache->lookup(modelKey, dimOutput)) {
+        info("found %s in model cache for %s", modelKey.c_str(), modelName);
+        if(rmdir(buildFolder.c_str()) < 0 || modelCache->link(modelKey, modelFolder) < 0) {
+            return error_close(sock, "unable to use model cache entry %s for %s", modelKey.c_str(), modelName);
+        }
+    }
+    else {
+        ERRCHK(buildModule(sock, args, clientName, modelName, modelFolder, buildFolder, dimInput, dimOutput));
+        int status = modelCache->insert(modelKey, modelFolder, dimOutput);
+        if(status < -1) {
+            return error_close(sock, "model folder of %s lost while adding it to model cache", modelName);
+        }
+        else if(status < 0) {
+            warning("unable to add %s to model cache", modelName);
+        }
+    }
+
     // step-final: send completion status message
+    InfComCommand cmdUpdate = {
+        INFCOM_MAGIC, INFCOM_CMD_COMPILER_STATUS, { 0 }, { 0 }
+    };
     cmdUpdate.data[0] = 1;
     cmdUpdate.data[1] = 100;
     cmdUpdate.data[2] = dimOutput[0];
@@ -383,7 +465,7 @@ int runCompiler(int sock, Arguments * args, std::string& clientName, InfComComma
 
     // create module configuration file
     std::string annModuleConfigFile = args->getConfigurationDir() + "/" + modelName + "/" + MODULE_CONFIG;
-    fp = fopen(annModuleConfigFile.c_str(), "w");
+    FILE * fp = fopen(annModuleConfigFile.c_str(), "w");
     if(fp) {
         fprintf(fp, "%s\n%d %d %d\n%d %d %d\n%d\n%g %g %g %g %g %g\n", modelName,
                        dimInput[0], dimInput[1], dimInput[2],
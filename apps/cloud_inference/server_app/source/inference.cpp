@@ -63,7 +63,7 @@ InferenceEngine::InferenceEngine(int sock_, Arguments * args_, const std::string
       receiveFileNames { (bool)cmd->data[8] }, topK { cmd->data[9] }, 
       detectBoundingBoxes { cmd->data[10] }, decodeMode { cmd->data[11] }, loop { (bool)cmd->data[12] },
       reverseInputChannelOrder{ 0 }, preprocessMpy{ 1, 1, 1 }, preprocessAdd{ 0, 0, 0 },
-      moduleHandle{ nullptr }, annCreateGraph{ nullptr }, annAddtoGraph { nullptr},
+      moduleHandle{ nullptr }, annCreateGraph{ nullptr }, annAddtoGraph { nullptr}, annReleaseGraph{ nullptr },
       deviceLockSuccess{ false }, useShadowFilenames{ false }
 #if INFERENCE_SCHEDULER_MODE == NO_INFERENCE_SCHEDULER && !DONOT_RUN_INFERENCE
     , openvx_context{ nullptr }, openvx_graph{ nullptr }, openvx_input{ nullptr }, openvx_output{ nullptr }
@@ -108,6 +108,10 @@ InferenceEngine::InferenceEngine(int sock_, Arguments * args_, const std::string
 
     if (detectBoundingBoxes)
         region = new CYoloRegion();
+    preprocess_context = vxCreateContext();
+    if (vxGetStatus((vx_reference)preprocess_context) != VX_SUCCESS) {
+        fatal("InferenceEngine: vxCreateContext(preprocess) failed");
+    }
     // lock devices
 #if ENABLE_OPENCL
     if(!args->lockGpuDevices(GPUs, device_id))
@@ -126,7 +130,8 @@ InferenceEngine::~InferenceEngine()
 #if ENABLE_OPENCL  
 #if INFERENCE_SCHEDULER_MODE == NO_INFERENCE_SCHEDULER && !DONOT_RUN_INFERENCE
     if(openvx_graph) {
-        vxReleaseGraph(&openvx_graph);
+        if(annReleaseGraph) annReleaseGraph(&openvx_graph);
+        else vxReleaseGraph(&openvx_graph);
     }
     if(openvx_input) {
         vxReleaseTensor(&openvx_input);
@@ -191,7 +196,8 @@ InferenceEngine::~InferenceEngine()
             delete queueDeviceOutputMemBusy[i];
         }
         if(openvx_graph[i]) {
-            vxReleaseGraph(&openvx_graph[i]);
+            if(annReleaseGraph) annReleaseGraph(&openvx_graph[i]);
+            else vxReleaseGraph(&openvx_graph[i]);
         }
         if(openvx_input[i]) {
             vxReleaseTensor(&openvx_input[i]);
@@ -220,343 +226,58 @@ InferenceEngine::~InferenceEngine()
     if (region) delete region;
     PROFILER_SHUTDOWN();
 #endif    
+    if (preprocess_context) {
+        vxReleaseContext(&preprocess_context);
+    }
 }
 
 vx_status InferenceEngine::DecodeScaleAndConvertToTensor(vx_size width, vx_size height, int size, unsigned char *inp, float *buf, int use_fp16)
 {
-    int length = width*height;
     cv::Mat matOrig = cv::imdecode(cv::Mat(1, size, CV_8UC1, inp), cv::IMREAD_COLOR);
-#if USE_SSE_OPTIMIZATION
-    unsigned char *data_resize = nullptr;
-    unsigned char * img;
-    if ((width == matOrig.cols) && (height == matOrig.rows))
-    {
-        // no resize required
-        img = matOrig.data;
-    }else
-    {
-        unsigned int aligned_size = ((length+width) * 3 + 128)&~127;
-        data_resize = new unsigned char[aligned_size];
-        RGB_resize(matOrig.data, data_resize, matOrig.cols, matOrig.rows, matOrig.step, width, height);
-        img = data_resize;
-    }
+    if (matOrig.empty())
+        return VX_FAILURE;
     PROFILER_START(inference_server_app, workRGBtoTensor);
-
-    __m128i mask_B, mask_G, mask_R;
-    if (reverseInputChannelOrder)
-    {
-        mask_B = _mm_setr_epi8((char)0x0, (char)0x80, (char)0x80, (char)0x80, (char)0x3, (char)0x80, (char)0x80, (char)0x80, (char)0x6, (char)0x80, (char)0x80, (char)0x80, (char)0x9, (char)0x80, (char)0x80, (char)0x80);
-        mask_G = _mm_setr_epi8((char)0x1, (char)0x80, (char)0x80, (char)0x80, (char)0x4, (char)0x80, (char)0x80, (char)0x80, (char)0x7, (char)0x80, (char)0x80, (char)0x80, (char)0xA, (char)0x80, (char)0x80, (char)0x80);
-        mask_R = _mm_setr_epi8((char)0x2, (char)0x80, (char)0x80, (char)0x80, (char)0x5, (char)0x80, (char)0x80, (char)0x80, (char)0x8, (char)0x80, (char)0x80, (char)0x80, (char)0xB, (char)0x80, (char)0x80, (char)0x80);
-    }
-    else
+    // scale, normalize and store planar with the ScaleCropImageToTensor node:
+    //   the decoded image is BGR, so the node's channel order is the reverse of the requested one
+    //   and out = pixel * mpy + add becomes (pixel - mean) / stddev with mean = -add/mpy and stddev = 1/mpy
+    vx_status status = VX_FAILURE;
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = matOrig.cols;
+    addr.dim_y = matOrig.rows;
+    addr.stride_x = 3;
+    addr.stride_y = (vx_int32)matOrig.step;
+    addr.scale_x = VX_SCALE_UNITY;
+    addr.scale_y = VX_SCALE_UNITY;
+    void * ptr = matOrig.data;
+    vx_image image = vxCreateImageFromHandle(preprocess_context, VX_DF_IMAGE_RGB, &addr, &ptr, VX_MEMORY_TYPE_HOST);
+    vx_size elemSize = use_fp16 ? sizeof(vx_uint16) : sizeof(vx_float32);
+    vx_size dims[3] = { width, height, 3 };
+    vx_size strides[3] = { elemSize, elemSize * width, elemSize * width * height };
+    vx_tensor tensor = vxCreateTensorFromHandle(preprocess_context, 3, dims, use_fp16 ? VX_TYPE_FLOAT16 : VX_TYPE_FLOAT32, 0, strides, buf, VX_MEMORY_TYPE_HOST);
+    vx_array mean = vxCreateArray(preprocess_context, VX_TYPE_FLOAT32, 3);
+    vx_array stddev = vxCreateArray(preprocess_context, VX_TYPE_FLOAT32, 3);
+    if (vxGetStatus((vx_reference)image) == VX_SUCCESS && vxGetStatus((vx_reference)tensor) == VX_SUCCESS &&
+        vxGetStatus((vx_reference)mean) == VX_SUCCESS && vxGetStatus((vx_reference)stddev) == VX_SUCCESS)
     {
-        mask_R = _mm_setr_epi8((char)0x0, (char)0x80, (char)0x80, (char)0x80, (char)0x3, (char)0x80, (char)0x80, (char)0x80, (char)0x6, (char)0x80, (char)0x80, (char)0x80, (char)0x9, (char)0x80, (char)0x80, (char)0x80);
-        mask_G = _mm_setr_epi8((char)0x1, (char)0x80, (char)0x80, (char)0x80, (char)0x4, (char)0x80, (char)0x80, (char)0x80, (char)0x7, (char)0x80, (char)0x80, (char)0x80, (char)0xA, (char)0x80, (char)0x80, (char)0x80);
-        mask_B = _mm_setr_epi8((char)0x2, (char)0x80, (char)0x80, (char)0x80, (char)0x5, (char)0x80, (char)0x80, (char)0x80, (char)0x8, (char)0x80, (char)0x80, (char)0x80, (char)0xB, (char)0x80, (char)0x80, (char)0x80);
-    }
-    int alignedLength = (length-2)& ~3;
-    bool bPreprocess = (preprocessMpy[0] != 1) & (preprocessAdd[0] != 0) ;
-    if (!use_fp16) {
-        float * B_buf = buf;
-        float * G_buf = B_buf + length;
-        float * R_buf = G_buf + length;
-        int i = 0;
-
-        __m128 fR, fG, fB;
-        if (bPreprocess) {
-            for (; i < alignedLength; i += 4)
-            {
-                __m128i pix0 = _mm_loadu_si128((__m128i *) img);
-                fB = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_B));
-                fG = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_G));
-                fR = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_R));
-                fB = _mm_mul_ps(fB, _mm_set1_ps(preprocessMpy[0]));
-                fG = _mm_mul_ps(fG, _mm_set1_ps(preprocessMpy[1]));
-                fR = _mm_mul_ps(fR, _mm_set1_ps(preprocessMpy[2]));
-                fB = _mm_add_ps(fB, _mm_set1_ps(preprocessAdd[0]));
-                fG = _mm_add_ps(fG, _mm_set1_ps(preprocessAdd[1]));
-                fR = _mm_add_ps(fR, _mm_set1_ps(preprocessAdd[2]));
-                _mm_storeu_ps(B_buf, fB);
-                _mm_storeu_ps(G_buf, fG);
-                _mm_storeu_ps(R_buf, fR);
-                B_buf += 4; G_buf += 4; R_buf += 4;
-                img += 12;
-            }
-            for (; i < length; i++, img += 3) {
-                *B_buf++ = (img[0] * preprocessMpy[0]) + preprocessAdd[0];
-                *G_buf++ = (img[1] * preprocessMpy[1]) + preprocessAdd[1];
-                *R_buf++ = (img[2] * preprocessMpy[2]) + preprocessAdd[2];
-            }
-        }else
-        {
-            for (; i < alignedLength; i += 4)
-            {
-                __m128i pix0 = _mm_loadu_si128((__m128i *) img);
-                fB = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_B));
-                fG = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_G));
-                fR = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_R));
-                _mm_storeu_ps(B_buf, fB);
-                _mm_storeu_ps(G_buf, fG);
-                _mm_storeu_ps(R_buf, fR);
-                B_buf += 4; G_buf += 4; R_buf += 4;
-                img += 12;
-            }
-            for (; i < length; i++, img += 3) {
-                *B_buf++ = img[0];
-                *G_buf++ = img[1];
-                *R_buf++ = img[2];
-            }
-        }
-    } else
-    {
-        unsigned short * B_buf = (unsigned short *)buf;
-        unsigned short * G_buf = B_buf + length;
-        unsigned short * R_buf = G_buf + length;
-        int i = 0;
-
-        __m128 fR, fG, fB;
-        __m128i hR, hG, hB;
-        if (bPreprocess) {
-            for (; i < alignedLength; i += 4)
-            {
-                __m128i pix0 = _mm_loadu_si128((__m128i *) img);
-                fB = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_B));
-                fG = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_G));
-                fR = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_R));
-                fB = _mm_mul_ps(fB, _mm_set1_ps(preprocessMpy[0]));
-                fG = _mm_mul_ps(fG, _mm_set1_ps(preprocessMpy[1]));
-                fR = _mm_mul_ps(fR, _mm_set1_ps(preprocessMpy[2]));
-                fB = _mm_add_ps(fB, _mm_set1_ps(preprocessAdd[0]));
-                fG = _mm_add_ps(fG, _mm_set1_ps(preprocessAdd[1]));
-                fR = _mm_add_ps(fR, _mm_set1_ps(preprocessAdd[2]));
-                // convert to half
-                hB = _mm_cvtps_ph(fB, 0xF);
-                hG = _mm_cvtps_ph(fG, 0xF);
-                hR = _mm_cvtps_ph(fR, 0xF);
-                _mm_storel_epi64((__m128i*)B_buf, hB);
-                _mm_storel_epi64((__m128i*)G_buf, hG);
-                _mm_storel_epi64((__m128i*)R_buf, hR);
-                B_buf += 4; G_buf += 4; R_buf += 4;
-                img += 12;
-            }
-            for (; i < length; i++, img += 3) {
-                *B_buf++ = _cvtss_sh((float)((img[0] * preprocessMpy[0]) + preprocessAdd[0]), 1);
-                *G_buf++ = _cvtss_sh((float)((img[1] * preprocessMpy[1]) + preprocessAdd[1]), 1);
-                *R_buf++ = _cvtss_sh((float)((img[2] * preprocessMpy[2]) + preprocessAdd[2]), 1);
-            }
-        } else
-        {
-            for (; i < alignedLength; i += 4)
-            {
-                __m128i pix0 = _mm_loadu_si128((__m128i *) img);
-                fB = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_B));
-                fG = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_G));
-                fR = _mm_cvtepi32_ps(_mm_shuffle_epi8(pix0, mask_R));
-                // convert to half
-                hB = _mm_cvtps_ph(fB, 0xF);
-                hG = _mm_cvtps_ph(fG, 0xF);
-                hR = _mm_cvtps_ph(fR, 0xF);
-                _mm_storel_epi64((__m128i*)B_buf, hB);
-                _mm_storel_epi64((__m128i*)G_buf, hG);
-                _mm_storel_epi64((__m128i*)R_buf, hR);
-                B_buf += 4; G_buf += 4; R_buf += 4;
-                img += 12;
-            }
-            for (; i < length; i++, img += 3) {
-                *B_buf++ = _cvtss_sh((float)img[0], 1);
-                *G_buf++ = _cvtss_sh((float)img[1], 1);
-                *R_buf++ = _cvtss_sh((float)img[2], 1);
-            }
+        vx_float32 meanValue[3], stddevValue[3];
+        for (int c = 0; c < 3; c++) {
+            meanValue[c] = -preprocessAdd[c] / preprocessMpy[c];
+            stddevValue[c] = 1.0f / preprocessMpy[c];
         }
+        vxAddArrayItems(mean, 3, meanValue, sizeof(vx_float32));
+        vxAddArrayItems(stddev, 3, stddevValue, sizeof(vx_float32));
+        status = vxuScaleCropImageToTensor(preprocess_context, (vx_reference)image, nullptr, mean, stddev,
+                                           reverseInputChannelOrder ? vx_false_e : vx_true_e, tensor);
     }
+    vxReleaseArray(&stddev);
+    vxReleaseArray(&mean);
+    vxReleaseTensor(&tensor);
+    vxReleaseImage(&image);
     PROFILER_STOP(inference_server_app, workRGBtoTensor);
-    if (data_resize != nullptr) delete[] data_resize;
-#else
-    cv::Mat matScaled;
-    cv::resize(matOrig, matScaled, cv::Size(width, height));
-    float *ptr = buf;
-    for (int c = 0; c < 3; c++, ptr += length) {
-        float a = preprocessMpy[c], b = preprocessAdd[c];
-        unsigned char * img = matScaled.data + (reverseInputChannelOrder ? c : (2 - c));
-        for (int i = 0; i < length; i++, img += 3) {
-            ptr[i] = *img * a + b;
-        }
-    }
-    matScaled.release();
-#endif
     matOrig.release();
-    return VX_SUCCESS;
+    return status;
 }
 
-#define FP_BITS     16
-#define FP_MUL      (1<<FP_BITS)
-
-void InferenceEngine::RGB_resize(unsigned char *Rgb_in, unsigned char *Rgb_out, unsigned int swidth, unsigned int sheight,  unsigned int sstride, unsigned int dwidth, unsigned int dheight)
-{
-    float xscale = (float)((double)swidth / (double)dwidth);
-    float yscale = (float)((double)sheight / (double)dheight);
-    int alignW = (dwidth + 15)&~15;
-    unsigned int *Xmap = new unsigned int[alignW*2];
-    unsigned short *Xf = (unsigned short *)(Xmap + alignW);
-    unsigned short *Xf1 = Xf + alignW;
-
-    int xpos = (int)(FP_MUL * (xscale*0.5 - 0.5));
-    int xinc = (int)(FP_MUL * xscale);
-    int yinc = (int)(FP_MUL * yscale);		// to convert to fixed point
-    unsigned int aligned_width = dwidth;
-    // generate xmap
-    for (unsigned int x = 0; x < dwidth; x++, xpos += xinc)
-    {
-        int xf;
-        int xmap = (xpos >> FP_BITS);
-        if (xmap >= (int)(swidth - 8)){
-            aligned_width = x;
-        }
-        if (xmap >= (int)(swidth - 1)){
-            Xmap[x] = (swidth - 1)*3;
-        }
-        else
-            Xmap[x] = (xmap<0)? 0: xmap*3;
-        xf = ((xpos & 0xffff) + 0x80) >> 8;
-        Xf[x] = xf;
-        Xf1[x] = (0x100 - xf);
-    }
-    aligned_width &= ~3;
-    int dstride = dwidth * 3;
-    unsigned char *pSrcBorder = Rgb_in + (sheight*sstride) - 3;    // points to the last pixel
-
-    int ypos = (int)(FP_MUL * (yscale*0.5 - 0.5));
-    for (int y = 0; y < (int)dheight; y++, ypos += yinc)
-    {
-        int ym, fy, fy1;
-        unsigned char *pSrc1, *pSrc2;
-        unsigned char *pdst = Rgb_out + y*dstride;
-
-        ym = (ypos >> FP_BITS);
-        fy = ((ypos & 0xffff) + 0x80) >> 8;
-        fy1 = (0x100 - fy);
-        if (ym >= (int)(sheight - 1)){
-            pSrc1 = pSrc2 = Rgb_in + (sheight - 1)*sstride;
-        }
-        else
-        {
-            pSrc1 = (ym<0)? Rgb_in : (Rgb_in + ym*sstride);
-            pSrc2 = pSrc1 + sstride;
-        }
-        __m128i w_y = _mm_setr_epi32(fy1, fy, fy1, fy);
-        const __m128i mm_zeros = _mm_setzero_si128();
-        const __m128i mm_round = _mm_set1_epi32((int)0x80);
-        __m128i p01, p23, ps01, ps23, pRG1, pRG2, pRG3;
-        unsigned int x = 0;
-        for (; x < aligned_width; x += 4)
-        {
-            // load 2 pixels each
-            p01 = _mm_loadl_epi64((const __m128i*) &pSrc1[Xmap[x]]);
-            p23 = _mm_loadl_epi64((const __m128i*) &pSrc1[Xmap[x+1]]);
-            ps01 = _mm_loadl_epi64((const __m128i*) &pSrc2[Xmap[x]]);
-            ps23 = _mm_loadl_epi64((const __m128i*) &pSrc2[Xmap[x + 1]]);
-            // unpcklo for p01 and ps01
-            p01 = _mm_unpacklo_epi8(p01, ps01);
-            p23 = _mm_unpacklo_epi8(p23, ps23);
-            p01 = _mm_unpacklo_epi16(p01, _mm_srli_si128(p01, 6));     //R0R1R2R3 G0G1G2G3 B0B1B2B3 XXXX for first pixel
-            p23 = _mm_unpacklo_epi16(p23, _mm_srli_si128(p23, 6));      //R0R1R2R3 G0G1G2G3 B0B1B2B3 XXXX for second pixel
-
-            // load xf and 1-xf
-            ps01 = _mm_setr_epi32(Xf1[x], Xf1[x], Xf[x], Xf[x]);			// xfxfxf1xf1
-            ps01 = _mm_mullo_epi32(ps01, w_y);                      // W0W1W2W3 for first pixel
-            ps23 = _mm_setr_epi32(Xf1[x + 1], Xf1[x + 1], Xf[x + 1], Xf[x + 1]);
-            ps23 = _mm_mullo_epi32(ps23, w_y);                      // W0W1W2W3 for second pixel
-            ps01 = _mm_srli_epi32(ps01, 8);                 // convert to 16bit
-            ps23 = _mm_srli_epi32(ps23, 8);                 // convert to 16bit
-            ps01 = _mm_packus_epi32(ps01, ps01);                 // convert to 16bit
-            ps23 = _mm_packus_epi32(ps23, ps23);                 // convert to 16bit
-
-            // extend to 16bit
-            pRG1 = _mm_unpacklo_epi8(p01, mm_zeros);        // R0R1R2R3 and G0G1G2G3
-            p01 = _mm_srli_si128(p01, 8);             // B0B1B2B3xxxx
-            p01 = _mm_unpacklo_epi32(p01, p23);       // B0B1B2B3 R0R1R2R3: ist and second
-            p23 = _mm_srli_si128(p23, 4);             // G0G1G2G3 B0B1B2B3 for second pixel
-            p01 = _mm_unpacklo_epi8(p01, mm_zeros);         // B0B1B2B3 R0R1R2R3
-            pRG2 = _mm_unpacklo_epi8(p23, mm_zeros);        // G0G1G2G3 B0B1B2B3 for second pixel
-
-            pRG1 = _mm_madd_epi16(pRG1, ps01);                  // (W0*R0+W1*R1), (W2*R2+W3*R3), (W0*G0+W1*G1), (W2*G2+W3*G3)
-            pRG2 = _mm_madd_epi16(pRG2, ps23);                  //(W0*R0+W1*R1), (W2*R2+W3*R3), (W0*G0+W1*G1), (W2*G2+W3*G3) for seond pixel
-            ps01 = _mm_unpacklo_epi64(ps01, ps23);
-            p01 = _mm_madd_epi16(p01, ps01);                  //(W0*B0+W1*B1), (W2*B2+W3*B3), (W0*R0+W1*R1), (W2*R2+W3*R3) 1st and second pixel
-
-            pRG1 = _mm_hadd_epi32(pRG1, p01);      // R0,G0, B0, R1 (32bit)
-            p01 = _mm_loadl_epi64((const __m128i*) &pSrc1[Xmap[x+2]]);
-            p23 = _mm_loadl_epi64((const __m128i*) &pSrc1[Xmap[x+3]]);
-            ps01 = _mm_loadl_epi64((const __m128i*) &pSrc2[Xmap[x+2]]);
-            ps23 = _mm_loadl_epi64((const __m128i*) &pSrc2[Xmap[x+3]]);
-            pRG1 = _mm_add_epi32(pRG1, mm_round);
-            // unpcklo for p01 and ps01
-            p01 = _mm_unpacklo_epi8(p01, ps01);
-            p01 = _mm_unpacklo_epi16(p01, _mm_srli_si128(p01, 6));     //R0R1R2R3 G0G1G2G3 B0B1B2B3 XXXX for first pixel
-            p23 = _mm_unpacklo_epi8(p23, ps23);
-            p23 = _mm_unpacklo_epi16(p23, _mm_srli_si128(p23, 6));      //R0R1R2R3 G0G1G2G3 B0B1B2B3 XXXX for second pixel
-            // load xf and 1-xf
-            ps01 = _mm_setr_epi32(Xf1[x+2], Xf1[x+2], Xf[x+2], Xf[x+2]);			// xfxfxf1xf1
-            ps01 = _mm_mullo_epi32(ps01, w_y);                      // W0W1W2W3 for first pixel
-            ps23 = _mm_setr_epi32(Xf1[x + 3], Xf1[x + 3], Xf[x + 3], Xf[x + 3]);
-            ps23 = _mm_mullo_epi32(ps23, w_y);                      // W0W1W2W3 for second pixel
-            ps01 = _mm_srli_epi32(ps01, 8);                 // convert to 16bit
-            ps23 = _mm_srli_epi32(ps23, 8);                 // convert to 16bit
-            ps01 = _mm_packus_epi32(ps01, ps01);                 // convert to 16bit
-            ps23 = _mm_packus_epi32(ps23, ps23);                 // convert to 16bit
-            // extend to 16bit
-            pRG3 = _mm_unpacklo_epi8(p01, mm_zeros);        // R0R1R2R3 and G0G1G2G3
-            p01 = _mm_srli_si128(p01, 8);             // B0B1B2B3xxxx
-            p01 = _mm_unpacklo_epi32(p01, p23);       // B0B1B2B3 R0R1R2R3: ist and second
-            p23 = _mm_srli_si128(p23, 4);             // G0G1G2G3 B0B1B2B3 for second pixel
-            p01 = _mm_unpacklo_epi8(p01, mm_zeros);         // B0B1B2B3 R0R1R2R3
-            p23 = _mm_unpacklo_epi8(p23, mm_zeros);        // G0G1G2G3 B0B1B2B3 for second pixel
-
-            pRG3 = _mm_madd_epi16(pRG3, ps01);                  // (W0*R0+W1*R1), (W2*R2+W3*R3), (W0*G0+W1*G1), (W2*G2+W3*G3)
-            p23 = _mm_madd_epi16(p23, ps23);                  //(W0*R0+W1*R1), (W2*R2+W3*R3), (W0*G0+W1*G1), (W2*G2+W3*G3) for seond pixel
-            ps01 = _mm_unpacklo_epi64(ps01, ps23);
-            p01 = _mm_madd_epi16(p01, ps01);                  //(W0*B0+W1*B1), (W2*B2+W3*B3), (W0*B0+W1*B1), (W2*B2+W3*B3) for seond pixel
-
-            pRG2 = _mm_hadd_epi32(pRG2, pRG3);      // G1, B1, R2,G2 (32bit)
-            p01 = _mm_hadd_epi32(p01, p23);      // B2,R3, G3, B3 (32bit)
-            pRG2 = _mm_add_epi32(pRG2, mm_round);
-            p01 = _mm_add_epi32(p01, mm_round);
-            pRG1 = _mm_srli_epi32(pRG1, 8);      // /256
-            pRG2 = _mm_srli_epi32(pRG2, 8);      // /256
-            p01 = _mm_srli_epi32(p01, 8);      // /256
-
-            // convert to 16bit
-            pRG1 = _mm_packus_epi32(pRG1, pRG2); //R0G0B0R1G1B1R2G2
-            p01 = _mm_packus_epi32(p01, p01); //B2R3B3G3
-            pRG1 = _mm_packus_epi16(pRG1, mm_zeros);
-            p01 = _mm_packus_epi16(p01, mm_zeros);
-            _mm_storeu_si128((__m128i *)pdst, _mm_unpacklo_epi64(pRG1, p01));
-            pdst += 12;
-        }
-
-        for (; x < dwidth; x++) {
-            int result;
-            const unsigned char *p0 = pSrc1 + Xmap[x];
-            const unsigned char *p01 = p0 + 3;
-            const unsigned char *p1 = pSrc2 + Xmap[x];
-            const unsigned char *p11 = p1 + 3;
-            if (p0 > pSrcBorder) p0 = pSrcBorder;
-            if (p1 > pSrcBorder) p1 = pSrcBorder;
-            if (p01 > pSrcBorder) p01 = pSrcBorder;
-            if (p11 > pSrcBorder) p11 = pSrcBorder;
-            result = ((Xf1[x] * fy1*p0[0]) + (Xf[x] * fy1*p01[0]) + (Xf1[x] * fy*p1[0]) + (Xf[x] * fy*p11[0]) + 0x8000) >> 16;
-            *pdst++ = (unsigned char) std::max(0, std::min(result, 255));
-            result = ((Xf1[x] * fy1*p0[1]) + (Xf[x] * fy1*p01[1]) + (Xf1[x] * fy*p1[1]) + (Xf[x] * fy*p11[1]) + 0x8000) >> 16;
-            *pdst++ = (unsigned char)std::max(0, std::min(result, 255));
-            result = ((Xf1[x] * fy1*p0[2]) + (Xf[x] * fy1*p01[2]) + (Xf1[x] * fy*p1[2]) + (Xf[x] * fy*p11[2]) + 0x8000) >> 16;
-            *pdst++ = (unsigned char)std::max(0, std::min(result, 255));
-        }
-    }
-    if (Xmap) delete[] Xmap;
-}
-
-
 void InferenceEngine::DecodeScaleAndConvertToTensorBatch(std::vector<std::tuple<char*, int>>& batch_Q, int start, int end, int dim[3], float *tens_buf)
 {
     for (int i = start; i <= end; i++)
@@ -574,7 +295,7 @@ void InferenceEngine::DecodeScaleAndConvertToTensorBatch(std::vector<std::tuple<
         else
             buf = (float *) tens_buf + dim[0] * dim[1] * dim[2] * i;
         DecodeScaleAndConvertToTensor(dim[0], dim[1], size, (unsigned char *)byteStream, buf, useFp16);
-        delete[] byteStream;
+        releaseBuffer(byteStream);
     }
 }
 
@@ -672,6 +393,10 @@ int InferenceEngine::run()
             found = false;
             error("could not find function annAddToGraph() in module %s for %s", modulePath.c_str(), clientName.c_str());
         }
+        else {
+            // modules generated without annReleaseGraph() keep the weights file mapped until exit
+            annReleaseGraph = (type_annReleaseGraph *) dlsym(moduleHandle, "annReleaseGraph");
+        }
     }
     else {
         error("unable to find requested model:%s input:%dx%dx%d output:%dx%dx%d from %s", modelName.c_str(),
@@ -1065,7 +790,7 @@ int InferenceEngine::run()
                         fseek(fp,0,SEEK_END);
                         int fsize = ftell(fp);
                         fseek(fp,0,SEEK_SET);
-                        byteStream = new char [fsize];
+                        byteStream = allocBuffer(fsize);
                         size = (int)fread(byteStream, 1, fsize, fp);
                         fclose(fp);
                         delete[] buff;
@@ -1076,7 +801,7 @@ int InferenceEngine::run()
                     else
                     {
                         // allocate and receive the image and EOF marker
-                        byteStream = new char [size];
+                        byteStream = allocBuffer(size);
                         ERRCHK(recvBuffer(sock, byteStream, size, clientName));
                     }
                     int eofMarker = 0;
@@ -1092,7 +817,7 @@ int InferenceEngine::run()
                     int label = tag % dimOutput[2];
                     std::this_thread::sleep_for(std::chrono::milliseconds(4));
                     // release byteStream and keep the results in outputQ
-                    delete[] byteStream;
+                    releaseBuffer(byteStream);
                     outputQ.enqueue(std::tuple<int,int>(tag,label));
 #else
                     // process the input immediately since there is no scheduler
@@ -1134,7 +859,7 @@ int InferenceEngine::run()
                         fatal("workDeviceProcess: vxUnmapTensorPatch(output)) failed(%d)", status);
                     }
                     // release byteStream and keep the results in outputQ
-                    delete[] byteStream;
+                    releaseBuffer(byteStream);
                     outputQ.enqueue(std::tuple<int,int>(tag,label));
 #endif
 #elif INFERENCE_SCHEDULER_MODE == LIBRE_INFERENCE_SCHEDULER
@@ -1320,7 +1045,7 @@ void InferenceEngine::workDeviceInputCopy(int gpu)
                 DecodeScaleAndConvertToTensor(dimInput[0], dimInput[1], size, (unsigned char *)byteStream, buf, useFp16);
                 PROFILER_STOP(inference_server_app, workDeviceInputCopyJpegDecode);
                 // release byteStream
-                delete[] byteStream;
+                releaseBuffer(byteStream);
             }
         }
         // unlock the OpenCL buffer to perform the writing
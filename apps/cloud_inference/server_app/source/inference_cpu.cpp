@@ -0,0 +1,948 @@
+/*
+Copyright (c) 2017 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "inference.h"
+#include "netutil.h"
+#include "common.h"
+#include <thread>
+#include <chrono>
+#include <dlfcn.h>
+#include <numeric>
+#include <pthread.h>
+#include <sched.h>
+
+#if INFERENCE_SCHEDULER_MODE == LIBRE_INFERENCE_SCHEDULER
+
+extern void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[]);
+
+// parse sysfs cpu/node lists of the form "0-3,8,10-11"
+static std::vector<int> parseCpuList(const char * list)
+{
+    std::vector<int> ids;
+    for(const char * p = list; *p && *p != '\n'; ) {
+        char * end = nullptr;
+        int first = (int)strtol(p, &end, 10), last = first;
+        if(end == p)
+            break;
+        if(*end == '-')
+            last = (int)strtol(end + 1, &end, 10);
+        for(int id = first; id <= last; id++)
+            ids.push_back(id);
+        p = (*end == ',') ? end + 1 : end;
+    }
+    return ids;
+}
+
+static std::vector<int> readCpuList(const std::string& fileName)
+{
+    char line[4096] = { 0 };
+    FILE * fp = fopen(fileName.c_str(), "r");
+    if(fp) {
+        if(!fgets(line, sizeof(line), fp))
+            line[0] = '\0';
+        fclose(fp);
+    }
+    return parseCpuList(line);
+}
+
+// get CPUs of each NUMA node: falls back to a single node with all CPUs of the process
+static std::vector<std::pair<int,std::vector<int>>> getNumaNodes()
+{
+    std::vector<std::pair<int,std::vector<int>>> nodes;
+    for(int node : readCpuList("/sys/devices/system/node/online")) {
+        std::vector<int> cpus = readCpuList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if(cpus.size() > 0)
+            nodes.push_back(std::make_pair(node, cpus));
+    }
+    if(nodes.size() == 0) {
+        std::vector<int> cpus;
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        if(sched_getaffinity(0, sizeof(cpuset), &cpuset) == 0) {
+            for(int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if(CPU_ISSET(cpu, &cpuset))
+                    cpus.push_back(cpu);
+            }
+        }
+        nodes.push_back(std::make_pair(0, cpus));
+    }
+    return nodes;
+}
+
+InferenceEngineCpu::InferenceEngineCpu(int sock_, Arguments * args_, const std::string clientName_, InfComCommand * cmd)
+                  :InferenceEngine(sock_, args_, clientName_, cmd),
+                  queueDeviceInputMemIdle{ nullptr }, queueDeviceInputMemBusy{ nullptr },
+                  queueDeviceOutputMemIdle{ nullptr }, queueDeviceOutputMemBusy{ nullptr },
+                  workerNode{ 0 }, activeOutputWorkers{ 0 }
+{
+    // one worker per NUMA node unless the number of workers is configured:
+    // workers are spread round-robin across the nodes
+    std::vector<std::pair<int,std::vector<int>>> nodes = getNumaNodes();
+    GPUs = args->getNumCpuWorkers();
+    if(GPUs < 1)
+        GPUs = std::min((int)nodes.size(), MAX_NUM_GPU);
+    for(int worker = 0; worker < GPUs; worker++) {
+        workerNode[worker] = nodes[worker % nodes.size()].first;
+        workerCpus[worker] = nodes[worker % nodes.size()].second;
+    }
+}
+
+InferenceEngineCpu::~InferenceEngineCpu()
+{
+    // wait for all threads to complete and release all resources
+    std::tuple<int,char*,int> endOfSequenceInput(-1,nullptr,0);
+    inputQ.enqueue(endOfSequenceInput);
+    if(threadMasterInputQ && threadMasterInputQ->joinable()) {
+        threadMasterInputQ->join();
+    }
+    if(threadMasterInputQ) {
+        delete threadMasterInputQ;
+        threadMasterInputQ = nullptr;
+    }
+    std::tuple<char*,int> endOfSequenceImage(nullptr,0);
+    int endOfSequenceTag = -1;
+    for(int i = 0; i < GPUs; i++) {
+        if(queueDeviceTagQ[i]) {
+            queueDeviceTagQ[i]->enqueue(endOfSequenceTag);
+        }
+        if(queueDeviceImageQ[i]) {
+            queueDeviceImageQ[i]->enqueue(endOfSequenceImage);
+        }
+        std::thread ** threads[3] = { &threadDeviceInputCopy[i], &threadDeviceProcess[i], &threadDeviceOutputCopy[i] };
+        for(auto thread : threads) {
+            if(*thread && (*thread)->joinable()) {
+                (*thread)->join();
+            }
+            if(*thread) {
+                delete *thread;
+                *thread = nullptr;
+            }
+        }
+        while(queueDeviceInputMemIdle[i] && queueDeviceInputMemIdle[i]->size() > 0) {
+            void * mem;
+            queueDeviceInputMemIdle[i]->dequeue(mem);
+            free(mem);
+        }
+        while(queueDeviceOutputMemIdle[i] && queueDeviceOutputMemIdle[i]->size() > 0) {
+            void * mem;
+            queueDeviceOutputMemIdle[i]->dequeue(mem);
+            free(mem);
+        }
+        if(queueDeviceTagQ[i]) {
+            delete queueDeviceTagQ[i];
+            queueDeviceTagQ[i] = nullptr;
+        }
+        if(queueDeviceImageQ[i]) {
+            delete queueDeviceImageQ[i];
+            queueDeviceImageQ[i] = nullptr;
+        }
+        if(queueDeviceInputMemIdle[i]) {
+            delete queueDeviceInputMemIdle[i];
+        }
+        if(queueDeviceInputMemBusy[i]) {
+            delete queueDeviceInputMemBusy[i];
+        }
+        if(queueDeviceOutputMemIdle[i]) {
+            delete queueDeviceOutputMemIdle[i];
+        }
+        if(queueDeviceOutputMemBusy[i]) {
+            delete queueDeviceOutputMemBusy[i];
+        }
+        if(openvx_graph[i]) {
+            if(annReleaseGraph) annReleaseGraph(&openvx_graph[i]);
+            else vxReleaseGraph(&openvx_graph[i]);
+        }
+        if(openvx_input[i]) {
+            vxReleaseTensor(&openvx_input[i]);
+        }
+        if(openvx_output[i]) {
+            vxReleaseTensor(&openvx_output[i]);
+        }
+        if(openvx_context[i]) {
+            vxReleaseContext(&openvx_context[i]);
+        }
+    }
+    // the base class releases whatever is still set
+    if(moduleHandle) {
+        dlclose(moduleHandle);
+        moduleHandle = nullptr;
+    }
+    if (region) {
+        delete region;
+        region = nullptr;
+    }
+#if !ENABLE_OPENCL
+    PROFILER_SHUTDOWN();
+#endif
+}
+
+void InferenceEngineCpu::bindWorker(int worker)
+{
+    // keep the calling thread on the CPUs of the worker's NUMA node
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for(int cpu : workerCpus[worker]) {
+        if(cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &cpuset);
+    }
+    if(CPU_COUNT(&cpuset) > 0 && pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+        warning("bindWorker: unable to bind CPU worker#%d to NUMA node#%d", worker, workerNode[worker]);
+    }
+}
+
+void InferenceEngineCpu::initializeWorker(int worker)
+{
+    // runs on a thread bound to the worker's node so that the first touch of the input/output
+    // buffers and of the activations allocated by the graph happens there; the weights are not
+    // node-local: all workers share the read-only mapping of the weights file
+    bindWorker(worker);
+
+    //////
+    // create OpenVX context
+    vx_status status;
+    openvx_context[worker] = vxCreateContext();
+    if((status = vxGetStatus((vx_reference)openvx_context[worker])) != VX_SUCCESS)
+        fatal("InferenceEngine: vxCreateContext(#%d) failed (%d)", worker, status);
+
+    // create scheduler device queues
+    queueDeviceTagQ[worker] = new MessageQueue<int>();
+    queueDeviceTagQ[worker]->setMaxQueueDepth(MAX_DEVICE_QUEUE_DEPTH);
+    queueDeviceImageQ[worker] = new MessageQueue<std::tuple<char*,int>>();
+    queueDeviceInputMemIdle[worker] = new MessageQueue<void *>();
+    queueDeviceInputMemBusy[worker] = new MessageQueue<void *>();
+    queueDeviceOutputMemIdle[worker] = new MessageQueue<void *>();
+    queueDeviceOutputMemBusy[worker] = new MessageQueue<void *>();
+
+    // create host buffers for input/output and add them to queueDeviceInputMemIdle/queueDeviceOutputMemIdle
+    size_t inputAllocSize = (inputSizeInBytes + 63) & ~63, outputAllocSize = (outputSizeInBytes + 63) & ~63;
+    void * memInput = nullptr, * memOutput = nullptr;
+    for(int i = 0; i < INFERENCE_PIPE_QUEUE_DEPTH; i++) {
+        memInput = aligned_alloc(64, inputAllocSize);
+        memOutput = aligned_alloc(64, outputAllocSize);
+        if(!memInput || !memOutput) {
+            fatal("InferenceEngine: aligned_alloc(#%d) of %d/%d bytes failed", worker, inputSizeInBytes, outputSizeInBytes);
+        }
+        memset(memInput, 0, inputAllocSize);
+        memset(memOutput, 0, outputAllocSize);
+        queueDeviceInputMemIdle[worker]->enqueue(memInput);
+        queueDeviceOutputMemIdle[worker]->enqueue(memOutput);
+    }
+    vx_size idim[4] = { (vx_size)dimInput[0], (vx_size)dimInput[1], (vx_size)dimInput[2], (vx_size)batchSize };
+    vx_size odim[4] = { (vx_size)dimOutput[0], (vx_size)dimOutput[1], (vx_size)dimOutput[2], (vx_size)batchSize };
+    vx_size istride[4] = { 4, (vx_size)4 * dimInput[0], (vx_size)4 * dimInput[0] * dimInput[1], (vx_size)4 * dimInput[0] * dimInput[1] * dimInput[2] };
+    vx_size ostride[4] = { 4, (vx_size)4 * dimOutput[0], (vx_size)4 * dimOutput[0] * dimOutput[1], (vx_size)4 * dimOutput[0] * dimOutput[1] * dimOutput[2] };
+    openvx_input[worker] = vxCreateTensorFromHandle(openvx_context[worker], 4, idim, VX_TYPE_FLOAT32, 0, istride, memInput, VX_MEMORY_TYPE_HOST);
+    openvx_output[worker] = vxCreateTensorFromHandle(openvx_context[worker], 4, odim, VX_TYPE_FLOAT32, 0, ostride, memOutput, VX_MEMORY_TYPE_HOST);
+    if((status = vxGetStatus((vx_reference)openvx_input[worker])) != VX_SUCCESS)
+        fatal("InferenceEngine: vxCreateTensorFromHandle(input#%d) failed (%d)", worker, status);
+    if((status = vxGetStatus((vx_reference)openvx_output[worker])) != VX_SUCCESS)
+        fatal("InferenceEngine: vxCreateTensorFromHandle(output#%d) failed (%d)", worker, status);
+
+    //////
+    // load the model
+    if (annCreateGraph != nullptr) {
+        openvx_graph[worker] = annCreateGraph(openvx_context[worker], openvx_input[worker], openvx_output[worker], modelPath.c_str());
+        if((status = vxGetStatus((vx_reference)openvx_graph[worker])) != VX_SUCCESS)
+            fatal("InferenceEngine: annCreateGraph(#%d) failed (%d)", worker, status);
+    }
+    else if (annAddtoGraph != nullptr) {
+        std::string weightsFile = modelPath + "/weights.bin";
+        vxRegisterLogCallback(openvx_context[worker], log_callback, vx_false_e);
+        openvx_graph[worker] = vxCreateGraph(openvx_context[worker]);
+        status = vxGetStatus((vx_reference)openvx_graph[worker]);
+        if(status) {
+            fatal("InferenceEngine: vxCreateGraph(#%d) failed (%d)", worker, status);
+        }
+        status = annAddtoGraph(openvx_graph[worker], openvx_input[worker], openvx_output[worker], weightsFile.c_str());
+        if(status) {
+            fatal("InferenceEngine: annAddToGraph(#%d) failed (%d)", worker, status);
+        }
+        status = vxVerifyGraph(openvx_graph[worker]);
+        if(status) {
+            fatal("InferenceEngine: vxVerifyGraph(#%d) failed (%d)", worker, status);
+        }
+    }
+}
+
+int InferenceEngineCpu::run()
+{
+    //////
+    /// make sure that the CPU inference engine supports the requested precision
+    ///
+    if(useFp16) {
+        return error_close(sock, "FP16 inference is not supported by the CPU inference engine for %s", clientName.c_str());
+    }
+
+    //////
+    /// check if server and client are in the same mode for data
+    ///
+    if (receiveFileNames && !useShadowFilenames)
+    {
+        return error_close(sock, "client is sending filenames but server is not configured with shadow folder\n");
+    }
+
+    //////
+    /// check if client is requesting topK which is not supported
+    ///
+    if (topK > 5)
+    {
+        return error_close(sock, "Number of topK confidances: %d not supported\n", topK);
+    }
+
+    //////
+    /// check for model validity
+    ///
+    bool found = false;
+    for(size_t i = 0; i < args->getNumConfigureddModels(); i++) {
+        std::tuple<std::string,int,int,int,int,int,int,int,float,float,float,float,float,float,std::string> info = args->getConfiguredModelInfo(i);
+        if(std::get<0>(info) == modelName &&
+           std::get<1>(info) == dimInput[0] &&
+           std::get<2>(info) == dimInput[1] &&
+           std::get<3>(info) == dimInput[2] &&
+           std::get<4>(info) == dimOutput[0] &&
+           std::get<5>(info) == dimOutput[1] &&
+           std::get<6>(info) == dimOutput[2])
+        {
+            reverseInputChannelOrder = std::get<7>(info);
+            preprocessMpy[0] = std::get<8>(info);
+            preprocessMpy[1] = std::get<9>(info);
+            preprocessMpy[2] = std::get<10>(info);
+            preprocessAdd[0] = std::get<11>(info);
+            preprocessAdd[1] = std::get<12>(info);
+            preprocessAdd[2] = std::get<13>(info);
+            modelPath = args->getConfigurationDir() + "/" + std::get<14>(info);
+            found = true;
+            break;
+        }
+    }
+    if(!found) {
+        for(size_t i = 0; i < args->getNumUploadedModels(); i++) {
+            std::tuple<std::string,int,int,int,int,int,int,int,float,float,float,float,float,float> info = args->getUploadedModelInfo(i);
+            if(std::get<0>(info) == modelName &&
+               std::get<1>(info) == dimInput[0] &&
+               std::get<2>(info) == dimInput[1] &&
+               std::get<3>(info) == dimInput[2] &&
+               std::get<4>(info) == dimOutput[0] &&
+               std::get<5>(info) == dimOutput[1] &&
+               std::get<6>(info) == dimOutput[2])
+            {
+                reverseInputChannelOrder = std::get<7>(info);
+                preprocessMpy[0] = std::get<8>(info);
+                preprocessMpy[1] = std::get<9>(info);
+                preprocessMpy[2] = std::get<10>(info);
+                preprocessAdd[0] = std::get<11>(info);
+                preprocessAdd[1] = std::get<12>(info);
+                preprocessAdd[2] = std::get<13>(info);
+                modelPath = args->getConfigurationDir() + "/" + modelName;
+                found = true;
+                break;
+            }
+        }
+    }
+    if(found) {
+        modulePath = modelPath + "/build/" + MODULE_LIBNAME;
+        moduleHandle = dlopen(modulePath.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if(!moduleHandle) {
+            found = false;
+            error("could not locate module %s for %s", modulePath.c_str(), clientName.c_str());
+        }
+        if (args->getModelCompilerPath().empty()) {
+            if(!(annCreateGraph = (type_annCreateGraph *) dlsym(moduleHandle, "annCreateGraph"))) {
+                found = false;
+                error("could not find function annCreateGraph() in module %s for %s", modulePath.c_str(), clientName.c_str());
+            }
+        }
+        else if(!(annAddtoGraph = (type_annAddToGraph *) dlsym(moduleHandle, "annAddToGraph"))) {
+            found = false;
+            error("could not find function annAddToGraph() in module %s for %s", modulePath.c_str(), clientName.c_str());
+        }
+        else {
+            // modules generated without annReleaseGraph() keep the weights file mapped until exit
+            annReleaseGraph = (type_annReleaseGraph *) dlsym(moduleHandle, "annReleaseGraph");
+        }
+    }
+    else {
+        error("unable to find requested model:%s input:%dx%dx%d output:%dx%dx%d from %s", modelName.c_str(),
+              dimInput[2], dimInput[1], dimInput[0], dimOutput[2], dimOutput[1], dimOutput[0], clientName.c_str());
+    }
+    if(!found) {
+        // send and wait for INFCOM_CMD_DONE message
+        InfComCommand reply = {
+            INFCOM_MAGIC, INFCOM_CMD_DONE, { 0 }, { 0 }
+        };
+        ERRCHK(sendCommand(sock, reply, clientName));
+        ERRCHK(recvCommand(sock, reply, clientName, INFCOM_CMD_DONE));
+        close(sock);
+        return -1;
+    }
+    info("found requested model:%s input:%dx%dx%d output:%dx%dx%d from %s", modelName.c_str(),
+          dimInput[2], dimInput[1], dimInput[0], dimOutput[2], dimOutput[1], dimOutput[0], clientName.c_str());
+
+    // send and wait for INFCOM_CMD_INFERENCE_INITIALIZATION message
+    InfComCommand updateCmd = {
+        INFCOM_MAGIC, INFCOM_CMD_INFERENCE_INITIALIZATION, { 0 }, "started initialization"
+    };
+    ERRCHK(sendCommand(sock, updateCmd, clientName));
+    ERRCHK(recvCommand(sock, updateCmd, clientName, INFCOM_CMD_INFERENCE_INITIALIZATION));
+    info(updateCmd.message);
+
+    info("InferenceEngine: using LIBRE_INFERENCE_SCHEDULER with %d CPU workers", GPUs);
+    //////
+    /// allocate OpenVX and host resources on all workers in parallel
+    ///
+    std::vector<std::thread> initThreads;
+    for(int worker = 0; worker < GPUs; worker++) {
+        initThreads.push_back(std::thread(&InferenceEngineCpu::initializeWorker, this, worker));
+    }
+    // join all threads before reporting progress, since reporting can return on a socket error
+    for(auto& thread : initThreads) {
+        thread.join();
+    }
+    for(int worker = 0; worker < GPUs; worker++) {
+        // send and wait for INFCOM_CMD_INFERENCE_INITIALIZATION message
+        updateCmd.data[0] = 80 * (worker + 1) / GPUs;
+        sprintf(updateCmd.message, "completed OpenVX graph for CPU worker#%d on NUMA node#%d", worker, workerNode[worker]);
+        ERRCHK(sendCommand(sock, updateCmd, clientName));
+        ERRCHK(recvCommand(sock, updateCmd, clientName, INFCOM_CMD_INFERENCE_INITIALIZATION));
+        info(updateCmd.message);
+    }
+
+    //////
+    /// start scheduler threads
+    ///
+    activeOutputWorkers = GPUs;
+    threadMasterInputQ = new std::thread(&InferenceEngineCpu::workMasterInputQ, this);
+    for(int worker = 0; worker < GPUs; worker++) {
+        threadDeviceInputCopy[worker] = new std::thread(&InferenceEngineCpu::workDeviceInputCopy, this, worker);
+        threadDeviceProcess[worker] = new std::thread(&InferenceEngineCpu::workDeviceProcess, this, worker);
+        threadDeviceOutputCopy[worker] = new std::thread(&InferenceEngineCpu::workDeviceOutputCopy, this, worker);
+    }
+
+    // send and wait for INFCOM_CMD_INFERENCE_INITIALIZATION message
+    updateCmd.data[0] = 100;
+    sprintf(updateCmd.message, "inference engine is ready");
+    ERRCHK(sendCommand(sock, updateCmd, clientName));
+    ERRCHK(recvCommand(sock, updateCmd, clientName, INFCOM_CMD_INFERENCE_INITIALIZATION));
+    info(updateCmd.message);
+
+    ////////
+    /// \brief keep running the inference in loop
+    ///
+    bool endOfImageRequested = false;
+    for(bool endOfSequence = false; !endOfSequence; ) {
+        bool didSomething = false;
+
+        // send all the available results to the client
+        int resultCountAvailable = outputQ.size();
+        if(resultCountAvailable > 0) {
+            didSomething = true;
+            while(resultCountAvailable > 0) {
+                if (!detectBoundingBoxes){
+                    if (topK < 1){
+                        int resultCount = std::min(resultCountAvailable, (INFCOM_MAX_IMAGES_FOR_TOP1_PER_PACKET/2));
+                        InfComCommand cmd = {
+                            INFCOM_MAGIC, INFCOM_CMD_INFERENCE_RESULT, { resultCount, 0 }, { 0 }
+                        };
+                        for(int i = 0; i < resultCount; i++) {
+                            std::tuple<int,int> result;
+                            outputQ.dequeue(result);
+                            int tag = std::get<0>(result);
+                            int label = std::get<1>(result);
+                            if(tag < 0) {
+                                endOfSequence = true;
+                                resultCount = i;
+                                break;
+                            }
+                            cmd.data[2 + i * 2 + 0] = tag; // tag
+                            cmd.data[2 + i * 2 + 1] = label; // label
+                        }
+                        if(resultCount > 0) {
+                            cmd.data[0] = resultCount;
+                            ERRCHK(sendCommand(sock, cmd, clientName));
+                            resultCountAvailable -= resultCount;
+                            ERRCHK(recvCommand(sock, cmd, clientName, INFCOM_CMD_INFERENCE_RESULT));
+                        }
+                        if(endOfSequence) {
+                            break;
+                        }
+                    }else {
+                        // send topK labels
+                        int maxResults = INFCOM_MAX_IMAGES_FOR_TOP1_PER_PACKET/(topK+1);
+                        int resultCount = std::min(resultCountAvailable, maxResults);
+                        InfComCommand cmd = {
+                            INFCOM_MAGIC, INFCOM_CMD_TOPK_INFERENCE_RESULT, { resultCount, topK }, { 0 }
+                        };
+                        for(int i = 0; i < resultCount; i++) {
+                            std::tuple<int,int> result;
+                            std::vector<unsigned int> labels;
+                            outputQ.dequeue(result);
+                            int tag = std::get<0>(result);
+                            if(tag < 0) {
+                                endOfSequence = true;
+                                resultCount = i;
+                                break;
+                            }
+                            outputQTopk.dequeue(labels);
+                            cmd.data[2 + i * (topK+1) + 0] = tag; // tag
+                            for (int j=0; j<topK; j++){
+                                cmd.data[3 + i * (topK+1) + j] = labels[j]; // label[j]
+                            }
+                            labels.clear();
+                        }
+                        if(resultCount > 0) {
+                            cmd.data[0] = resultCount;
+                            ERRCHK(sendCommand(sock, cmd, clientName));
+                            resultCountAvailable -= resultCount;
+                            ERRCHK(recvCommand(sock, cmd, clientName, INFCOM_CMD_TOPK_INFERENCE_RESULT));
+                        }
+                        if(endOfSequence) {
+                            break;
+                        }
+                    }
+                }else
+                {
+                    // Dequeue the bounding box
+                    std::tuple<int,int> result;
+                    std::vector<ObjectBB> bounding_boxes;
+                    outputQ.dequeue(result);
+                    int tag = std::get<0>(result);
+                    int label = std::get<1>(result);        // label of first bounding box
+                    if(tag < 0) {
+                        endOfSequence = true;
+                        resultCountAvailable--;
+                        break;
+                    }else
+                    {
+                        int numBB = 0;
+                        int numMessages = 0;
+                        if (label >= 0) {
+                            OutputQBB.dequeue(bounding_boxes);
+                            numBB = bounding_boxes.size();
+                            if (numBB) numMessages = numBB/3;   // max 3 bb per mesasge
+                            if (numBB % 3) numMessages++;
+                        }
+                        if (!numBB) {
+                            InfComCommand cmd = {
+                                INFCOM_MAGIC, INFCOM_CMD_BB_INFERENCE_RESULT, { tag, 0 }, { 0 }        // no bb detected
+                            };
+                            ERRCHK(sendCommand(sock, cmd, clientName));
+                            ERRCHK(recvCommand(sock, cmd, clientName, INFCOM_CMD_BB_INFERENCE_RESULT));
+                        } else
+                        {
+                            ObjectBB *pObj= &bounding_boxes[0];
+                            for (int i=0, j=0; (i < numMessages && j < numBB); i++) {
+                                int numBB_per_message = std::min((numBB-j), 3);
+                                int bb_info = (numBB_per_message & 0xFFFF) | (numBB << 16);
+                                InfComCommand cmd = {
+                                    INFCOM_MAGIC, INFCOM_CMD_BB_INFERENCE_RESULT, { tag, bb_info }, { 0 }        // 3 bounding boxes in one message
+                                };
+                                cmd.data[2] = (unsigned int)((pObj->y*0x7FFF)+0.5)<<16  | (unsigned int)((pObj->x*0x7FFF)+0.5);
+                                cmd.data[3] = (unsigned int)((pObj->h*0x7FFF)+0.5)<<16  | (unsigned int)((pObj->w*0x7FFF)+0.5);
+                                cmd.data[4] = (unsigned int) ((pObj->confidence*0x3FFFFFFF)+0.5);    // convert float to Q30.1
+                                cmd.data[5] = pObj->label;
+                                pObj++;
+                                if (numBB_per_message > 1) {
+                                    cmd.data[6] = (unsigned int)((pObj->y*0x7FFF)+0.5)<<16  | (unsigned int)((pObj->x*0x7FFF)+0.5);
+                                    cmd.data[7] = (unsigned int)((pObj->h*0x7FFF)+0.5)<<16  | (unsigned int)((pObj->w*0x7FFF)+0.5);
+                                    cmd.data[8] = (unsigned int) ((pObj->confidence*0x3FFFFFFF)+0.5);    // convert float to Q30.1
+                                    cmd.data[9] = pObj->label;
+                                    pObj++;
+                                }
+                                if (numBB_per_message > 2) {
+                                    cmd.data[10] = (unsigned int)((pObj->y*0x7FFF)+0.5)<<16  | (unsigned int)((pObj->x*0x7FFF)+0.5);
+                                    cmd.data[11] = (unsigned int)((pObj->h*0x7FFF)+0.5)<<16  | (unsigned int)((pObj->w*0x7FFF)+0.5);
+                                    cmd.data[12] = (unsigned int) ((pObj->confidence*0x3FFFFFFF)+0.5);    // convert float to Q30.1;
+                                    cmd.data[13] = pObj->label;
+                                    pObj++;
+                                }
+                                ERRCHK(sendCommand(sock, cmd, clientName));
+                                ERRCHK(recvCommand(sock, cmd, clientName, INFCOM_CMD_BB_INFERENCE_RESULT));
+                                j += numBB_per_message;
+                            }
+                        }
+                        resultCountAvailable--;
+                    }
+                    bounding_boxes.clear();
+                }
+            }
+        }
+
+        // if not endOfImageRequested, request client to send images
+        if(!endOfImageRequested) {
+            // get number of empty slots in the input queue
+            int imageCountRequested = 0;
+            imageCountRequested = MAX_INPUT_QUEUE_DEPTH - inputQ.size();
+            if(imageCountRequested > 0) {
+                didSomething = true;
+                // send request for upto INFCOM_MAX_IMAGES_PER_PACKET images
+                imageCountRequested = std::min(imageCountRequested, (INFCOM_MAX_IMAGES_FOR_TOP1_PER_PACKET/2));
+                InfComCommand cmd = {
+                    INFCOM_MAGIC, INFCOM_CMD_SEND_IMAGES, { imageCountRequested }, { 0 }
+                };
+                ERRCHK(sendCommand(sock, cmd, clientName));
+                ERRCHK(recvCommand(sock, cmd, clientName, INFCOM_CMD_SEND_IMAGES));
+
+                // check of endOfImageRequested and receive images one at a time
+                int imageCountReceived = cmd.data[0];
+                if(imageCountReceived < 0) {
+                    // submit the endOfSequence indicator to scheduler
+                    inputQ.enqueue(std::tuple<int,char*,int>(-1,nullptr,0));
+                    endOfImageRequested = true;
+                }
+                int i = 0;
+                for(; i < imageCountReceived; i++) {
+                    // get header with tag and size info
+                    int header[2] = { 0, 0 };
+                    ERRCHK(recvBuffer(sock, &header, sizeof(header), clientName));
+                    int tag = header[0];
+                    int size = header[1];
+                    // do sanity check with unreasonable parameters
+                    if(tag < 0 || size <= 0 || size > 50000000) {
+                        return error_close(sock, "invalid (tag:%d,size:%d) from %s", tag, size, clientName.c_str());
+                    }
+                    char * byteStream = 0;
+                    if (receiveFileNames)
+                    {
+                        std::string fileNameDir = args->getlocalShadowRootDir() + "/";
+                        char * buff = new char [size];
+                        ERRCHK(recvBuffer(sock, buff, size, clientName));
+                        fileNameDir.append(std::string(buff, size));
+                        FILE * fp = fopen(fileNameDir.c_str(), "rb");
+                        if(!fp) {
+                            return error_close(sock, "filename %s (incorrect)", fileNameDir.c_str());
+                        }
+                        fseek(fp,0,SEEK_END);
+                        int fsize = ftell(fp);
+                        fseek(fp,0,SEEK_SET);
+                        byteStream = allocBuffer(fsize);
+                        size = (int)fread(byteStream, 1, fsize, fp);
+                        fclose(fp);
+                        delete[] buff;
+                        if (size != fsize) {
+                            return error_close(sock, "error reading %d bytes from file:%s", fsize, fileNameDir.c_str());
+                        }
+                    }
+                    else
+                    {
+                        // allocate and receive the image and EOF marker
+                        byteStream = allocBuffer(size);
+                        ERRCHK(recvBuffer(sock, byteStream, size, clientName));
+                    }
+                    int eofMarker = 0;
+                    ERRCHK(recvBuffer(sock, &eofMarker, sizeof(eofMarker), clientName));
+                    if(eofMarker != INFCOM_EOF_MARKER) {
+                        return error_close(sock, "eofMarker 0x%08x (incorrect)", eofMarker);
+                    }
+
+                    // submit the input (tag,byteStream,size) to scheduler
+                    inputQ.enqueue(std::tuple<int,char*,int>(tag,byteStream,size));
+                }
+            }
+        }
+
+        // if nothing done, wait for sometime
+        if(!didSomething && INFERENCE_SERVICE_IDLE_TIME > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(INFERENCE_SERVICE_IDLE_TIME));
+        }
+    }
+    info("runInference: terminated for %s", clientName.c_str());
+
+    // send and wait for INFCOM_CMD_DONE message
+    InfComCommand reply = {
+        INFCOM_MAGIC, INFCOM_CMD_DONE, { 0 }, { 0 }
+    };
+    ERRCHK(sendCommand(sock, reply, clientName));
+    ERRCHK(recvCommand(sock, reply, clientName, INFCOM_CMD_DONE));
+
+    return 0;
+}
+
+void InferenceEngineCpu::workMasterInputQ()
+{
+    args->lock();
+    info("workMasterInputQ: started for %s", clientName.c_str());
+    args->unlock();
+
+    int batchSize = args->getBatchSize();
+    int totalInputCount = 0;
+    int inputCountInBatch = 0, worker = 0;
+    for(;;) {
+        PROFILER_START(inference_server_app, workMasterInputQ);
+        // get next item from the input queue
+        std::tuple<int,char*,int> input;
+        inputQ.dequeue(input);
+        int tag = std::get<0>(input);
+        char * byteStream = std::get<1>(input);
+        int size = std::get<2>(input);
+
+        // check for end of input
+        if(tag < 0 || byteStream == nullptr || size == 0)
+            break;
+        totalInputCount++;
+
+        // add the image to selected worker queue
+        std::tuple<char*,int> image(byteStream,size);
+        queueDeviceTagQ[worker]->enqueue(tag);
+        queueDeviceImageQ[worker]->enqueue(image);
+        PROFILER_STOP(inference_server_app, workMasterInputQ);
+
+        // at the end of Batch pick another worker
+        inputCountInBatch++;
+        if(inputCountInBatch == batchSize) {
+            inputCountInBatch = 0;
+            worker = (worker + 1) % GPUs;
+            for(int i = 0; i < GPUs; i++) {
+                if(i != worker && queueDeviceTagQ[i]->size() < queueDeviceTagQ[worker]->size()) {
+                    worker = i;
+                }
+            }
+        }
+    }
+
+    // send endOfSequence indicator to all scheduler threads
+    for(int i = 0; i < GPUs; i++) {
+        int endOfSequenceTag = -1;
+        std::tuple<char*,int> endOfSequenceImage(nullptr,0);
+        queueDeviceTagQ[i]->enqueue(endOfSequenceTag);
+        queueDeviceImageQ[i]->enqueue(endOfSequenceImage);
+    }
+    args->lock();
+    info("workMasterInputQ: terminated for %s [scheduled %d images]", clientName.c_str(), totalInputCount);
+    args->unlock();
+}
+
+void InferenceEngineCpu::workDeviceInputCopy(int worker)
+{
+    bindWorker(worker);
+    args->lock();
+    info("workDeviceInputCopy: CPU worker#%d started for %s", worker, clientName.c_str());
+    args->unlock();
+
+    int totalBatchCounter = 0, totalImageCounter = 0;
+    for(bool endOfSequenceReached = false; !endOfSequenceReached; ) {
+        PROFILER_START(inference_server_app, workDeviceInputCopyBatch);
+        // get an empty host buffer
+        void * input;
+        queueDeviceInputMemIdle[worker]->dequeue(input);
+        if(input == nullptr) {
+            fatal("workDeviceInputCopy: unexpected nullptr in queueDeviceInputMemIdle[%d]", worker);
+        }
+
+        // get next batch of inputs and convert them into tensor and release input byteStream
+        int inputCount = 0;
+        for(; inputCount < batchSize; inputCount++) {
+            // get next item from the input queue and check for end of input
+            std::tuple<char*,int> image;
+            queueDeviceImageQ[worker]->dequeue(image);
+            char * byteStream = std::get<0>(image);
+            int size = std::get<1>(image);
+            if(byteStream == nullptr || size == 0) {
+                endOfSequenceReached = true;
+                break;
+            }
+            // decode, scale, and format convert directly into the input tensor
+            float * buf = (float *)input + dimInput[0] * dimInput[1] * dimInput[2] * inputCount;
+            PROFILER_START(inference_server_app, workDeviceInputCopyJpegDecode);
+            DecodeScaleAndConvertToTensor(dimInput[0], dimInput[1], size, (unsigned char *)byteStream, buf, 0);
+            PROFILER_STOP(inference_server_app, workDeviceInputCopyJpegDecode);
+            // release byteStream
+            releaseBuffer(byteStream);
+        }
+
+        if(inputCount > 0) {
+            // add the input for processing
+            queueDeviceInputMemBusy[worker]->enqueue(input);
+            // update counters
+            totalBatchCounter++;
+            totalImageCounter += inputCount;
+        }
+        else {
+            // add the input back to idle queue
+            queueDeviceInputMemIdle[worker]->enqueue(input);
+        }
+        PROFILER_STOP(inference_server_app, workDeviceInputCopyBatch);
+    }
+
+    // add the endOfSequenceMarker to next stage
+    void * endOfSequenceMarker = nullptr;
+    queueDeviceInputMemBusy[worker]->enqueue(endOfSequenceMarker);
+
+    args->lock();
+    info("workDeviceInputCopy: CPU worker#%d terminated for %s [processed %d batches, %d images]", worker, clientName.c_str(), totalBatchCounter, totalImageCounter);
+    args->unlock();
+}
+
+void InferenceEngineCpu::workDeviceProcess(int worker)
+{
+    bindWorker(worker);
+    args->lock();
+    info("workDeviceProcess: CPU worker#%d started for %s", worker, clientName.c_str());
+    args->unlock();
+
+    int processCounter = 0;
+    for(;;) {
+        // get a busy host buffer for input and check for end of sequence marker
+        void * input;
+        queueDeviceInputMemBusy[worker]->dequeue(input);
+        if(!input) {
+            break;
+        }
+        // get an empty host buffer for output
+        void * output;
+        queueDeviceOutputMemIdle[worker]->dequeue(output);
+        if(!output) {
+            fatal("workDeviceProcess: unexpected nullptr in queueDeviceOutputMemIdle[%d]", worker);
+        }
+        // process the graph
+        vx_status status;
+        status = vxSwapTensorHandle(openvx_input[worker], input, nullptr);
+        if(status != VX_SUCCESS) {
+            fatal("workDeviceProcess: vxSwapTensorHandle(input#%d) failed(%d)", worker, status);
+        }
+        status = vxSwapTensorHandle(openvx_output[worker], output, nullptr);
+        if(status != VX_SUCCESS) {
+            fatal("workDeviceProcess: vxSwapTensorHandle(output#%d) failed(%d)", worker, status);
+        }
+#if !DONOT_RUN_INFERENCE
+        PROFILER_START(inference_server_app, workDeviceProcess);
+        status = vxProcessGraph(openvx_graph[worker]);
+        PROFILER_STOP(inference_server_app, workDeviceProcess);
+        if(status != VX_SUCCESS) {
+            fatal("workDeviceProcess: vxProcessGraph(#%d) failed(%d)", worker, status);
+        }
+#else
+        info("InferenceEngine:workDeviceProcess DONOT_RUN_INFERENCE mode");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));  // simulate some work
+#endif
+        // add the input for idle queue and output to busy queue
+        queueDeviceInputMemIdle[worker]->enqueue(input);
+        queueDeviceOutputMemBusy[worker]->enqueue(output);
+        processCounter++;
+    }
+
+    // add the endOfSequenceMarker to next stage
+    void * endOfSequenceMarker = nullptr;
+    queueDeviceOutputMemBusy[worker]->enqueue(endOfSequenceMarker);
+
+    args->lock();
+    info("workDeviceProcess: CPU worker#%d terminated for %s [processed %d batches]", worker, clientName.c_str(), processCounter);
+    args->unlock();
+}
+
+void InferenceEngineCpu::workDeviceOutputCopy(int worker)
+{
+    bindWorker(worker);
+    args->lock();
+    info("workDeviceOutputCopy: CPU worker#%d started for %s", worker, clientName.c_str());
+    args->unlock();
+
+    int totalBatchCounter = 0, totalImageCounter = 0;
+    for(bool endOfSequenceReached = false; !endOfSequenceReached; ) {
+        // get an output host buffer
+        void * output;
+        queueDeviceOutputMemBusy[worker]->dequeue(output);
+        if(output == nullptr) {
+            break;
+        }
+
+        PROFILER_START(inference_server_app, workDeviceOutputCopy);
+
+        // get next batch of outputs
+        int outputCount = 0;
+        for(; outputCount < batchSize; outputCount++) {
+            // get next item from the tag queue and check for end of input
+            int tag;
+            queueDeviceTagQ[worker]->dequeue(tag);
+            if(tag < 0) {
+                endOfSequenceReached = true;
+                break;
+            }
+
+            float * buf = (float *)output + dimOutput[0] * dimOutput[1] * dimOutput[2] * outputCount;
+            if (!detectBoundingBoxes)
+            {
+                if (topK < 1){
+                    int label = 0;
+                    float max_prob = buf[0];
+                    for(int c = 1; c < dimOutput[2]; c++) {
+                        float prob = buf[c];
+                        if(prob > max_prob) {
+                            label = c;
+                            max_prob = prob;
+                        }
+                    }
+                    outputQ.enqueue(std::tuple<int,int>(tag,label));
+                }else {
+                    std::vector<float>  prob_vec(buf, buf + dimOutput[2]);
+                    std::vector<size_t> idx(prob_vec.size());
+                    std::iota(idx.begin(), idx.end(), 0);
+                    sort_indexes(prob_vec, idx);            // sort indeces based on prob
+                    std::vector<unsigned int>    labels;
+                    outputQ.enqueue(std::tuple<int,int>(tag,idx[0]));
+                    int j=0;
+                    for (auto i: idx) {
+                        // make label which is index and prob
+                        int packed_label_prob = (i&0xFFFF)|(((unsigned int)((prob_vec[i]*0x7FFF)+0.5))<<16);   // convert prob to 16bit float and store in MSBs
+                        labels.push_back(packed_label_prob);
+                        if (++j >= topK) break;
+                    }
+                    outputQTopk.enqueue(labels);
+                }
+            }else
+            {
+                std::vector<ObjectBB> detected_objects;
+                region->GetObjectDetections(buf, BB_biases, dimOutput[2], dimOutput[1], dimOutput[0], BOUNDING_BOX_NUMBER_OF_CLASSES, dimInput[0], dimInput[1], BOUNDING_BOX_CONFIDENCE_THRESHHOLD, BOUNDING_BOX_NMS_THRESHHOLD, 13, detected_objects);
+                if (detected_objects.size() > 0) {
+                    // add it to outputQ
+                    outputQ.enqueue(std::tuple<int,int>(tag,detected_objects[0].label));
+                    // add detected objects with BB into BoundingBox Q
+                    OutputQBB.enqueue(detected_objects);
+                } else
+                {
+                    // add it to outputQ
+                    outputQ.enqueue(std::tuple<int,int>(tag,-1));
+                }
+            }
+        }
+
+        // add the output back to idle queue
+        queueDeviceOutputMemIdle[worker]->enqueue(output);
+
+        PROFILER_STOP(inference_server_app, workDeviceOutputCopy);
+
+        // update counter
+        if(outputCount > 0) {
+            totalBatchCounter++;
+            totalImageCounter += outputCount;
+        }
+    }
+
+    // send end of sequence marker to next stage once all workers are done
+    if(--activeOutputWorkers == 0) {
+        outputQ.enqueue(std::tuple<int,int>(-1,-1));
+    }
+    args->lock();
+    info("workDeviceOutputCopy: CPU worker#%d terminated for %s [processed %d batches, %d images]", worker, clientName.c_str(), totalBatchCounter, totalImageCounter);
+    args->unlock();
+}
+
+#endif
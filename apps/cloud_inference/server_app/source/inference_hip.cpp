@@ -57,7 +57,8 @@ InferenceEngineHip::~InferenceEngineHip()
 {
 #if INFERENCE_SCHEDULER_MODE == NO_INFERENCE_SCHEDULER && !DONOT_RUN_INFERENCE
     if(openvx_graph) {
-        vxReleaseGraph(&openvx_graph);
+        if(annReleaseGraph) annReleaseGraph(&openvx_graph);
+        else vxReleaseGraph(&openvx_graph);
     }
     if(openvx_input) {
         vxReleaseTensor(&openvx_input);
@@ -122,7 +123,8 @@ InferenceEngineHip::~InferenceEngineHip()
             delete queueDeviceOutputMemBusy[i];
         }
         if(openvx_graph[i]) {
-            vxReleaseGraph(&openvx_graph[i]);
+            if(annReleaseGraph) annReleaseGraph(&openvx_graph[i]);
+            else vxReleaseGraph(&openvx_graph[i]);
         }
         if(openvx_input[i]) {
             vxReleaseTensor(&openvx_input[i]);
@@ -243,6 +245,10 @@ int InferenceEngineHip::run()
             found = false;
             error("could not find function annAddToGraph() in module %s for %s", modulePath.c_str(), clientName.c_str());
         }
+        else {
+            // modules generated without annReleaseGraph() keep the weights file mapped until exit
+            annReleaseGraph = (type_annReleaseGraph *) dlsym(moduleHandle, "annReleaseGraph");
+        }
     }
     else {
         error("unable to find requested model:%s input:%dx%dx%d output:%dx%dx%d from %s", modelName.c_str(),
@@ -645,7 +651,7 @@ int InferenceEngineHip::run()
                         fseek(fp,0,SEEK_END);
                         int fsize = ftell(fp);
                         fseek(fp,0,SEEK_SET);
-                        byteStream = new char [fsize];
+                        byteStream = allocBuffer(fsize);
                         size = (int)fread(byteStream, 1, fsize, fp);
                         fclose(fp);
                         delete[] buff;
@@ -656,7 +662,7 @@ int InferenceEngineHip::run()
                     else
                     {
                         // allocate and receive the image and EOF marker
-                        byteStream = new char [size];
+                        byteStream = allocBuffer(size);
                         ERRCHK(recvBuffer(sock, byteStream, size, clientName));
                     }
                     int eofMarker = 0;
@@ -672,7 +678,7 @@ int InferenceEngineHip::run()
                     int label = tag % dimOutput[2];
                     std::this_thread::sleep_for(std::chrono::milliseconds(4));
                     // release byteStream and keep the results in outputQ
-                    delete[] byteStream;
+                    releaseBuffer(byteStream);
                     outputQ.enqueue(std::tuple<int,int>(tag,label));
 #else
                     // process the input immediately since there is no scheduler
@@ -714,7 +720,7 @@ int InferenceEngineHip::run()
                         fatal("workDeviceProcess: vxUnmapTensorPatch(output)) failed(%d)", status);
                     }
                     // release byteStream and keep the results in outputQ
-                    delete[] byteStream;
+                    releaseBuffer(byteStream);
                     outputQ.enqueue(std::tuple<int,int>(tag,label));
 #endif
 #elif INFERENCE_SCHEDULER_MODE == LIBRE_INFERENCE_SCHEDULER
@@ -898,7 +904,7 @@ void InferenceEngineHip::workDeviceInputCopy(int gpu)
                 DecodeScaleAndConvertToTensor(dimInput[0], dimInput[1], size, (unsigned char *)byteStream, (float *)buf, useFp16);
                 PROFILER_STOP(inference_server_app, workDeviceInputCopyJpegDecode);
                 // release byteStream
-                delete[] byteStream;
+                releaseBuffer(byteStream);
             }
         }
         if(hipStreamSynchronize(stream) != hipSuccess) {
@@ -95,7 +95,8 @@ InferenceEngineRocalHip::~InferenceEngineRocalHip() {
             delete queueDeviceOutputMemBusy[i];
         }
         if(openvx_graph[i]) {
-            vxReleaseGraph(&openvx_graph[i]);
+            if(annReleaseGraph) annReleaseGraph(&openvx_graph[i]);
+            else vxReleaseGraph(&openvx_graph[i]);
         }
         if(openvx_input[i]) {
             vxReleaseTensor(&openvx_input[i]);
@@ -216,6 +217,10 @@ int InferenceEngineRocalHip::run() {
             found = false;
             error("could not find function annAddToGraph() in module %s for %s", modulePath.c_str(), clientName.c_str());
         }
+        else {
+            // modules generated without annReleaseGraph() keep the weights file mapped until exit
+            annReleaseGraph = (type_annReleaseGraph *) dlsym(moduleHandle, "annReleaseGraph");
+        }
     }
     else {
         error("unable to find requested model:%s input:%dx%dx%d output:%dx%dx%d from %s", modelName.c_str(),
@@ -576,7 +581,7 @@ int InferenceEngineRocalHip::run() {
                     }
                     char * byteStream;
                     if (receiveFileNames) {
-                        byteStream = new char [size];
+                        byteStream = allocBuffer(size);
                         ERRCHK(recvBuffer(sock, byteStream, size, clientName));
                         std::string str(byteStream, size);
                         if(fileNameMap.find(str) == fileNameMap.end()) {
@@ -585,7 +590,7 @@ int InferenceEngineRocalHip::run() {
                     }
                     else {
                         // allocate and receive the image and EOF marker
-                        byteStream = new char [size];
+                        byteStream = allocBuffer(size);
                         ERRCHK(recvBuffer(sock, byteStream, size, clientName));
                     }
                     int eofMarker = 0;
@@ -709,6 +714,8 @@ void InferenceEngineRocalHip::workDeviceInputCopy(int gpu)
                 endOfSequenceReached = true;
                 break;
             }
+            // rocAL reads the images itself: recycle the received byteStream
+            releaseBuffer(std::get<0>(image));
         }
         
         // decode and resize using rocAL
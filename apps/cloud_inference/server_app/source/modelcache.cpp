@@ -0,0 +1,275 @@
+/*
+Copyright (c) 2017 - 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "modelcache.h"
+#include "common.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <algorithm>
+
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t rotr(uint32_t x, int n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+ModelHash::ModelHash()
+    : state{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 },
+      buffer{ 0 }, length{ 0 }
+{
+}
+
+void ModelHash::transform(const uint8_t * block)
+{
+    uint32_t w[64];
+    for(int i = 0; i < 16; i++) {
+        w[i] = ((uint32_t)block[4*i] << 24) | ((uint32_t)block[4*i+1] << 16) | ((uint32_t)block[4*i+2] << 8) | block[4*i+3];
+    }
+    for(int i = 16; i < 64; i++) {
+        uint32_t s0 = rotr(w[i-15], 7) ^ rotr(w[i-15], 18) ^ (w[i-15] >> 3);
+        uint32_t s1 = rotr(w[i-2], 17) ^ rotr(w[i-2], 19) ^ (w[i-2] >> 10);
+        w[i] = w[i-16] + s0 + w[i-7] + s1;
+    }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for(int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + sha256_k[i] + w[i];
+        uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+void ModelHash::update(const void * data, size_t size)
+{
+    const uint8_t * p = (const uint8_t *)data;
+    size_t used = length & 63;
+    length += size;
+    if(used > 0) {
+        size_t n = std::min(size, 64 - used);
+        memcpy(buffer + used, p, n);
+        p += n; size -= n; used += n;
+        if(used < 64)
+            return;
+        transform(buffer);
+    }
+    for(; size >= 64; p += 64, size -= 64) {
+        transform(p);
+    }
+    memcpy(buffer, p, size);
+}
+
+void ModelHash::update(int value)
+{
+    update(&value, sizeof(value));
+}
+
+void ModelHash::update(const std::string& value)
+{
+    // length prefix keeps adjacent fields from aliasing
+    update((int)value.size());
+    update(value.data(), value.size());
+}
+
+int ModelHash::updateFile(const std::string& fileName)
+{
+    FILE * fp = fopen(fileName.c_str(), "rb");
+    if(!fp) {
+        return -1;
+    }
+    update(fileName.substr(fileName.find_last_of('/') + 1));
+    fseek(fp, 0L, SEEK_END);
+    update((int)ftell(fp));
+    fseek(fp, 0L, SEEK_SET);
+    char block[4096];
+    for(size_t n; (n = fread(block, 1, sizeof(block), fp)) > 0;) {
+        update(block, n);
+    }
+    fclose(fp);
+    return 0;
+}
+
+std::string ModelHash::hexdigest()
+{
+    uint64_t bits = length * 8;
+    uint8_t pad[72] = { 0x80 };
+    size_t padSize = ((length & 63) < 56) ? (56 - (length & 63)) : (120 - (length & 63));
+    for(int i = 0; i < 8; i++) {
+        pad[padSize + i] = (uint8_t)(bits >> (56 - 8 * i));
+    }
+    update(pad, padSize + 8);
+    char hex[65];
+    for(int i = 0; i < 8; i++) {
+        sprintf(hex + 8 * i, "%08x", state[i]);
+    }
+    return std::string(hex);
+}
+
+ModelCache::ModelCache(const std::string& cacheDir_)
+    : cacheDir{ cacheDir_ }
+{
+    mkdir(cacheDir.c_str(), 0700);
+}
+
+ModelCache::~ModelCache()
+{
+    for(auto handle : moduleHandles) {
+        dlclose(handle);
+    }
+}
+
+void ModelCache::loadModule(const std::string& key)
+{
+    // keep the module resident so that sessions of cached models don't pay for loading it
+    std::string modulePath = getEntryFolder(key) + "/build/" + MODULE_LIBNAME;
+    void * handle = dlopen(modulePath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if(handle) {
+        moduleHandles.push_back(handle);
+    }
+    else {
+        warning("unable to pre-load cached module %s: %s", modulePath.c_str(), dlerror());
+    }
+}
+
+int ModelCache::preload()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    DIR * dir = opendir(cacheDir.c_str());
+    if(!dir) {
+        return error("unable to open folder: %s", cacheDir.c_str());
+    }
+    for(struct dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        if((entry->d_type & DT_DIR) == DT_DIR && entry->d_name[0] != '.') {
+            std::string key = entry->d_name;
+            std::string cacheInfoFile = getEntryFolder(key) + "/" + MODULE_CACHE_INFO;
+            std::string modulePath = getEntryFolder(key) + "/build/" + MODULE_LIBNAME;
+            struct stat sbufModule = { 0 };
+            int dimOutput[3] = { 0 };
+            FILE * fp = fopen(cacheInfoFile.c_str(), "r");
+            if(fp) {
+                int n = fscanf(fp, "%d%d%d", &dimOutput[0], &dimOutput[1], &dimOutput[2]);
+                fclose(fp);
+                if(n == 3 && stat(modulePath.c_str(), &sbufModule) == 0) {
+                    entries[key] = std::make_tuple(dimOutput[0], dimOutput[1], dimOutput[2]);
+                    loadModule(key);
+                    continue;
+                }
+            }
+            warning("ignoring incomplete model cache entry: %s", getEntryFolder(key).c_str());
+        }
+    }
+    closedir(dir);
+    info("found %d cached modules in %s", (int)entries.size(), cacheDir.c_str());
+    return 0;
+}
+
+bool ModelCache::lookup(const std::string& key, int dimOutput[3])
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if(it == entries.end())
+        return false;
+    dimOutput[0] = std::get<0>(it->second);
+    dimOutput[1] = std::get<1>(it->second);
+    dimOutput[2] = std::get<2>(it->second);
+    return true;
+}
+
+int ModelCache::insert(const std::string& key, const std::string& modelFolder, const int dimOutput[3])
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(entries.find(key) != entries.end()) {
+        // same model got compiled by a concurrent session: keep this model folder as is
+        return 0;
+    }
+    std::string entryFolder = getEntryFolder(key);
+    std::string cacheInfoFile = modelFolder + "/" + MODULE_CACHE_INFO;
+    FILE * fp = fopen(cacheInfoFile.c_str(), "w");
+    if(!fp) {
+        return error("unable to create: %s", cacheInfoFile.c_str());
+    }
+    fprintf(fp, "%d %d %d\n", dimOutput[0], dimOutput[1], dimOutput[2]);
+    fclose(fp);
+    // remove stale entry left behind by an incomplete insert
+    std::string command = "/bin/rm -rf " + entryFolder;
+    if(system(command.c_str()) != 0 || rename(modelFolder.c_str(), entryFolder.c_str()) < 0) {
+        return error("unable to move %s into model cache", modelFolder.c_str());
+    }
+    if(mkdir(modelFolder.c_str(), 0700) < 0 || link(key, modelFolder) < 0) {
+        // move the compiled model back so that the session can still use it
+        command = "/bin/rm -rf " + modelFolder;
+        if(system(command.c_str()) != 0 || rename(entryFolder.c_str(), modelFolder.c_str()) < 0) {
+            error("unable to restore %s from model cache entry %s", modelFolder.c_str(), entryFolder.c_str());
+            return -2;
+        }
+        return error("unable to link model cache entry %s into %s", entryFolder.c_str(), modelFolder.c_str());
+    }
+    entries[key] = std::make_tuple(dimOutput[0], dimOutput[1], dimOutput[2]);
+    loadModule(key);
+    info("added module to model cache: %s", entryFolder.c_str());
+    return 0;
+}
+
+int ModelCache::link(const std::string& key, const std::string& modelFolder)
+{
+    std::string entryFolder = getEntryFolder(key);
+    DIR * dir = opendir(entryFolder.c_str());
+    if(!dir) {
+        return error("unable to open folder: %s", entryFolder.c_str());
+    }
+    int status = 0;
+    for(struct dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if(name == "." || name == ".." || name == MODULE_CONFIG)
+            continue;
+        std::string target = entryFolder + "/" + name;
+        std::string linkPath = modelFolder + "/" + name;
+        struct stat sbuf = { 0 };
+        if(lstat(linkPath.c_str(), &sbuf) == 0)
+            continue;
+        if(symlink(target.c_str(), linkPath.c_str()) < 0) {
+            status = error("unable to create link %s -> %s", linkPath.c_str(), target.c_str());
+            break;
+        }
+    }
+    closedir(dir);
+    return status;
+}
@@ -24,10 +24,23 @@ THE SOFTWARE.
 #include "common.h"
 #include <stdio.h>
 #include <stdarg.h>
+#include <errno.h>
+#include <mutex>
+#include <vector>
 
 #define INFCOM_DEBUG_DUMP      0 // for debugging network protocol
 #define INFCOM_ENABLE_NODELAY  0 // for debugging network protocol
 
+// buffer pool size classes are powers of two from 4KB to 64MB
+#define BUFFER_POOL_MIN_CLASS     12
+#define BUFFER_POOL_MAX_CLASS     26
+#define BUFFER_POOL_MAX_RETAINED  (256 << 20) // max bytes kept in the free lists
+#define BUFFER_POOL_HEADER_SIZE   64         // keeps the returned buffer cache-line aligned
+
+static std::mutex bufferPoolMutex;
+static std::vector<char *> bufferPoolFreeList[BUFFER_POOL_MAX_CLASS + 1];
+static size_t bufferPoolRetained = 0;
+
 int sendBuffer(int sock, const void * buf, size_t len, std::string& clientName)
 {
 #if INFCOM_ENABLE_NODELAY
@@ -47,11 +60,13 @@ int sendBuffer(int sock, const void * buf, size_t len, std::string& clientName)
 
 int recvBuffer(int sock, void * buf, size_t len, std::string& clientName)
 {
+    // receive directly into the caller's buffer with as few recv() calls as possible
     char * byteStream = (char *) buf;
-    int remaining = len;
+    size_t remaining = len;
     while(remaining > 0) {
-        int pktSize = std::min(remaining, INFCOM_MAX_PACKET_SIZE);
-        int n = recv(sock, byteStream, pktSize, 0);
+        ssize_t n = recv(sock, byteStream, remaining, MSG_WAITALL);
+        if(n < 0 && errno == EINTR)
+            continue;
         if(n < 1)
             break;
         remaining -= n;
@@ -93,6 +108,46 @@ int recvCommand(int sock, InfComCommand& cmd, std::string& clientName, int expec
     return 0;
 }
 
+char * allocBuffer(size_t size)
+{
+    int sizeClass = BUFFER_POOL_MIN_CLASS;
+    while(sizeClass <= BUFFER_POOL_MAX_CLASS && ((size_t)1 << sizeClass) < size)
+        sizeClass++;
+    char * mem = nullptr;
+    if(sizeClass <= BUFFER_POOL_MAX_CLASS) {
+        std::lock_guard<std::mutex> lock(bufferPoolMutex);
+        if(!bufferPoolFreeList[sizeClass].empty()) {
+            mem = bufferPoolFreeList[sizeClass].back();
+            bufferPoolFreeList[sizeClass].pop_back();
+            bufferPoolRetained -= (size_t)1 << sizeClass;
+        }
+    }
+    if(!mem) {
+        // buffers larger than the biggest class are not pooled
+        size_t capacity = (sizeClass <= BUFFER_POOL_MAX_CLASS) ? ((size_t)1 << sizeClass) : size;
+        mem = new char [BUFFER_POOL_HEADER_SIZE + capacity];
+        *(int *)mem = sizeClass;
+    }
+    return mem + BUFFER_POOL_HEADER_SIZE;
+}
+
+void releaseBuffer(char * buf)
+{
+    if(!buf)
+        return;
+    char * mem = buf - BUFFER_POOL_HEADER_SIZE;
+    int sizeClass = *(int *)mem;
+    if(sizeClass <= BUFFER_POOL_MAX_CLASS) {
+        std::lock_guard<std::mutex> lock(bufferPoolMutex);
+        if(bufferPoolRetained + ((size_t)1 << sizeClass) <= BUFFER_POOL_MAX_RETAINED) {
+            bufferPoolFreeList[sizeClass].push_back(mem);
+            bufferPoolRetained += (size_t)1 << sizeClass;
+            return;
+        }
+    }
+    delete[] mem;
+}
+
 void dumpCommand(const char * mesg, const InfComCommand& cmd)
 {
     info("InfComCommand: %s 0x%08x %8d { %d %d - %d %d %d - %d %d %d - %d %d } %s", mesg,
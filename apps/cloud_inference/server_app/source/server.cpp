@@ -27,17 +27,31 @@ THE SOFTWARE.
 #include "netutil.h"
 #include "shadow.h"
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/epoll.h>
 
-int connection(int sock, Arguments * args, std::string clientName)
+#define MAX_EPOLL_EVENTS   256
+#define SESSION_WORKER_IDLE_SEC  60  // session workers exit after being idle this long
+
+// client connection waiting in the reactor for the reply to INFCOM_CMD_SEND_MODE
+struct PendingConnection {
+    std::string clientName;
+    InfComCommand cmd;
+    size_t bytesSent;
+    size_t bytesReceived;
+};
+
+// client session handed over to the worker pool
+typedef std::tuple<int,std::string,InfComCommand> Session;
+
+int session(int sock, Arguments * args, std::string clientName, InfComCommand cmd)
 {
-    info("== CONNECTED to %s ================", clientName.c_str());
-
-    // ask connection mode by sending InfComCommand:INFCOM_CMD_SEND_MODE
-    InfComCommand cmd = {
-        INFCOM_MAGIC, INFCOM_CMD_SEND_MODE, { 0 }, { 0 }
-    };
-    ERRCHK(sendCommand(sock, cmd, clientName));
-    ERRCHK(recvCommand(sock, cmd, clientName, INFCOM_CMD_SEND_MODE));
     int mode = cmd.data[0];
     if(mode != INFCOM_MODE_CONFIGURE && mode != INFCOM_MODE_COMPILER && mode != INFCOM_MODE_INFERENCE && mode != INFCOM_MODE_SHADOW) {
         dumpCommand("reply", cmd);
@@ -53,17 +67,22 @@ int connection(int sock, Arguments * args, std::string clientName)
         status = runCompiler(sock, args, clientName, &cmd);
     }
     else if(mode == INFCOM_MODE_INFERENCE) {
-#if ENABLE_OPENCL      
-        InferenceEngine * ie = new InferenceEngine(sock, args, clientName, &cmd);
-#else
-        InferenceEngineHip * ie;
-        int decodeMode = cmd.data[11];
-        std::string dataFolder(cmd.path);
-        if(decodeMode == 0) 
-            ie = new InferenceEngineHip(sock, args, clientName, &cmd);
-        else if(decodeMode == 1)    
-            ie = new InferenceEngineRocalHip(sock, args, clientName, &cmd, dataFolder);
-#endif        
+        InferenceEngine * ie = nullptr;
+        if(args->cpuInference()) {
+            ie = new InferenceEngineCpu(sock, args, clientName, &cmd);
+        }
+        else {
+#if ENABLE_OPENCL
+            ie = new InferenceEngine(sock, args, clientName, &cmd);
+#elif ENABLE_HIP
+            int decodeMode = cmd.data[11];
+            std::string dataFolder(cmd.path);
+            if(decodeMode == 0) 
+                ie = new InferenceEngineHip(sock, args, clientName, &cmd);
+            else if(decodeMode == 1)    
+                ie = new InferenceEngineRocalHip(sock, args, clientName, &cmd, dataFolder);
+#endif
+        }
         if(ie) {
             status = ie->run();
             delete ie;
@@ -80,6 +99,137 @@ int connection(int sock, Arguments * args, std::string clientName)
     return status;
 }
 
+// pool of up to -c session workers: workers are started as sessions arrive, sessions that arrive while
+// all workers are busy wait in the queue until a session ends, and workers idle for SESSION_WORKER_IDLE_SEC exit
+class SessionPool {
+public:
+    SessionPool(Arguments * args_) : args{ args_ }, maxWorkers{ args_->getNumSessionWorkers() }, numWorkers{ 0 }, idleWorkers{ 0 }, stopping{ false } {
+    }
+    // queue a session: returns the number of sessions waiting for a busy worker to become free
+    int submit(const Session& item) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(item);
+        if((int)queue.size() > idleWorkers && numWorkers < maxWorkers) {
+            numWorkers++;
+            idleWorkers++;
+            std::thread worker(&SessionPool::run, this);
+            std::thread::id id = worker.get_id();
+            threads[id] = std::move(worker);
+        }
+        signal.notify_one();
+        return std::max(0, (int)queue.size() - idleWorkers);
+    }
+    int getNumWorkers() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return numWorkers;
+    }
+    // join the workers that exited after being idle
+    void reap() {
+        std::vector<std::thread> finished;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for(auto id : exited) {
+                finished.push_back(std::move(threads[id]));
+                threads.erase(id);
+            }
+            exited.clear();
+        }
+        for(auto& worker : finished) {
+            worker.join();
+        }
+    }
+    // stop all workers after their current session and close the sessions still queued
+    void stop() {
+        std::map<std::thread::id,std::thread> workers;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            workers.swap(threads);
+            for(auto& item : queue) {
+                close(std::get<0>(item));
+            }
+            queue.clear();
+            exited.clear();
+        }
+        signal.notify_all();
+        for(auto& it : workers) {
+            it.second.join();
+        }
+    }
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for(;;) {
+            if(!signal.wait_for(lock, std::chrono::seconds(SESSION_WORKER_IDLE_SEC), [this] { return stopping || !queue.empty(); })) {
+                idleWorkers--;
+                numWorkers--;
+                exited.push_back(std::this_thread::get_id());
+                info("session worker exited after %d seconds idle (%d workers left)", SESSION_WORKER_IDLE_SEC, numWorkers);
+                return;
+            }
+            if(stopping) {
+                idleWorkers--;
+                numWorkers--;
+                return;
+            }
+            Session item = queue.front();
+            queue.pop_front();
+            idleWorkers--;
+            lock.unlock();
+            session(std::get<0>(item), args, std::get<1>(item), std::get<2>(item));
+            lock.lock();
+            idleWorkers++;
+        }
+    }
+    Arguments * args;
+    int maxWorkers;
+    int numWorkers;
+    int idleWorkers;
+    bool stopping;
+    std::deque<Session> queue;
+    std::map<std::thread::id,std::thread> threads;
+    std::vector<std::thread::id> exited;
+    std::mutex mutex;
+    std::condition_variable signal;
+};
+
+static void closePending(int epfd, int sock, std::map<int,PendingConnection>& pending)
+{
+    epoll_ctl(epfd, EPOLL_CTL_DEL, sock, nullptr);
+    close(sock);
+    pending.erase(sock);
+}
+
+// progress the INFCOM_CMD_SEND_MODE handshake of a non-blocking client socket:
+// returns 1 when the reply is complete, 0 when more I/O is needed, -1 on error
+static int progressHandshake(int sock, PendingConnection& conn)
+{
+    const size_t cmdSize = sizeof(InfComCommand);
+    while(conn.bytesSent < cmdSize) {
+        ssize_t n = send(sock, (const char *)&conn.cmd + conn.bytesSent, cmdSize - conn.bytesSent, MSG_NOSIGNAL);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return 0;
+        if(n <= 0)
+            return -1;
+        conn.bytesSent += n;
+        if(conn.bytesSent == cmdSize)
+            memset(&conn.cmd, 0, cmdSize); // the reply is received into the same command
+    }
+    while(conn.bytesReceived < cmdSize) {
+        ssize_t n = recv(sock, (char *)&conn.cmd + conn.bytesReceived, cmdSize - conn.bytesReceived, 0);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return 0;
+        if(n <= 0)
+            return -1;
+        conn.bytesReceived += n;
+    }
+    return 1;
+}
+
 int server(Arguments * args)
 {
     // setup socket address structure and create socket
@@ -89,7 +239,7 @@ int server(Arguments * args)
     server_addr.sin_port = htons(args->getPort());
     server_addr.sin_addr.s_addr = INADDR_ANY;
     int sockServer = socket(PF_INET,SOCK_STREAM, 0);
-    if (!sockServer) {
+    if (sockServer < 0) {
         return error("socket() failed");
     }
 
@@ -108,23 +258,113 @@ int server(Arguments * args)
     if (listen(sockServer, SOMAXCONN) < 0) {
         return error_close(sockServer, "listen() failed");
     }
-    info("listening on port %d for annInferenceApp connections ...", args->getPort());
+    fcntl(sockServer, F_SETFL, fcntl(sockServer, F_GETFL, 0) | O_NONBLOCK);
+
+    // the reactor owns all sockets until their handshake completes
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0) {
+        return error_close(sockServer, "epoll_create1() failed");
+    }
+    struct epoll_event ev = { 0 };
+    ev.events = EPOLLIN;
+    ev.data.fd = sockServer;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, sockServer, &ev) < 0) {
+        close(epfd);
+        return error_close(sockServer, "epoll_ctl(listen) failed");
+    }
 
-    // accept clients
-    struct sockaddr_in client_addr;
-    socklen_t clientlen = sizeof(client_addr);
-    int sockClient = -1;
-    while ((sockClient = accept(sockServer, (struct sockaddr *)&client_addr, &clientlen)) > 0) {
-        // client info
-        char clientName[256] = "Unknown";
-        inet_ntop(AF_INET, &client_addr.sin_addr, clientName, sizeof(clientName));
+    // sessions run on a pool of up to -c workers
+    SessionPool pool(args);
+    info("listening on port %d for annInferenceApp connections (up to %d session workers) ...", args->getPort(), args->getNumSessionWorkers());
 
-        // run client connection in a separate thread
-        std::thread work(connection, sockClient, args, clientName);
-        work.detach();
+    // event loop: accept clients and run the INFCOM_CMD_SEND_MODE handshake
+    std::map<int,PendingConnection> pending;
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+    for(;;) {
+        // wake up at least once per idle period to join the workers that exited
+        int count = epoll_wait(epfd, events, MAX_EPOLL_EVENTS, SESSION_WORKER_IDLE_SEC * 1000);
+        pool.reap();
+        if(count < 0) {
+            if(errno == EINTR)
+                continue;
+            error("epoll_wait() failed (errno:%d)", errno);
+            break;
+        }
+        for(int e = 0; e < count; e++) {
+            int sock = events[e].data.fd;
+            if(sock == sockServer) {
+                // accept all clients ready on the listen socket
+                for(;;) {
+                    struct sockaddr_in client_addr;
+                    socklen_t clientlen = sizeof(client_addr);
+                    int sockClient = accept4(sockServer, (struct sockaddr *)&client_addr, &clientlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if(sockClient < 0) {
+                        if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                            warning("accept() failed (errno:%d)", errno);
+                        break;
+                    }
+                    // client info
+                    char clientName[256] = "Unknown";
+                    inet_ntop(AF_INET, &client_addr.sin_addr, clientName, sizeof(clientName));
+                    info("== CONNECTED to %s ================", clientName);
+
+                    // ask connection mode by sending InfComCommand:INFCOM_CMD_SEND_MODE
+                    PendingConnection& conn = pending[sockClient];
+                    conn.clientName = clientName;
+                    conn.cmd = { INFCOM_MAGIC, INFCOM_CMD_SEND_MODE, { 0 }, { 0 } };
+                    conn.bytesSent = conn.bytesReceived = 0;
+                    ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP;
+                    ev.data.fd = sockClient;
+                    if(epoll_ctl(epfd, EPOLL_CTL_ADD, sockClient, &ev) < 0) {
+                        error("epoll_ctl(%s) failed", clientName);
+                        close(sockClient);
+                        pending.erase(sockClient);
+                    }
+                }
+                continue;
+            }
+            auto it = pending.find(sock);
+            if(it == pending.end())
+                continue;
+            PendingConnection& conn = it->second;
+            int status = (events[e].events & EPOLLERR) ? -1 : progressHandshake(sock, conn);
+            if(status < 0) {
+                info("== disconnected %s before selecting a mode ================", conn.clientName.c_str());
+                closePending(epfd, sock, pending);
+            }
+            else if(status == 0) {
+                if(conn.bytesSent == sizeof(InfComCommand)) {
+                    ev.events = EPOLLIN | EPOLLRDHUP;
+                    ev.data.fd = sock;
+                    epoll_ctl(epfd, EPOLL_CTL_MOD, sock, &ev);
+                }
+            }
+            else {
+                // hand over the client to a session worker with a blocking socket
+                epoll_ctl(epfd, EPOLL_CTL_DEL, sock, nullptr);
+                fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) & ~O_NONBLOCK);
+                if(conn.cmd.magic != INFCOM_MAGIC || conn.cmd.command != INFCOM_CMD_SEND_MODE) {
+                    error("recv() incorrect InfComCommand from %s (magic 0x%08x command 0x%08x)", conn.clientName.c_str(), conn.cmd.magic, conn.cmd.command);
+                    close(sock);
+                }
+                else {
+                    int waiting = pool.submit(Session(sock, conn.clientName, conn.cmd));
+                    if(waiting > 0) {
+                        warning("all %d session workers are busy: %s waits for a session to end (%d sessions waiting)",
+                                pool.getNumWorkers(), conn.clientName.c_str(), waiting);
+                    }
+                }
+                pending.erase(it);
+            }
+        }
     }
 
-    // close server
+    // stop the workers and close server
+    pool.stop();
+    for(auto& it : pending) {
+        close(it.first);
+    }
+    close(epfd);
     close(sockServer);
 
     return 0;
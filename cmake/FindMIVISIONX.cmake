@@ -128,6 +128,21 @@ else()
     endif()
 endif()
 
+# find vx_loomsl
+find_path(VX_LOOMSL_INCLUDE_DIR NAMES live_stitch_api.h PATHS ${ROCM_PATH}/include/mivisionx)
+find_library(VX_LOOMSL_LIBRARY NAMES vx_loomsl HINTS ${ROCM_PATH}/lib)
+mark_as_advanced(VX_LOOMSL_LIBRARY)
+if(VX_LOOMSL_LIBRARY AND VX_LOOMSL_INCLUDE_DIR)
+    if(MIVISIONX_FIND_REQUIRED)
+        message("-- ${White}FindMIVISIONX -- Using VX_LOOMSL: \n\tLib:${VX_LOOMSL_LIBRARY}${ColourReset}")
+    endif()
+    set(MIVISIONX_LIBRARIES ${MIVISIONX_LIBRARIES} ${VX_LOOMSL_LIBRARY})
+else()
+    if(MIVISIONX_FIND_REQUIRED)
+        message( "-- ${Yellow}NOTE: FindMIVISIONX failed to find VX_LOOMSL${ColourReset}" )
+    endif()
+endif()
+
 
 # find runvx exe
 find_program(RUNVX_EXECUTABLE NAMES runvx PATHS ${ROCM_PATH}/bin)
@@ -187,6 +202,7 @@ set(VX_AMD_MEDIA_LIBRARY ${VX_AMD_MEDIA_LIBRARY} CACHE INTERNAL "")
 set(VX_AMD_MIGRAPHX_LIBRARY ${VX_AMD_MIGRAPHX_LIBRARY} CACHE INTERNAL "")
 set(VX_NN_LIBRARY ${VX_NN_LIBRARY} CACHE INTERNAL "")
 set(VX_OPENCV_LIBRARY ${VX_OPENCV_LIBRARY} CACHE INTERNAL "")
+set(VX_LOOMSL_LIBRARY ${VX_LOOMSL_LIBRARY} CACHE INTERNAL "")
 set(VX_RPP_LIBRARY ${VX_RPP_LIBRARY} CACHE INTERNAL "")
 set(RUNVX_EXECUTABLE ${RUNVX_EXECUTABLE} CACHE INTERNAL "")
 set(MIVISIONX_INCLUDE_DIR ${MIVISIONX_INCLUDE_DIR} CACHE INTERNAL "")
@@ -334,6 +334,12 @@ def generateModuleH(graph,fileName,virtual_tensor_flag):
 """//
 extern "C" VX_API_ENTRY vx_status VX_API_CALL annAddToGraph(vx_graph graph, %s, %s, std::map<std::string, vx_tensor> &tensorMap, const char * binaryFilename);
 
+////
+// release a graph built by annAddToGraph(): the weights file is unmapped once no graph uses it, including
+// graphs released earlier with vxReleaseGraph()
+//
+extern "C" VX_API_ENTRY vx_status VX_API_CALL annReleaseGraph(vx_graph * graph);
+
 #endif
 """ % (', '.join(['vx_tensor ' + tensor.name for tensor in graph.inputs]), \
        ', '.join(['vx_tensor ' + tensor.name for tensor in graph.outputs])))
@@ -342,6 +348,12 @@ extern "C" VX_API_ENTRY vx_status VX_API_CALL annAddToGraph(vx_graph graph, %s,
 """//
 extern "C" VX_API_ENTRY vx_status VX_API_CALL annAddToGraph(vx_graph graph, %s, %s, const char * binaryFilename);
 
+////
+// release a graph built by annAddToGraph(): the weights file is unmapped once no graph uses it, including
+// graphs released earlier with vxReleaseGraph()
+//
+extern "C" VX_API_ENTRY vx_status VX_API_CALL annReleaseGraph(vx_graph * graph);
+
 #endif
 """ % (', '.join(['vx_tensor ' + tensor.name for tensor in graph.inputs]), \
        ', '.join(['vx_tensor ' + tensor.name for tensor in graph.outputs])))
@@ -358,17 +370,173 @@ def generateModuleCPP(graph,fileName,virtual_tensor_flag):
 #include <vx_amd_nn.h>
 #include <vx_ext_amd.h>
 #include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !_WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
 
 #define ERROR_CHECK_OBJECT(obj) { vx_status status = vxGetStatus((vx_reference)(obj)); if(status != VX_SUCCESS) { vxAddLogEntry((vx_reference)context, status     , "ERROR: failed with status = (%d) at " __FILE__ "#%d\\n", status, __LINE__); return status; } }
 #define ERROR_CHECK_STATUS(call) { vx_status status = (call); if(status != VX_SUCCESS) { vxAddLogEntry((vx_reference)context, status, "ERROR: failed with status = (%d) at " __FILE__ "#%d\\n", status, __LINE__); return status; } }
 
-static vx_status initializeTensor(vx_context context, vx_tensor tensor, FILE * fp, const char * binaryFilename)
+#define VARIABLES_FILE_MAGIC 0xf00dd1e0
+#define VARIABLES_DATA_MAGIC 0xf00dd1e1
+#define VARIABLES_EOFF_MAGIC 0xf00dd1e2
+#define VARIABLES_PADD_MAGIC 0xf00dd1e3
+
+struct WeightsMapping {
+    const vx_uint8 * base;
+    size_t size;
+    int refCount;
+};
+
+struct WeightsFile {
+    const vx_uint8 * base;
+    size_t size;
+    size_t pos;
+};
+
+// mappings of weights files, keyed by file identity so that a file replaced on disk is mapped again,
+// and the graphs holding a reference to each mapping
+static std::mutex weightsMutex;
+static std::map<std::string, WeightsMapping *> weightsFiles;
+static std::multimap<vx_graph, WeightsMapping *> weightsGraphs;
+
+static void unmapWeightsFile(WeightsMapping * mapping)
+{
+#if _WIN32
+    delete[] mapping->base;
+#else
+    munmap((void *)mapping->base, mapping->size);
+#endif
+    delete mapping;
+}
+
+// each entry of weightsGraphs holds a reference to its graph and to the context of the graph, so the
+// graph, and with it the variables pointing into the mapping, can't be destroyed behind our back. Once
+// these are the only references left, the application has released the graph, whether with
+// annReleaseGraph() or vxReleaseGraph(): the graph is destroyed here and unused mappings are unmapped.
+// Called with weightsMutex held.
+static void releaseUnusedWeights()
+{
+    for(auto it = weightsGraphs.begin(); it != weightsGraphs.end(); ) {
+        vx_graph graph = it->first;
+        auto range = weightsGraphs.equal_range(graph);
+        vx_uint32 count = 0;
+        if(vxQueryReference((vx_reference)graph, VX_REFERENCE_COUNT, &count, sizeof(count)) != VX_SUCCESS ||
+           count > (vx_uint32)weightsGraphs.count(graph)) {
+            it = range.second;
+            continue;
+        }
+        vx_context context = vxGetContext((vx_reference)graph);
+        std::vector<WeightsMapping *> mappings;
+        for(auto entry = range.first; entry != range.second; ++entry) {
+            mappings.push_back(entry->second);
+            vx_graph handle = graph;
+            vxReleaseGraph(&handle);
+        }
+        for(WeightsMapping * mapping : mappings) {
+            if(--mapping->refCount == 0) {
+                for(auto file = weightsFiles.begin(); file != weightsFiles.end(); ++file) {
+                    if(file->second == mapping) {
+                        weightsFiles.erase(file);
+                        break;
+                    }
+                }
+                unmapWeightsFile(mapping);
+            }
+            vx_context handle = context;
+            vxReleaseContext(&handle);
+        }
+        it = weightsGraphs.erase(range.first, range.second);
+    }
+}
+
+// map the weights file read-only: the pages are shared by every graph and every process that
+// loads the same file. The variables created by createTensorFromWeights() point directly into
+// the mapping, so the mapping is kept until the graph is destroyed (see releaseUnusedWeights).
+static vx_status openWeightsFile(vx_context context, vx_graph graph, const char * binaryFilename, WeightsFile * weights)
+{
+    std::lock_guard<std::mutex> lock(weightsMutex);
+    releaseUnusedWeights();
+    struct stat st;
+    if(stat(binaryFilename, &st) != 0 || st.st_size <= 0) {
+        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: unable to open: %s\\n", binaryFilename);
+        return VX_FAILURE;
+    }
+#if _WIN32
+    std::string key = std::string(binaryFilename) + ":" + std::to_string((long long)st.st_size) + ":" + std::to_string((long long)st.st_mtime);
+#else
+    std::string key = std::to_string((unsigned long long)st.st_dev) + ":" + std::to_string((unsigned long long)st.st_ino) + ":" +
+                      std::to_string((long long)st.st_size) + ":" + std::to_string((long long)st.st_mtim.tv_sec) + "." + std::to_string((long long)st.st_mtim.tv_nsec);
+#endif
+    auto it = weightsFiles.find(key);
+    if(it == weightsFiles.end()) {
+        const vx_uint8 * base = nullptr;
+        size_t size = 0;
+#if _WIN32
+        FILE * fp = fopen(binaryFilename, "rb");
+        if(fp) {
+            fseek(fp, 0L, SEEK_END);
+            size = (size_t)ftell(fp);
+            fseek(fp, 0L, SEEK_SET);
+            vx_uint8 * buf = new vx_uint8[size];
+            if(fread(buf, 1, size, fp) == size) base = buf;
+            else delete[] buf;
+            fclose(fp);
+        }
+#else
+        int fd = open(binaryFilename, O_RDONLY);
+        if(fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0) {
+            size = (size_t)st.st_size;
+            void * ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            if(ptr != MAP_FAILED) base = (const vx_uint8 *)ptr;
+        }
+        if(fd >= 0) close(fd);
+#endif
+        if(!base) {
+            vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: unable to open: %s\\n", binaryFilename);
+            return VX_FAILURE;
+        }
+        WeightsMapping * mapping = new WeightsMapping;
+        mapping->base = base;
+        mapping->size = size;
+        mapping->refCount = 0;
+        it = weightsFiles.insert(std::make_pair(key, mapping)).first;
+    }
+    WeightsMapping * mapping = it->second;
+    mapping->refCount++;
+    vxRetainReference((vx_reference)graph);
+    vxRetainReference((vx_reference)context);
+    weightsGraphs.insert(std::make_pair(graph, mapping));
+    weights->base = mapping->base;
+    weights->size = mapping->size;
+    weights->pos = 0;
+    return VX_SUCCESS;
+}
+
+static vx_status readWeightsMagic(vx_context context, WeightsFile * weights, vx_uint32 expected, const char * binaryFilename)
+{
+    vx_uint32 magic = 0;
+    if(weights->pos + sizeof(magic) <= weights->size) {
+        memcpy(&magic, weights->base + weights->pos, sizeof(magic));
+        weights->pos += sizeof(magic);
+    }
+    if(magic != expected) {
+        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid magic 0x%x (expected 0x%x) in %s\\n", magic, expected, binaryFilename);
+        return VX_FAILURE;
+    }
+    return VX_SUCCESS;
+}
+
+static vx_tensor createTensorFromWeights(vx_context context, vx_size num_of_dims, const vx_size * dims, vx_enum data_type, WeightsFile * weights, const char * binaryFilename)
 {
-    vx_enum data_type = VX_TYPE_FLOAT32;
-    vx_size num_of_dims = 4, dims[4] = { 1, 1, 1, 1 }, stride[4];
-    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_DATA_TYPE, &data_type, sizeof(vx_enum)));
-    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_NUMBER_OF_DIMS, &num_of_dims, sizeof(vx_size)));
-    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_DIMS, &dims, num_of_dims * sizeof(vx_size)));
     vx_size itemsize = sizeof(float);
     if(data_type == VX_TYPE_UINT8 || data_type == VX_TYPE_INT8) {
         itemsize = sizeof(vx_uint8);
@@ -379,26 +547,43 @@ static vx_status initializeTensor(vx_context context, vx_tensor tensor, FILE * f
     else if(data_type == VX_TYPE_INT64) {
         itemsize = sizeof(vx_int64);
     }
-    vx_size count = dims[0] * dims[1] * dims[2] * dims[3];
+    std::vector<vx_size> stride(num_of_dims, itemsize);
+    for(vx_size i = 1; i < num_of_dims; i++) {
+        stride[i] = stride[i-1] * dims[i-1];
+    }
+    vx_size count = stride[num_of_dims-1] * dims[num_of_dims-1] / itemsize;
 
+    // skip the alignment padding in front of the data
     vx_uint32 h[2] = { 0 };
-    fread(h, 1, sizeof(h), fp);
-    if(h[0] != 0xf00dd1e1 || (vx_size)h[1] != (count*itemsize)) {
-      vxAddLogEntry((vx_reference)tensor, VX_FAILURE, "ERROR: invalid data (magic,size)=(0x%x,%d) in %s at byte position %d -- expected size is %ld\\n", h[0], h[1], binaryFilename, ftell(fp)-sizeof(h), count*itemsize);
-      return VX_FAILURE;
+    for(;;) {
+        if(weights->pos + sizeof(h) > weights->size) {
+            h[0] = 0;
+            break;
+        }
+        memcpy(h, weights->base + weights->pos, sizeof(h));
+        if(h[0] != VARIABLES_PADD_MAGIC)
+            break;
+        weights->pos += sizeof(h) + h[1];
     }
-
-    vx_map_id map_id;
-    void * ptr;
-    ERROR_CHECK_STATUS(vxMapTensorPatch(tensor, num_of_dims, nullptr, nullptr, &map_id, stride, (void **)&ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
-    vx_size n = fread(ptr, itemsize, count, fp);
-    if(n != count) {
-        vxAddLogEntry((vx_reference)tensor, VX_FAILURE, "ERROR: expected char[%ld], but got char[%ld] in %s\\n", count*itemsize, n*itemsize, binaryFilename);
-        return VX_FAILURE;
+    if(h[0] != VARIABLES_DATA_MAGIC || (vx_size)h[1] != (count*itemsize) || weights->pos + sizeof(h) + h[1] > weights->size) {
+      vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid data (magic,size)=(0x%x,%d) in %s at byte position %ld -- expected size is %ld\\n", h[0], h[1], binaryFilename, weights->pos, count*itemsize);
+      return nullptr;
     }
-    ERROR_CHECK_STATUS(vxUnmapTensorPatch(tensor, map_id));
+    void * ptr = (void *)(weights->base + weights->pos + sizeof(h));
+    weights->pos += sizeof(h) + h[1];
 
-    return VX_SUCCESS;
+    return vxCreateTensorFromHandle(context, num_of_dims, dims, data_type, 0, stride.data(), ptr, VX_MEMORY_TYPE_HOST);
+}
+
+VX_API_ENTRY vx_status VX_API_CALL annReleaseGraph(vx_graph * graph)
+{
+    vx_status status = vxReleaseGraph(graph);
+    if(status == VX_SUCCESS) {
+        // destroy the graph if no other reference is left and unmap the weights files it was the last user of
+        std::lock_guard<std::mutex> lock(weightsMutex);
+        releaseUnusedWeights();
+    }
+    return status;
 }
 """ )
         if virtual_tensor_flag == 0:
@@ -423,42 +608,20 @@ static vx_status initializeTensor(vx_context context, vx_tensor tensor, FILE * f
     // create variables
 """ % (', '.join(['vx_tensor ' + tensor.name for tensor in graph.inputs]), \
        ', '.join(['vx_tensor ' + tensor.name for tensor in graph.outputs])))
+        f.write( \
+"""    WeightsFile weights__variables;
+    ERROR_CHECK_STATUS(openWeightsFile(context, graph, binaryFilename, &weights__variables));
+    ERROR_CHECK_STATUS(readWeightsMagic(context, &weights__variables, VARIABLES_FILE_MAGIC, binaryFilename));
+""")
         for tensor in graph.initializers:
             f.write( \
 """    vx_size dims_%s[%d] = { %s };
-    vx_tensor %s = vxCreateTensor(context, %d, dims_%s, %s, 0);
+    vx_tensor %s = createTensorFromWeights(context, %d, dims_%s, %s, &weights__variables, binaryFilename);
     ERROR_CHECK_OBJECT(%s);
 """ %(tensor.name, len(tensor.shape), ', '.join([str(v) for v in reversed(tensor.shape)]), \
       tensor.name, len(tensor.shape), tensor.name, tensor_type_nnir2openvx[tensor.type], tensor.name))
         f.write( \
-"""
-    // initialize variables
-    FILE * fp__variables = fopen(binaryFilename, "rb");
-    if(!fp__variables) {
-        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: unable to open: %s\\n", binaryFilename);
-        return VX_FAILURE;
-    }
-    { vx_uint32 magic = 0;
-      fread(&magic, 1, sizeof(magic), fp__variables);
-      if(magic != 0xf00dd1e0) {
-        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid file magic in %s\\n", binaryFilename);
-        return VX_FAILURE;
-      }
-    }
-""")
-        for tensor in graph.initializers:
-            f.write( \
-"""    ERROR_CHECK_STATUS(initializeTensor(context, %s, fp__variables, binaryFilename));
-""" %(tensor.name))
-        f.write( \
-"""    { vx_uint32 magic = 0;
-      fread(&magic, 1, sizeof(magic), fp__variables);
-      if(magic != 0xf00dd1e2) {
-        vxAddLogEntry((vx_reference)context, VX_FAILURE, "ERROR: invalid eoff magic in %s\\n", binaryFilename);
-        return VX_FAILURE;
-      }
-      fclose(fp__variables);
-    }
+"""    ERROR_CHECK_STATUS(readWeightsMagic(context, &weights__variables, VARIABLES_EOFF_MAGIC, binaryFilename));
 
     // create local tensors used in graph
 """)
@@ -1462,7 +1625,7 @@ VX_API_ENTRY pyif_ann_handle VX_API_CALL annCreateInference(const char * binaryF
     if(!successful) {
         if(handle) {
             if(handle->graph)
-                vxReleaseGraph(&handle->graph);
+                annReleaseGraph(&handle->graph);
             if(handle->input)
                 vxReleaseTensor(&handle->input);
 """ )
@@ -1488,8 +1651,8 @@ VX_API_ENTRY int VX_API_CALL annReleaseInference(pyif_ann_handle handle)
         status = VX_FAILURE;
         printf("ERROR: annReleaseInference: invalid handle\\n");
     }
-    else if(handle->graph && (status = vxReleaseGraph(&handle->graph)) != VX_SUCCESS) {
-        printf("ERROR: annReleaseInference: vxReleaseGraph: failed (%d)\\n", status);
+    else if(handle->graph && (status = annReleaseGraph(&handle->graph)) != VX_SUCCESS) {
+        printf("ERROR: annReleaseInference: annReleaseGraph: failed (%d)\\n", status);
     }
     else if(handle->input && (status = vxReleaseTensor(&handle->input)) != VX_SUCCESS) {
         printf("ERROR: annReleaseInference: vxReleaseTensor(input): failed (%d)\\n", status);
@@ -2715,7 +2878,7 @@ int main(int argc, const char ** argv)
     printf("OK: vxProcessGraph() took %.3f msec (average over %d iterations)\\n", (float)(t1-t0)*1000.0f/(float)freq/(float)N, N);
 
     // release resources
-    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(annReleaseGraph(&graph));
 """)
         for tensor in graph.inputs:
             f.write( \
@@ -2737,11 +2900,20 @@ def generateBinary(graph,fileName):
     VARIABLES_FILE_MAGIC = 0xF00DD1E0
     VARIABLES_DATA_MAGIC = 0xF00DD1E1
     VARIABLES_EOFF_MAGIC = 0xF00DD1E2
+    VARIABLES_PADD_MAGIC = 0xF00DD1E3
+    VARIABLES_DATA_ALIGN = 64
     print('creating ' + fileName + ' ...')
     with open(fileName, 'wb') as f:
         f.write(struct.pack('I', VARIABLES_FILE_MAGIC))
         for tensor in graph.initializers:
             binary = graph.binaries[tensor.name]
+            # insert a padding record so that the data starts at an aligned offset,
+            # since the generated module uses the data in-place from the mapped file
+            pos = f.tell() + 8
+            if pos % VARIABLES_DATA_ALIGN != 0:
+                padding = (VARIABLES_DATA_ALIGN - (pos + 8) % VARIABLES_DATA_ALIGN) % VARIABLES_DATA_ALIGN
+                f.write(struct.pack('II', VARIABLES_PADD_MAGIC, padding))
+                f.write(bytes(padding))
             f.write(struct.pack('II', VARIABLES_DATA_MAGIC, len(binary)))
             f.write(binary)
         f.write(struct.pack('I', VARIABLES_EOFF_MAGIC))
@@ -0,0 +1,584 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// runs the vx_loomsl warp, merge and multiband blend nodes on the CPU target and compares
+// their outputs against scalar references built from random tables and images.
+// Run with STITCH_CPU_DISABLE_AVX2=1 to check the SSE4.1 path.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <VX/vx.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+// image format of the multiband blend output registered by vx_loomsl (S16 RGB, 6 bytes per pixel)
+#define VX_DF_IMAGE_RGB4_AMD VX_DF_IMAGE('R', 'G', 'B', '4')
+
+// table entries with the same layout as the vx_loomsl ones
+struct WarpRemapEntry
+{
+    vx_uint16 coord[16]; // x, y of 8 pixels in 1/8 pixel units (0xffff, 0xffff: invalid)
+};
+struct BlendValidEntry
+{
+    vx_uint32 camId : 5;
+    vx_uint32 dstX : 14;
+    vx_uint32 dstY : 13;
+    vx_uint32 last_x : 8;
+    vx_uint32 last_y : 8;
+    vx_uint32 skip_x : 8;
+    vx_uint32 skip_y : 8;
+};
+
+#define NUM_CAMERAS 3
+#define CAM_WIDTH 96
+#define CAM_HEIGHT 40
+#define OUT_WIDTH 128
+#define OUT_HEIGHT 24
+
+static int failures = 0;
+
+static unsigned int random_state = 12345;
+
+static unsigned int random_next()
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+static vx_context context;
+
+static void check(const char *name, size_t mismatches, size_t count)
+{
+    if (mismatches)
+    {
+        printf("FAILED: %s: %zu of %zu values differ from the reference\n", name, mismatches, count);
+        failures++;
+    }
+    else
+    {
+        printf("PASSED: %s\n", name);
+    }
+}
+
+// copies a packed host image (rows of width * bpp bytes) into or out of an OpenVX image
+static void copy_image(vx_image image, vector<vx_uint8> &data, vx_uint32 bpp, vx_enum usage)
+{
+    vx_uint32 width = 0, height = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_WIDTH, &width, sizeof(width)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_HEIGHT, &height, sizeof(height)));
+    if (data.size() != (size_t)width * height * bpp)
+        data.resize((size_t)width * height * bpp);
+    vx_rectangle_t rect = { 0, 0, width, height };
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    void *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, &ptr, usage, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    for (vx_uint32 y = 0; y < height; y++)
+    {
+        vx_uint8 *row = (vx_uint8 *)ptr + y * addr.stride_y;
+        if (usage == VX_READ_ONLY)
+            memcpy(&data[(size_t)y * width * bpp], row, width * bpp);
+        else
+            memcpy(row, &data[(size_t)y * width * bpp], width * bpp);
+    }
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static vx_image create_image(vx_uint32 width, vx_uint32 height, vx_df_image format, vector<vx_uint8> &data, vx_uint32 bpp, bool random)
+{
+    vx_image image = vxCreateImage(context, width, height, format);
+    ERROR_CHECK_OBJECT(image);
+    data.resize((size_t)width * height * bpp);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = random ? (vx_uint8)random_next() : 0x5a;
+    copy_image(image, data, bpp, VX_WRITE_ONLY);
+    return image;
+}
+
+static vx_node create_node(vx_graph graph, const char *kernel_name, const vector<vx_reference> &params)
+{
+    vx_kernel kernel = vxGetKernelByName(context, kernel_name);
+    ERROR_CHECK_OBJECT(kernel);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    ERROR_CHECK_OBJECT(node);
+    for (vx_uint32 i = 0; i < (vx_uint32)params.size(); i++)
+    {
+        if (params[i])
+            ERROR_CHECK_STATUS(vxSetParameterByIndex(node, i, params[i]));
+    }
+    ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+    return node;
+}
+
+static void run_graph(vx_graph graph)
+{
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+}
+
+static vx_uint8 saturate_u8(float v)
+{
+    return (vx_uint8)min(255L, max(0L, lrintf(v)));
+}
+
+static vx_int16 saturate_s16(float v)
+{
+    return (vx_int16)min(32767L, max(-32768L, lrintf(v)));
+}
+
+// returns 1 when any channel of a U8 pixel is off by more than one from the float reference
+static size_t pixel_differs(const vx_uint8 *out, const float *ref, vx_uint32 channels)
+{
+    for (vx_uint32 c = 0; c < channels; c++)
+    {
+        if (abs((int)out[c] - (int)saturate_u8(ref[c])) > 1)
+            return 1;
+    }
+    return 0;
+}
+
+static void bicubic_coeffs(float x, float mf[4])
+{
+    mf[0] = -0.5f * x + x * x - 0.5f * x * x * x;
+    mf[1] = 1.0f - 2.5f * x * x + 1.5f * x * x * x;
+    mf[2] = 0.5f * x + 2.0f * x * x - 1.5f * x * x * x;
+    mf[3] = 0.5f * (-x * x + x * x * x);
+}
+
+// warp: every camera of the stacked input is remapped into its own band of the output through random
+// tables with bilinear or bicubic interpolation; a few entries are skipped and a few pixels are invalid
+static void test_warp(const char *name, bool bicubic, vx_df_image in_format, vx_df_image out_format, vx_enum gray_method, bool luma)
+{
+    vx_uint32 in_bpp = (in_format == VX_DF_IMAGE_RGBX) ? 4 : 3, out_bpp = (out_format == VX_DF_IMAGE_RGBX) ? 4 : 3;
+    vector<vx_uint8> in_data, out_data, luma_data;
+    vx_image input = create_image(CAM_WIDTH, CAM_HEIGHT * NUM_CAMERAS, in_format, in_data, in_bpp, true);
+    vx_image output = create_image(OUT_WIDTH, OUT_HEIGHT * NUM_CAMERAS, out_format, out_data, out_bpp, false);
+    vx_image output_luma = luma ? create_image(OUT_WIDTH, OUT_HEIGHT * NUM_CAMERAS, VX_DF_IMAGE_U8, luma_data, 1, false) : nullptr;
+
+    // tables: one entry per 8 output pixels, sources kept inside the camera image for the interpolation window
+    vector<vx_uint32> valid;
+    vector<WarpRemapEntry> remap;
+    vx_uint32 lo = bicubic ? 1 : 0, hi_x = bicubic ? CAM_WIDTH - 3 : CAM_WIDTH - 2, hi_y = bicubic ? CAM_HEIGHT - 3 : CAM_HEIGHT - 2;
+    for (vx_uint32 cam = 0; cam < NUM_CAMERAS; cam++)
+    {
+        for (vx_uint32 y = 0; y < OUT_HEIGHT; y++)
+        {
+            for (vx_uint32 bx = 0; bx < OUT_WIDTH / 8; bx++)
+            {
+                if (random_next() % 5 == 0)
+                    continue;
+                WarpRemapEntry entry;
+                for (int i = 0; i < 8; i++)
+                {
+                    if (random_next() % 10 == 0)
+                    {
+                        entry.coord[2 * i] = entry.coord[2 * i + 1] = 0xffff;
+                        continue;
+                    }
+                    entry.coord[2 * i] = (vx_uint16)(((lo + random_next() % (hi_x - lo + 1)) << 3) | (random_next() & 7));
+                    entry.coord[2 * i + 1] = (vx_uint16)(((lo + random_next() % (hi_y - lo + 1)) << 3) | (random_next() & 7));
+                }
+                valid.push_back(cam | (bx << 8) | (y << 19));
+                remap.push_back(entry);
+            }
+        }
+    }
+    // entries marked 0xffffffff are skipped
+    for (int i = 0; i < 4; i++)
+    {
+        size_t k = random_next() % valid.size();
+        valid[k] = 0xffffffff;
+    }
+    vx_enum remap_type = vxRegisterUserStruct(context, sizeof(WarpRemapEntry));
+    vx_array valid_array = vxCreateArray(context, VX_TYPE_UINT32, valid.size());
+    vx_array remap_array = vxCreateArray(context, remap_type, remap.size());
+    ERROR_CHECK_OBJECT(valid_array);
+    ERROR_CHECK_OBJECT(remap_array);
+    ERROR_CHECK_STATUS(vxAddArrayItems(valid_array, valid.size(), valid.data(), sizeof(vx_uint32)));
+    ERROR_CHECK_STATUS(vxAddArrayItems(remap_array, remap.size(), remap.data(), sizeof(WarpRemapEntry)));
+
+    vx_uint32 num_cameras = NUM_CAMERAS, num_camera_columns = 1;
+    vx_uint8 flags = bicubic ? 1 : 0;
+    vx_scalar s_method = vxCreateScalar(context, VX_TYPE_ENUM, &gray_method);
+    vx_scalar s_num_cameras = vxCreateScalar(context, VX_TYPE_UINT32, &num_cameras);
+    vx_scalar s_num_camera_columns = vxCreateScalar(context, VX_TYPE_UINT32, &num_camera_columns);
+    vx_scalar s_flags = vxCreateScalar(context, VX_TYPE_UINT8, &flags);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_node node = create_node(graph, "com.amd.loomsl.warp",
+                               { (vx_reference)s_method, (vx_reference)s_num_cameras, (vx_reference)valid_array, (vx_reference)remap_array,
+                                 (vx_reference)input, (vx_reference)output, (vx_reference)output_luma, (vx_reference)s_num_camera_columns,
+                                 nullptr, (vx_reference)s_flags });
+    run_graph(graph);
+    copy_image(output, out_data, out_bpp, VX_READ_ONLY);
+    if (luma)
+        copy_image(output_luma, luma_data, 1, VX_READ_ONLY);
+
+    // reference
+    size_t mismatches = 0, luma_mismatches = 0, count = 0;
+    for (size_t e = 0; e < valid.size(); e++)
+    {
+        if (valid[e] == 0xffffffff)
+            continue;
+        vx_uint32 cam = valid[e] & 0x1f, bx = (valid[e] >> 8) & 0x7ff, y = (valid[e] >> 19) & 0x1fff;
+        const vx_uint8 *ip = &in_data[(size_t)cam * CAM_HEIGHT * CAM_WIDTH * in_bpp];
+        for (int i = 0; i < 8; i++)
+        {
+            vx_uint32 sx = remap[e].coord[2 * i], sy = remap[e].coord[2 * i + 1];
+            size_t op = ((size_t)(cam * OUT_HEIGHT + y) * OUT_WIDTH + bx * 8 + i);
+            const vx_uint8 *out = &out_data[op * out_bpp];
+            count++;
+            if (sx == 0xffff && sy == 0xffff)
+            {
+                bool ok = !out[0] && !out[1] && !out[2] && (out_bpp == 3 || out[3] == 0x80);
+                if (!ok)
+                    mismatches++;
+                if (luma && luma_data[op] != 0)
+                    luma_mismatches++;
+                continue;
+            }
+            float fx = (sx & 7) * 0.125f, fy = (sy & 7) * 0.125f, v[4] = { 0, 0, 0, 0 };
+            int x0 = (int)(sx >> 3), y0 = (int)(sy >> 3);
+            float wx[4], wy[4];
+            int taps;
+            if (bicubic)
+            {
+                bicubic_coeffs(fx, wx);
+                bicubic_coeffs(fy, wy);
+                x0 -= 1;
+                y0 -= 1;
+                taps = 4;
+            }
+            else
+            {
+                wx[0] = 1.0f - fx, wx[1] = fx, wy[0] = 1.0f - fy, wy[1] = fy;
+                taps = 2;
+            }
+            for (int ty = 0; ty < taps; ty++)
+            {
+                for (int tx = 0; tx < taps; tx++)
+                {
+                    const vx_uint8 *p = ip + ((size_t)(y0 + ty) * CAM_WIDTH + x0 + tx) * in_bpp;
+                    for (vx_uint32 c = 0; c < in_bpp; c++)
+                        v[c] += wx[tx] * wy[ty] * p[c];
+                }
+            }
+            if (in_bpp == 3)
+            {
+                if (gray_method == 0)
+                    v[3] = (v[0] + v[1] + v[2]) * 0.3333333333f;
+                else
+                    v[3] = sqrtf((v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) * 0.3333333333f);
+            }
+            mismatches += pixel_differs(out, v, out_bpp);
+            if (luma)
+            {
+                float l = v[0] * 0.2126f + v[1] * 0.7152f + v[2] * 0.0722f;
+                luma_mismatches += pixel_differs(&luma_data[op], &l, 1);
+            }
+        }
+    }
+    check(name, mismatches, count);
+    if (luma)
+    {
+        string luma_name = string(name) + " luma";
+        check(luma_name.c_str(), luma_mismatches, count);
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_method));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_cameras));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_camera_columns));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_flags));
+    ERROR_CHECK_STATUS(vxReleaseArray(&valid_array));
+    ERROR_CHECK_STATUS(vxReleaseArray(&remap_array));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+    if (output_luma)
+        ERROR_CHECK_STATUS(vxReleaseImage(&output_luma));
+}
+
+// merge: every 8-pixel block either copies one camera, blends two to six cameras with the U8 weights,
+// or is left untouched (camera id 31)
+static void test_merge(const char *name, vx_df_image out_format)
+{
+    vx_uint32 out_bpp = (out_format == VX_DF_IMAGE_RGBX) ? 4 : 3, blocks = OUT_WIDTH / 8;
+    vector<vx_uint8> camid_data(blocks * OUT_HEIGHT), group_data[2], in_data, wt_data, out_data;
+    for (int g = 0; g < 2; g++)
+        group_data[g].resize(blocks * OUT_HEIGHT * 2);
+    for (size_t i = 0; i < camid_data.size(); i++)
+    {
+        static const vx_uint8 selections[] = { 0, 1, 2, 31, 64, 128, 129, 130, 131, 132 };
+        camid_data[i] = selections[random_next() % (sizeof(selections) / sizeof(selections[0]))];
+        for (int g = 0; g < 2; g++)
+        {
+            vx_uint16 cams = 0;
+            for (int k = 0; k < 3; k++)
+            {
+                vx_uint32 cam = random_next() % (NUM_CAMERAS + 1);
+                cams |= (vx_uint16)((cam < NUM_CAMERAS ? cam : 31) << (5 * k));
+            }
+            memcpy(&group_data[g][i * 2], &cams, 2);
+        }
+    }
+    vx_image camid = vxCreateImage(context, blocks, OUT_HEIGHT, VX_DF_IMAGE_U8);
+    vx_image group1 = vxCreateImage(context, blocks, OUT_HEIGHT, VX_DF_IMAGE_U16);
+    vx_image group2 = vxCreateImage(context, blocks, OUT_HEIGHT, VX_DF_IMAGE_U16);
+    ERROR_CHECK_OBJECT(camid);
+    ERROR_CHECK_OBJECT(group1);
+    ERROR_CHECK_OBJECT(group2);
+    copy_image(camid, camid_data, 1, VX_WRITE_ONLY);
+    copy_image(group1, group_data[0], 2, VX_WRITE_ONLY);
+    copy_image(group2, group_data[1], 2, VX_WRITE_ONLY);
+    vx_image input = create_image(OUT_WIDTH, OUT_HEIGHT * NUM_CAMERAS, VX_DF_IMAGE_RGBX, in_data, 4, true);
+    vx_image weight = create_image(OUT_WIDTH, OUT_HEIGHT * NUM_CAMERAS, VX_DF_IMAGE_U8, wt_data, 1, true);
+    vx_image output = create_image(OUT_WIDTH, OUT_HEIGHT, out_format, out_data, out_bpp, false);
+
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_node node = create_node(graph, "com.amd.loomsl.merge",
+                               { (vx_reference)camid, (vx_reference)group1, (vx_reference)group2,
+                                 (vx_reference)input, (vx_reference)weight, (vx_reference)output });
+    run_graph(graph);
+    copy_image(output, out_data, out_bpp, VX_READ_ONLY);
+
+    // reference
+    size_t mismatches = 0, count = 0;
+    for (vx_uint32 y = 0; y < OUT_HEIGHT; y++)
+    {
+        for (vx_uint32 b = 0; b < blocks; b++)
+        {
+            vx_uint8 select = camid_data[y * blocks + b];
+            vx_uint32 cams[6], num_cams = 0;
+            if (select < 31)
+            {
+                cams[num_cams++] = select;
+            }
+            else if (select > 31)
+            {
+                vx_uint16 g1, g2;
+                memcpy(&g1, &group_data[0][(y * blocks + b) * 2], 2);
+                memcpy(&g2, &group_data[1][(y * blocks + b) * 2], 2);
+                vx_uint32 all[6] = { g1 & 0x1fu, (g1 >> 5) & 0x1fu, (g1 >> 10) & 0x1fu, g2 & 0x1fu, (g2 >> 5) & 0x1fu, (g2 >> 10) & 0x1fu };
+                vx_uint32 used = 2 + (select > 128) + (select > 129) + (select > 130) + (select > 131);
+                for (vx_uint32 k = 0; k < used; k++)
+                {
+                    if (all[k] < 31)
+                        cams[num_cams++] = all[k];
+                }
+            }
+            for (vx_uint32 x = b * 8; x < b * 8 + 8; x++)
+            {
+                const vx_uint8 *out = &out_data[((size_t)y * OUT_WIDTH + x) * out_bpp];
+                count++;
+                if (select == 31)
+                {
+                    bool untouched = true;
+                    for (vx_uint32 c = 0; c < out_bpp; c++)
+                        untouched = untouched && (out[c] == 0x5a);
+                    if (!untouched)
+                        mismatches++;
+                    continue;
+                }
+                float v[4] = { 0, 0, 0, 255 };
+                for (vx_uint32 k = 0; k < num_cams; k++)
+                {
+                    size_t p = (size_t)(y + OUT_HEIGHT * cams[k]) * OUT_WIDTH + x;
+                    float w = (select < 31) ? 1.0f : wt_data[p] * (1.0f / 255.0f);
+                    for (int c = 0; c < 3; c++)
+                        v[c] += in_data[p * 4 + c] * w;
+                }
+                mismatches += pixel_differs(out, v, out_bpp);
+            }
+        }
+    }
+    check(name, mismatches, count);
+
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseImage(&camid));
+    ERROR_CHECK_STATUS(vxReleaseImage(&group1));
+    ERROR_CHECK_STATUS(vxReleaseImage(&group2));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&weight));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+// multiband blend: the valid 64x16 blocks of the RGBX input are weighted into the S16 RGB output,
+// the pixels outside of the listed blocks are left untouched
+static void test_multiband_blend(const char *name)
+{
+    const vx_uint32 width = 192, cam_height = 32, height = cam_height * NUM_CAMERAS;
+    vector<vx_uint8> in_data, wt_data, out_data;
+    vx_image input = create_image(width, height, VX_DF_IMAGE_RGBX, in_data, 4, true);
+    vx_image weight = create_image(width, height, VX_DF_IMAGE_U8, wt_data, 1, true);
+    vx_image output = create_image(width, height, VX_DF_IMAGE_RGB4_AMD, out_data, 6, false);
+
+    // the entry at offset - 1 holds the number of valid entries of the level
+    vector<BlendValidEntry> entries(1);
+    for (vx_uint32 cam = 0; cam < NUM_CAMERAS; cam++)
+    {
+        for (vx_uint32 by = 0; by < cam_height / 16; by++)
+        {
+            for (vx_uint32 bx = 0; bx < width / 64; bx++)
+            {
+                if (random_next() % 4 == 0)
+                    continue;
+                BlendValidEntry entry = {};
+                entry.camId = cam;
+                entry.dstX = bx * 64;
+                entry.dstY = by * 16;
+                entry.last_x = random_next() % 64;
+                entry.last_y = random_next() % 16;
+                entries.push_back(entry);
+            }
+        }
+    }
+    vx_uint32 num_entries = (vx_uint32)entries.size() - 1;
+    memset(&entries[0], 0, sizeof(BlendValidEntry));
+    memcpy(&entries[0], &num_entries, sizeof(num_entries));
+    vx_enum entry_type = vxRegisterUserStruct(context, sizeof(BlendValidEntry));
+    vx_array valid_array = vxCreateArray(context, entry_type, entries.size());
+    ERROR_CHECK_OBJECT(valid_array);
+    ERROR_CHECK_STATUS(vxAddArrayItems(valid_array, entries.size(), entries.data(), sizeof(BlendValidEntry)));
+
+    vx_uint32 num_cameras = NUM_CAMERAS, offset = 1;
+    vx_scalar s_num_cameras = vxCreateScalar(context, VX_TYPE_UINT32, &num_cameras);
+    vx_scalar s_offset = vxCreateScalar(context, VX_TYPE_UINT32, &offset);
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_node node = create_node(graph, "com.amd.loomsl.multiband_blend",
+                               { (vx_reference)s_num_cameras, (vx_reference)s_offset, (vx_reference)input,
+                                 (vx_reference)weight, (vx_reference)valid_array, (vx_reference)output });
+    run_graph(graph);
+    copy_image(output, out_data, 6, VX_READ_ONLY);
+
+    // reference: mark the pixels of the valid blocks, then check every pixel
+    vector<bool> covered((size_t)width * height, false);
+    for (size_t e = 1; e < entries.size(); e++)
+    {
+        vx_uint32 rows = min(16u, entries[e].last_y + 1u), cols = min(16u, entries[e].last_x / 4 + 1u) * 4;
+        for (vx_uint32 ly = 0; ly < rows; ly++)
+            for (vx_uint32 lx = 0; lx < cols; lx++)
+                covered[(size_t)(entries[e].camId * cam_height + entries[e].dstY + ly) * width + entries[e].dstX + lx] = true;
+    }
+    size_t mismatches = 0;
+    for (size_t p = 0; p < covered.size(); p++)
+    {
+        vx_int16 out[3];
+        memcpy(out, &out_data[p * 6], sizeof(out));
+        if (!covered[p])
+        {
+            if (memcmp(&out_data[p * 6], "\x5a\x5a\x5a\x5a\x5a\x5a", 6))
+                mismatches++;
+            continue;
+        }
+        float w = wt_data[p] * 0.0627451f;
+        for (int c = 0; c < 3; c++)
+        {
+            if (abs((int)out[c] - (int)saturate_s16(in_data[p * 4 + c] * w)) > 1)
+            {
+                mismatches++;
+                break;
+            }
+        }
+    }
+    check(name, mismatches, covered.size());
+
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_num_cameras));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_offset));
+    ERROR_CHECK_STATUS(vxReleaseArray(&valid_array));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&weight));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+int main(int argc, char **argv)
+{
+    context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    // run every node on the CPU, whatever devices are present
+    AgoTargetAffinityInfo affinity = { AGO_TARGET_AFFINITY_CPU, 0, 0, 0 };
+    ERROR_CHECK_STATUS(vxSetContextAttribute(context, VX_CONTEXT_ATTRIBUTE_AMD_AFFINITY, &affinity, sizeof(affinity)));
+    ERROR_CHECK_STATUS(vxLoadKernels(context, "vx_loomsl"));
+
+    test_warp("warp bilinear RGB to RGBX", false, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX, 0, true);
+    test_warp("warp bilinear RGB to RGBX (distance gray)", false, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX, 1, false);
+    test_warp("warp bicubic RGBX to RGB", true, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGB, 0, false);
+    test_warp("warp bicubic RGB to RGBX", true, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX, 0, true);
+    test_merge("merge to RGB", VX_DF_IMAGE_RGB);
+    test_merge("merge to RGBX", VX_DF_IMAGE_RGBX);
+    test_multiband_blend("multiband blend");
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    if (failures)
+    {
+        printf("ERROR: %d loomsl CPU kernel checks failed\n", failures);
+        return 1;
+    }
+    printf("STATUS: all loomsl CPU kernel checks passed\n");
+    return 0;
+}
@@ -0,0 +1,283 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// checks that graphs of one context can be verified, scheduled and executed from several threads at once,
+// together with vxu calls on the same context: every thread compares its outputs with results computed
+// on a single thread before. Graphs of different threads share input images, so their verifications
+// wait for each other's data claims, while graphs on disjoint objects are verified in parallel.
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include <VX/vx.h>
+#include <VX/vxu.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+#define WIDTH 640
+#define HEIGHT 480
+#define NUM_INPUTS 3
+#define NUM_THREADS 6
+#define NUM_ITERATIONS 8
+
+static atomic<int> failures(0);
+
+static unsigned int random_state = 12345;
+
+static unsigned int random_next()
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+static vx_context context;
+static vx_image inputs[NUM_INPUTS];
+// results computed on a single thread: the pipeline graph and vxuGaussian3x3 of each input
+static vector<vx_int16> expectedMagnitude[NUM_INPUTS];
+static vector<vx_uint8> expectedGaussian[NUM_INPUTS];
+
+static void copy_image(vx_image image, void *data, vx_uint32 pixelSize, vx_enum usage)
+{
+    vx_rectangle_t rect = { 0, 0, WIDTH, HEIGHT };
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = WIDTH;
+    addr.dim_y = HEIGHT;
+    addr.stride_x = pixelSize;
+    addr.stride_y = WIDTH * pixelSize;
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, data, usage, VX_MEMORY_TYPE_HOST));
+}
+
+// input -> Gaussian3x3 -> Sobel3x3 -> Magnitude -> output, with virtual intermediates
+static vx_graph create_pipeline(vx_image input, vx_image output)
+{
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_image blurred = vxCreateVirtualImage(graph, WIDTH, HEIGHT, VX_DF_IMAGE_U8);
+    vx_image gx = vxCreateVirtualImage(graph, WIDTH, HEIGHT, VX_DF_IMAGE_S16);
+    vx_image gy = vxCreateVirtualImage(graph, WIDTH, HEIGHT, VX_DF_IMAGE_S16);
+    ERROR_CHECK_OBJECT(blurred);
+    ERROR_CHECK_OBJECT(gx);
+    ERROR_CHECK_OBJECT(gy);
+    vx_node nodes[] = {
+        vxGaussian3x3Node(graph, input, blurred),
+        vxSobel3x3Node(graph, blurred, gx, gy),
+        vxMagnitudeNode(graph, gx, gy, output),
+    };
+    for (vx_node &node : nodes)
+    {
+        ERROR_CHECK_OBJECT(node);
+        ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    }
+    ERROR_CHECK_STATUS(vxReleaseImage(&blurred));
+    ERROR_CHECK_STATUS(vxReleaseImage(&gx));
+    ERROR_CHECK_STATUS(vxReleaseImage(&gy));
+    return graph;
+}
+
+static void check_magnitude(vx_image output, int input, const char *what, int thread)
+{
+    vector<vx_int16> result(WIDTH * HEIGHT);
+    copy_image(output, result.data(), sizeof(vx_int16), VX_READ_ONLY);
+    if (result != expectedMagnitude[input])
+    {
+        printf("FAILED: %s: thread %d input %d differs from the single-threaded result\n", what, thread, input);
+        failures++;
+    }
+}
+
+// creates, verifies and processes new graphs: verifications of graphs on the same input wait for each
+// other, the others run in parallel
+static void verify_thread(int thread)
+{
+    int input = thread % NUM_INPUTS;
+    vx_image output = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_S16);
+    ERROR_CHECK_OBJECT(output);
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        vx_graph graph = create_pipeline(inputs[input], output);
+        vx_status status = vxVerifyGraph(graph);
+        if (status == VX_SUCCESS)
+            status = vxProcessGraph(graph);
+        if (status != VX_SUCCESS)
+        {
+            printf("FAILED: verify: thread %d: status = %d\n", thread, status);
+            failures++;
+        }
+        else
+            check_magnitude(output, input, "verify", thread);
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    }
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+// schedules a graph verified on this thread on the context scheduler and waits for it
+static void schedule_thread(int thread)
+{
+    int input = thread % NUM_INPUTS;
+    vx_image output = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_S16);
+    ERROR_CHECK_OBJECT(output);
+    vx_graph graph = create_pipeline(inputs[input], output);
+    vx_status status = vxVerifyGraph(graph);
+    for (int iter = 0; iter < NUM_ITERATIONS && status == VX_SUCCESS; iter++)
+    {
+        vx_int16 zero = 0;
+        ERROR_CHECK_STATUS(vxSetImagePixelValues(output, (const vx_pixel_value_t *)&zero));
+        status = vxScheduleGraph(graph);
+        if (status == VX_SUCCESS)
+            status = vxWaitGraph(graph);
+        if (status == VX_SUCCESS)
+            check_magnitude(output, input, "schedule", thread);
+    }
+    if (status != VX_SUCCESS)
+    {
+        printf("FAILED: schedule: thread %d: status = %d\n", thread, status);
+        failures++;
+    }
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+// immediate mode calls with the same signature share the vxu graph cache of the context
+static void vxu_thread(int thread)
+{
+    int input = thread % NUM_INPUTS;
+    vx_image output = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(output);
+    vector<vx_uint8> result(WIDTH * HEIGHT);
+    for (int iter = 0; iter < NUM_ITERATIONS; iter++)
+    {
+        vx_status status = vxuGaussian3x3(context, inputs[input], output);
+        if (status != VX_SUCCESS)
+        {
+            printf("FAILED: vxu: thread %d: status = %d\n", thread, status);
+            failures++;
+            break;
+        }
+        copy_image(output, result.data(), sizeof(vx_uint8), VX_READ_ONLY);
+        if (result != expectedGaussian[input])
+        {
+            printf("FAILED: vxu: thread %d input %d differs from the single-threaded result\n", thread, input);
+            failures++;
+        }
+    }
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+static void run_threads(const char *name, const vector<void (*)(int)> &functions)
+{
+    int before = failures;
+    vector<thread> threads;
+    for (int t = 0; t < NUM_THREADS; t++)
+        for (auto function : functions)
+            threads.emplace_back(function, t);
+    for (auto &t : threads)
+        t.join();
+    if (failures == before)
+        printf("PASSED: %s\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    printf("STATUS: AVX2 code paths %s\n", vxIsCpuAvx2Supported() ? "enabled" : "disabled");
+
+    // inputs and single-threaded results
+    vector<vx_uint8> pixels(WIDTH * HEIGHT);
+    for (int i = 0; i < NUM_INPUTS; i++)
+    {
+        for (auto &v : pixels)
+            v = (vx_uint8)random_next();
+        inputs[i] = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(inputs[i]);
+        copy_image(inputs[i], pixels.data(), sizeof(vx_uint8), VX_WRITE_ONLY);
+
+        vx_image magnitude = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_S16);
+        vx_image gaussian = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_U8);
+        ERROR_CHECK_OBJECT(magnitude);
+        ERROR_CHECK_OBJECT(gaussian);
+        vx_graph graph = create_pipeline(inputs[i], magnitude);
+        ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+        ERROR_CHECK_STATUS(vxuGaussian3x3(context, inputs[i], gaussian));
+        expectedMagnitude[i].resize(WIDTH * HEIGHT);
+        expectedGaussian[i].resize(WIDTH * HEIGHT);
+        copy_image(magnitude, expectedMagnitude[i].data(), sizeof(vx_int16), VX_READ_ONLY);
+        copy_image(gaussian, expectedGaussian[i].data(), sizeof(vx_uint8), VX_READ_ONLY);
+        ERROR_CHECK_STATUS(vxReleaseImage(&magnitude));
+        ERROR_CHECK_STATUS(vxReleaseImage(&gaussian));
+    }
+
+    run_threads("parallel verify", { verify_thread });
+    run_threads("parallel schedule", { schedule_thread });
+    run_threads("parallel vxu", { vxu_thread });
+    run_threads("parallel verify, schedule and vxu", { verify_thread, schedule_thread, vxu_thread });
+
+    for (int i = 0; i < NUM_INPUTS; i++)
+        ERROR_CHECK_STATUS(vxReleaseImage(&inputs[i]));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    if (failures)
+    {
+        printf("ERROR: %d concurrency checks failed\n", (int)failures);
+        return 1;
+    }
+    printf("STATUS: all concurrency checks passed\n");
+    return 0;
+}
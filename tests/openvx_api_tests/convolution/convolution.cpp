@@ -0,0 +1,251 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// checks custom convolutions against direct summation for U8 and S16 outputs: rank-1 matrices take the
+// separable path, constant matrices the running-sum (box) path and all others the direct kernels.
+// Coefficients are updated between runs of a verified graph, so every path is also entered after verify.
+// Run with AGO_CPU_DISABLE_AVX2=1 to cover the non-AVX2 paths.
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <VX/vxu.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static int failures = 0;
+
+static unsigned int random_state = 12345;
+
+static unsigned int random_next()
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+static vx_int16 random_coef(int range)
+{
+    return (vx_int16)((int)(random_next() % (2 * range + 1)) - range);
+}
+
+enum matrix_kind
+{
+    MATRIX_SEPARABLE,          // v * h'
+    MATRIX_SEPARABLE_ZERO_ROW, // v * h' with v[0] = 0, so the first row can't give the factors
+    MATRIX_BOX,                // every coefficient equal
+    MATRIX_GENERAL,            // random, not separable
+};
+
+static const char *kind_names[] = { "separable", "separable (zero first row)", "box", "general" };
+
+static vector<vx_int16> make_matrix(matrix_kind kind, vx_size cols, vx_size rows)
+{
+    vector<vx_int16> matrix(cols * rows);
+    vector<vx_int16> h(cols), v(rows);
+    switch (kind)
+    {
+    case MATRIX_SEPARABLE:
+    case MATRIX_SEPARABLE_ZERO_ROW:
+        for (vx_size j = 0; j < cols; j++)
+            h[j] = random_coef(4);
+        for (vx_size i = 0; i < rows; i++)
+            v[i] = random_coef(4);
+        h[cols / 2] = 3;
+        v[rows / 2] = -2;
+        if (kind == MATRIX_SEPARABLE_ZERO_ROW)
+            v[0] = 0;
+        for (vx_size i = 0; i < rows; i++)
+            for (vx_size j = 0; j < cols; j++)
+                matrix[i * cols + j] = (vx_int16)(v[i] * h[j]);
+        break;
+    case MATRIX_BOX:
+        fill(matrix.begin(), matrix.end(), (vx_int16)1);
+        break;
+    case MATRIX_GENERAL:
+        for (vx_size i = 0; i < matrix.size(); i++)
+            matrix[i] = random_coef(20);
+        // rows 0 and 1 are not proportional
+        matrix[0] = 7;
+        matrix[1] = 0;
+        matrix[cols] = 0;
+        matrix[cols + 1] = 5;
+        break;
+    }
+    return matrix;
+}
+
+// output(x, y) = sum(input(x + m - j, y + n - i) * C[i][j]) / scale, saturated; only the pixels that
+// don't need a border (UNDEFINED border mode) are compared
+static void check(const char *name, const vector<vx_uint8> &src, const vector<vx_int16> &dst, vx_df_image format,
+                  vx_uint32 width, vx_uint32 height, const vector<vx_int16> &matrix, vx_size cols, vx_size rows, vx_uint32 scale)
+{
+    int shift = 0;
+    while ((1u << shift) < scale)
+        shift++;
+    vx_int32 m = (vx_int32)cols / 2, n = (vx_int32)rows / 2;
+    size_t mismatches = 0, count = 0;
+    for (vx_int32 y = n; y < (vx_int32)height - n; y++)
+        for (vx_int32 x = m; x < (vx_int32)width - m; x++, count++)
+        {
+            vx_int32 sum = 0;
+            for (vx_int32 i = 0; i < (vx_int32)rows; i++)
+                for (vx_int32 j = 0; j < (vx_int32)cols; j++)
+                    sum += (vx_int32)src[(size_t)(y + n - i) * width + (x + m - j)] * matrix[i * cols + j];
+            sum >>= shift;
+            vx_int32 ref = (format == VX_DF_IMAGE_U8) ? min(max(sum, 0), 255) : min(max(sum, -32768), 32767);
+            if (dst[(size_t)y * width + x] != ref)
+                mismatches++;
+        }
+    if (mismatches)
+    {
+        printf("FAILED: %s: %zu of %zu pixels differ from the reference\n", name, mismatches, count);
+        failures++;
+    }
+    else
+        printf("PASSED: %s\n", name);
+}
+
+static void test_convolution(vx_context context, vx_df_image format, vx_size cols, vx_size rows)
+{
+    // wide enough for the separable path to split the rows over several threads
+    const vx_uint32 width = 317, height = 263;
+    vector<vx_uint8> src((size_t)width * height);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = (vx_uint8)random_next();
+    vx_image input = vxCreateImage(context, width, height, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, width, height, format);
+    ERROR_CHECK_OBJECT(input);
+    ERROR_CHECK_OBJECT(output);
+    vx_rectangle_t rect = { 0, 0, width, height };
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = width;
+    addr.dim_y = height;
+    addr.stride_x = 1;
+    addr.stride_y = width;
+    ERROR_CHECK_STATUS(vxCopyImagePatch(input, &rect, 0, &addr, src.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+
+    vx_convolution conv = vxCreateConvolution(context, cols, rows);
+    ERROR_CHECK_OBJECT(conv);
+    vector<vx_int16> matrix = make_matrix(MATRIX_SEPARABLE, cols, rows);
+    ERROR_CHECK_STATUS(vxCopyConvolutionCoefficients(conv, matrix.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_node node = vxConvolveNode(graph, input, conv, output);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+
+    vector<vx_int16> dst((size_t)width * height);
+    vx_imagepatch_addressing_t dstAddr = addr;
+    dstAddr.stride_x = (format == VX_DF_IMAGE_U8) ? 1 : 2;
+    dstAddr.stride_y = width * dstAddr.stride_x;
+    for (int kind = MATRIX_SEPARABLE; kind <= MATRIX_GENERAL; kind++)
+    {
+        if (kind != MATRIX_SEPARABLE)
+            matrix = make_matrix((matrix_kind)kind, cols, rows);
+        // U8 outputs are scaled to roughly the output range, S16 outputs keep more of the sum and saturate less often
+        vx_int32 sumAbs = 0;
+        for (vx_int16 c : matrix)
+            sumAbs += abs(c);
+        vx_uint32 scale = 1;
+        while (scale * (format == VX_DF_IMAGE_U8 ? 1 : 64) < (vx_uint32)sumAbs)
+            scale <<= 1;
+        ERROR_CHECK_STATUS(vxCopyConvolutionCoefficients(conv, matrix.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+        ERROR_CHECK_STATUS(vxSetConvolutionAttribute(conv, VX_CONVOLUTION_SCALE, &scale, sizeof(scale)));
+        ERROR_CHECK_STATUS(vxProcessGraph(graph));
+        if (format == VX_DF_IMAGE_U8)
+        {
+            vector<vx_uint8> dst8((size_t)width * height);
+            ERROR_CHECK_STATUS(vxCopyImagePatch(output, &rect, 0, &dstAddr, dst8.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+            copy(dst8.begin(), dst8.end(), dst.begin());
+        }
+        else
+            ERROR_CHECK_STATUS(vxCopyImagePatch(output, &rect, 0, &dstAddr, dst.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+
+        char name[96];
+        snprintf(name, sizeof(name), "convolve %s %dx%d %s", format == VX_DF_IMAGE_U8 ? "U8" : "S16", (int)cols, (int)rows, kind_names[kind]);
+        check(name, src, dst, format, width, height, matrix, cols, rows, scale);
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseConvolution(&conv));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    printf("STATUS: AVX2 code paths %s\n", vxIsCpuAvx2Supported() ? "enabled" : "disabled");
+
+    const vx_size sizes[][2] = { { 3, 3 }, { 5, 5 }, { 7, 7 }, { 9, 9 }, { 3, 7 }, { 9, 5 } };
+    for (vx_df_image format : { VX_DF_IMAGE_U8, VX_DF_IMAGE_S16 })
+        for (const auto &size : sizes)
+            test_convolution(context, format, size[0], size[1]);
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    if (failures)
+    {
+        printf("ERROR: %d convolution checks failed\n", failures);
+        return 1;
+    }
+    printf("STATUS: all convolution checks passed\n");
+    return 0;
+}
@@ -0,0 +1,375 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// checks remap, warp affine, warp perspective and scale of RGB, RGBX, U16 and S16 images against a
+// scalar reference; run with AGO_CPU_DISABLE_AVX2=1 to cover the non-AVX2 paths.
+// The reference follows the CPU kernels: bilinear locations are rounded to 1/256 of a pixel, the two
+// taps of a row are blended with rounding first and then the two rows; destination pixels without
+// a source location are zero (UNDEFINED border).
+
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <VX/vxu.h>
+#include <VX/vx_compatibility.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+#define FRAC_BITS 8
+#define FRAC_ONE (1 << FRAC_BITS)
+#define REMAP_FRAC_BITS 3
+
+static int failures = 0;
+
+static unsigned int random_state = 12345;
+
+static unsigned int random_next()
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+struct format_info
+{
+    vx_df_image format;
+    const char *name;
+    int channels;
+    int bytes; // bytes per channel
+};
+
+static const format_info formats[] = {
+    { VX_DF_IMAGE_RGB, "RGB", 3, 1 },
+    { VX_DF_IMAGE_RGBX, "RGBX", 4, 1 },
+    { VX_DF_IMAGE_U16, "U16", 1, 2 },
+    { VX_DF_IMAGE_S16, "S16", 1, 2 },
+};
+
+// dense host copy of an image
+struct host_image
+{
+    vx_uint32 width, height;
+    format_info info;
+    vector<vx_uint8> data;
+    int pixel_bytes() const { return info.channels * info.bytes; }
+    vx_int32 get(vx_uint32 x, vx_uint32 y, int c) const
+    {
+        const vx_uint8 *p = &data[((size_t)y * width + x) * pixel_bytes()];
+        if (info.format == VX_DF_IMAGE_U16) return ((const vx_uint16 *)p)[c];
+        if (info.format == VX_DF_IMAGE_S16) return ((const vx_int16 *)p)[c];
+        return p[c];
+    }
+};
+
+static void copy_image(vx_image image, host_image &host, vx_enum usage)
+{
+    vx_rectangle_t rect = { 0, 0, host.width, host.height };
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = host.width;
+    addr.dim_y = host.height;
+    addr.stride_x = host.pixel_bytes();
+    addr.stride_y = host.width * host.pixel_bytes();
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, host.data.data(), usage, VX_MEMORY_TYPE_HOST));
+}
+
+static vx_image create_random_image(vx_context context, const format_info &info, vx_uint32 width, vx_uint32 height, host_image &host)
+{
+    host.width = width;
+    host.height = height;
+    host.info = info;
+    host.data.resize((size_t)width * height * host.pixel_bytes());
+    for (size_t i = 0; i < host.data.size(); i++)
+        host.data[i] = (vx_uint8)random_next();
+    vx_image image = vxCreateImage(context, width, height, info.format);
+    ERROR_CHECK_OBJECT(image);
+    copy_image(image, host, VX_WRITE_ONLY);
+    return image;
+}
+
+// source location of a destination pixel: integer for nearest neighbor, 1/256 fixed-point for bilinear
+struct location
+{
+    bool valid;
+    vx_int32 sx, sy;
+};
+
+static location float_location(vx_float32 xf, vx_float32 yf, const host_image &src, bool nearest)
+{
+    location loc;
+    vx_float32 w = (vx_float32)src.width, h = (vx_float32)src.height;
+    if (nearest)
+    {
+        loc.valid = xf >= 0.0f && xf < w && yf >= 0.0f && yf < h;
+        loc.sx = loc.valid ? (vx_int32)xf : 0;
+        loc.sy = loc.valid ? (vx_int32)yf : 0;
+    }
+    else
+    {
+        loc.valid = xf >= 0.0f && xf <= w - 1.0f && yf >= 0.0f && yf <= h - 1.0f;
+        loc.sx = loc.valid ? (vx_int32)(xf * (vx_float32)FRAC_ONE + 0.5f) : 0;
+        loc.sy = loc.valid ? (vx_int32)(yf * (vx_float32)FRAC_ONE + 0.5f) : 0;
+    }
+    return loc;
+}
+
+static vx_int32 reference_sample(const host_image &src, const location &loc, bool nearest, int c)
+{
+    if (!loc.valid)
+        return 0;
+    if (nearest)
+        return src.get(loc.sx, loc.sy, c);
+    vx_int32 x0 = loc.sx >> FRAC_BITS, y0 = loc.sy >> FRAC_BITS;
+    vx_int32 fx = loc.sx & (FRAC_ONE - 1), fy = loc.sy & (FRAC_ONE - 1);
+    vx_int32 x1 = std::min(x0 + 1, (vx_int32)src.width - 1), y1 = std::min(y0 + 1, (vx_int32)src.height - 1);
+    vx_int32 round = FRAC_ONE >> 1;
+    vx_int32 h0 = (src.get(x0, y0, c) * (FRAC_ONE - fx) + src.get(x1, y0, c) * fx + round) >> FRAC_BITS;
+    vx_int32 h1 = (src.get(x0, y1, c) * (FRAC_ONE - fx) + src.get(x1, y1, c) * fx + round) >> FRAC_BITS;
+    return (h0 * (FRAC_ONE - fy) + h1 * fy + round) >> FRAC_BITS;
+}
+
+template <typename Locate>
+static void check(const char *name, const host_image &src, const host_image &dst, bool nearest, Locate locate)
+{
+    size_t mismatches = 0, count = 0;
+    for (vx_uint32 y = 0; y < dst.height; y++)
+        for (vx_uint32 x = 0; x < dst.width; x++)
+        {
+            location loc = locate(x, y);
+            for (int c = 0; c < dst.info.channels; c++, count++)
+                if (dst.get(x, y, c) != reference_sample(src, loc, nearest, c))
+                    mismatches++;
+        }
+    if (mismatches)
+    {
+        printf("FAILED: %s: %zu of %zu values differ from the reference\n", name, mismatches, count);
+        failures++;
+    }
+    else
+        printf("PASSED: %s\n", name);
+}
+
+static void test_remap(vx_context context, const format_info &dstInfo, const format_info &srcInfo, bool nearest)
+{
+    const vx_uint32 sw = 67, sh = 45, dw = 53, dh = 39;
+    host_image src, dst = { dw, dh, dstInfo };
+    dst.data.resize((size_t)dw * dh * dst.pixel_bytes());
+    vx_image input = create_random_image(context, srcInfo, sw, sh, src);
+    vx_image output = vxCreateImage(context, dw, dh, dstInfo.format);
+    ERROR_CHECK_OBJECT(output);
+    // table entries on the 1/8 grid of the fixed-point table, some of them outside of the source image
+    vx_remap table = vxCreateRemap(context, sw, sh, dw, dh);
+    ERROR_CHECK_OBJECT(table);
+    vector<vx_float32> mapX((size_t)dw * dh), mapY((size_t)dw * dh);
+    for (vx_uint32 y = 0; y < dh; y++)
+        for (vx_uint32 x = 0; x < dw; x++)
+        {
+            size_t i = (size_t)y * dw + x;
+            mapX[i] = (vx_float32)((int)(random_next() % ((sw + 4) * 8)) - 16) / 8.0f;
+            mapY[i] = (vx_float32)((int)(random_next() % ((sh + 4) * 8)) - 16) / 8.0f;
+            ERROR_CHECK_STATUS(vxSetRemapPoint(table, x, y, mapX[i], mapY[i]));
+        }
+    ERROR_CHECK_STATUS(vxuRemap(context, input, table, nearest ? VX_INTERPOLATION_NEAREST_NEIGHBOR : VX_INTERPOLATION_BILINEAR, output));
+    copy_image(output, dst, VX_READ_ONLY);
+
+    char name[64];
+    snprintf(name, sizeof(name), "remap %s <- %s %s", dstInfo.name, srcInfo.name, nearest ? "nearest" : "bilinear");
+    check(name, src, dst, nearest, [&](vx_uint32 x, vx_uint32 y) {
+        // the table keeps REMAP_FRAC_BITS fractional bits and marks locations outside of [0, size-1) as invalid
+        size_t i = (size_t)y * dw + x;
+        vx_float32 fx = mapX[i], fy = mapY[i];
+        location loc;
+        loc.valid = !(fx < 0.0f || fy < 0.0f || fx >= (vx_float32)(sw - 1) || fy >= (vx_float32)(sh - 1));
+        vx_int32 mx = (vx_int32)(fx * (1 << REMAP_FRAC_BITS) + 0.5f), my = (vx_int32)(fy * (1 << REMAP_FRAC_BITS) + 0.5f);
+        vx_int32 half = (1 << REMAP_FRAC_BITS) >> 1;
+        loc.sx = nearest ? (mx + half) >> REMAP_FRAC_BITS : mx << (FRAC_BITS - REMAP_FRAC_BITS);
+        loc.sy = nearest ? (my + half) >> REMAP_FRAC_BITS : my << (FRAC_BITS - REMAP_FRAC_BITS);
+        if (nearest && (loc.sx >= (vx_int32)sw || loc.sy >= (vx_int32)sh))
+            loc.valid = false;
+        return loc;
+    });
+
+    ERROR_CHECK_STATUS(vxReleaseRemap(&table));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+static void test_warp_affine(vx_context context, const format_info &info, bool nearest)
+{
+    const vx_uint32 sw = 67, sh = 45, dw = 59, dh = 41;
+    host_image src, dst = { dw, dh, info };
+    dst.data.resize((size_t)dw * dh * dst.pixel_bytes());
+    vx_image input = create_random_image(context, info, sw, sh, src);
+    vx_image output = vxCreateImage(context, dw, dh, info.format);
+    ERROR_CHECK_OBJECT(output);
+    // rotation by about 10 degrees with a small scale and an offset that moves part of the image out
+    vx_float32 m[3][2] = { { 0.97f, 0.17f }, { -0.18f, 1.04f }, { 4.3f, -6.1f } };
+    vx_matrix matrix = vxCreateMatrix(context, VX_TYPE_FLOAT32, 2, 3);
+    ERROR_CHECK_OBJECT(matrix);
+    ERROR_CHECK_STATUS(vxCopyMatrix(matrix, m, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxuWarpAffine(context, input, matrix, nearest ? VX_INTERPOLATION_NEAREST_NEIGHBOR : VX_INTERPOLATION_BILINEAR, output));
+    copy_image(output, dst, VX_READ_ONLY);
+
+    char name[64];
+    snprintf(name, sizeof(name), "warp affine %s %s", info.name, nearest ? "nearest" : "bilinear");
+    check(name, src, dst, nearest, [&](vx_uint32 x, vx_uint32 y) {
+        vx_float32 x0 = m[1][0] * (vx_float32)y + m[2][0];
+        vx_float32 y0 = m[1][1] * (vx_float32)y + m[2][1];
+        vx_float32 dx = (vx_float32)x;
+        return float_location(m[0][0] * dx + x0, m[0][1] * dx + y0, src, nearest);
+    });
+
+    ERROR_CHECK_STATUS(vxReleaseMatrix(&matrix));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+static void test_warp_perspective(vx_context context, const format_info &info, bool nearest)
+{
+    const vx_uint32 sw = 67, sh = 45, dw = 61, dh = 37;
+    host_image src, dst = { dw, dh, info };
+    dst.data.resize((size_t)dw * dh * dst.pixel_bytes());
+    vx_image input = create_random_image(context, info, sw, sh, src);
+    vx_image output = vxCreateImage(context, dw, dh, info.format);
+    ERROR_CHECK_OBJECT(output);
+    vx_float32 m[3][3] = { { 0.93f, 0.11f, 0.0009f }, { -0.12f, 1.02f, 0.0013f }, { 3.7f, -2.9f, 1.0f } };
+    vx_matrix matrix = vxCreateMatrix(context, VX_TYPE_FLOAT32, 3, 3);
+    ERROR_CHECK_OBJECT(matrix);
+    ERROR_CHECK_STATUS(vxCopyMatrix(matrix, m, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    ERROR_CHECK_STATUS(vxuWarpPerspective(context, input, matrix, nearest ? VX_INTERPOLATION_NEAREST_NEIGHBOR : VX_INTERPOLATION_BILINEAR, output));
+    copy_image(output, dst, VX_READ_ONLY);
+
+    char name[64];
+    snprintf(name, sizeof(name), "warp perspective %s %s", info.name, nearest ? "nearest" : "bilinear");
+    check(name, src, dst, nearest, [&](vx_uint32 x, vx_uint32 y) {
+        vx_float32 x0 = m[1][0] * (vx_float32)y + m[2][0];
+        vx_float32 y0 = m[1][1] * (vx_float32)y + m[2][1];
+        vx_float32 z0 = m[1][2] * (vx_float32)y + m[2][2];
+        vx_float32 dx = (vx_float32)x;
+        vx_float32 z = m[0][2] * dx + z0;
+        vx_float32 rz = (z != 0.0f) ? 1.0f / z : 0.0f;
+        vx_float32 xf = (z != 0.0f) ? (m[0][0] * dx + x0) * rz : -1.0f;
+        return float_location(xf, (m[0][1] * dx + y0) * rz, src, nearest);
+    });
+
+    ERROR_CHECK_STATUS(vxReleaseMatrix(&matrix));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+static vx_int32 scale_coord(vx_uint32 d, vx_uint32 srcSize, vx_uint32 dstSize, bool nearest)
+{
+    vx_float32 scale = (vx_float32)((vx_float64)srcSize / (vx_float64)dstSize);
+    vx_float32 offset = (vx_float32)((vx_float64)srcSize / (vx_float64)dstSize * 0.5 - 0.5);
+    if (nearest)
+        return std::min((vx_int32)(((vx_float32)d + 0.5f) * scale), (vx_int32)srcSize - 1);
+    vx_float32 f = std::min(std::max((vx_float32)d * scale + offset, 0.0f), (vx_float32)(srcSize - 1));
+    return (vx_int32)(f * (vx_float32)FRAC_ONE + 0.5f);
+}
+
+static void test_scale(vx_context context, const format_info &info, bool nearest, vx_uint32 dw, vx_uint32 dh)
+{
+    const vx_uint32 sw = 67, sh = 45;
+    host_image src, dst = { dw, dh, info };
+    dst.data.resize((size_t)dw * dh * dst.pixel_bytes());
+    vx_image input = create_random_image(context, info, sw, sh, src);
+    vx_image output = vxCreateImage(context, dw, dh, info.format);
+    ERROR_CHECK_OBJECT(output);
+    ERROR_CHECK_STATUS(vxuScaleImage(context, input, output, nearest ? VX_INTERPOLATION_NEAREST_NEIGHBOR : VX_INTERPOLATION_BILINEAR));
+    copy_image(output, dst, VX_READ_ONLY);
+
+    char name[64];
+    snprintf(name, sizeof(name), "scale %s %ux%u %s", info.name, dw, dh, nearest ? "nearest" : "bilinear");
+    check(name, src, dst, nearest, [&](vx_uint32 x, vx_uint32 y) {
+        location loc = { true, scale_coord(x, sw, dw, nearest), scale_coord(y, sh, dh, nearest) };
+        return loc;
+    });
+
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    printf("STATUS: AVX2 code paths %s\n", vxIsCpuAvx2Supported() ? "enabled" : "disabled");
+
+    for (int nearest = 1; nearest >= 0; nearest--)
+    {
+        for (const format_info &info : formats)
+        {
+            test_remap(context, info, info, nearest != 0);
+            test_warp_affine(context, info, nearest != 0);
+            test_warp_perspective(context, info, nearest != 0);
+            test_scale(context, info, nearest != 0, 29, 21);  // downscale
+            test_scale(context, info, nearest != 0, 101, 70); // upscale
+        }
+        // RGB output from an RGBX source
+        test_remap(context, formats[0], formats[1], nearest != 0);
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    if (failures)
+    {
+        printf("ERROR: %d geometric checks failed\n", failures);
+        return 1;
+    }
+    printf("STATUS: all geometric checks passed\n");
+    return 0;
+}
@@ -0,0 +1,355 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// checks the rectangle-granular sync of images between the OpenCL buffer and the host buffer
+// (AGO_BUFFER_SYNC_FLAG_DIRTY_SYNCHED_RECT): after every map, copy, unmap and GPU node, both the pixels
+// seen through the OpenVX API and the OpenCL buffer read directly must match a host model of the image.
+// Requires the OpenCL backend (e.g., PoCL when no GPU is available).
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <VX/vx.h>
+#include <vx_ext_amd.h>
+#if __APPLE__
+#include <opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_CL(err)                                                                     \
+    {                                                                                           \
+        cl_int err_ = (err);                                                                    \
+        if (err_ != CL_SUCCESS)                                                                 \
+        {                                                                                       \
+            printf("ERROR: OpenCL error (%d) at " __FILE__ "#%d\n", err_, __LINE__);            \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+#define WIDTH 200
+#define HEIGHT 120
+
+static int failures = 0;
+
+static unsigned int random_state = 12345;
+
+static unsigned int random_next()
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+static cl_command_queue opencl_cmdq;
+
+// host model of a U8 image
+typedef vector<vx_uint8> host_image;
+
+static void report(const char *step, const char *side, size_t mismatches)
+{
+    if (mismatches)
+    {
+        printf("FAILED: %s: %s: %zu pixels differ from the model\n", step, side, mismatches);
+        failures++;
+    }
+}
+
+// reads the OpenCL buffer of an image directly and compares it with the model
+static void check_gpu(vx_image image, const host_image &expected, const char *step)
+{
+    cl_mem mem = nullptr;
+    cl_uint offset = 0, stride = 0;
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_AMD_OPENCL_BUFFER, &mem, sizeof(mem)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_AMD_GPU_BUFFER_OFFSET, &offset, sizeof(offset)));
+    ERROR_CHECK_STATUS(vxQueryImage(image, VX_IMAGE_ATTRIBUTE_AMD_GPU_BUFFER_STRIDE, &stride, sizeof(stride)));
+    if (!mem)
+    {
+        printf("FAILED: %s: image has no OpenCL buffer\n", step);
+        failures++;
+        return;
+    }
+    vector<vx_uint8> buffer((size_t)stride * HEIGHT);
+    ERROR_CHECK_CL(clEnqueueReadBuffer(opencl_cmdq, mem, CL_TRUE, offset, buffer.size(), buffer.data(), 0, nullptr, nullptr));
+    size_t mismatches = 0;
+    for (vx_uint32 y = 0; y < HEIGHT; y++)
+        for (vx_uint32 x = 0; x < WIDTH; x++)
+            if (buffer[(size_t)y * stride + x] != expected[y * WIDTH + x])
+                mismatches++;
+    report(step, "OpenCL buffer", mismatches);
+}
+
+// compares a patch returned by map or copy with the model
+static void check_patch(const void *ptr, const vx_imagepatch_addressing_t &addr, const vx_rectangle_t &rect,
+                        const host_image &expected, const char *step)
+{
+    size_t mismatches = 0;
+    for (vx_uint32 y = rect.start_y; y < rect.end_y; y++)
+        for (vx_uint32 x = rect.start_x; x < rect.end_x; x++)
+        {
+            const vx_uint8 *p = (const vx_uint8 *)ptr + (y - rect.start_y) * addr.stride_y + (x - rect.start_x) * addr.stride_x;
+            if (*p != expected[y * WIDTH + x])
+                mismatches++;
+        }
+    report(step, "host patch", mismatches);
+}
+
+static void map_and_check(vx_image image, const vx_rectangle_t &rect, const host_image &expected, const char *step)
+{
+    vx_map_id map_id;
+    vx_imagepatch_addressing_t addr;
+    void *ptr = nullptr;
+    ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, 0, &map_id, &addr, &ptr, VX_READ_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+    check_patch(ptr, addr, rect, expected, step);
+    ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+}
+
+static void copy_and_check(vx_image image, const vx_rectangle_t &rect, const host_image &expected, const char *step)
+{
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = rect.end_x - rect.start_x;
+    addr.dim_y = rect.end_y - rect.start_y;
+    addr.stride_x = 1;
+    addr.stride_y = addr.dim_x;
+    vector<vx_uint8> patch(addr.dim_x * addr.dim_y);
+    ERROR_CHECK_STATUS(vxCopyImagePatch(image, &rect, 0, &addr, patch.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    check_patch(patch.data(), addr, rect, expected, step);
+}
+
+static void write_input(vx_image input, host_image &pixels)
+{
+    for (auto &v : pixels)
+        v = (vx_uint8)random_next();
+    vx_rectangle_t rect = { 0, 0, WIDTH, HEIGHT };
+    vx_imagepatch_addressing_t addr = { 0 };
+    addr.dim_x = WIDTH;
+    addr.dim_y = HEIGHT;
+    addr.stride_x = 1;
+    addr.stride_y = WIDTH;
+    ERROR_CHECK_STATUS(vxCopyImagePatch(input, &rect, 0, &addr, pixels.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+static host_image invert(const host_image &pixels)
+{
+    host_image result(pixels.size());
+    for (size_t i = 0; i < pixels.size(); i++)
+        result[i] = (vx_uint8)~pixels[i];
+    return result;
+}
+
+static vx_graph create_not_graph(vx_context context, vx_image input, vx_image output)
+{
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    AgoTargetAffinityInfo affinity = { AGO_TARGET_AFFINITY_GPU };
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_AFFINITY, &affinity, sizeof(affinity)));
+    vx_node node = vxNotNode(graph, input, output);
+    ERROR_CHECK_OBJECT(node);
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    return graph;
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+
+    // the OpenCL context is created here with any device type, so that CPU implementations such as PoCL
+    // can run the test, and a separate command queue reads the OpenCL buffers behind the back of the library
+    cl_platform_id platform;
+    cl_device_id device;
+    cl_int err;
+    ERROR_CHECK_CL(clGetPlatformIDs(1, &platform, nullptr));
+    ERROR_CHECK_CL(clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 1, &device, nullptr));
+    cl_context_properties properties[] = { CL_CONTEXT_PLATFORM, (cl_context_properties)platform, 0 };
+    cl_context opencl_context = clCreateContext(properties, 1, &device, nullptr, nullptr, &err);
+    ERROR_CHECK_CL(err);
+    ERROR_CHECK_STATUS(vxSetContextAttribute(context, VX_CONTEXT_ATTRIBUTE_AMD_OPENCL_CONTEXT, &opencl_context, sizeof(opencl_context)));
+    opencl_cmdq = clCreateCommandQueue(opencl_context, device, 0, &err);
+    ERROR_CHECK_CL(err);
+
+    // input -> (GPU) writer -> image -> (GPU) reader -> output
+    vx_image input = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_U8);
+    vx_image image = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_U8);
+    vx_image output = vxCreateImage(context, WIDTH, HEIGHT, VX_DF_IMAGE_U8);
+    ERROR_CHECK_OBJECT(input);
+    ERROR_CHECK_OBJECT(image);
+    ERROR_CHECK_OBJECT(output);
+    vx_graph writer = create_not_graph(context, input, image);
+    vx_graph reader = create_not_graph(context, image, output);
+
+    host_image pixels(WIDTH * HEIGHT), model;
+    const vx_rectangle_t r1 = { 16, 8, 80, 40 };      // first patch
+    const vx_rectangle_t r1b = { 16, 40, 80, 56 };    // rows right below r1: grows the synched rectangle
+    const vx_rectangle_t r2 = { 48, 24, 120, 72 };    // overlaps r1
+    const vx_rectangle_t r3 = { 140, 80, 196, 116 };  // disjoint from r1 and r2
+    const vx_rectangle_t r4 = { 32, 60, 112, 100 };   // partially written on unmap
+    const vx_rectangle_t r5 = { 4, 100, 36, 118 };    // written with vxCopyImagePatch
+
+    // 1. GPU write, then map and copy sub-rectangles of the GPU dirty image
+    write_input(input, pixels);
+    ERROR_CHECK_STATUS(vxProcessGraph(writer));
+    model = invert(pixels);
+    check_gpu(image, model, "gpu write");
+    map_and_check(image, r1, model, "map r1");
+    check_gpu(image, model, "map r1");
+    copy_and_check(image, r1b, model, "copy r1b");
+    copy_and_check(image, r1, model, "copy r1");
+    check_gpu(image, model, "copy r1b");
+
+    // 2. another GPU write invalidates the synched rectangle: an overlapping map must see the new pixels
+    write_input(input, pixels);
+    ERROR_CHECK_STATUS(vxProcessGraph(writer));
+    model = invert(pixels);
+    check_gpu(image, model, "second gpu write");
+    map_and_check(image, r2, model, "map overlapping r2");
+    check_gpu(image, model, "map overlapping r2");
+
+    // 3. a disjoint rectangle replaces the synched rectangle, so r1 is read again
+    map_and_check(image, r3, model, "map disjoint r3");
+    check_gpu(image, model, "map disjoint r3");
+    copy_and_check(image, r1, model, "copy r1 after r3");
+    check_gpu(image, model, "copy r1 after r3");
+
+    // 4. partial writes into the GPU dirty image go to the OpenCL buffer without stale host pixels
+    {
+        vx_map_id map_id;
+        vx_imagepatch_addressing_t addr;
+        void *ptr = nullptr;
+        ERROR_CHECK_STATUS(vxMapImagePatch(image, &r4, 0, &map_id, &addr, &ptr, VX_READ_AND_WRITE, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        check_patch(ptr, addr, r4, model, "map r4 for write");
+        // only every other row of the patch is modified
+        for (vx_uint32 y = r4.start_y; y < r4.end_y; y += 2)
+            for (vx_uint32 x = r4.start_x; x < r4.end_x; x++)
+            {
+                vx_uint8 *p = (vx_uint8 *)ptr + (y - r4.start_y) * addr.stride_y + (x - r4.start_x) * addr.stride_x;
+                *p = (vx_uint8)(x + y);
+                model[y * WIDTH + x] = *p;
+            }
+        ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+    }
+    check_gpu(image, model, "unmap partial write r4");
+    map_and_check(image, r4, model, "unmap partial write r4");
+    {
+        vx_imagepatch_addressing_t addr = { 0 };
+        addr.dim_x = r5.end_x - r5.start_x;
+        addr.dim_y = r5.end_y - r5.start_y;
+        addr.stride_x = 1;
+        addr.stride_y = addr.dim_x;
+        vector<vx_uint8> patch(addr.dim_x * addr.dim_y);
+        for (vx_uint32 y = r5.start_y; y < r5.end_y; y++)
+            for (vx_uint32 x = r5.start_x; x < r5.end_x; x++)
+                model[y * WIDTH + x] = patch[(y - r5.start_y) * addr.dim_x + (x - r5.start_x)] = (vx_uint8)random_next();
+        ERROR_CHECK_STATUS(vxCopyImagePatch(image, &r5, 0, &addr, patch.data(), VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+    }
+    check_gpu(image, model, "copy write r5");
+    copy_and_check(image, r5, model, "copy write r5");
+
+    // 5. a GPU node reading the image sees all the writes, and the whole image is consistent on both sides
+    ERROR_CHECK_STATUS(vxProcessGraph(reader));
+    check_gpu(image, model, "gpu read");
+    check_gpu(output, invert(model), "gpu read output");
+    const vx_rectangle_t whole = { 0, 0, WIDTH, HEIGHT };
+    copy_and_check(output, whole, invert(model), "gpu read output");
+    copy_and_check(image, whole, model, "gpu read");
+
+    // 6. the same through an image ROI, whose patches are offset into the buffer of its master image
+    const vx_rectangle_t roiRect = { 40, 20, 180, 110 };
+    vx_image roi = vxCreateImageFromROI(image, &roiRect);
+    ERROR_CHECK_OBJECT(roi);
+    write_input(input, pixels);
+    ERROR_CHECK_STATUS(vxProcessGraph(writer));
+    model = invert(pixels);
+    {
+        const vx_rectangle_t r = { 10, 10, 70, 50 };
+        vx_map_id map_id;
+        vx_imagepatch_addressing_t addr;
+        void *ptr = nullptr;
+        ERROR_CHECK_STATUS(vxMapImagePatch(roi, &r, 0, &map_id, &addr, &ptr, VX_READ_AND_WRITE, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        vx_rectangle_t rm = { r.start_x + roiRect.start_x, r.start_y + roiRect.start_y, r.end_x + roiRect.start_x, r.end_y + roiRect.start_y };
+        check_patch(ptr, addr, rm, model, "map roi");
+        for (vx_uint32 y = rm.start_y; y < rm.end_y; y++)
+        {
+            vx_uint8 *p = (vx_uint8 *)ptr + (y - rm.start_y) * addr.stride_y;
+            *p = 0x5a;
+            model[y * WIDTH + rm.start_x] = 0x5a;
+        }
+        ERROR_CHECK_STATUS(vxUnmapImagePatch(roi, map_id));
+    }
+    check_gpu(image, model, "unmap roi write");
+    ERROR_CHECK_STATUS(vxProcessGraph(reader));
+    check_gpu(output, invert(model), "gpu read after roi write");
+    copy_and_check(image, whole, model, "gpu read after roi write");
+    ERROR_CHECK_STATUS(vxReleaseImage(&roi));
+
+    ERROR_CHECK_CL(clReleaseCommandQueue(opencl_cmdq));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&writer));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&reader));
+    ERROR_CHECK_STATUS(vxReleaseImage(&input));
+    ERROR_CHECK_STATUS(vxReleaseImage(&image));
+    ERROR_CHECK_STATUS(vxReleaseImage(&output));
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    ERROR_CHECK_CL(clReleaseContext(opencl_context));
+    if (failures)
+    {
+        printf("ERROR: %d rectangle sync checks failed\n", failures);
+        return 1;
+    }
+    printf("STATUS: all rectangle sync checks passed\n");
+    return 0;
+}
@@ -0,0 +1,336 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// checks ScaleCropImageToTensor against a scalar reference for RGB and NV12 inputs, FLOAT32 and FLOAT16
+// outputs and both channel orders; run with AGO_CPU_DISABLE_AVX2=1 to cover the non-AVX2 paths.
+// The reference samples the crop rectangle bilinearly with pixel centers aligned and edges clamped,
+// NV12 chroma is sited at the center of each 2x2 block and converted with BT.709.
+
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <VX/vxu.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static int failures = 0;
+
+static unsigned int random_state = 12345;
+
+static unsigned int random_next()
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+// reference float -> half conversion with round to nearest even (by counting the dropped bits)
+static vx_uint16 float_to_half(float f)
+{
+    vx_uint32 x;
+    memcpy(&x, &f, sizeof(x));
+    vx_uint16 sign = (vx_uint16)((x >> 16) & 0x8000);
+    int exponent = (int)((x >> 23) & 0xff) - 127;
+    vx_uint32 mantissa = (x & 0x7fffff) | 0x800000;
+    if ((x & 0x7fffffff) == 0)
+        return sign;
+    if (exponent > 15)
+        return sign | 0x7c00;
+    // number of mantissa bits dropped: 13 for normals, more for denormals
+    int shift = exponent >= -14 ? 13 : 13 + (-14 - exponent);
+    if (shift > 24)
+        return sign;
+    vx_uint32 kept = mantissa >> shift, rest = mantissa & ((1u << shift) - 1), half = 1u << (shift - 1);
+    if (rest > half || (rest == half && (kept & 1)))
+        kept++;
+    vx_uint32 bits = exponent >= -14 ? ((vx_uint32)(exponent + 15) << 10) + (kept - 0x400) : kept;
+    return sign | (vx_uint16)std::min<vx_uint32>(bits, 0x7c00);
+}
+
+static float half_to_float(vx_uint16 h)
+{
+    int exponent = (h >> 10) & 0x1f, mantissa = h & 0x3ff;
+    float v = exponent == 0 ? ldexpf((float)mantissa, -24) : ldexpf((float)(mantissa | 0x400), exponent - 25);
+    return (h & 0x8000) ? -v : v;
+}
+
+// host copy of an RGB or NV12 image: interleaved RGB, or the Y plane followed by the interleaved UV plane
+struct host_image
+{
+    vx_df_image format;
+    vx_uint32 width, height;
+    vector<vx_uint8> rgb, y, uv;
+};
+
+static void fill_image(vx_image image, host_image &host)
+{
+    vx_uint32 planes = host.format == VX_DF_IMAGE_NV12 ? 2 : 1;
+    if (host.format == VX_DF_IMAGE_NV12)
+    {
+        host.y.resize((size_t)host.width * host.height);
+        host.uv.resize((size_t)host.width * (host.height / 2));
+    }
+    else
+        host.rgb.resize((size_t)host.width * host.height * 3);
+    for (vx_uint32 p = 0; p < planes; p++)
+    {
+        vx_rectangle_t rect = { 0, 0, host.width, host.height };
+        vx_imagepatch_addressing_t addr;
+        vx_map_id map_id;
+        void *ptr = nullptr;
+        ERROR_CHECK_STATUS(vxMapImagePatch(image, &rect, p, &map_id, &addr, &ptr, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST, VX_NOGAP_X));
+        for (vx_uint32 y = 0; y < host.height; y += addr.step_y)
+            for (vx_uint32 x = 0; x < host.width; x += addr.step_x)
+            {
+                vx_uint8 *pixel = (vx_uint8 *)vxFormatImagePatchAddress2d(ptr, x, y, &addr);
+                if (host.format == VX_DF_IMAGE_RGB)
+                    for (int c = 0; c < 3; c++)
+                        pixel[c] = host.rgb[((size_t)y * host.width + x) * 3 + c] = (vx_uint8)random_next();
+                else if (p == 0)
+                    pixel[0] = host.y[(size_t)y * host.width + x] = (vx_uint8)random_next();
+                else
+                    for (int c = 0; c < 2; c++)
+                        pixel[c] = host.uv[(size_t)(y / 2) * host.width + x + c] = (vx_uint8)random_next();
+            }
+        ERROR_CHECK_STATUS(vxUnmapImagePatch(image, map_id));
+    }
+}
+
+// clamp(center-aligned source position, start, end - 1) split into the two neighbours and the weight of the second
+static void coord(float pos, int start, int end, int &i0, int &i1, float &f)
+{
+    pos = min(max(pos, (float)start), (float)(end - 1));
+    i0 = (int)pos;
+    i1 = min(i0 + 1, end - 1);
+    f = pos - (float)i0;
+}
+
+static float lerp(float a, float b, float f)
+{
+    return a + (b - a) * f;
+}
+
+// sample(x, y) reads channel c of a source pixel; returns the bilinear sample of output pixel (x, y)
+template <typename F>
+static float bilinear(F sample, int x0, int x1, float fx, int y0, int y1, float fy)
+{
+    return lerp(lerp(sample(x0, y0), sample(x1, y0), fx), lerp(sample(x0, y1), sample(x1, y1), fx), fy);
+}
+
+// reference output (planar, in RGB order) of one image
+static vector<float> reference(const host_image &src, const vx_rectangle_t &crop, vx_uint32 dw, vx_uint32 dh)
+{
+    vector<float> out((size_t)3 * dw * dh);
+    float ratioX = (float)(crop.end_x - crop.start_x) / dw, ratioY = (float)(crop.end_y - crop.start_y) / dh;
+    for (vx_uint32 y = 0; y < dh; y++)
+        for (vx_uint32 x = 0; x < dw; x++)
+        {
+            int x0, x1, y0, y1;
+            float fx, fy, rgb[3];
+            coord(((float)x + 0.5f) * ratioX - 0.5f + crop.start_x, crop.start_x, crop.end_x, x0, x1, fx);
+            coord(((float)y + 0.5f) * ratioY - 0.5f + crop.start_y, crop.start_y, crop.end_y, y0, y1, fy);
+            if (src.format == VX_DF_IMAGE_RGB)
+            {
+                for (int c = 0; c < 3; c++)
+                    rgb[c] = bilinear([&](int sx, int sy) { return (float)src.rgb[((size_t)sy * src.width + sx) * 3 + c]; }, x0, x1, fx, y0, y1, fy);
+            }
+            else
+            {
+                int cx0, cx1, cy0, cy1;
+                float fcx, fcy, uv[2];
+                coord(((float)x + 0.5f) * 0.5f * ratioX - 0.5f + 0.5f * crop.start_x, crop.start_x >> 1, (crop.end_x + 1) >> 1, cx0, cx1, fcx);
+                coord(((float)y + 0.5f) * 0.5f * ratioY - 0.5f + 0.5f * crop.start_y, crop.start_y >> 1, (crop.end_y + 1) >> 1, cy0, cy1, fcy);
+                float Y = bilinear([&](int sx, int sy) { return (float)src.y[(size_t)sy * src.width + sx]; }, x0, x1, fx, y0, y1, fy);
+                for (int c = 0; c < 2; c++)
+                    uv[c] = bilinear([&](int sx, int sy) { return (float)src.uv[(size_t)sy * src.width + 2 * sx + c]; }, cx0, cx1, fcx, cy0, cy1, fcy) - 128.0f;
+                rgb[0] = min(max(Y + 1.5748f * uv[1], 0.0f), 255.0f);
+                rgb[1] = min(max(Y - 0.1873f * uv[0] - 0.4681f * uv[1], 0.0f), 255.0f);
+                rgb[2] = min(max(Y + 1.8556f * uv[0], 0.0f), 255.0f);
+            }
+            for (int c = 0; c < 3; c++)
+                out[((size_t)c * dh + y) * dw + x] = rgb[c];
+        }
+    return out;
+}
+
+// crops[n] is the crop of image n; one image is passed as a vx_image, several as an object array
+static void test_scale_crop(vx_context context, vx_df_image format, vx_enum type, bool reverse, const vector<vx_rectangle_t> &crops)
+{
+    const vx_uint32 sw = 84, sh = 62, dw = 45, dh = 29;
+    vx_size N = crops.size();
+    vector<host_image> src(N, host_image{ format, sw, sh });
+    vx_image exemplar = vxCreateImage(context, sw, sh, format);
+    ERROR_CHECK_OBJECT(exemplar);
+    vx_object_array batch = nullptr;
+    vx_reference input;
+    if (N == 1)
+    {
+        fill_image(exemplar, src[0]);
+        input = (vx_reference)exemplar;
+    }
+    else
+    {
+        batch = vxCreateObjectArray(context, (vx_reference)exemplar, N);
+        ERROR_CHECK_OBJECT(batch);
+        for (vx_size n = 0; n < N; n++)
+        {
+            vx_image item = (vx_image)vxGetObjectArrayItem(batch, (vx_uint32)n);
+            ERROR_CHECK_OBJECT(item);
+            fill_image(item, src[n]);
+            ERROR_CHECK_STATUS(vxReleaseImage(&item));
+        }
+        input = (vx_reference)batch;
+    }
+    vx_array crop = vxCreateArray(context, VX_TYPE_RECTANGLE, N);
+    ERROR_CHECK_OBJECT(crop);
+    ERROR_CHECK_STATUS(vxAddArrayItems(crop, N, crops.data(), sizeof(vx_rectangle_t)));
+    // mean and stddev are indexed by output channel
+    const vx_float32 meanValues[3] = { 123.7f, 116.3f, 103.5f }, stddevValues[3] = { 58.4f, 57.1f, 57.4f };
+    vx_array mean = vxCreateArray(context, VX_TYPE_FLOAT32, 3), stddev = vxCreateArray(context, VX_TYPE_FLOAT32, 3);
+    ERROR_CHECK_OBJECT(mean);
+    ERROR_CHECK_OBJECT(stddev);
+    ERROR_CHECK_STATUS(vxAddArrayItems(mean, 3, meanValues, sizeof(vx_float32)));
+    ERROR_CHECK_STATUS(vxAddArrayItems(stddev, 3, stddevValues, sizeof(vx_float32)));
+    vx_size dims[4] = { dw, dh, 3, N };
+    vx_tensor output = vxCreateTensor(context, N > 1 ? 4 : 3, dims, type, 0);
+    ERROR_CHECK_OBJECT(output);
+
+    ERROR_CHECK_STATUS(vxuScaleCropImageToTensor(context, input, crop, mean, stddev, reverse ? vx_true_e : vx_false_e, output));
+
+    size_t elementSize = type == VX_TYPE_FLOAT32 ? 4 : 2, count = (size_t)dw * dh * 3 * N;
+    vector<vx_uint8> data(count * elementSize);
+    vx_size start[4] = { 0, 0, 0, 0 }, strides[4] = { elementSize, elementSize * dw, elementSize * dw * dh, elementSize * dw * dh * 3 };
+    ERROR_CHECK_STATUS(vxCopyTensorPatch(output, N > 1 ? 4 : 3, start, dims, strides, data.data(), VX_READ_ONLY, VX_MEMORY_TYPE_HOST));
+    size_t mismatches = 0;
+    for (vx_size n = 0; n < N; n++)
+    {
+        vector<float> ref = reference(src[n], crops[n], dw, dh);
+        for (int oc = 0; oc < 3; oc++)
+        {
+            int c = reverse ? 2 - oc : oc;
+            for (size_t i = 0; i < (size_t)dw * dh; i++)
+            {
+                float expected = (ref[(size_t)c * dw * dh + i] - meanValues[oc]) / stddevValues[oc];
+                size_t k = (n * 3 + oc) * dw * dh + i;
+                float value;
+                if (type == VX_TYPE_FLOAT32)
+                    memcpy(&value, &data[k * 4], 4);
+                else
+                {
+                    vx_uint16 h;
+                    memcpy(&h, &data[k * 2], 2);
+                    value = half_to_float(h);
+                    expected = half_to_float(float_to_half(expected));
+                }
+                // the kernel multiplies by 1/stddev and may round differently than the division above
+                float tolerance = type == VX_TYPE_FLOAT32 ? 1e-5f + 1e-5f * fabsf(expected) : 1e-3f + 1e-3f * fabsf(expected);
+                if (!(fabsf(value - expected) <= tolerance))
+                    mismatches++;
+            }
+        }
+    }
+    char name[128];
+    snprintf(name, sizeof(name), "scale crop %s -> %s%s, %d image(s), crop (%d,%d,%d,%d)", format == VX_DF_IMAGE_RGB ? "RGB" : "NV12",
+             type == VX_TYPE_FLOAT32 ? "F32" : "F16", reverse ? " reversed" : "", (int)N,
+             crops[0].start_x, crops[0].start_y, crops[0].end_x, crops[0].end_y);
+    if (mismatches)
+    {
+        printf("FAILED: %s: %zu of %zu values differ from the reference\n", name, mismatches, count);
+        failures++;
+    }
+    else
+        printf("PASSED: %s\n", name);
+
+    ERROR_CHECK_STATUS(vxReleaseTensor(&output));
+    ERROR_CHECK_STATUS(vxReleaseArray(&mean));
+    ERROR_CHECK_STATUS(vxReleaseArray(&stddev));
+    ERROR_CHECK_STATUS(vxReleaseArray(&crop));
+    if (batch)
+        ERROR_CHECK_STATUS(vxReleaseObjectArray(&batch));
+    ERROR_CHECK_STATUS(vxReleaseImage(&exemplar));
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    printf("STATUS: AVX2 code paths %s\n", vxIsCpuAvx2Supported() ? "enabled" : "disabled");
+
+    // the whole image (downscale), and an upscaled crop with odd corners (chroma siting of NV12)
+    const vx_rectangle_t whole = { 0, 0, 84, 62 }, part = { 7, 5, 38, 24 };
+    for (vx_df_image format : { VX_DF_IMAGE_RGB, VX_DF_IMAGE_NV12 })
+        for (vx_enum type : { VX_TYPE_FLOAT32, VX_TYPE_FLOAT16 })
+            for (bool reverse : { false, true })
+            {
+                test_scale_crop(context, format, type, reverse, { whole });
+                test_scale_crop(context, format, type, reverse, { part });
+            }
+    // a batch with one crop per image
+    test_scale_crop(context, VX_DF_IMAGE_RGB, VX_TYPE_FLOAT32, true, { part, whole });
+    test_scale_crop(context, VX_DF_IMAGE_NV12, VX_TYPE_FLOAT16, false, { whole, part });
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    if (failures)
+    {
+        printf("ERROR: %d scale crop checks failed\n", failures);
+        return 1;
+    }
+    printf("STATUS: all scale crop checks passed\n");
+    return 0;
+}
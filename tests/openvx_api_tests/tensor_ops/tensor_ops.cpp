@@ -0,0 +1,412 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// checks the AGO tensor kernels (element-wise add/subtract/multiply, transpose and convert depth)
+// against scalar reference results; run with AGO_CPU_DISABLE_AVX2=1 to cover the non-AVX2 paths
+
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <VX/vxu.h>
+#include <vx_ext_amd.h>
+
+using namespace std;
+
+#define MAX_TENSOR_DIMS 6
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+static int failures = 0;
+
+static void report(const char *name, size_t mismatches, size_t count)
+{
+    if (mismatches)
+    {
+        printf("FAILED: %s: %zu of %zu elements differ from the reference\n", name, mismatches, count);
+        failures++;
+    }
+    else
+        printf("PASSED: %s\n", name);
+}
+
+static size_t element_size(vx_enum type)
+{
+    switch (type)
+    {
+    case VX_TYPE_UINT8: case VX_TYPE_INT8: return 1;
+    case VX_TYPE_INT16: case VX_TYPE_UINT16: case VX_TYPE_FLOAT16: return 2;
+    default: return 4;
+    }
+}
+
+static size_t element_count(vx_size num_dims, const vx_size *dims)
+{
+    size_t count = 1;
+    for (vx_size i = 0; i < num_dims; i++)
+        count *= dims[i];
+    return count;
+}
+
+// copies a dense buffer into or out of the whole tensor
+static void copy_tensor(vx_tensor tensor, vx_size num_dims, const vx_size *dims, vx_enum type, void *data, vx_enum usage)
+{
+    vx_size start[MAX_TENSOR_DIMS] = { 0 }, stride[MAX_TENSOR_DIMS];
+    stride[0] = element_size(type);
+    for (vx_size i = 1; i < num_dims; i++)
+        stride[i] = stride[i - 1] * dims[i - 1];
+    ERROR_CHECK_STATUS(vxCopyTensorPatch(tensor, num_dims, start, dims, stride, data, usage, VX_MEMORY_TYPE_HOST));
+}
+
+static vx_tensor create_tensor(vx_context context, vx_size num_dims, const vx_size *dims, vx_enum type, vx_int8 fixed_point_pos, void *data)
+{
+    vx_tensor tensor = vxCreateTensor(context, num_dims, dims, type, fixed_point_pos);
+    ERROR_CHECK_OBJECT(tensor);
+    if (data)
+        copy_tensor(tensor, num_dims, dims, type, data, VX_WRITE_ONLY);
+    return tensor;
+}
+
+static unsigned int random_state = 12345;
+
+static unsigned int random_next()
+{
+    random_state = random_state * 1103515245u + 12345u;
+    return random_state >> 8;
+}
+
+static float random_float(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)(random_next() & 0xffff) / 65535.0f;
+}
+
+template <typename T>
+static vector<T> random_values(size_t count)
+{
+    vector<T> v(count);
+    for (size_t i = 0; i < count; i++)
+        v[i] = (T)(random_next() & 0xffff);
+    return v;
+}
+
+template <typename T>
+static T saturate(double v)
+{
+    if (v <= (double)numeric_limits<T>::lowest()) return numeric_limits<T>::lowest();
+    if (v >= (double)numeric_limits<T>::max()) return numeric_limits<T>::max();
+    return (T)v;
+}
+
+// reference float -> half conversion with round to nearest even (by counting the dropped bits)
+static vx_uint16 float_to_half(float f)
+{
+    vx_uint32 x;
+    memcpy(&x, &f, sizeof(x));
+    vx_uint16 sign = (vx_uint16)((x >> 16) & 0x8000);
+    int exponent = (int)((x >> 23) & 0xff) - 127;
+    vx_uint32 mantissa = (x & 0x7fffff) | 0x800000;
+    if ((x & 0x7fffffff) == 0)
+        return sign;
+    if (exponent > 15)
+        return sign | 0x7c00;
+    // number of mantissa bits dropped: 13 for normals, more for denormals
+    int shift = exponent >= -14 ? 13 : 13 + (-14 - exponent);
+    if (shift > 24)
+        return sign;
+    vx_uint32 kept = mantissa >> shift, rest = mantissa & ((1u << shift) - 1), half = 1u << (shift - 1);
+    if (rest > half || (rest == half && (kept & 1)))
+        kept++;
+    vx_uint32 bits = exponent >= -14 ? ((vx_uint32)(exponent + 15) << 10) + (kept - 0x400) : kept;
+    return sign | (vx_uint16)std::min<vx_uint32>(bits, 0x7c00);
+}
+
+static float half_to_float(vx_uint16 h)
+{
+    int exponent = (h >> 10) & 0x1f, mantissa = h & 0x3ff;
+    float v = exponent == 0 ? ldexpf((float)mantissa, -24) : ldexpf((float)(mantissa | 0x400), exponent - 25);
+    return (h & 0x8000) ? -v : v;
+}
+
+enum binary_op { OP_ADD, OP_SUB, OP_MUL };
+
+// runs one of the com.amd.openvx.Tensor{Add,Subtract,Multiply}_DATA_DATA_DATA kernels on in1 op in2
+template <typename T>
+static void test_elementwise(vx_context context, const char *name, binary_op op, vx_enum type, vx_int8 fixed_point_pos,
+                             vx_enum overflow, vx_enum rounding, float scale, const vx_size dims[3], const vx_size dims2[3])
+{
+    size_t count = element_count(3, dims), count2 = element_count(3, dims2);
+    vector<T> in1, in2;
+    if (type == VX_TYPE_FLOAT32)
+    {
+        for (size_t i = 0; i < count; i++) in1.push_back((T)random_float(-100.0f, 100.0f));
+        for (size_t i = 0; i < count2; i++) in2.push_back((T)random_float(-100.0f, 100.0f));
+    }
+    else
+    {
+        in1 = random_values<T>(count);
+        in2 = random_values<T>(count2);
+    }
+    vector<T> out(count), ref(count);
+    vx_tensor t1 = create_tensor(context, 3, dims, type, fixed_point_pos, in1.data());
+    vx_tensor t2 = create_tensor(context, 3, dims2, type, fixed_point_pos, in2.data());
+    vx_tensor to = create_tensor(context, 3, dims, type, fixed_point_pos, nullptr);
+    const char *kernelName = op == OP_ADD ? "com.amd.openvx.TensorAdd_DATA_DATA_DATA"
+                           : (op == OP_SUB ? "com.amd.openvx.TensorSubtract_DATA_DATA_DATA" : "com.amd.openvx.TensorMultiply_DATA_DATA_DATA");
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    vx_kernel kernel = vxGetKernelByName(context, kernelName);
+    ERROR_CHECK_OBJECT(kernel);
+    vx_node node = vxCreateGenericNode(graph, kernel);
+    ERROR_CHECK_OBJECT(node);
+    vx_scalar s_scale = vxCreateScalar(context, VX_TYPE_FLOAT32, &scale);
+    vx_scalar s_overflow = vxCreateScalar(context, VX_TYPE_ENUM, &overflow);
+    vx_scalar s_rounding = vxCreateScalar(context, VX_TYPE_ENUM, &rounding);
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 0, (vx_reference)to));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 1, (vx_reference)t1));
+    ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 2, (vx_reference)t2));
+    if (op == OP_MUL)
+    {
+        ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 3, (vx_reference)s_scale));
+        ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 4, (vx_reference)s_overflow));
+        ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 5, (vx_reference)s_rounding));
+    }
+    else
+        ERROR_CHECK_STATUS(vxSetParameterByIndex(node, 3, (vx_reference)s_overflow));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    ERROR_CHECK_STATUS(vxProcessGraph(graph));
+    copy_tensor(to, 3, dims, type, out.data(), VX_READ_ONLY);
+
+    // reference with the input-2 dimensions of size 1 broadcast
+    bool sat = overflow == VX_CONVERT_POLICY_SATURATE;
+    double fscale = (double)scale / (double)(1 << fixed_point_pos);
+    size_t mismatches = 0;
+    for (vx_size z = 0; z < dims[2]; z++)
+        for (vx_size y = 0; y < dims[1]; y++)
+            for (vx_size x = 0; x < dims[0]; x++)
+            {
+                size_t i = x + dims[0] * (y + dims[1] * z);
+                size_t j = (dims2[0] > 1 ? x : 0) + dims2[0] * ((dims2[1] > 1 ? y : 0) + dims2[1] * (dims2[2] > 1 ? z : 0));
+                T a = in1[i], b = in2[j];
+                if (type == VX_TYPE_FLOAT32)
+                {
+                    float fa = (float)a, fb = (float)b;
+                    ref[i] = (T)(op == OP_ADD ? fa + fb : (op == OP_SUB ? fa - fb : fa * fb * scale));
+                }
+                else if (op == OP_MUL)
+                {
+                    double v = (double)a * (double)b * fscale;
+                    v = rounding == VX_ROUND_POLICY_TO_NEAREST_EVEN ? nearbyint(v) : trunc(v);
+                    ref[i] = sat ? saturate<T>(v) : (T)(long long)v;
+                }
+                else
+                {
+                    long long v = op == OP_ADD ? (long long)a + (long long)b : (long long)a - (long long)b;
+                    ref[i] = sat ? saturate<T>((double)v) : (T)v;
+                }
+                if (memcmp(&ref[i], &out[i], sizeof(T)))
+                    mismatches++;
+            }
+    report(name, mismatches, count);
+
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_scale));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_overflow));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_rounding));
+    ERROR_CHECK_STATUS(vxReleaseNode(&node));
+    ERROR_CHECK_STATUS(vxReleaseKernel(&kernel));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&t1));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&t2));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&to));
+}
+
+template <typename T>
+static void test_transpose(vx_context context, const char *name, vx_enum type, vx_size num_dims, const vx_size *dims, vx_size dim1, vx_size dim2)
+{
+    size_t count = element_count(num_dims, dims);
+    vector<T> in = random_values<T>(count), out(count);
+    vx_size odims[MAX_TENSOR_DIMS];
+    for (vx_size i = 0; i < num_dims; i++)
+        odims[i] = dims[i];
+    swap(odims[dim1], odims[dim2]);
+    vx_tensor ti = create_tensor(context, num_dims, dims, type, 0, in.data());
+    vx_tensor to = create_tensor(context, num_dims, odims, type, 0, nullptr);
+    ERROR_CHECK_STATUS(vxuTensorTranspose(context, ti, to, dim1, dim2));
+    copy_tensor(to, num_dims, odims, type, out.data(), VX_READ_ONLY);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        // output coordinate -> input coordinate with dim1 and dim2 swapped
+        vx_size coord[MAX_TENSOR_DIMS];
+        size_t rem = i;
+        for (vx_size d = 0; d < num_dims; d++)
+        {
+            coord[d] = rem % odims[d];
+            rem /= odims[d];
+        }
+        swap(coord[dim1], coord[dim2]);
+        size_t j = 0;
+        for (vx_size d = num_dims; d-- > 0;)
+            j = j * dims[d] + coord[d];
+        if (out[i] != in[j])
+            mismatches++;
+    }
+    report(name, mismatches, count);
+    ERROR_CHECK_STATUS(vxReleaseTensor(&ti));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&to));
+}
+
+// out = (in - offset) / norm on the real values of fixed-point tensors; tolerance is in output units
+template <typename TI, typename TO>
+static void test_convert_depth(vx_context context, const char *name, vx_enum itype, vx_int8 ifpp, const vector<TI> &in,
+                               vx_enum otype, vx_int8 ofpp, vx_enum policy, float norm, float offset, double tolerance)
+{
+    vx_size dims[3] = { 67, 9, 3 };
+    size_t count = element_count(3, dims);
+    vector<TO> out(count);
+    vx_tensor ti = create_tensor(context, 3, dims, itype, ifpp, (void *)in.data());
+    vx_tensor to = create_tensor(context, 3, dims, otype, ofpp, nullptr);
+    vx_scalar s_norm = vxCreateScalar(context, VX_TYPE_FLOAT32, &norm);
+    vx_scalar s_offset = vxCreateScalar(context, VX_TYPE_FLOAT32, &offset);
+    ERROR_CHECK_STATUS(vxuTensorConvertDepth(context, ti, policy, s_norm, s_offset, to));
+    copy_tensor(to, 3, dims, otype, out.data(), VX_READ_ONLY);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        double v = itype == VX_TYPE_FLOAT16 ? half_to_float((vx_uint16)in[i]) : ldexp((double)in[i], -ifpp);
+        v = (v - offset) / norm;
+        bool ok;
+        if (otype == VX_TYPE_FLOAT16)
+            ok = (vx_uint16)out[i] == float_to_half((float)v);
+        else if (otype == VX_TYPE_FLOAT32)
+            ok = fabs((double)out[i] - v) <= tolerance * std::max(1.0, fabs(v));
+        else
+        {
+            double r = nearbyint(ldexp(v, ofpp));
+            TO expected = policy == VX_CONVERT_POLICY_SATURATE ? saturate<TO>(r) : (TO)(long long)r;
+            ok = fabs((double)out[i] - (double)expected) <= tolerance;
+        }
+        if (!ok)
+            mismatches++;
+    }
+    report(name, mismatches, count);
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_norm));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&s_offset));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&ti));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&to));
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    printf("STATUS: AVX2 code paths %s\n", vxIsCpuAvx2Supported() ? "enabled" : "disabled");
+
+    // element-wise: full tensors, broadcast along dimension 1 and along dimension 0 (zero-stride rows)
+    vx_size dims[3] = { 37, 5, 3 }, dimsB1[3] = { 37, 1, 3 }, dimsB0[3] = { 1, 5, 3 };
+    test_elementwise<vx_float32>(context, "add F32", OP_ADD, VX_TYPE_FLOAT32, 0, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, 1.0f, dims, dims);
+    test_elementwise<vx_float32>(context, "subtract F32 broadcast dim 0", OP_SUB, VX_TYPE_FLOAT32, 0, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, 1.0f, dims, dimsB0);
+    test_elementwise<vx_float32>(context, "multiply F32 broadcast dim 1", OP_MUL, VX_TYPE_FLOAT32, 0, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, 0.125f, dims, dimsB1);
+    test_elementwise<vx_uint8>(context, "add U8 wrap", OP_ADD, VX_TYPE_UINT8, 0, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, 1.0f, dims, dims);
+    test_elementwise<vx_uint8>(context, "subtract U8 saturate broadcast dim 0", OP_SUB, VX_TYPE_UINT8, 0, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO, 1.0f, dims, dimsB0);
+    test_elementwise<vx_int8>(context, "add S8 saturate broadcast dim 1", OP_ADD, VX_TYPE_INT8, 0, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO, 1.0f, dims, dimsB1);
+    test_elementwise<vx_int16>(context, "add S16 saturate", OP_ADD, VX_TYPE_INT16, 0, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO, 1.0f, dims, dims);
+    test_elementwise<vx_int16>(context, "subtract S16 wrap", OP_SUB, VX_TYPE_INT16, 0, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, 1.0f, dims, dims);
+    test_elementwise<vx_int16>(context, "multiply S16 Q8 saturate nearest", OP_MUL, VX_TYPE_INT16, 8, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_NEAREST_EVEN, 0.5f, dims, dims);
+    test_elementwise<vx_uint8>(context, "multiply U8 wrap truncate", OP_MUL, VX_TYPE_UINT8, 0, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, 0.25f, dims, dimsB0);
+
+    // transpose: 2-D blocked path and strided N-D paths
+    vx_size tdims2[2] = { 45, 33 }, tdims3[3] = { 13, 7, 5 }, tdims4[4] = { 6, 5, 4, 3 };
+    test_transpose<vx_int16>(context, "transpose S16 2-D (0,1)", VX_TYPE_INT16, 2, tdims2, 0, 1);
+    test_transpose<vx_float32>(context, "transpose F32 3-D (0,2)", VX_TYPE_FLOAT32, 3, tdims3, 0, 2);
+    test_transpose<vx_float32>(context, "transpose F32 3-D (1,2)", VX_TYPE_FLOAT32, 3, tdims3, 1, 2);
+    test_transpose<vx_uint8>(context, "transpose U8 4-D (1,3)", VX_TYPE_UINT8, 4, tdims4, 1, 3);
+
+    // convert depth: F16 rows go through the AVX2/F16C code when it is enabled
+    size_t count = 67 * 9 * 3;
+    vector<vx_float32> f32;
+    for (size_t i = 0; i < count; i++)
+    {
+        // cover normals, denormals and values that round up to the next exponent
+        float v = random_float(-1000.0f, 1000.0f);
+        if (i % 7 == 1) v *= 1e-7f;
+        if (i % 11 == 2) v = 2047.9f + (float)(i % 3);
+        f32.push_back(v);
+    }
+    vector<vx_uint16> f16(count);
+    for (size_t i = 0; i < count; i++)
+        f16[i] = float_to_half(f32[i] * 0.01f);
+    vector<vx_uint8> u8 = random_values<vx_uint8>(count);
+    vector<vx_int16> s16 = random_values<vx_int16>(count);
+    test_convert_depth<vx_float32, vx_uint16>(context, "convert depth F32 -> F16", VX_TYPE_FLOAT32, 0, f32, VX_TYPE_FLOAT16, 0, VX_CONVERT_POLICY_SATURATE, 1.0f, 0.0f, 0.0);
+    test_convert_depth<vx_float32, vx_uint16>(context, "convert depth F32 -> F16 normalized", VX_TYPE_FLOAT32, 0, f32, VX_TYPE_FLOAT16, 0, VX_CONVERT_POLICY_SATURATE, 4.0f, 8.0f, 0.0);
+    test_convert_depth<vx_uint16, vx_float32>(context, "convert depth F16 -> F32", VX_TYPE_FLOAT16, 0, f16, VX_TYPE_FLOAT32, 0, VX_CONVERT_POLICY_SATURATE, 1.0f, 0.0f, 0.0);
+    test_convert_depth<vx_uint8, vx_float32>(context, "convert depth U8 -> F32 normalized", VX_TYPE_UINT8, 0, u8, VX_TYPE_FLOAT32, 0, VX_CONVERT_POLICY_SATURATE, 255.0f, 128.0f, 1e-6);
+    test_convert_depth<vx_float32, vx_int16>(context, "convert depth F32 -> S16 Q8 saturate", VX_TYPE_FLOAT32, 0, f32, VX_TYPE_INT16, 8, VX_CONVERT_POLICY_SATURATE, 2.0f, 1.0f, 1.0);
+    test_convert_depth<vx_int16, vx_uint8>(context, "convert depth S16 -> U8 wrap", VX_TYPE_INT16, 0, s16, VX_TYPE_UINT8, 0, VX_CONVERT_POLICY_WRAP, 1.0f, 0.0f, 0.0);
+    test_convert_depth<vx_int16, vx_uint8>(context, "convert depth S16 -> U8 saturate", VX_TYPE_INT16, 0, s16, VX_TYPE_UINT8, 0, VX_CONVERT_POLICY_SATURATE, 1.0f, 0.0f, 0.0);
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    if (failures)
+    {
+        printf("ERROR: %d tensor checks failed\n", failures);
+        return 1;
+    }
+    printf("STATUS: all tensor checks passed\n");
+    return 0;
+}
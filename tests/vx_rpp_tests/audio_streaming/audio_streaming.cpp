@@ -0,0 +1,472 @@
+/*
+Copyright (c) 2024 Advanced Micro Devices, Inc. All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+// checks that the streaming variants of PreemphasisFilter, Spectrogram and Resample give the same result
+// when a signal is processed in chunks of varying length as when it is processed in one execution.
+// Each of the two streams of the batch uses its own chunk lengths; every stream is run twice, starting over
+// with resetState, to check that the state of the first pass does not leak into the second one.
+
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <VX/vx.h>
+#include <vx_ext_amd.h>
+#include <vx_ext_rpp.h>
+
+using namespace std;
+
+#define ERROR_CHECK_STATUS(status)                                                              \
+    {                                                                                           \
+        vx_status status_ = (status);                                                           \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+#define ERROR_CHECK_OBJECT(obj)                                                                 \
+    {                                                                                           \
+        vx_status status_ = vxGetStatus((vx_reference)(obj));                                   \
+        if (status_ != VX_SUCCESS)                                                              \
+        {                                                                                       \
+            printf("ERROR: failed with status = (%d) at " __FILE__ "#%d\n", status_, __LINE__); \
+            exit(1);                                                                            \
+        }                                                                                       \
+    }
+
+static void VX_CALLBACK log_callback(vx_context context, vx_reference ref, vx_status status, const vx_char string[])
+{
+    size_t len = strlen(string);
+    if (len > 0)
+    {
+        printf("%s", string);
+        if (string[len - 1] != '\n')
+            printf("\n");
+        fflush(stdout);
+    }
+}
+
+#define NUM_STREAMS 2
+#define SIGNAL_LENGTH 4000
+#define MAX_CHUNK 1024
+#define NUM_CHUNKS 6
+// spectrogram layout (vxTensorLayout::VX_NTF of the RPP extension): frames x bins
+#define LAYOUT_NTF 6
+
+// chunk lengths of each stream, each adding up to SIGNAL_LENGTH; a chunk of 1 sample completes no window
+static const vx_uint32 chunks[NUM_STREAMS][NUM_CHUNKS] = {
+    { 700, 333, 1024, 1, 941, 1001 },
+    { 1024, 1024, 17, 900, 35, 1000 },
+};
+
+static int failures = 0;
+
+static vector<float> signals[NUM_STREAMS];
+
+static void make_signals()
+{
+    unsigned int state = 12345;
+    for (int n = 0; n < NUM_STREAMS; n++)
+    {
+        signals[n].resize(SIGNAL_LENGTH);
+        for (int i = 0; i < SIGNAL_LENGTH; i++)
+        {
+            state = state * 1103515245u + 12345u;
+            float noise = (float)((state >> 8) & 0xffff) / 65536.0f - 0.5f;
+            signals[n][i] = 0.5f * sinf(0.031f * (n + 1) * i) + 0.3f * sinf(0.17f * i) + 0.2f * noise;
+        }
+    }
+}
+
+static vx_tensor create_tensor(vx_context context, vx_size d0, vx_size d1, vx_size d2, vx_enum type)
+{
+    vx_size dims[3] = { d0, d1, d2 };
+    vx_tensor tensor = vxCreateTensor(context, d2 ? 3 : (d1 ? 2 : 1), dims, type, 0);
+    ERROR_CHECK_OBJECT(tensor);
+    return tensor;
+}
+
+// copies the whole tensor as it is laid out in memory: the RPP extension lists the dimensions outermost first,
+// so the host buffers here are indexed [n][sample] with the stream outermost
+static void copy_tensor(vx_tensor tensor, void *ptr, vx_size elementSize, vx_enum usage)
+{
+    vx_size num_dims, dims[3], start[3] = { 0, 0, 0 }, strides[3];
+    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_NUMBER_OF_DIMS, &num_dims, sizeof(num_dims)));
+    ERROR_CHECK_STATUS(vxQueryTensor(tensor, VX_TENSOR_DIMS, dims, num_dims * sizeof(vx_size)));
+    strides[0] = elementSize;
+    for (vx_size i = 1; i < num_dims; i++)
+        strides[i] = strides[i - 1] * dims[i - 1];
+    ERROR_CHECK_STATUS(vxCopyTensorPatch(tensor, num_dims, start, dims, strides, ptr, usage, VX_MEMORY_TYPE_HOST));
+}
+
+// audio tensors are [N, samples, channels] with one channel here, ROI tensors hold {x, y, samples, channels} per stream
+static void write_chunk(vx_tensor src, vx_tensor roi, vx_size capacity, const vx_uint32 offset[NUM_STREAMS], const vx_uint32 length[NUM_STREAMS])
+{
+    vector<float> data(NUM_STREAMS * capacity, 0.0f);
+    vector<vx_uint32> rois(NUM_STREAMS * 4, 0);
+    for (int n = 0; n < NUM_STREAMS; n++)
+    {
+        copy(signals[n].begin() + offset[n], signals[n].begin() + offset[n] + length[n], data.begin() + n * capacity);
+        rois[n * 4 + 2] = length[n];
+        rois[n * 4 + 3] = 1;
+    }
+    copy_tensor(src, data.data(), sizeof(float), VX_WRITE_ONLY);
+    copy_tensor(roi, rois.data(), sizeof(vx_uint32), VX_WRITE_ONLY);
+}
+
+static void set_reset(vx_scalar reset, bool value)
+{
+    vx_bool v = value ? vx_true_e : vx_false_e;
+    ERROR_CHECK_STATUS(vxCopyScalar(reset, &v, VX_WRITE_ONLY, VX_MEMORY_TYPE_HOST));
+}
+
+static vx_graph create_cpu_graph(vx_context context)
+{
+    vx_graph graph = vxCreateGraph(context);
+    ERROR_CHECK_OBJECT(graph);
+    AgoTargetAffinityInfo affinity = { AGO_TARGET_AFFINITY_CPU };
+    ERROR_CHECK_STATUS(vxSetGraphAttribute(graph, VX_GRAPH_ATTRIBUTE_AMD_AFFINITY, &affinity, sizeof(affinity)));
+    return graph;
+}
+
+// runs the whole-signal graph; returns false if the RPP library was built without audio support
+static bool process_reference(vx_graph graph, const char *name)
+{
+    vx_status status = vxProcessGraph(graph);
+    if (status == VX_ERROR_NOT_SUPPORTED)
+    {
+        printf("SKIPPED: %s: RPP was built without audio support\n", name);
+        return false;
+    }
+    ERROR_CHECK_STATUS(status);
+    return true;
+}
+
+static void report(const char *name, int pass, size_t mismatches, size_t count)
+{
+    if (mismatches)
+    {
+        printf("FAILED: %s pass %d: %zu of %zu values differ from the whole signal\n", name, pass, mismatches, count);
+        failures++;
+    }
+    else
+        printf("PASSED: %s pass %d\n", name, pass);
+}
+
+static void test_preemphasis(vx_context context)
+{
+    const float coeffValues[NUM_STREAMS] = { 0.97f, 0.9f };
+    vx_int32 borderValue = 1; // clamp
+    vx_array coeff = vxCreateArray(context, VX_TYPE_FLOAT32, NUM_STREAMS);
+    ERROR_CHECK_STATUS(vxAddArrayItems(coeff, NUM_STREAMS, coeffValues, sizeof(float)));
+    vx_scalar border = vxCreateScalar(context, VX_TYPE_INT32, &borderValue);
+    vx_bool resetValue = vx_true_e;
+    vx_scalar reset = vxCreateScalar(context, VX_TYPE_BOOL, &resetValue);
+    ERROR_CHECK_OBJECT(coeff);
+    ERROR_CHECK_OBJECT(border);
+    ERROR_CHECK_OBJECT(reset);
+
+    // whole signal
+    vx_graph wholeGraph = create_cpu_graph(context);
+    vx_tensor wholeSrc = create_tensor(context, NUM_STREAMS, SIGNAL_LENGTH, 1, VX_TYPE_FLOAT32);
+    vx_tensor wholeDst = create_tensor(context, NUM_STREAMS, SIGNAL_LENGTH, 1, VX_TYPE_FLOAT32);
+    vx_tensor wholeRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+    ERROR_CHECK_OBJECT(vxExtRppPreemphasisFilter(wholeGraph, wholeSrc, wholeRoi, wholeDst, coeff, border));
+    ERROR_CHECK_STATUS(vxVerifyGraph(wholeGraph));
+    const vx_uint32 zero[NUM_STREAMS] = { 0, 0 }, full[NUM_STREAMS] = { SIGNAL_LENGTH, SIGNAL_LENGTH };
+    write_chunk(wholeSrc, wholeRoi, SIGNAL_LENGTH, zero, full);
+    if (process_reference(wholeGraph, "preemphasis"))
+    {
+        vector<float> whole(NUM_STREAMS * SIGNAL_LENGTH);
+        copy_tensor(wholeDst, whole.data(), sizeof(float), VX_READ_ONLY);
+
+        // chunks
+        vx_graph graph = create_cpu_graph(context);
+        vx_tensor src = create_tensor(context, NUM_STREAMS, MAX_CHUNK, 1, VX_TYPE_FLOAT32);
+        vx_tensor dst = create_tensor(context, NUM_STREAMS, MAX_CHUNK, 1, VX_TYPE_FLOAT32);
+        vx_tensor roi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+        ERROR_CHECK_OBJECT(vxExtRppPreemphasisFilterStream(graph, src, roi, dst, coeff, border, reset));
+        ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+        vector<float> out(NUM_STREAMS * MAX_CHUNK);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            size_t mismatches = 0;
+            vx_uint32 offset[NUM_STREAMS] = { 0, 0 };
+            for (int k = 0; k < NUM_CHUNKS; k++)
+            {
+                const vx_uint32 length[NUM_STREAMS] = { chunks[0][k], chunks[1][k] };
+                write_chunk(src, roi, MAX_CHUNK, offset, length);
+                set_reset(reset, k == 0);
+                ERROR_CHECK_STATUS(vxProcessGraph(graph));
+                copy_tensor(dst, out.data(), sizeof(float), VX_READ_ONLY);
+                for (int n = 0; n < NUM_STREAMS; n++)
+                {
+                    for (vx_uint32 i = 0; i < length[n]; i++)
+                    {
+                        float expected = whole[n * SIGNAL_LENGTH + offset[n] + i];
+                        if (!(fabsf(out[n * MAX_CHUNK + i] - expected) <= 1e-5f))
+                            mismatches++;
+                    }
+                    offset[n] += length[n];
+                }
+            }
+            report("preemphasis", pass, mismatches, (size_t)NUM_STREAMS * SIGNAL_LENGTH);
+        }
+        ERROR_CHECK_STATUS(vxReleaseTensor(&src));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&dst));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&roi));
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    }
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeSrc));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeDst));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeRoi));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&wholeGraph));
+    ERROR_CHECK_STATUS(vxReleaseArray(&coeff));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&border));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&reset));
+}
+
+static void test_spectrogram(vx_context context)
+{
+    const vx_int32 nfftValue = 64, windowLengthValue = 48, windowStepValue = 16, powerValue = 2, layoutValue = LAYOUT_NTF;
+    const vx_int32 bins = nfftValue / 2 + 1;
+    const vx_size wholeFrames = (SIGNAL_LENGTH - windowLengthValue) / windowStepValue + 1;
+    const vx_size chunkFrames = (MAX_CHUNK - 1) / windowStepValue + 1;
+    vector<float> hann(windowLengthValue);
+    for (int i = 0; i < windowLengthValue; i++)
+        hann[i] = 0.5f * (1.0f - cosf(2.0f * 3.14159265f * i / (windowLengthValue - 1)));
+    vx_array window = vxCreateArray(context, VX_TYPE_FLOAT32, windowLengthValue);
+    ERROR_CHECK_OBJECT(window);
+    ERROR_CHECK_STATUS(vxAddArrayItems(window, windowLengthValue, hann.data(), sizeof(float)));
+    vx_bool falseValue = vx_false_e, resetValue = vx_true_e;
+    vx_scalar center = vxCreateScalar(context, VX_TYPE_BOOL, &falseValue);
+    vx_scalar reflect = vxCreateScalar(context, VX_TYPE_BOOL, &falseValue);
+    vx_scalar layout = vxCreateScalar(context, VX_TYPE_INT32, &layoutValue);
+    vx_scalar power = vxCreateScalar(context, VX_TYPE_INT32, &powerValue);
+    vx_scalar nfft = vxCreateScalar(context, VX_TYPE_INT32, &nfftValue);
+    vx_scalar windowLength = vxCreateScalar(context, VX_TYPE_INT32, &windowLengthValue);
+    vx_scalar windowStep = vxCreateScalar(context, VX_TYPE_INT32, &windowStepValue);
+    vx_scalar reset = vxCreateScalar(context, VX_TYPE_BOOL, &resetValue);
+
+    vx_graph wholeGraph = create_cpu_graph(context);
+    vx_tensor wholeSrc = create_tensor(context, NUM_STREAMS, SIGNAL_LENGTH, 1, VX_TYPE_FLOAT32);
+    vx_tensor wholeDst = create_tensor(context, NUM_STREAMS, wholeFrames, bins, VX_TYPE_FLOAT32);
+    vx_tensor wholeSrcRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+    vx_tensor wholeDstRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+    ERROR_CHECK_OBJECT(vxExtRppSpectrogram(wholeGraph, wholeSrc, wholeSrcRoi, wholeDst, wholeDstRoi, window, center, reflect, layout, power, nfft, windowLength, windowStep));
+    ERROR_CHECK_STATUS(vxVerifyGraph(wholeGraph));
+    const vx_uint32 zero[NUM_STREAMS] = { 0, 0 }, full[NUM_STREAMS] = { SIGNAL_LENGTH, SIGNAL_LENGTH };
+    write_chunk(wholeSrc, wholeSrcRoi, SIGNAL_LENGTH, zero, full);
+    if (process_reference(wholeGraph, "spectrogram"))
+    {
+        vector<float> whole(NUM_STREAMS * wholeFrames * bins);
+        copy_tensor(wholeDst, whole.data(), sizeof(float), VX_READ_ONLY);
+
+        vx_graph graph = create_cpu_graph(context);
+        vx_tensor src = create_tensor(context, NUM_STREAMS, MAX_CHUNK, 1, VX_TYPE_FLOAT32);
+        vx_tensor dst = create_tensor(context, NUM_STREAMS, chunkFrames, bins, VX_TYPE_FLOAT32);
+        vx_tensor srcRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+        vx_tensor dstRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+        ERROR_CHECK_OBJECT(vxExtRppSpectrogramStream(graph, src, srcRoi, dst, dstRoi, window, center, reflect, layout, power, nfft, windowLength, windowStep, reset));
+        ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+        vector<float> out(NUM_STREAMS * chunkFrames * bins);
+        vector<vx_uint32> rois(NUM_STREAMS * 4);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            size_t mismatches = 0;
+            vx_uint32 offset[NUM_STREAMS] = { 0, 0 }, frame[NUM_STREAMS] = { 0, 0 };
+            for (int k = 0; k < NUM_CHUNKS; k++)
+            {
+                const vx_uint32 length[NUM_STREAMS] = { chunks[0][k], chunks[1][k] };
+                write_chunk(src, srcRoi, MAX_CHUNK, offset, length);
+                set_reset(reset, k == 0);
+                ERROR_CHECK_STATUS(vxProcessGraph(graph));
+                copy_tensor(dst, out.data(), sizeof(float), VX_READ_ONLY);
+                copy_tensor(dstRoi, rois.data(), sizeof(vx_uint32), VX_READ_ONLY);
+                for (int n = 0; n < NUM_STREAMS; n++)
+                {
+                    // NTF: the ROI width is the number of complete frames of this chunk
+                    vx_uint32 frames = rois[n * 4 + 2];
+                    for (vx_uint32 t = 0; t < frames; t++, frame[n]++)
+                    {
+                        if (frame[n] >= wholeFrames)
+                        {
+                            mismatches += bins;
+                            continue;
+                        }
+                        const float *expected = &whole[(n * wholeFrames + frame[n]) * bins];
+                        const float *value = &out[(n * chunkFrames + t) * bins];
+                        float peak = *max_element(expected, expected + bins);
+                        for (vx_int32 f = 0; f < bins; f++)
+                            if (!(fabsf(value[f] - expected[f]) <= 1e-5f * peak + 1e-6f))
+                                mismatches++;
+                    }
+                    offset[n] += length[n];
+                }
+            }
+            for (int n = 0; n < NUM_STREAMS; n++)
+                if (frame[n] != wholeFrames)
+                {
+                    printf("ERROR: spectrogram stream %d pass %d: %u frames instead of %zu\n", n, pass, frame[n], wholeFrames);
+                    mismatches++;
+                }
+            report("spectrogram", pass, mismatches, (size_t)NUM_STREAMS * wholeFrames * bins);
+        }
+        ERROR_CHECK_STATUS(vxReleaseTensor(&src));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&dst));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&srcRoi));
+        ERROR_CHECK_STATUS(vxReleaseTensor(&dstRoi));
+        ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    }
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeSrc));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeDst));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeSrcRoi));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeDstRoi));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&wholeGraph));
+    ERROR_CHECK_STATUS(vxReleaseArray(&window));
+    vx_scalar scalars[] = { center, reflect, layout, power, nfft, windowLength, windowStep, reset };
+    for (vx_scalar &s : scalars)
+        ERROR_CHECK_STATUS(vxReleaseScalar(&s));
+}
+
+// the streaming resampler delays its output by the half-width of the filter, so the chunks are compared
+// with the streaming resampler run on the whole signal in one execution rather than with the RPP resampler
+static void test_resample(vx_context context)
+{
+    const float inRateValues[NUM_STREAMS] = { 16000.0f, 16000.0f }, outRateValues[NUM_STREAMS] = { 11025.0f, 22050.0f };
+    const vx_size wholeCapacity = (vx_size)(SIGNAL_LENGTH * 22050.0 / 16000.0) + 8;
+    const vx_size chunkCapacity = (vx_size)(MAX_CHUNK * 22050.0 / 16000.0) + 8;
+    vx_float32 qualityValue = 50.0f;
+    vx_bool resetValue = vx_true_e;
+    vx_array inRate = vxCreateArray(context, VX_TYPE_FLOAT32, NUM_STREAMS);
+    ERROR_CHECK_OBJECT(inRate);
+    ERROR_CHECK_STATUS(vxAddArrayItems(inRate, NUM_STREAMS, inRateValues, sizeof(float)));
+    vx_tensor outRate = create_tensor(context, NUM_STREAMS, 0, 0, VX_TYPE_FLOAT32);
+    copy_tensor(outRate, (void *)outRateValues, sizeof(float), VX_WRITE_ONLY);
+    vx_scalar quality = vxCreateScalar(context, VX_TYPE_FLOAT32, &qualityValue);
+    vx_scalar reset = vxCreateScalar(context, VX_TYPE_BOOL, &resetValue);
+    ERROR_CHECK_OBJECT(quality);
+    ERROR_CHECK_OBJECT(reset);
+
+    vx_graph wholeGraph = create_cpu_graph(context);
+    vx_tensor wholeSrc = create_tensor(context, NUM_STREAMS, SIGNAL_LENGTH, 1, VX_TYPE_FLOAT32);
+    vx_tensor wholeDst = create_tensor(context, NUM_STREAMS, wholeCapacity, 1, VX_TYPE_FLOAT32);
+    vx_tensor wholeSrcRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+    vx_tensor wholeDstRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+    ERROR_CHECK_OBJECT(vxExtRppResampleStream(wholeGraph, wholeSrc, wholeDst, wholeSrcRoi, wholeDstRoi, inRate, outRate, quality, reset));
+    ERROR_CHECK_STATUS(vxVerifyGraph(wholeGraph));
+    const vx_uint32 zero[NUM_STREAMS] = { 0, 0 }, full[NUM_STREAMS] = { SIGNAL_LENGTH, SIGNAL_LENGTH };
+    write_chunk(wholeSrc, wholeSrcRoi, SIGNAL_LENGTH, zero, full);
+    ERROR_CHECK_STATUS(vxProcessGraph(wholeGraph));
+    vector<float> whole(NUM_STREAMS * wholeCapacity);
+    vector<vx_uint32> wholeRois(NUM_STREAMS * 4);
+    copy_tensor(wholeDst, whole.data(), sizeof(float), VX_READ_ONLY);
+    copy_tensor(wholeDstRoi, wholeRois.data(), sizeof(vx_uint32), VX_READ_ONLY);
+
+    vx_graph graph = create_cpu_graph(context);
+    vx_tensor src = create_tensor(context, NUM_STREAMS, MAX_CHUNK, 1, VX_TYPE_FLOAT32);
+    vx_tensor dst = create_tensor(context, NUM_STREAMS, chunkCapacity, 1, VX_TYPE_FLOAT32);
+    vx_tensor srcRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+    vx_tensor dstRoi = create_tensor(context, NUM_STREAMS, 4, 0, VX_TYPE_UINT32);
+    ERROR_CHECK_OBJECT(vxExtRppResampleStream(graph, src, dst, srcRoi, dstRoi, inRate, outRate, quality, reset));
+    ERROR_CHECK_STATUS(vxVerifyGraph(graph));
+    vector<float> out(NUM_STREAMS * chunkCapacity);
+    vector<vx_uint32> rois(NUM_STREAMS * 4);
+    for (int pass = 0; pass < 2; pass++)
+    {
+        size_t mismatches = 0;
+        vx_uint32 offset[NUM_STREAMS] = { 0, 0 }, produced[NUM_STREAMS] = { 0, 0 };
+        for (int k = 0; k < NUM_CHUNKS; k++)
+        {
+            const vx_uint32 length[NUM_STREAMS] = { chunks[0][k], chunks[1][k] };
+            write_chunk(src, srcRoi, MAX_CHUNK, offset, length);
+            set_reset(reset, k == 0);
+            ERROR_CHECK_STATUS(vxProcessGraph(graph));
+            copy_tensor(dst, out.data(), sizeof(float), VX_READ_ONLY);
+            copy_tensor(dstRoi, rois.data(), sizeof(vx_uint32), VX_READ_ONLY);
+            for (int n = 0; n < NUM_STREAMS; n++)
+            {
+                vx_uint32 count = rois[n * 4 + 2];
+                for (vx_uint32 i = 0; i < count; i++, produced[n]++)
+                {
+                    if (produced[n] >= wholeRois[n * 4 + 2])
+                    {
+                        mismatches++;
+                        continue;
+                    }
+                    float expected = whole[n * wholeCapacity + produced[n]];
+                    if (!(fabsf(out[n * chunkCapacity + i] - expected) <= 1e-5f))
+                        mismatches++;
+                }
+                offset[n] += length[n];
+            }
+        }
+        for (int n = 0; n < NUM_STREAMS; n++)
+            if (produced[n] != wholeRois[n * 4 + 2])
+            {
+                printf("ERROR: resample stream %d pass %d: %u samples instead of %u\n", n, pass, produced[n], wholeRois[n * 4 + 2]);
+                mismatches++;
+            }
+        report("resample", pass, mismatches, (size_t)wholeRois[2] + wholeRois[6]);
+    }
+
+    ERROR_CHECK_STATUS(vxReleaseTensor(&src));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&dst));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&srcRoi));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&dstRoi));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&graph));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeSrc));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeDst));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeSrcRoi));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&wholeDstRoi));
+    ERROR_CHECK_STATUS(vxReleaseGraph(&wholeGraph));
+    ERROR_CHECK_STATUS(vxReleaseTensor(&outRate));
+    ERROR_CHECK_STATUS(vxReleaseArray(&inRate));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&quality));
+    ERROR_CHECK_STATUS(vxReleaseScalar(&reset));
+}
+
+int main(int argc, char **argv)
+{
+    vx_context context = vxCreateContext();
+    ERROR_CHECK_OBJECT(context);
+    vxRegisterLogCallback(context, log_callback, vx_false_e);
+    ERROR_CHECK_STATUS(vxLoadKernels(context, "vx_rpp"));
+    make_signals();
+
+    test_preemphasis(context);
+    test_spectrogram(context);
+    test_resample(context);
+
+    ERROR_CHECK_STATUS(vxReleaseContext(&context));
+    if (failures)
+    {
+        printf("ERROR: %d streaming checks failed\n", failures);
+        return 1;
+    }
+    printf("STATUS: all streaming checks passed\n");
+    return 0;
+}